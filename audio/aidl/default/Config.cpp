@@ -21,18 +21,49 @@
 
 #include "core-impl/AudioPolicyConfigXmlConverter.h"
 #include "core-impl/Config.h"
+#include "core-impl/ConfigCache.h"
 #include "core-impl/EngineConfigXmlConverter.h"
 
 using aidl::android::media::audio::common::AudioHalEngineConfig;
 
 namespace aidl::android::hardware::audio::core {
+namespace {
+
+std::string getAudioPolicyConfigFile() {
+    return ::android::audio_get_audio_policy_config_file();
+}
+
+std::string getEngineConfigFile() {
+    return ::android::audio_find_readable_configuration_file(kEngineConfigFileName.c_str());
+}
+
+}  // namespace
+
+// static
+internal::AudioPolicyConfigXmlConverter& Config::getAudioPolicyConverter() {
+    static internal::AudioPolicyConfigXmlConverter converter{getAudioPolicyConfigFile()};
+    return converter;
+}
+
+// static
+internal::EngineConfigXmlConverter& Config::getEngConfigConverter() {
+    static internal::EngineConfigXmlConverter converter{getEngineConfigFile()};
+    return converter;
+}
+
 ndk::ScopedAStatus Config::getSurroundSoundConfig(SurroundSoundConfig* _aidl_return) {
     static const auto& func = __func__;
-    static const SurroundSoundConfig surroundSoundConfig = [this]() {
-        SurroundSoundConfig surroundCfg = mAudioPolicyConverter.getSurroundSoundConfig();
-        if (mAudioPolicyConverter.getStatus() != ::android::OK) {
-            LOG(WARNING) << func << ": " << mAudioPolicyConverter.getError();
-        }
+    static const SurroundSoundConfig surroundSoundConfig = []() {
+        SurroundSoundConfig surroundCfg;
+        internal::ConfigCache cache("surround_sound_config", {getAudioPolicyConfigFile()});
+        cache.getOrCreate<SurroundSoundConfig>(&surroundCfg, [](SurroundSoundConfig* cfg) {
+            auto& converter = getAudioPolicyConverter();
+            *cfg = converter.getSurroundSoundConfig();
+            if (converter.getStatus() != ::android::OK) {
+                LOG(WARNING) << func << ": " << converter.getError();
+            }
+            return true;
+        });
         return surroundCfg;
     }();
     *_aidl_return = surroundSoundConfig;
@@ -42,18 +73,27 @@ ndk::ScopedAStatus Config::getSurroundSoundConfig(SurroundSoundConfig* _aidl_ret
 
 ndk::ScopedAStatus Config::getEngineConfig(AudioHalEngineConfig* _aidl_return) {
     static const auto& func = __func__;
-    static const AudioHalEngineConfig returnEngCfg = [this]() {
+    static const AudioHalEngineConfig returnEngCfg = []() {
         AudioHalEngineConfig engConfig;
-        if (mEngConfigConverter.getStatus() == ::android::OK) {
-            engConfig = mEngConfigConverter.getAidlEngineConfig();
-        } else {
-            LOG(INFO) << func << ": " << mEngConfigConverter.getError();
-            if (mAudioPolicyConverter.getStatus() == ::android::OK) {
-                engConfig = mAudioPolicyConverter.getAidlEngineConfig();
+        // The audio policy configuration is a fallback for the engine configuration.
+        internal::ConfigCache cache("engine_config",
+                                    {getEngineConfigFile(), getAudioPolicyConfigFile()});
+        cache.getOrCreate<AudioHalEngineConfig>(&engConfig, [](AudioHalEngineConfig* cfg) {
+            auto& engConfigConverter = getEngConfigConverter();
+            if (engConfigConverter.getStatus() == ::android::OK) {
+                *cfg = engConfigConverter.getAidlEngineConfig();
+                return true;
+            }
+            LOG(INFO) << func << ": " << engConfigConverter.getError();
+            auto& audioPolicyConverter = getAudioPolicyConverter();
+            if (audioPolicyConverter.getStatus() == ::android::OK) {
+                *cfg = audioPolicyConverter.getAidlEngineConfig();
             } else {
-                LOG(WARNING) << func << ": " << mAudioPolicyConverter.getError();
+                LOG(WARNING) << func << ": " << audioPolicyConverter.getError();
+                *cfg = AudioHalEngineConfig{};
             }
-        }
+            return true;
+        });
         // Logging full contents of the config is an overkill, just provide statistics.
         LOG(DEBUG) << func
                    << ": number of strategies parsed: " << engConfig.productStrategies.size()
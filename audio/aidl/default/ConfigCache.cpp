@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <set>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define LOG_TAG "AHAL_ConfigCache"
+#include <android-base/file.h>
+#include <android-base/logging.h>
+#include <android-base/properties.h>
+#include <android-base/scopeguard.h>
+#include <android-base/unique_fd.h>
+#include <android/binder_auto_utils.h>
+
+#include "core-impl/ConfigCache.h"
+
+using android::base::unique_fd;
+
+namespace aidl::android::hardware::audio::core::internal {
+
+namespace {
+
+// "AHCC", for Audio HAL Config Cache.
+constexpr uint32_t kCacheMagic = 0x41484343;
+// Must be incremented when the layout of the cache files changes.
+constexpr uint32_t kCacheVersion = 1;
+
+struct CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint64_t payloadSize;
+    uint64_t payloadChecksum;
+};
+
+constexpr uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ULL;
+constexpr uint64_t kFnvPrime = 0x100000001b3ULL;
+
+// 64-bit FNV-1a, which is stable across builds unlike std::hash.
+uint64_t hashBytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * kFnvPrime;
+    }
+    return hash;
+}
+
+uint64_t hashString(uint64_t hash, const std::string& s) {
+    // Include the terminator so that consecutive strings can't be confused.
+    return hashBytes(hash, s.c_str(), s.size() + 1);
+}
+
+// Returns the files referenced by the XInclude elements of an XML file. This does not need to be
+// a complete XML parser: a false positive, for example an include in a comment, only adds a file
+// to the key.
+std::vector<std::string> getIncludedFiles(const std::string& path, const std::string& contents) {
+    static const std::string kInclude = "<xi:include";
+    static const std::string kHref = "href=";
+    const size_t slash = path.rfind('/');
+    const std::string dir = slash == std::string::npos ? "" : path.substr(0, slash + 1);
+    std::vector<std::string> files;
+    for (size_t pos = contents.find(kInclude); pos != std::string::npos;
+         pos = contents.find(kInclude, pos + kInclude.size())) {
+        const size_t end = contents.find('>', pos);
+        const size_t href = contents.find(kHref, pos);
+        if (end == std::string::npos || href == std::string::npos || href > end) continue;
+        const size_t open = href + kHref.size();
+        const char quote = contents[open];
+        if (quote != '"' && quote != '\'') continue;
+        const size_t close = contents.find(quote, open + 1);
+        if (close == std::string::npos || close > end) continue;
+        std::string file = contents.substr(open + 1, close - open - 1);
+        files.push_back(!file.empty() && file[0] == '/' ? file : dir + file);
+    }
+    return files;
+}
+
+uint64_t computeKey(const std::vector<std::string>& sourceFiles) {
+    uint64_t key = hashBytes(kFnvOffsetBasis, &kCacheVersion, sizeof(kCacheVersion));
+    key = hashString(key, ::android::base::GetProperty("ro.vendor.build.fingerprint", ""));
+    // The marshalled parcel format belongs to libbinder_ndk, which is on the system partition.
+    key = hashString(key, ::android::base::GetProperty("ro.system.build.fingerprint", ""));
+    std::deque<std::string> pending(sourceFiles.begin(), sourceFiles.end());
+    std::set<std::string> visited;
+    while (!pending.empty()) {
+        std::string file = std::move(pending.front());
+        pending.pop_front();
+        if (!visited.insert(file).second) continue;
+        key = hashString(key, file);
+        // A missing file is part of the key too, the configuration may depend on its absence.
+        std::string contents;
+        const bool isReadable = ::android::base::ReadFileToString(file, &contents);
+        key = hashBytes(key, &isReadable, sizeof(isReadable));
+        if (!isReadable) continue;
+        key = hashString(key, contents);
+        for (auto& included : getIncludedFiles(file, contents)) {
+            pending.push_back(std::move(included));
+        }
+    }
+    return key;
+}
+
+int64_t elapsedUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                 start)
+            .count();
+}
+
+}  // namespace
+
+ConfigCache::ConfigCache(const std::string& name, const std::vector<std::string>& sourceFiles,
+                         const std::string& cacheDir)
+    : mName(name),
+      mCacheDir(cacheDir),
+      mCacheFile(cacheDir + "/" + name + ".cache"),
+      mKey(computeKey(sourceFiles)) {}
+
+void ConfigCache::getOrCreate(const std::function<binder_status_t(const AParcel*)>& read,
+                              const std::function<bool()>& create,
+                              const std::function<binder_status_t(AParcel*)>& write) {
+    const auto start = std::chrono::steady_clock::now();
+    if (access(mCacheDir.c_str(), W_OK) != 0) {
+        create();
+        LOG(INFO) << __func__ << ": " << mName << ": created in " << elapsedUs(start)
+                  << " us, caching is disabled as " << mCacheDir << " is not writable";
+        return;
+    }
+    if (load(read)) {
+        LOG(INFO) << __func__ << ": " << mName << ": loaded from " << mCacheFile << " in "
+                  << elapsedUs(start) << " us";
+        return;
+    }
+    if (!create()) {
+        LOG(INFO) << __func__ << ": " << mName << ": created in " << elapsedUs(start)
+                  << " us, not cacheable";
+        return;
+    }
+    const int64_t createUs = elapsedUs(start);
+    const bool stored = store(write);
+    LOG(INFO) << __func__ << ": " << mName << ": created in " << createUs << " us, "
+              << (stored ? "stored in " : "could not store in ") << mCacheFile;
+}
+
+bool ConfigCache::load(const std::function<binder_status_t(const AParcel*)>& read) const {
+    unique_fd fd(TEMP_FAILURE_RETRY(open(mCacheFile.c_str(), O_RDONLY | O_CLOEXEC)));
+    if (fd == -1) {
+        if (errno != ENOENT) {
+            PLOG(WARNING) << __func__ << ": " << mName << ": failed to open " << mCacheFile;
+        }
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd.get(), &st) != 0) {
+        PLOG(WARNING) << __func__ << ": " << mName << ": failed to stat " << mCacheFile;
+        return false;
+    }
+    const size_t fileSize = st.st_size;
+    if (fileSize < sizeof(CacheHeader)) {
+        LOG(WARNING) << __func__ << ": " << mName << ": " << mCacheFile << " is truncated";
+        return false;
+    }
+    void* data = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd.get(), 0);
+    if (data == MAP_FAILED) {
+        PLOG(WARNING) << __func__ << ": " << mName << ": failed to map " << mCacheFile;
+        return false;
+    }
+    auto unmap = ::android::base::make_scope_guard([&]() { munmap(data, fileSize); });
+
+    CacheHeader header;
+    memcpy(&header, data, sizeof(header));
+    const uint8_t* payload = static_cast<const uint8_t*>(data) + sizeof(header);
+    const size_t payloadSize = fileSize - sizeof(header);
+    if (header.magic != kCacheMagic || header.version != kCacheVersion) {
+        LOG(WARNING) << __func__ << ": " << mName << ": " << mCacheFile << " has an unknown format";
+        return false;
+    }
+    if (header.key != mKey) {
+        LOG(INFO) << __func__ << ": " << mName << ": the source files have changed";
+        return false;
+    }
+    if (header.payloadSize != payloadSize ||
+        header.payloadChecksum != hashBytes(kFnvOffsetBasis, payload, payloadSize)) {
+        LOG(WARNING) << __func__ << ": " << mName << ": " << mCacheFile << " is corrupted";
+        return false;
+    }
+
+    ndk::ScopedAParcel parcel(AParcel_create());
+    if (binder_status_t status = AParcel_unmarshal(parcel.get(), payload, payloadSize);
+        status != STATUS_OK) {
+        LOG(WARNING) << __func__ << ": " << mName << ": failed to unmarshal: " << status;
+        return false;
+    }
+    AParcel_setDataPosition(parcel.get(), 0);
+    if (binder_status_t status = read(parcel.get()); status != STATUS_OK) {
+        LOG(WARNING) << __func__ << ": " << mName << ": failed to read: " << status;
+        return false;
+    }
+    return true;
+}
+
+bool ConfigCache::store(const std::function<binder_status_t(AParcel*)>& write) const {
+    ndk::ScopedAParcel parcel(AParcel_create());
+    if (binder_status_t status = write(parcel.get()); status != STATUS_OK) {
+        LOG(WARNING) << __func__ << ": " << mName << ": failed to write: " << status;
+        return false;
+    }
+    const size_t payloadSize = AParcel_getDataSize(parcel.get());
+    std::vector<uint8_t> buffer(sizeof(CacheHeader) + payloadSize);
+    uint8_t* payload = buffer.data() + sizeof(CacheHeader);
+    if (binder_status_t status = AParcel_marshal(parcel.get(), payload, 0, payloadSize);
+        status != STATUS_OK) {
+        LOG(WARNING) << __func__ << ": " << mName << ": failed to marshal: " << status;
+        return false;
+    }
+    const CacheHeader header = {
+            .magic = kCacheMagic,
+            .version = kCacheVersion,
+            .key = mKey,
+            .payloadSize = payloadSize,
+            .payloadChecksum = hashBytes(kFnvOffsetBasis, payload, payloadSize)};
+    memcpy(buffer.data(), &header, sizeof(header));
+
+    // Write a temporary file and rename it, so that the cache file is always complete.
+    const std::string tempFile = mCacheFile + ".tmp";
+    unique_fd fd(TEMP_FAILURE_RETRY(
+            open(tempFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0640)));
+    if (fd == -1) {
+        PLOG(WARNING) << __func__ << ": " << mName << ": failed to create " << tempFile;
+        return false;
+    }
+    if (!::android::base::WriteFully(fd.get(), buffer.data(), buffer.size()) ||
+        fsync(fd.get()) != 0) {
+        PLOG(WARNING) << __func__ << ": " << mName << ": failed to write " << tempFile;
+        unlink(tempFile.c_str());
+        return false;
+    }
+    fd.reset();
+    if (rename(tempFile.c_str(), mCacheFile.c_str()) != 0) {
+        PLOG(WARNING) << __func__ << ": " << mName << ": failed to rename " << tempFile;
+        unlink(tempFile.c_str());
+        return false;
+    }
+    return true;
+}
+
+}  // namespace aidl::android::hardware::audio::core::internal
@@ -18,19 +18,83 @@
 #include <string>
 #define LOG_TAG "AHAL_EffectConfig"
 #include <android-base/logging.h>
+#include <android/binder_parcel_utils.h>
 #include <system/audio_aidl_utils.h>
 #include <system/audio_effects/audio_effects_conf.h>
 #include <system/audio_effects/effect_uuid.h>
 
+#include "core-impl/ConfigCache.h"
 #include "effectFactory-impl/EffectConfig.h"
 
 using aidl::android::media::audio::common::AudioSource;
 using aidl::android::media::audio::common::AudioStreamType;
+using aidl::android::hardware::audio::core::internal::ConfigCache;
 using aidl::android::media::audio::common::AudioUuid;
 
+#define RETURN_IF_PARCEL_ERROR(expr)                                \
+    do {                                                            \
+        if (binder_status_t status = (expr); status != STATUS_OK) { \
+            return status;                                          \
+        }                                                           \
+    } while (0)
+
 namespace aidl::android::hardware::audio::effect {
 
+namespace {
+
+binder_status_t writeLibrary(AParcel* parcel, const EffectConfig::Library& library) {
+    RETURN_IF_PARCEL_ERROR(::ndk::AParcel_writeString(parcel, library.name));
+    RETURN_IF_PARCEL_ERROR(::ndk::AParcel_writeParcelable(parcel, library.uuid));
+    return ::ndk::AParcel_writeNullableParcelable(parcel, library.type);
+}
+
+binder_status_t readLibrary(const AParcel* parcel, EffectConfig::Library* library) {
+    RETURN_IF_PARCEL_ERROR(::ndk::AParcel_readString(parcel, &library->name));
+    RETURN_IF_PARCEL_ERROR(::ndk::AParcel_readParcelable(parcel, &library->uuid));
+    return ::ndk::AParcel_readNullableParcelable(parcel, &library->type);
+}
+
+binder_status_t writeEffectLibraries(AParcel* parcel,
+                                     const EffectConfig::EffectLibraries& effectLibraries) {
+    RETURN_IF_PARCEL_ERROR(AParcel_writeBool(parcel, effectLibraries.proxyLibrary.has_value()));
+    if (effectLibraries.proxyLibrary.has_value()) {
+        RETURN_IF_PARCEL_ERROR(writeLibrary(parcel, effectLibraries.proxyLibrary.value()));
+    }
+    RETURN_IF_PARCEL_ERROR(
+            AParcel_writeInt32(parcel, static_cast<int32_t>(effectLibraries.libraries.size())));
+    for (const auto& library : effectLibraries.libraries) {
+        RETURN_IF_PARCEL_ERROR(writeLibrary(parcel, library));
+    }
+    return STATUS_OK;
+}
+
+binder_status_t readEffectLibraries(const AParcel* parcel,
+                                    EffectConfig::EffectLibraries* effectLibraries) {
+    bool hasProxyLibrary;
+    RETURN_IF_PARCEL_ERROR(AParcel_readBool(parcel, &hasProxyLibrary));
+    if (hasProxyLibrary) {
+        RETURN_IF_PARCEL_ERROR(readLibrary(parcel, &effectLibraries->proxyLibrary.emplace()));
+    }
+    int32_t size;
+    RETURN_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &size));
+    RETURN_VALUE_IF(size < 0, STATUS_BAD_VALUE, "negativeSize");
+    effectLibraries->libraries.resize(size);
+    for (auto& library : effectLibraries->libraries) {
+        RETURN_IF_PARCEL_ERROR(readLibrary(parcel, &library));
+    }
+    return STATUS_OK;
+}
+
+}  // namespace
+
 EffectConfig::EffectConfig(const std::string& file) {
+    ConfigCache cache("audio_effects_config", {file});
+    cache.getOrCreate([this](const AParcel* parcel) { return readFromParcel(parcel); },
+                      [this, &file]() { return parse(file); },
+                      [this](AParcel* parcel) { return writeToParcel(parcel); });
+}
+
+bool EffectConfig::parse(const std::string& file) {
     tinyxml2::XMLDocument doc;
     doc.LoadFile(file.c_str());
     LOG(DEBUG) << __func__ << " loading " << file;
@@ -38,7 +102,7 @@ EffectConfig::EffectConfig(const std::string& file) {
     if (doc.Error()) {
         LOG(ERROR) << __func__ << " tinyxml2 failed to load " << file
                    << " error: " << doc.ErrorStr();
-        return;
+        return false;
     }
 
     auto registerFailure = [&](bool result) { mSkippedElements += result ? 0 : 1; };
@@ -76,6 +140,77 @@ EffectConfig::EffectConfig(const std::string& file) {
     }
     LOG(DEBUG) << __func__ << " successfully parsed " << file << ", skipping " << mSkippedElements
                << " element(s)";
+    return true;
+}
+
+binder_status_t EffectConfig::writeToParcel(AParcel* parcel) const {
+    RETURN_IF_PARCEL_ERROR(AParcel_writeInt32(parcel, mSkippedElements));
+    RETURN_IF_PARCEL_ERROR(AParcel_writeInt32(parcel, static_cast<int32_t>(mLibraryMap.size())));
+    for (const auto& [name, path] : mLibraryMap) {
+        RETURN_IF_PARCEL_ERROR(::ndk::AParcel_writeString(parcel, name));
+        RETURN_IF_PARCEL_ERROR(::ndk::AParcel_writeString(parcel, path));
+    }
+    RETURN_IF_PARCEL_ERROR(AParcel_writeInt32(parcel, static_cast<int32_t>(mEffectsMap.size())));
+    for (const auto& [name, effectLibraries] : mEffectsMap) {
+        RETURN_IF_PARCEL_ERROR(::ndk::AParcel_writeString(parcel, name));
+        RETURN_IF_PARCEL_ERROR(writeEffectLibraries(parcel, effectLibraries));
+    }
+    RETURN_IF_PARCEL_ERROR(AParcel_writeInt32(parcel, static_cast<int32_t>(mProcessingMap.size())));
+    for (const auto& [type, effectLibrariesList] : mProcessingMap) {
+        RETURN_IF_PARCEL_ERROR(::ndk::AParcel_writeParcelable(parcel, type));
+        RETURN_IF_PARCEL_ERROR(
+                AParcel_writeInt32(parcel, static_cast<int32_t>(effectLibrariesList.size())));
+        for (const auto& effectLibraries : effectLibrariesList) {
+            RETURN_IF_PARCEL_ERROR(writeEffectLibraries(parcel, effectLibraries));
+        }
+    }
+    return STATUS_OK;
+}
+
+binder_status_t EffectConfig::readFromParcel(const AParcel* parcel) {
+    // Only update the maps once everything is read, a failure leaves them to the parser.
+    int32_t skippedElements;
+    std::unordered_map<std::string, std::string> libraryMap;
+    std::unordered_map<std::string, struct EffectLibraries> effectsMap;
+    ProcessingLibrariesMap processingMap;
+    int32_t size;
+
+    RETURN_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &skippedElements));
+    RETURN_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &size));
+    for (int32_t i = 0; i < size; ++i) {
+        std::string name, path;
+        RETURN_IF_PARCEL_ERROR(::ndk::AParcel_readString(parcel, &name));
+        RETURN_IF_PARCEL_ERROR(::ndk::AParcel_readString(parcel, &path));
+        libraryMap[name] = std::move(path);
+    }
+    RETURN_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &size));
+    for (int32_t i = 0; i < size; ++i) {
+        std::string name;
+        RETURN_IF_PARCEL_ERROR(::ndk::AParcel_readString(parcel, &name));
+        RETURN_IF_PARCEL_ERROR(readEffectLibraries(parcel, &effectsMap[name]));
+    }
+    RETURN_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &size));
+    for (int32_t i = 0; i < size; ++i) {
+        Processing::Type type;
+        int32_t count;
+        RETURN_IF_PARCEL_ERROR(::ndk::AParcel_readParcelable(parcel, &type));
+        RETURN_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &count));
+        RETURN_VALUE_IF(count < 0, STATUS_BAD_VALUE, "negativeSize");
+        auto& effectLibrariesList = processingMap[type];
+        effectLibrariesList.resize(count);
+        for (auto& effectLibraries : effectLibrariesList) {
+            RETURN_IF_PARCEL_ERROR(readEffectLibraries(parcel, &effectLibraries));
+        }
+    }
+
+    mSkippedElements = skippedElements;
+    mLibraryMap = std::move(libraryMap);
+    mEffectsMap = std::move(effectsMap);
+    mProcessingMap = std::move(processingMap);
+    LOG(DEBUG) << __func__ << " loaded " << mLibraryMap.size() << " libraries, "
+               << mEffectsMap.size() << " effects, " << mProcessingMap.size()
+               << " processing chains";
+    return STATUS_OK;
 }
 
 std::vector<std::reference_wrapper<const tinyxml2::XMLElement>> EffectConfig::getChildren(
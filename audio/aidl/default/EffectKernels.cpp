@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <cmath>
+
+#define LOG_TAG "AHAL_EffectKernels"
+#include <android-base/logging.h>
+
+#include "EffectKernelsImpl.h"
+
+namespace aidl::android::hardware::audio::effect {
+
+namespace {
+
+constexpr EffectKernels kScalarKernels = {
+        .name = "scalar",
+        .scale = scale<Scalar>,
+        .ramp = ramp<>,
+        .biquads = biquads<>,
+        .limiter = limiter<>,
+};
+
+// Keeps the filters stable and meaningful for any sample rate, including ones too low for the
+// requested frequency.
+double normalizedFrequency(float sampleRate, float frequency) {
+    return 2 * M_PI * std::clamp<double>(frequency, 1., 0.45 * sampleRate) / sampleRate;
+}
+
+BiquadCoefs normalize(double b0, double b1, double b2, double a0, double a1, double a2) {
+    return {static_cast<float>(b0 / a0), static_cast<float>(b1 / a0), static_cast<float>(b2 / a0),
+            static_cast<float>(a1 / a0), static_cast<float>(a2 / a0)};
+}
+
+}  // namespace
+
+const EffectKernels* getScalarEffectKernels() {
+    return &kScalarKernels;
+}
+
+const EffectKernels& getEffectKernels() {
+    static const EffectKernels* sKernels = [] {
+        const EffectKernels* kernels = getAvx2EffectKernels();
+        if (kernels == nullptr) kernels = getSse2EffectKernels();
+        if (kernels == nullptr) kernels = getNeonEffectKernels();
+        if (kernels == nullptr) kernels = getScalarEffectKernels();
+        LOG(INFO) << "Using the " << kernels->name << " effect kernels";
+        return kernels;
+    }();
+    return *sKernels;
+}
+
+// Shelves with a slope of 1, the steepest without overshoot.
+BiquadCoefs makeLowShelf(float sampleRate, float frequency, float gainDb) {
+    const double a = std::pow(10., gainDb / 40.);
+    const double w0 = normalizedFrequency(sampleRate, frequency);
+    const double cosW0 = std::cos(w0);
+    const double twoSqrtAAlpha = 2 * std::sqrt(a) * std::sin(w0) / M_SQRT2;
+    return normalize(a * ((a + 1) - (a - 1) * cosW0 + twoSqrtAAlpha),
+                     2 * a * ((a - 1) - (a + 1) * cosW0),
+                     a * ((a + 1) - (a - 1) * cosW0 - twoSqrtAAlpha),
+                     (a + 1) + (a - 1) * cosW0 + twoSqrtAAlpha, -2 * ((a - 1) + (a + 1) * cosW0),
+                     (a + 1) + (a - 1) * cosW0 - twoSqrtAAlpha);
+}
+
+BiquadCoefs makeHighShelf(float sampleRate, float frequency, float gainDb) {
+    const double a = std::pow(10., gainDb / 40.);
+    const double w0 = normalizedFrequency(sampleRate, frequency);
+    const double cosW0 = std::cos(w0);
+    const double twoSqrtAAlpha = 2 * std::sqrt(a) * std::sin(w0) / M_SQRT2;
+    return normalize(a * ((a + 1) + (a - 1) * cosW0 + twoSqrtAAlpha),
+                     -2 * a * ((a - 1) + (a + 1) * cosW0),
+                     a * ((a + 1) + (a - 1) * cosW0 - twoSqrtAAlpha),
+                     (a + 1) - (a - 1) * cosW0 + twoSqrtAAlpha, 2 * ((a - 1) - (a + 1) * cosW0),
+                     (a + 1) - (a - 1) * cosW0 - twoSqrtAAlpha);
+}
+
+BiquadCoefs makePeaking(float sampleRate, float frequency, float gainDb, float q) {
+    const double a = std::pow(10., gainDb / 40.);
+    const double w0 = normalizedFrequency(sampleRate, frequency);
+    const double cosW0 = std::cos(w0);
+    const double alpha = std::sin(w0) / (2 * q);
+    return normalize(1 + alpha * a, -2 * cosW0, 1 - alpha * a, 1 + alpha / a, -2 * cosW0,
+                     1 - alpha / a);
+}
+
+float limiterCoef(float sampleRate, float timeMs) {
+    if (timeMs <= 0.f) {
+        return 1.f;
+    }
+    return static_cast<float>(1. - std::exp(-1000. / (timeMs * sampleRate)));
+}
+
+void BiquadCascade::setStages(size_t channels, const std::vector<BiquadCoefs>& stages) {
+    if (channels != mChannels || stages.size() != mStages.size()) {
+        mChannels = channels;
+        mState.assign(2 * stages.size() * channels, 0.f);
+    }
+    mStages = stages;
+}
+
+void BiquadCascade::reset() {
+    std::fill(mState.begin(), mState.end(), 0.f);
+}
+
+void BiquadCascade::process(const float* in, float* out, size_t frames) {
+    getEffectKernels().biquads(in, out, frames, mChannels, mStages.data(), mStages.size(),
+                               mState.data());
+}
+
+}  // namespace aidl::android::hardware::audio::effect
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "effect-impl/EffectKernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include <immintrin.h>
+
+// Everything declared from here on, including the kernel templates, is compiled for AVX2 and FMA.
+// The public declarations and the system headers are included above so they're not affected.
+#pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+
+#include "EffectKernelsImpl.h"
+
+namespace aidl::android::hardware::audio::effect {
+namespace {
+
+struct AvxF32x8 {
+    using Reg = __m256;
+    static constexpr size_t kLanes = 8;
+
+    static Reg load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, Reg v) { _mm256_storeu_ps(p, v); }
+    static Reg set1(float v) { return _mm256_set1_ps(v); }
+    static Reg add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm256_sub_ps(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+    static Reg mulAdd(Reg a, Reg b, Reg c) { return _mm256_fmadd_ps(b, c, a); }
+    static Reg abs(Reg a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a); }
+    static Reg max(Reg a, Reg b) { return _mm256_max_ps(a, b); }
+    static Reg selectGreater(Reg a, Reg b, Reg x, Reg y) {
+        return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_GT_OQ));
+    }
+
+    static Reg log2(Reg x) {
+        const __m256i bits = _mm256_castps_si256(x);
+        const Reg exponent = _mm256_cvtepi32_ps(
+                _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+        const __m256i mantissaBits = _mm256_or_si256(
+                _mm256_and_si256(bits, _mm256_set1_epi32(0x7fffff)), _mm256_set1_epi32(0x3f800000));
+        const Reg mantissa = _mm256_castsi256_ps(mantissaBits);
+        return add(exponent, log2Mantissa<AvxF32x8>(sub(mantissa, set1(1.f))));
+    }
+
+    static Reg exp2(Reg y) {
+        y = max(y, set1(-126.f));
+        const __m256i integer = _mm256_cvttps_epi32(y);
+        const Reg scale = _mm256_castsi256_ps(
+                _mm256_slli_epi32(_mm256_add_epi32(integer, _mm256_set1_epi32(127)), 23));
+        return mul(scale, exp2Fraction<AvxF32x8>(sub(y, _mm256_cvtepi32_ps(integer))));
+    }
+};
+
+// Narrower channel groups use the VEX encoded SSE operations rather than partial AVX registers.
+constexpr EffectKernels kAvx2Kernels = {
+        .name = "avx2",
+        .scale = scale<AvxF32x8>,
+        .ramp = ramp<AvxF32x8>,
+        .biquads = biquads<AvxF32x8, SseF32x4, SseF32x2>,
+        .limiter = limiter<AvxF32x8, SseF32x4, SseF32x2>,
+};
+
+}  // namespace
+}  // namespace aidl::android::hardware::audio::effect
+
+#pragma clang attribute pop
+
+namespace aidl::android::hardware::audio::effect {
+
+const EffectKernels* getAvx2EffectKernels() {
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ? &kAvx2Kernels
+                                                                             : nullptr;
+}
+
+}  // namespace aidl::android::hardware::audio::effect
+
+#else  // !(defined(__x86_64__) || defined(__i386__))
+
+namespace aidl::android::hardware::audio::effect {
+
+const EffectKernels* getAvx2EffectKernels() {
+    return nullptr;
+}
+
+}  // namespace aidl::android::hardware::audio::effect
+
+#endif
@@ -0,0 +1,379 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The effect kernels, written once against a small set of vector operations and instantiated by
+ * each EffectKernels*.cpp for the registers of its instruction set.
+ *
+ * Everything here has internal linkage: the AVX2 file compiles all the functions it includes for
+ * AVX2, so they must not be merged with the SSE2 or scalar instantiations of the other files.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "effect-impl/EffectKernels.h"
+
+namespace aidl::android::hardware::audio::effect {
+namespace {
+
+// Max number of biquads run in one pass, with their coefficients and state held in registers.
+constexpr size_t kMaxBiquadStages = 8;
+
+// Polynomial approximations used by the limiter gain computer, with an error below 2e-5 for
+// log2(1 + t), t in [0, 1), and below 2e-7 for 2^f, f in (-1, 0].
+template <class V>
+typename V::Reg log2Mantissa(typename V::Reg t) {
+    typename V::Reg p = V::set1(0.0452682917f);
+    p = V::mulAdd(V::set1(-0.193516522f), p, t);
+    p = V::mulAdd(V::set1(0.415245559f), p, t);
+    p = V::mulAdd(V::set1(-0.708865217f), p, t);
+    p = V::mulAdd(V::set1(1.4418799f), p, t);
+    return V::mul(p, t);
+}
+
+template <class V>
+typename V::Reg exp2Fraction(typename V::Reg f) {
+    typename V::Reg p = V::set1(0.000952651423f);
+    p = V::mulAdd(V::set1(0.00922489449f), p, f);
+    p = V::mulAdd(V::set1(0.0553136261f), p, f);
+    p = V::mulAdd(V::set1(0.240185623f), p, f);
+    p = V::mulAdd(V::set1(0.693144297f), p, f);
+    return V::mulAdd(V::set1(1.f), p, f);
+}
+
+// One channel at a time. log2() takes x >= 1 and exp2() takes y <= 0, which is all the limiter
+// needs.
+struct Scalar {
+    using Reg = float;
+    static constexpr size_t kLanes = 1;
+
+    static Reg load(const float* p) { return *p; }
+    static void store(float* p, Reg v) { *p = v; }
+    static Reg set1(float v) { return v; }
+    static Reg add(Reg a, Reg b) { return a + b; }
+    static Reg sub(Reg a, Reg b) { return a - b; }
+    static Reg mul(Reg a, Reg b) { return a * b; }
+    // a + b * c
+    static Reg mulAdd(Reg a, Reg b, Reg c) { return a + b * c; }
+    static Reg abs(Reg a) { return a < 0.f ? -a : a; }
+    static Reg max(Reg a, Reg b) { return a > b ? a : b; }
+    // a > b ? x : y
+    static Reg selectGreater(Reg a, Reg b, Reg x, Reg y) { return a > b ? x : y; }
+
+    static Reg log2(Reg x) {
+        uint32_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        const float exponent = static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+        bits = (bits & 0x7fffff) | 0x3f800000;
+        float mantissa;
+        std::memcpy(&mantissa, &bits, sizeof(mantissa));
+        return exponent + log2Mantissa<Scalar>(mantissa - 1.f);
+    }
+
+    static Reg exp2(Reg y) {
+        y = max(y, -126.f);
+        const int32_t integer = static_cast<int32_t>(y);
+        const uint32_t bits = static_cast<uint32_t>(integer + 127) << 23;
+        float scale;
+        std::memcpy(&scale, &bits, sizeof(scale));
+        return scale * exp2Fraction<Scalar>(y - static_cast<float>(integer));
+    }
+};
+
+#if defined(__ARM_NEON)
+
+struct NeonF32x4 {
+    using Reg = float32x4_t;
+    static constexpr size_t kLanes = 4;
+
+    static Reg load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, Reg v) { vst1q_f32(p, v); }
+    static Reg set1(float v) { return vdupq_n_f32(v); }
+    static Reg add(Reg a, Reg b) { return vaddq_f32(a, b); }
+    static Reg sub(Reg a, Reg b) { return vsubq_f32(a, b); }
+    static Reg mul(Reg a, Reg b) { return vmulq_f32(a, b); }
+#if defined(__aarch64__)
+    static Reg mulAdd(Reg a, Reg b, Reg c) { return vfmaq_f32(a, b, c); }
+#else
+    static Reg mulAdd(Reg a, Reg b, Reg c) { return vmlaq_f32(a, b, c); }
+#endif
+    static Reg abs(Reg a) { return vabsq_f32(a); }
+    static Reg max(Reg a, Reg b) { return vmaxq_f32(a, b); }
+    static Reg selectGreater(Reg a, Reg b, Reg x, Reg y) {
+        return vbslq_f32(vcgtq_f32(a, b), x, y);
+    }
+
+    static Reg log2(Reg x) {
+        const uint32x4_t bits = vreinterpretq_u32_f32(x);
+        const Reg exponent = vcvtq_f32_s32(
+                vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+        const Reg mantissa = vreinterpretq_f32_u32(
+                vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x7fffff)), vdupq_n_u32(0x3f800000)));
+        return add(exponent, log2Mantissa<NeonF32x4>(sub(mantissa, set1(1.f))));
+    }
+
+    static Reg exp2(Reg y) {
+        y = max(y, set1(-126.f));
+        const int32x4_t integer = vcvtq_s32_f32(y);
+        const Reg scale =
+                vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(integer, vdupq_n_s32(127)), 23));
+        return mul(scale, exp2Fraction<NeonF32x4>(sub(y, vcvtq_f32_s32(integer))));
+    }
+};
+
+// Two channels in the low half of a q register, so the kernels don't need a d register variant.
+struct NeonF32x2 : NeonF32x4 {
+    static constexpr size_t kLanes = 2;
+
+    static Reg load(const float* p) { return vcombine_f32(vld1_f32(p), vdup_n_f32(0.f)); }
+    static void store(float* p, Reg v) { vst1_f32(p, vget_low_f32(v)); }
+};
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+struct SseF32x4 {
+    using Reg = __m128;
+    static constexpr size_t kLanes = 4;
+
+    static Reg load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Reg v) { _mm_storeu_ps(p, v); }
+    static Reg set1(float v) { return _mm_set1_ps(v); }
+    static Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+    static Reg mulAdd(Reg a, Reg b, Reg c) { return _mm_add_ps(a, _mm_mul_ps(b, c)); }
+    static Reg abs(Reg a) { return _mm_andnot_ps(_mm_set1_ps(-0.f), a); }
+    static Reg max(Reg a, Reg b) { return _mm_max_ps(a, b); }
+    static Reg selectGreater(Reg a, Reg b, Reg x, Reg y) {
+        const Reg mask = _mm_cmpgt_ps(a, b);
+        return _mm_or_ps(_mm_and_ps(mask, x), _mm_andnot_ps(mask, y));
+    }
+
+    static Reg log2(Reg x) {
+        const __m128i bits = _mm_castps_si128(x);
+        const Reg exponent =
+                _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+        const Reg mantissa = _mm_castsi128_ps(_mm_or_si128(
+                _mm_and_si128(bits, _mm_set1_epi32(0x7fffff)), _mm_set1_epi32(0x3f800000)));
+        return add(exponent, log2Mantissa<SseF32x4>(sub(mantissa, set1(1.f))));
+    }
+
+    static Reg exp2(Reg y) {
+        y = max(y, set1(-126.f));
+        const __m128i integer = _mm_cvttps_epi32(y);
+        const Reg scale = _mm_castsi128_ps(
+                _mm_slli_epi32(_mm_add_epi32(integer, _mm_set1_epi32(127)), 23));
+        return mul(scale, exp2Fraction<SseF32x4>(sub(y, _mm_cvtepi32_ps(integer))));
+    }
+};
+
+// Two channels in the low half of an xmm register.
+struct SseF32x2 : SseF32x4 {
+    static constexpr size_t kLanes = 2;
+
+    static Reg load(const float* p) {
+        return _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+    }
+    static void store(float* p, Reg v) { _mm_storel_pi(reinterpret_cast<__m64*>(p), v); }
+};
+
+#endif
+
+template <class V>
+void scale(const float* in, float* out, size_t samples, float gain) {
+    const typename V::Reg g = V::set1(gain);
+    size_t i = 0;
+    for (; i + V::kLanes <= samples; i += V::kLanes) {
+        V::store(out + i, V::mul(V::load(in + i), g));
+    }
+    for (; i < samples; i++) {
+        out[i] = in[i] * gain;
+    }
+}
+
+// Max number of channels rampFrames() handles as groups of frames.
+constexpr size_t kMaxRampChannels = 32;
+
+// Ramps with V, returns false if it can't. The gain of each frame is calculated from its index
+// rather than accumulated, so all the instruction sets produce the same ramp.
+template <class V>
+bool rampFrames(const float* in, float* out, size_t frames, size_t channels, float startGain,
+                float endGain) {
+    using Reg = typename V::Reg;
+    constexpr size_t kLanes = V::kLanes;
+    const Reg start = V::set1(startGain);
+    const float step = (endGain - startGain) / static_cast<float>(frames);
+    const Reg stepReg = V::set1(step);
+
+    if (channels > kMaxRampChannels) {
+        if (channels % kLanes != 0) {
+            return false;
+        }
+        for (size_t frame = 0; frame < frames; frame++) {
+            const Reg gain = V::mulAdd(start, stepReg, V::set1(static_cast<float>(frame + 1)));
+            const size_t first = frame * channels;
+            for (size_t i = first; i < first + channels; i += kLanes) {
+                V::store(out + i, V::mul(V::load(in + i), gain));
+            }
+        }
+        return true;
+    }
+
+    // Every kLanes frames fill channels registers, whose lanes always fall on the same frames
+    // relative to the first one.
+    float offsets[kMaxRampChannels * kLanes];
+    const size_t groupSamples = channels * kLanes;
+    for (size_t i = 0; i < groupSamples; i++) {
+        offsets[i] = static_cast<float>(i / channels + 1);
+    }
+    const size_t samples = frames * channels;
+    size_t i = 0;
+    for (size_t frame = 0; i + groupSamples <= samples; i += groupSamples, frame += kLanes) {
+        const Reg first = V::set1(static_cast<float>(frame));
+        for (size_t reg = 0; reg < groupSamples; reg += kLanes) {
+            const Reg gain = V::mulAdd(start, stepReg, V::add(first, V::load(offsets + reg)));
+            V::store(out + i + reg, V::mul(V::load(in + i + reg), gain));
+        }
+    }
+    for (; i < samples; i++) {
+        out[i] = in[i] * (startGain + step * static_cast<float>(i / channels + 1));
+    }
+    return true;
+}
+
+template <class... Vs>
+void ramp(const float* in, float* out, size_t frames, size_t channels, float startGain,
+          float endGain) {
+    if (frames == 0 || (rampFrames<Vs>(in, out, frames, channels, startGain, endGain) || ...)) {
+        return;
+    }
+    rampFrames<Scalar>(in, out, frames, channels, startGain, endGain);
+}
+
+// Calls fn(V{}, channel) for each group of channels, using the widest of Vs that fits the
+// remaining channels and Scalar for the last ones.
+template <class... Vs, class Fn>
+void forEachChannelGroup(size_t channels, Fn&& fn) {
+    size_t channel = 0;
+    auto run = [&](auto ops) {
+        constexpr size_t kLanes = decltype(ops)::kLanes;
+        for (; channel + kLanes <= channels; channel += kLanes) {
+            fn(ops, channel);
+        }
+    };
+    (run(Vs{}), ...);
+    run(Scalar{});
+}
+
+template <class V>
+void biquadChannels(const float* in, float* out, size_t frames, size_t channels, size_t channel,
+                    const BiquadCoefs* coefs, size_t stages, float* state) {
+    using Reg = typename V::Reg;
+    Reg b0[kMaxBiquadStages], b1[kMaxBiquadStages], b2[kMaxBiquadStages];
+    Reg negA1[kMaxBiquadStages], negA2[kMaxBiquadStages];
+    Reg s1[kMaxBiquadStages], s2[kMaxBiquadStages];
+    for (size_t stage = 0; stage < stages; stage++) {
+        b0[stage] = V::set1(coefs[stage].b0);
+        b1[stage] = V::set1(coefs[stage].b1);
+        b2[stage] = V::set1(coefs[stage].b2);
+        negA1[stage] = V::set1(-coefs[stage].a1);
+        negA2[stage] = V::set1(-coefs[stage].a2);
+        s1[stage] = V::load(state + (2 * stage) * channels + channel);
+        s2[stage] = V::load(state + (2 * stage + 1) * channels + channel);
+    }
+
+    for (size_t i = channel; i < frames * channels; i += channels) {
+        Reg x = V::load(in + i);
+        for (size_t stage = 0; stage < stages; stage++) {
+            const Reg y = V::mulAdd(s1[stage], b0[stage], x);
+            s1[stage] = V::mulAdd(V::mulAdd(s2[stage], b1[stage], x), negA1[stage], y);
+            s2[stage] = V::mulAdd(V::mul(b2[stage], x), negA2[stage], y);
+            x = y;
+        }
+        V::store(out + i, x);
+    }
+
+    for (size_t stage = 0; stage < stages; stage++) {
+        V::store(state + (2 * stage) * channels + channel, s1[stage]);
+        V::store(state + (2 * stage + 1) * channels + channel, s2[stage]);
+    }
+}
+
+template <class... Vs>
+void biquads(const float* in, float* out, size_t frames, size_t channels, const BiquadCoefs* coefs,
+             size_t stages, float* state) {
+    if (stages == 0 && in != out) {
+        std::copy(in, in + frames * channels, out);
+    }
+    // Longer cascades run in several passes, the later ones in place.
+    for (size_t first = 0; first < stages; first += kMaxBiquadStages) {
+        const size_t count = std::min(stages - first, kMaxBiquadStages);
+        float* passState = state + 2 * first * channels;
+        forEachChannelGroup<Vs...>(channels, [&](auto ops, size_t channel) {
+            biquadChannels<decltype(ops)>(in, out, frames, channels, channel, coefs + first, count,
+                                          passState);
+        });
+        in = out;
+    }
+}
+
+template <class V>
+void limiterChannels(const float* in, float* out, size_t frames, size_t channels, size_t channel,
+                     const LimiterChannels& limiter) {
+    using Reg = typename V::Reg;
+    const Reg inputGain = V::load(limiter.inputGain + channel);
+    const Reg invThreshold = V::load(limiter.invThreshold + channel);
+    const Reg slope = V::load(limiter.slope + channel);
+    const Reg attack = V::load(limiter.attack + channel);
+    const Reg release = V::load(limiter.release + channel);
+    const Reg outputGain = V::load(limiter.outputGain + channel);
+    const Reg one = V::set1(1.f);
+    Reg envelope = V::load(limiter.envelope + channel);
+
+    for (size_t i = channel; i < frames * channels; i += channels) {
+        const Reg x = V::mul(V::load(in + i), inputGain);
+        const Reg level = V::abs(x);
+        const Reg coef = V::selectGreater(level, envelope, attack, release);
+        envelope = V::mulAdd(envelope, coef, V::sub(level, envelope));
+        // 1 below the threshold, since log2(1) and hence the exponent are 0.
+        const Reg over = V::max(V::mul(envelope, invThreshold), one);
+        const Reg gain = V::exp2(V::mul(slope, V::log2(over)));
+        V::store(out + i, V::mul(x, V::mul(gain, outputGain)));
+    }
+
+    V::store(limiter.envelope + channel, envelope);
+}
+
+template <class... Vs>
+void limiter(const float* in, float* out, size_t frames, size_t channels,
+             const LimiterChannels& limiter) {
+    forEachChannelGroup<Vs...>(channels, [&](auto ops, size_t channel) {
+        limiterChannels<decltype(ops)>(in, out, frames, channels, channel, limiter);
+    });
+}
+
+}  // namespace
+}  // namespace aidl::android::hardware::audio::effect
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "EffectKernelsImpl.h"
+
+namespace aidl::android::hardware::audio::effect {
+
+#if defined(__ARM_NEON)
+
+namespace {
+
+constexpr EffectKernels kNeonKernels = {
+        .name = "neon",
+        .scale = scale<NeonF32x4>,
+        .ramp = ramp<NeonF32x4>,
+        .biquads = biquads<NeonF32x4, NeonF32x2>,
+        .limiter = limiter<NeonF32x4, NeonF32x2>,
+};
+
+}  // namespace
+
+// NEON is mandatory on all the ARM ABIs Android supports, no need to check for it at runtime.
+const EffectKernels* getNeonEffectKernels() {
+    return &kNeonKernels;
+}
+
+#else  // !defined(__ARM_NEON)
+
+const EffectKernels* getNeonEffectKernels() {
+    return nullptr;
+}
+
+#endif
+
+}  // namespace aidl::android::hardware::audio::effect
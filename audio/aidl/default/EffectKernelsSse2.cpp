@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "EffectKernelsImpl.h"
+
+namespace aidl::android::hardware::audio::effect {
+
+#if defined(__x86_64__) || defined(__i386__)
+
+namespace {
+
+constexpr EffectKernels kSse2Kernels = {
+        .name = "sse2",
+        .scale = scale<SseF32x4>,
+        .ramp = ramp<SseF32x4>,
+        .biquads = biquads<SseF32x4, SseF32x2>,
+        .limiter = limiter<SseF32x4, SseF32x2>,
+};
+
+}  // namespace
+
+// SSE2 is part of the baseline of all the x86 ABIs Android supports.
+const EffectKernels* getSse2EffectKernels() {
+    return &kSse2Kernels;
+}
+
+#else  // !(defined(__x86_64__) || defined(__i386__))
+
+const EffectKernels* getSse2EffectKernels() {
+    return nullptr;
+}
+
+#endif
+
+}  // namespace aidl::android::hardware::audio::effect
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 
@@ -29,6 +30,25 @@ using ::android::hardware::EventFlag;
 
 namespace aidl::android::hardware::audio::effect {
 
+namespace {
+
+// Get the address of the sample at index in the transaction, and the number of samples stored
+// contiguously from there.
+float* getContiguous(const EffectContext::DataMQ::MemTransaction& tx, size_t index,
+                     size_t* length) {
+    const auto& first = tx.getFirstRegion();
+    if (index < first.getLength()) {
+        *length = first.getLength() - index;
+        return first.getAddress() + index;
+    }
+    const auto& second = tx.getSecondRegion();
+    index -= first.getLength();
+    *length = second.getLength() - index;
+    return second.getAddress() + index;
+}
+
+}  // namespace
+
 EffectThread::EffectThread() {
     LOG(DEBUG) << __func__;
 }
@@ -143,17 +163,70 @@ void EffectThread::process_l() {
     auto statusMQ = mThreadContext->getStatusFmq();
     auto inputMQ = mThreadContext->getInputDataFmq();
     auto outputMQ = mThreadContext->getOutputDataFmq();
-    auto buffer = mThreadContext->getWorkBuffer();
 
     auto processSamples = inputMQ->availableToRead();
     if (processSamples) {
-        inputMQ->read(buffer, processSamples);
-        IEffect::Status status = effectProcessImpl(buffer, buffer, processSamples);
-        outputMQ->write(buffer, status.fmqProduced);
+        IEffect::Status status;
+        if (!processInFmq_l(processSamples, &status)) {
+            auto buffer = mThreadContext->getWorkBuffer();
+            inputMQ->read(buffer, processSamples);
+            status = effectProcessImpl(buffer, buffer, processSamples);
+            outputMQ->write(buffer, status.fmqProduced);
+        }
         statusMQ->writeBlocking(&status, 1);
         LOG(VERBOSE) << mName << __func__ << ": done processing, effect consumed "
                      << status.fmqConsumed << " produced " << status.fmqProduced;
     }
 }
 
+bool EffectThread::processInFmq_l(size_t samples, IEffect::Status* status) {
+    // An effect changing the frame size doesn't produce as many samples as it consumes.
+    const size_t frameSize = mThreadContext->getInputFrameSize();
+    if (frameSize != mThreadContext->getOutputFrameSize()) {
+        return false;
+    }
+    // Frames are split on sample boundaries below, which needs frames of whole samples.
+    if (frameSize < sizeof(float) || frameSize % sizeof(float) != 0) {
+        return false;
+    }
+
+    auto inputMQ = mThreadContext->getInputDataFmq();
+    auto outputMQ = mThreadContext->getOutputDataFmq();
+    EffectContext::DataMQ::MemTransaction inputTx, outputTx;
+    if (!inputMQ->beginRead(samples, &inputTx) || !outputMQ->beginWrite(samples, &outputTx)) {
+        return false;
+    }
+
+    // The effects process whole frames, so only split the samples where both FMQs wrap around if
+    // that is on a frame boundary, which it is unless the client wrote a partial frame.
+    const size_t frameSamples = frameSize / sizeof(float);
+    if (samples % frameSamples || inputTx.getFirstRegion().getLength() % frameSamples ||
+        outputTx.getFirstRegion().getLength() % frameSamples) {
+        return false;
+    }
+
+    *status = {STATUS_OK, 0, 0};
+    size_t consumed = 0, produced = 0;
+    while (consumed < samples) {
+        size_t inputLength, outputLength;
+        float* in = getContiguous(inputTx, consumed, &inputLength);
+        float* out = getContiguous(outputTx, produced, &outputLength);
+        int chunk = static_cast<int>(std::min(inputLength, outputLength));
+        IEffect::Status chunkStatus = effectProcessImpl(in, out, chunk);
+        if (chunkStatus.status != STATUS_OK) {
+            status->status = chunkStatus.status;
+            break;
+        }
+        consumed += chunk;
+        produced += std::clamp(chunkStatus.fmqProduced, 0, chunk);
+    }
+
+    // Like the copy path, drop the input even if the effect failed to process it.
+    inputMQ->commitRead(samples);
+    outputMQ->commitWrite(produced);
+    status->fmqConsumed = static_cast<int>(consumed);
+    status->fmqProduced = static_cast<int>(produced);
+    return true;
+}
+
 }  // namespace aidl::android::hardware::audio::effect
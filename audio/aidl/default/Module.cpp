@@ -16,11 +16,13 @@
 
 #include <algorithm>
 #include <set>
+#include <sstream>
 
 #define LOG_TAG "AHAL_Module"
 #include <Utils.h>
 #include <aidl/android/media/audio/common/AudioInputFlags.h>
 #include <aidl/android/media/audio/common/AudioOutputFlags.h>
+#include <android-base/file.h>
 #include <android-base/logging.h>
 #include <android/binder_ibinder_platform.h>
 #include <error/expected_utils.h>
@@ -395,6 +397,15 @@ ndk::ScopedAStatus Module::updateStreamsConnectedState(const AudioPatch& oldPatc
     return ndk::ScopedAStatus::ok();
 }
 
+binder_status_t Module::dump(int fd, const char** args, uint32_t numArgs) {
+    std::stringstream ss;
+    ss << "Module " << mType << "\n";
+    if (!::android::base::WriteStringToFd(ss.str(), fd)) {
+        return -errno;
+    }
+    return mStreams.dump(fd, args, numArgs);
+}
+
 ndk::ScopedAStatus Module::setModuleDebug(
         const ::aidl::android::hardware::audio::core::ModuleDebug& in_debug) {
     LOG(DEBUG) << __func__ << ": " << mType << ": old flags:" << mDebug.toString()
@@ -17,7 +17,9 @@
 #include <pthread.h>
 
 #define LOG_TAG "AHAL_Stream"
+#include <android-base/file.h>
 #include <android-base/logging.h>
+#include <android-base/stringprintf.h>
 #include <android/binder_ibinder_platform.h>
 #include <utils/SystemClock.h>
 
@@ -764,6 +766,16 @@ ndk::ScopedAStatus StreamCommonImpl::bluetoothParametersUpdated() {
     return ndk::ScopedAStatus::fromExceptionCode(EX_UNSUPPORTED_OPERATION);
 }
 
+binder_status_t StreamCommonImpl::dumpCommon(int fd, const char** /*args*/, uint32_t /*numArgs*/) {
+    std::string result = ::android::base::StringPrintf(
+            "%s stream on mix port %d, handle %d%s\n", isInput(mMetadata) ? "Input" : "Output",
+            mContext.getPortId(), mContext.getMixPortHandle(), isClosed() ? " (closed)" : "");
+    result.append("  Connected devices: ")
+            .append(::android::internal::ToString(mConnectedDevices))
+            .append("\n");
+    return ::android::base::WriteStringToFd(result, fd) ? STATUS_OK : -errno;
+}
+
 namespace {
 static std::map<AudioDevice, std::string> transformMicrophones(
         const std::vector<MicrophoneInfo>& microphones) {
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <time.h>
+
+#define LOG_TAG "AHAL_StreamPacer"
+#include <android-base/logging.h>
+#include <audio_utils/clock.h>
+
+#include "core-impl/StreamPacer.h"
+
+namespace aidl::android::hardware::audio::core {
+
+void StreamPacer::pace(size_t frameCount) {
+    const int64_t nowNs = getNowNs();
+    const int64_t durationNs = getDueTimeNs(0, frameCount, mSampleRate);
+    if (!mStarted || nowNs - getDueTimeNs(mReferenceNs, mFrames, mSampleRate) > durationNs) {
+        if (mStarted) {
+            LOG(VERBOSE) << __func__ << ": late by more than " << durationNs
+                         << " ns, taking a new reference";
+        }
+        mStarted = true;
+        mReferenceNs = nowNs;
+        mFrames = 0;
+    }
+    mFrames += frameCount;
+    sleepUntil(getDueTimeNs(mReferenceNs, mFrames, mSampleRate));
+}
+
+// static
+int64_t StreamPacer::getDueTimeNs(int64_t referenceNs, int64_t frames, int sampleRate) {
+    // Whole seconds are taken out first, so that 'frames * NANOS_PER_SECOND' can't overflow.
+    return referenceNs + (frames / sampleRate) * NANOS_PER_SECOND +
+           (frames % sampleRate) * NANOS_PER_SECOND / sampleRate;
+}
+
+// static
+int64_t StreamPacer::getNowNs() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return audio_utils_ns_from_timespec(&now);
+}
+
+// static
+void StreamPacer::sleepUntil(int64_t timeNs) {
+    const struct timespec deadline = {.tv_sec = static_cast<time_t>(timeNs / NANOS_PER_SECOND),
+                                      .tv_nsec = static_cast<long>(timeNs % NANOS_PER_SECOND)};
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR) {
+    }
+}
+
+}  // namespace aidl::android::hardware::audio::core
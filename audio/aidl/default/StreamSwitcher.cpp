@@ -260,4 +260,11 @@ ndk::ScopedAStatus StreamSwitcher::bluetoothParametersUpdated() {
     return mStream->bluetoothParametersUpdated();
 }
 
+binder_status_t StreamSwitcher::dumpCommon(int fd, const char** args, uint32_t numArgs) {
+    if (mStream == nullptr) {
+        return STATUS_OK;
+    }
+    return mStream->dumpCommon(fd, args, numArgs);
+}
+
 }  // namespace aidl::android::hardware::audio::core
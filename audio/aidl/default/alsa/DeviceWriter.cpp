@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <pthread.h>
+#include <sys/resource.h>
+
+#define LOG_TAG "AHAL_AlsaDeviceWriter"
+#include <android-base/logging.h>
+
+#include "DeviceWriter.h"
+
+namespace aidl::android::hardware::audio::core::alsa {
+
+DeviceWriter::DeviceWriter(WriteFunction write) : mWrite(std::move(write)) {
+    int policy = SCHED_OTHER;
+    struct sched_param param = {.sched_priority = 0};
+    if (int err = pthread_getschedparam(pthread_self(), &policy, &param); err != 0) {
+        LOG(WARNING) << __func__ << ": failed to get the scheduling policy: " << err;
+    }
+    const int nice = getpriority(PRIO_PROCESS, 0);
+    mThread = std::thread(&DeviceWriter::threadLoop, this, policy, param, nice);
+}
+
+DeviceWriter::~DeviceWriter() {
+    {
+        std::lock_guard guard(mLock);
+        mExit = true;
+    }
+    mWriteRequested.notify_one();
+    mThread.join();
+}
+
+void DeviceWriter::startWrite(const void* buffer, size_t bytes) {
+    {
+        std::lock_guard guard(mLock);
+        mBuffer = buffer;
+        mBytes = bytes;
+    }
+    mWriteRequested.notify_one();
+}
+
+int DeviceWriter::waitForWrite() {
+    std::unique_lock lock(mLock);
+    ::android::base::ScopedLockAssertion lock_assertion(mLock);
+    mWriteDone.wait(lock, [&]() REQUIRES(mLock) { return mBuffer == nullptr; });
+    return mResult;
+}
+
+void DeviceWriter::threadLoop(int policy, struct sched_param param, int nice) {
+    pthread_setname_np(pthread_self(), "alsa_writer");
+    if (policy != SCHED_OTHER) {
+        if (int err = pthread_setschedparam(pthread_self(), policy, &param); err != 0) {
+            LOG(WARNING) << __func__ << ": failed to set the scheduling policy: " << err;
+        }
+    } else if (setpriority(PRIO_PROCESS, 0, nice) != 0) {
+        PLOG(WARNING) << __func__ << ": failed to set the priority";
+    }
+
+    std::unique_lock lock(mLock);
+    ::android::base::ScopedLockAssertion lock_assertion(mLock);
+    while (true) {
+        mWriteRequested.wait(lock, [&]() REQUIRES(mLock) { return mExit || mBuffer != nullptr; });
+        if (mExit) {
+            return;
+        }
+        const void* buffer = mBuffer;
+        const size_t bytes = mBytes;
+        lock.unlock();
+        const int result = mWrite(buffer, bytes);
+        lock.lock();
+        mResult = result;
+        mBuffer = nullptr;
+        mWriteDone.notify_one();
+    }
+}
+
+}  // namespace aidl::android::hardware::audio::core::alsa
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <android-base/thread_annotations.h>
+
+namespace aidl::android::hardware::audio::core::alsa {
+
+// Writes to an output device from a thread of its own, so that a stream can write to several
+// devices at once. The thread runs with the scheduling policy and priority of the thread which
+// created the writer, normally the stream worker.
+class DeviceWriter {
+  public:
+    // Writes the buffer to the device, returns 0 or a negative error code.
+    using WriteFunction = std::function<int(const void* buffer, size_t bytes)>;
+
+    explicit DeviceWriter(WriteFunction write);
+    ~DeviceWriter();
+
+    // Starts writing the buffer to the device. The buffer must stay valid until 'waitForWrite'
+    // returns, and 'waitForWrite' must be called before the next write.
+    void startWrite(const void* buffer, size_t bytes);
+    // Blocks until the last write is complete and returns its result.
+    int waitForWrite();
+
+  private:
+    void threadLoop(int policy, struct sched_param param, int nice);
+
+    const WriteFunction mWrite;
+    std::mutex mLock;
+    std::condition_variable mWriteRequested;
+    std::condition_variable mWriteDone;
+    const void* mBuffer GUARDED_BY(mLock) = nullptr;
+    size_t mBytes GUARDED_BY(mLock) = 0;
+    int mResult GUARDED_BY(mLock) = 0;
+    bool mExit GUARDED_BY(mLock) = false;
+    std::thread mThread;
+};
+
+}  // namespace aidl::android::hardware::audio::core::alsa
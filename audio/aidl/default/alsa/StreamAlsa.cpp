@@ -14,10 +14,13 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <sstream>
 
 #define LOG_TAG "AHAL_StreamAlsa"
+#include <android-base/file.h>
 #include <android-base/logging.h>
 
 #include <Utils.h>
@@ -60,6 +63,7 @@ StreamAlsa::StreamAlsa(StreamContext* context, const Metadata& metadata, int rea
 }
 
 ::android::status_t StreamAlsa::standby() {
+    mDeviceWriters.clear();
     mAlsaDeviceProxies.clear();
     return ::android::OK;
 }
@@ -70,7 +74,8 @@ StreamAlsa::StreamAlsa(StreamContext* context, const Metadata& metadata, int rea
         return ::android::OK;
     }
     decltype(mAlsaDeviceProxies) alsaDeviceProxies;
-    for (const auto& device : getDeviceProfiles()) {
+    const auto deviceProfiles = getDeviceProfiles();
+    for (const auto& device : deviceProfiles) {
         alsa::DeviceProxy proxy;
         if (device.isExternal) {
             // Always ask alsa configure as required since the configuration should be supported
@@ -89,6 +94,32 @@ StreamAlsa::StreamAlsa(StreamContext* context, const Metadata& metadata, int rea
         alsaDeviceProxies.push_back(std::move(proxy));
     }
     mAlsaDeviceProxies = std::move(alsaDeviceProxies);
+    if (!mIsInput) {
+        for (size_t i = 1; i < mAlsaDeviceProxies.size(); ++i) {
+            mDeviceWriters.push_back(std::make_unique<alsa::DeviceWriter>(
+                    [proxy = mAlsaDeviceProxies[i].get(), retries = mReadWriteRetries](
+                            const void* buffer, size_t bytes) {
+                        return proxy_write_with_retries(proxy, buffer, bytes, retries);
+                    }));
+        }
+    }
+    mProxyXruns.assign(mAlsaDeviceProxies.size(), 0);
+
+    // Keep counting the xruns of the devices which were already used before standby.
+    std::lock_guard guard(mStatsLock);
+    decltype(mDeviceStats) deviceStats;
+    for (const auto& device : deviceProfiles) {
+        auto sameDevice = [&device](const DeviceStats& stats) {
+            return stats.device.card == device.card && stats.device.device == device.device;
+        };
+        if (auto it = std::find_if(mDeviceStats.begin(), mDeviceStats.end(), sameDevice);
+            it != mDeviceStats.end()) {
+            deviceStats.push_back(*it);
+        } else {
+            deviceStats.push_back({device, 0, 0});
+        }
+    }
+    mDeviceStats = std::move(deviceStats);
     return ::android::OK;
 }
 
@@ -99,21 +130,22 @@ StreamAlsa::StreamAlsa(StreamContext* context, const Metadata& metadata, int rea
         return ::android::NO_INIT;
     }
     const size_t bytesToTransfer = frameCount * mFrameSizeBytes;
-    unsigned maxLatency = 0;
     if (mIsInput) {
         // For input case, only support single device.
         proxy_read_with_retries(mAlsaDeviceProxies[0].get(), buffer, bytesToTransfer,
                                 mReadWriteRetries);
-        maxLatency = proxy_get_latency(mAlsaDeviceProxies[0].get());
     } else {
-        for (auto& proxy : mAlsaDeviceProxies) {
-            proxy_write_with_retries(proxy.get(), buffer, bytesToTransfer, mReadWriteRetries);
-            maxLatency = std::max(maxLatency, proxy_get_latency(proxy.get()));
+        for (auto& writer : mDeviceWriters) {
+            writer->startWrite(buffer, bytesToTransfer);
+        }
+        proxy_write_with_retries(mAlsaDeviceProxies[0].get(), buffer, bytesToTransfer,
+                                 mReadWriteRetries);
+        for (auto& writer : mDeviceWriters) {
+            writer->waitForWrite();
         }
     }
     *actualFrameCount = frameCount;
-    maxLatency = std::min(maxLatency, static_cast<unsigned>(std::numeric_limits<int32_t>::max()));
-    *latencyMs = maxLatency;
+    *latencyMs = updateDeviceStats();
     return ::android::OK;
 }
 
@@ -152,7 +184,47 @@ StreamAlsa::StreamAlsa(StreamContext* context, const Metadata& metadata, int rea
 }
 
 void StreamAlsa::shutdown() {
+    mDeviceWriters.clear();
     mAlsaDeviceProxies.clear();
 }
 
+std::vector<StreamAlsa::DeviceStats> StreamAlsa::getDeviceStats() {
+    std::lock_guard guard(mStatsLock);
+    return mDeviceStats;
+}
+
+binder_status_t StreamAlsa::dumpCommon(int fd, const char** args, uint32_t numArgs) {
+    if (binder_status_t status = StreamCommonImpl::dumpCommon(fd, args, numArgs);
+        status != STATUS_OK) {
+        return status;
+    }
+    std::stringstream ss;
+    for (const auto& stats : getDeviceStats()) {
+        ss << "  ALSA device " << stats.device << ": " << stats.xruns << " xrun(s), latency "
+           << stats.latencyMs << " ms\n";
+    }
+    return ::android::base::WriteStringToFd(ss.str(), fd) ? STATUS_OK : -errno;
+}
+
+int32_t StreamAlsa::updateDeviceStats() {
+    unsigned maxLatency = 0;
+    std::lock_guard guard(mStatsLock);
+    for (size_t i = 0; i < mAlsaDeviceProxies.size(); ++i) {
+        alsa_device_proxy* proxy = mAlsaDeviceProxies[i].get();
+        const unsigned latency =
+                std::min(proxy_get_latency(proxy),
+                         static_cast<unsigned>(std::numeric_limits<int32_t>::max()));
+        const int xruns = pcm_get_xruns(proxy->pcm);
+        if (xruns > mProxyXruns[i]) {
+            LOG(WARNING) << __func__ << ": " << xruns - mProxyXruns[i] << " xrun(s) on device "
+                         << mDeviceStats[i].device;
+        }
+        mDeviceStats[i].xruns += xruns - mProxyXruns[i];
+        mDeviceStats[i].latencyMs = static_cast<int32_t>(latency);
+        mProxyXruns[i] = xruns;
+        maxLatency = std::max(maxLatency, latency);
+    }
+    return static_cast<int32_t>(maxLatency);
+}
+
 }  // namespace aidl::android::hardware::audio::core
@@ -164,12 +164,8 @@ RetCode BassBoostSw::releaseContext() {
 
 // Processing method running in EffectWorker thread.
 IEffect::Status BassBoostSw::effectProcessImpl(float* in, float* out, int samples) {
-    // TODO: get data buffer and process.
-    LOG(DEBUG) << __func__ << " in " << in << " out " << out << " samples " << samples;
-    for (int i = 0; i < samples; i++) {
-        *out++ = *in++;
-    }
-    return {STATUS_OK, samples, samples};
+    RETURN_VALUE_IF(!mContext, (IEffect::Status{EX_NULL_POINTER, 0, 0}), "nullContext");
+    return mContext->process(in, out, samples);
 }
 
 RetCode BassBoostSwContext::setBbStrengthPm(int strength) {
@@ -177,4 +173,23 @@ RetCode BassBoostSwContext::setBbStrengthPm(int strength) {
     return RetCode::SUCCESS;
 }
 
+IEffect::Status BassBoostSwContext::process(float* in, float* out, int samples) {
+    const size_t channels = ::aidl::android::hardware::audio::common::getChannelCount(
+            mCommon.input.base.channelMask);
+    RETURN_VALUE_IF(channels == 0, (IEffect::Status{EX_ILLEGAL_STATE, 0, 0}), "noChannels");
+
+    const int strength = mStrength;
+    const int sampleRate = mCommon.input.base.sampleRate;
+    if (strength != mFilterStrength || channels != mFilterChannels ||
+        sampleRate != mFilterSampleRate) {
+        mFilter.setStages(channels, {makeLowShelf(sampleRate, kBoostFrequency,
+                                                  kMaxBoostDb * strength / 1000.f)});
+        mFilterStrength = strength;
+        mFilterChannels = channels;
+        mFilterSampleRate = sampleRate;
+    }
+    mFilter.process(in, out, samples / channels);
+    return {STATUS_OK, samples, samples};
+}
+
 }  // namespace aidl::android::hardware::audio::effect
@@ -18,10 +18,12 @@
 
 #include <aidl/android/hardware/audio/effect/BnEffect.h>
 #include <fmq/AidlMessageQueue.h>
+#include <atomic>
 #include <cstdlib>
 #include <memory>
 
 #include "effect-impl/EffectImpl.h"
+#include "effect-impl/EffectKernels.h"
 
 namespace aidl::android::hardware::audio::effect {
 
@@ -35,8 +37,20 @@ class BassBoostSwContext final : public EffectContext {
     RetCode setBbStrengthPm(int strength);
     int getBbStrengthPm() const { return mStrength; }
 
+    IEffect::Status process(float* in, float* out, int samples);
+
   private:
-    int mStrength = 0;
+    // The boost is a low shelf, raised by up to kMaxBoostDb at full strength.
+    static constexpr float kBoostFrequency = 100.f;
+    static constexpr float kMaxBoostDb = 12.f;
+
+    std::atomic<int> mStrength = 0;
+
+    // Only used by the processing thread.
+    BiquadCascade mFilter;
+    int mFilterStrength = -1;
+    size_t mFilterChannels = 0;
+    int mFilterSampleRate = 0;
 };
 
 class BassBoostSw final : public EffectImpl {
@@ -15,6 +15,7 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <set>
 #include <unordered_set>
@@ -273,15 +274,69 @@ RetCode DynamicsProcessingSw::releaseContext() {
 
 // Processing method running in EffectWorker thread.
 IEffect::Status DynamicsProcessingSw::effectProcessImpl(float* in, float* out, int samples) {
-    // TODO: get data buffer and process.
-    LOG(DEBUG) << __func__ << " in " << in << " out " << out << " samples " << samples;
-    for (int i = 0; i < samples; i++) {
-        *out++ = *in++;
+    RETURN_VALUE_IF(!mContext, (IEffect::Status{EX_NULL_POINTER, 0, 0}), "nullContext");
+    return mContext->process(in, out, samples);
+}
+
+IEffect::Status DynamicsProcessingSwContext::process(float* in, float* out, int samples) {
+    const int sampleRate = mCommon.input.base.sampleRate;
+    if (mLimiterChanged.exchange(false) || sampleRate != mLimiter.sampleRate) {
+        updateLimiter(sampleRate);
     }
+    RETURN_VALUE_IF(mLimiter.channels == 0, (IEffect::Status{EX_ILLEGAL_STATE, 0, 0}),
+                    "noChannels");
+
+    const LimiterChannels limiter = {
+            .inputGain = mLimiter.inputGain.data(),
+            .invThreshold = mLimiter.invThreshold.data(),
+            .slope = mLimiter.slope.data(),
+            .attack = mLimiter.attack.data(),
+            .release = mLimiter.release.data(),
+            .outputGain = mLimiter.outputGain.data(),
+            .envelope = mLimiter.envelope.data(),
+    };
+    getEffectKernels().limiter(in, out, samples / mLimiter.channels, mLimiter.channels, limiter);
     return {STATUS_OK, samples, samples};
 }
 
+// Channels without a limiter, or with a ratio that doesn't compress, get a slope of 0 so the
+// kernel only applies their gains. The link groups aren't supported, each channel is limited on
+// its own level.
+void DynamicsProcessingSwContext::updateLimiter(int sampleRate) {
+    const auto dbToAmplitude = [](float db) { return std::pow(10.f, db / 20.f); };
+
+    std::lock_guard lg(mMutex);
+    if (mLimiter.channels != mChannelCount) {
+        mLimiter.channels = mChannelCount;
+        mLimiter.inputGain.resize(mChannelCount);
+        mLimiter.invThreshold.resize(mChannelCount);
+        mLimiter.slope.resize(mChannelCount);
+        mLimiter.attack.resize(mChannelCount);
+        mLimiter.release.resize(mChannelCount);
+        mLimiter.outputGain.resize(mChannelCount);
+        mLimiter.envelope.assign(mChannelCount, 0.f);
+    }
+    mLimiter.sampleRate = sampleRate;
+
+    for (size_t channel = 0; channel < mChannelCount; channel++) {
+        const auto& gain = mInputGainCfgs[channel];
+        mLimiter.inputGain[channel] =
+                gain.channel == kInvalidChannelId ? 1.f : dbToAmplitude(gain.gainDb);
+
+        const auto& cfg = mLimiterCfgs[channel];
+        const bool enabled =
+                mEngineSettings.limiterInUse && cfg.channel != kInvalidChannelId && cfg.enable;
+        mLimiter.invThreshold[channel] = enabled ? 1.f / dbToAmplitude(cfg.thresholdDb) : 1.f;
+        mLimiter.slope[channel] = enabled && cfg.ratio > 1.f ? 1.f / cfg.ratio - 1.f : 0.f;
+        mLimiter.attack[channel] = limiterCoef(sampleRate, enabled ? cfg.attackTimeMs : 0.f);
+        mLimiter.release[channel] = limiterCoef(sampleRate, enabled ? cfg.releaseTimeMs : 0.f);
+        mLimiter.outputGain[channel] = enabled ? dbToAmplitude(cfg.postGainDb) : 1.f;
+    }
+}
+
 RetCode DynamicsProcessingSwContext::setCommon(const Parameter::Common& common) {
+    std::lock_guard lg(mMutex);
+    mLimiterChanged = true;
     mCommon = common;
     mChannelCount = ::aidl::android::hardware::audio::common::getChannelCount(
             common.input.base.channelMask);
@@ -300,6 +355,8 @@ RetCode DynamicsProcessingSwContext::setEngineArchitecture(
         LOG(INFO) << __func__ << " not change in engine, do nothing";
         return RetCode::SUCCESS;
     }
+    std::lock_guard lg(mMutex);
+    mLimiterChanged = true;
     mEngineSettings = cfg;
     resizeBands();
     return RetCode::SUCCESS;
@@ -418,6 +475,8 @@ RetCode DynamicsProcessingSwContext::setLimiterCfgs(
     RetCode ret = RetCode::SUCCESS;
     std::unordered_set<int> channelSet;
 
+    std::lock_guard lg(mMutex);
+    mLimiterChanged = true;
     for (auto& it : cfgs) {
         if (0 != channelSet.count(it.channel)) {
             LOG(WARNING) << __func__ << " duplicated channel " << it.channel;
@@ -470,6 +529,8 @@ void DynamicsProcessingSwContext::resizeBands() {
 
 RetCode DynamicsProcessingSwContext::setInputGainCfgs(
         const std::vector<DynamicsProcessing::InputGain>& cfgs) {
+    std::lock_guard lg(mMutex);
+    mLimiterChanged = true;
     for (const auto& cfg : cfgs) {
         RETURN_VALUE_IF(cfg.channel < 0 || (size_t)cfg.channel >= mChannelCount,
                         RetCode::ERROR_ILLEGAL_PARAMETER, "invalidChannel");
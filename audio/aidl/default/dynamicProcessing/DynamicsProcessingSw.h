@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <Utils.h>
@@ -25,6 +27,7 @@
 #include <fmq/AidlMessageQueue.h>
 
 #include "effect-impl/EffectImpl.h"
+#include "effect-impl/EffectKernels.h"
 
 namespace aidl::android::hardware::audio::effect {
 
@@ -37,7 +40,8 @@ class DynamicsProcessingSwContext final : public EffectContext {
           mPreEqChCfgs(mChannelCount, {.channel = kInvalidChannelId}),
           mPostEqChCfgs(mChannelCount, {.channel = kInvalidChannelId}),
           mMbcChCfgs(mChannelCount, {.channel = kInvalidChannelId}),
-          mLimiterCfgs(mChannelCount, {.channel = kInvalidChannelId}) {
+          mLimiterCfgs(mChannelCount, {.channel = kInvalidChannelId}),
+          mInputGainCfgs(mChannelCount, {.channel = kInvalidChannelId}) {
         LOG(DEBUG) << __func__;
     }
 
@@ -74,6 +78,9 @@ class DynamicsProcessingSwContext final : public EffectContext {
     std::vector<DynamicsProcessing::LimiterConfig> getLimiterCfgs() { return mLimiterCfgs; }
     std::vector<DynamicsProcessing::InputGain> getInputGainCfgs();
 
+    // Applies the input gains and the limiters, the other stages aren't implemented.
+    IEffect::Status process(float* in, float* out, int samples);
+
   private:
     static constexpr int32_t kInvalidChannelId = -1;
     size_t mChannelCount = 0;
@@ -88,6 +95,27 @@ class DynamicsProcessingSwContext final : public EffectContext {
     std::vector<DynamicsProcessing::EqBandConfig> mPreEqChBands;
     std::vector<DynamicsProcessing::EqBandConfig> mPostEqChBands;
     std::vector<DynamicsProcessing::MbcBandConfig> mMbcChBands;
+
+    // Held by the setters of the configuration used for processing, and by the processing thread
+    // while it reads that configuration.
+    std::mutex mMutex;
+    std::atomic<bool> mLimiterChanged = true;
+
+    // The input gains and limiters in the layout of LimiterChannels, only used by the processing
+    // thread.
+    struct Limiter {
+        int sampleRate = 0;
+        size_t channels = 0;
+        std::vector<float> inputGain;
+        std::vector<float> invThreshold;
+        std::vector<float> slope;
+        std::vector<float> attack;
+        std::vector<float> release;
+        std::vector<float> outputGain;
+        std::vector<float> envelope;
+    } mLimiter;
+
+    void updateLimiter(int sampleRate);
     bool validateStageEnablement(const DynamicsProcessing::StageEnablement& enablement);
     bool validateEngineConfig(const DynamicsProcessing::EngineArchitecture& engine);
     bool validateEqBandConfig(const DynamicsProcessing::EqBandConfig& band, int maxChannel,
@@ -211,12 +211,44 @@ RetCode EqualizerSw::releaseContext() {
 
 // Processing method running in EffectWorker thread.
 IEffect::Status EqualizerSw::effectProcessImpl(float* in, float* out, int samples) {
-    // TODO: get data buffer and process.
-    LOG(DEBUG) << __func__ << " in " << in << " out " << out << " samples " << samples;
-    for (int i = 0; i < samples; i++) {
-        *out++ = *in++;
+    RETURN_VALUE_IF(!mContext, (IEffect::Status{EX_NULL_POINTER, 0, 0}), "nullContext");
+    return mContext->process(in, out, samples);
+}
+
+IEffect::Status EqualizerSwContext::process(float* in, float* out, int samples) {
+    const size_t channels = ::aidl::android::hardware::audio::common::getChannelCount(
+            mCommon.input.base.channelMask);
+    RETURN_VALUE_IF(channels == 0, (IEffect::Status{EX_ILLEGAL_STATE, 0, 0}), "noChannels");
+
+    const int sampleRate = mCommon.input.base.sampleRate;
+    if (mBandLevelsChanged.exchange(false) || channels != mFilterChannels ||
+        sampleRate != mFilterSampleRate) {
+        updateFilters(channels, sampleRate);
     }
+    mFilters.process(in, out, samples / channels);
     return {STATUS_OK, samples, samples};
 }
 
+// Shelves for the outer bands, so they also apply to the frequencies beyond their center.
+void EqualizerSwContext::updateFilters(size_t channels, int sampleRate) {
+    std::vector<BiquadCoefs> stages;
+    {
+        std::lock_guard lg(mMutex);
+        for (int band = 0; band < kMaxBandNumber; band++) {
+            const float frequency = kPresetsFrequencies[band];
+            const float gainDb = mBandLevels[band] / 100.f;
+            if (band == 0) {
+                stages.push_back(makeLowShelf(sampleRate, frequency, gainDb));
+            } else if (band == kMaxBandNumber - 1) {
+                stages.push_back(makeHighShelf(sampleRate, frequency, gainDb));
+            } else {
+                stages.push_back(makePeaking(sampleRate, frequency, gainDb, kBandQ));
+            }
+        }
+    }
+    mFilters.setStages(channels, stages);
+    mFilterChannels = channels;
+    mFilterSampleRate = sampleRate;
+}
+
 }  // namespace aidl::android::hardware::audio::effect
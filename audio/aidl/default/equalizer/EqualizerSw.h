@@ -17,11 +17,15 @@
 #pragma once
 
 #include <aidl/android/hardware/audio/effect/BnEffect.h>
+#include <android-base/thread_annotations.h>
 #include <fmq/AidlMessageQueue.h>
+#include <atomic>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 
 #include "effect-impl/EffectImpl.h"
+#include "effect-impl/EffectKernels.h"
 
 namespace aidl::android::hardware::audio::effect {
 
@@ -47,6 +51,7 @@ class EqualizerSwContext final : public EffectContext {
             return RetCode::ERROR_ILLEGAL_PARAMETER;
         }
         RetCode ret = RetCode::SUCCESS;
+        std::lock_guard lg(mMutex);
         for (auto& it : bandLevels) {
             if (it.index >= kMaxBandNumber || it.index < 0) {
                 LOG(ERROR) << __func__ << " index illegal, skip: " << it.index << " - "
@@ -56,10 +61,12 @@ class EqualizerSwContext final : public EffectContext {
                 mBandLevels[it.index] = it.levelMb;
             }
         }
+        mBandLevelsChanged = true;
         return ret;
     }
 
     std::vector<Equalizer::BandLevel> getEqBandLevels() {
+        std::lock_guard lg(mMutex);
         std::vector<Equalizer::BandLevel> bandLevels;
         for (int i = 0; i < kMaxBandNumber; i++) {
             bandLevels.push_back({i, mBandLevels[i]});
@@ -74,14 +81,25 @@ class EqualizerSwContext final : public EffectContext {
     static const int kMaxPresetNumber = 10;
     static const int kCustomPreset = -1;
 
+    IEffect::Status process(float* in, float* out, int samples);
+
   private:
     static constexpr std::array<uint16_t, kMaxBandNumber> kPresetsFrequencies = {60, 230, 910, 3600,
                                                                                  14000};
+    // The bands are two octaves apart, each peaking band is as wide.
+    static constexpr float kBandQ = 2.f / 3;
     // preset band level
     int mPreset = kCustomPreset;
-    int32_t mBandLevels[kMaxBandNumber] = {3, 0, 0, 0, 3};
+    std::mutex mMutex;
+    int32_t mBandLevels[kMaxBandNumber] GUARDED_BY(mMutex) = {3, 0, 0, 0, 3};
+    std::atomic<bool> mBandLevelsChanged = true;
+
+    // Only used by the processing thread.
+    BiquadCascade mFilters;
+    size_t mFilterChannels = 0;
+    int mFilterSampleRate = 0;
 
-    // Add equalizer specific context for processing here
+    void updateFilters(size_t channels, int sampleRate);
 };
 
 class EqualizerSw final : public EffectImpl {
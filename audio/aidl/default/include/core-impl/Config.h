@@ -29,10 +29,11 @@ class Config : public BnConfig {
     ndk::ScopedAStatus getSurroundSoundConfig(SurroundSoundConfig* _aidl_return) override;
     ndk::ScopedAStatus getEngineConfig(
             aidl::android::media::audio::common::AudioHalEngineConfig* _aidl_return) override;
-    internal::AudioPolicyConfigXmlConverter mAudioPolicyConverter{
-            ::android::audio_get_audio_policy_config_file()};
-    internal::EngineConfigXmlConverter mEngConfigConverter{
-            ::android::audio_find_readable_configuration_file(kEngineConfigFileName.c_str())};
+
+    // The converters parse the XML files on first use, which only happens when the configuration
+    // is not in the cache.
+    static internal::AudioPolicyConfigXmlConverter& getAudioPolicyConverter();
+    static internal::EngineConfigXmlConverter& getEngConfigConverter();
 };
 
 }  // namespace aidl::android::hardware::audio::core
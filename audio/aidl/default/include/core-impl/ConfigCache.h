@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <android/binder_parcel.h>
+
+namespace aidl::android::hardware::audio::core::internal {
+
+// Caches a configuration converted from XML files, so that the files only need to be parsed
+// again when they change.
+//
+// The configuration is serialized into a parcel, which is stored in '<cacheDir>/<name>.cache'
+// behind a header holding a key and a checksum of the parcel. The key is a hash of the contents
+// of the source files, of the files they include with XInclude, and of the vendor and system
+// build fingerprints. The vendor fingerprint covers the HAL binary and the other files of the
+// vendor partition the conversion may depend on. The system fingerprint covers libbinder_ndk:
+// the format of a marshalled parcel is private to it and is not guaranteed to be stable, so a
+// cache written by one system image must not be read by another one. Any update of the system
+// image thus invalidates the cache, and an update which would change the format without changing
+// the fingerprint would make the cache fail to unmarshal or to read, in which case it is ignored.
+// The cache file is mapped into memory and unmarshalled on load, and is ignored if anything does
+// not match.
+//
+// Caching is best effort, and is only enabled if the cache directory exists and is writable.
+// The HAL does not create the directory: a device enabling the cache must create it from its
+// init scripts and label it with sepolicy which allows the HAL to write there. Otherwise the
+// configuration is created every time, as it would be without the cache.
+class ConfigCache {
+  public:
+    static constexpr const char* kDefaultCacheDir = "/data/vendor/audio";
+
+    ConfigCache(const std::string& name, const std::vector<std::string>& sourceFiles,
+                const std::string& cacheDir = kDefaultCacheDir);
+
+    // Fills in the configuration from the cache, if the cache is valid. Otherwise calls create(),
+    // which must fill in the whole configuration, and stores the result in the cache unless
+    // create() returns false. Logs how long getting the configuration took.
+    //
+    // 'T' must be serializable the way AIDL parcelables are.
+    template <typename T>
+    void getOrCreate(T* config, const std::function<bool(T*)>& create) {
+        getOrCreate([config](const AParcel* parcel) { return config->readFromParcel(parcel); },
+                    [config, &create]() { return create(config); },
+                    [config](AParcel* parcel) { return config->writeToParcel(parcel); });
+    }
+
+    void getOrCreate(const std::function<binder_status_t(const AParcel*)>& read,
+                     const std::function<bool()>& create,
+                     const std::function<binder_status_t(AParcel*)>& write);
+
+    // Lower level interface, returns whether the configuration was read from the cache.
+    bool load(const std::function<binder_status_t(const AParcel*)>& read) const;
+    bool store(const std::function<binder_status_t(AParcel*)>& write) const;
+
+    uint64_t getKey() const { return mKey; }
+    const std::string& getCacheFile() const { return mCacheFile; }
+
+  private:
+    const std::string mName;
+    const std::string mCacheDir;
+    const std::string mCacheFile;
+    const uint64_t mKey;
+};
+
+}  // namespace aidl::android::hardware::audio::core::internal
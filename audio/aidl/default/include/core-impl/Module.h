@@ -40,6 +40,9 @@ class Module : public BnModule {
 
     explicit Module(Type type) : mType(type) {}
 
+    // Writes the state of the open streams for 'dumpsys'.
+    binder_status_t dump(int fd, const char** args, uint32_t numArgs) override;
+
     typedef std::tuple<std::weak_ptr<IBluetooth>, std::weak_ptr<IBluetoothA2dp>,
                        std::weak_ptr<IBluetoothLe>>
             BtProfileHandles;
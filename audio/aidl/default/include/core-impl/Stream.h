@@ -22,6 +22,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <variant>
 
 #include <StreamWorker.h>
@@ -359,6 +360,8 @@ struct StreamCommonInterface {
     virtual ndk::ScopedAStatus setConnectedDevices(
             const std::vector<::aidl::android::media::audio::common::AudioDevice>& devices) = 0;
     virtual ndk::ScopedAStatus bluetoothParametersUpdated() = 0;
+    // Called from 'dump' of 'IModule', 'IStreamIn' and 'IStreamOut'.
+    virtual binder_status_t dumpCommon(int fd, const char** args, uint32_t numArgs) = 0;
 };
 
 // This is equivalent to automatically generated 'IStreamCommonDelegator' but uses
@@ -460,6 +463,7 @@ class StreamCommonImpl : virtual public StreamCommonInterface, virtual public Dr
             const std::vector<::aidl::android::media::audio::common::AudioDevice>& devices)
             override;
     ndk::ScopedAStatus bluetoothParametersUpdated() override;
+    binder_status_t dumpCommon(int fd, const char** args, uint32_t numArgs) override;
 
   protected:
     static StreamWorkerInterface::CreateInstance getDefaultInWorkerCreator() {
@@ -496,6 +500,9 @@ class StreamIn : virtual public StreamCommonInterface, public BnStreamIn {
                                               in_sinkMetadata) override {
         return updateMetadataCommon(in_sinkMetadata);
     }
+    binder_status_t dump(int fd, const char** args, uint32_t numArgs) override {
+        return dumpCommon(fd, args, numArgs);
+    }
     ndk::ScopedAStatus getActiveMicrophones(
             std::vector<::aidl::android::media::audio::common::MicrophoneDynamicInfo>* _aidl_return)
             override;
@@ -538,6 +545,9 @@ class StreamOut : virtual public StreamCommonInterface, public BnStreamOut {
             override {
         return updateMetadataCommon(in_sourceMetadata);
     }
+    binder_status_t dump(int fd, const char** args, uint32_t numArgs) override {
+        return dumpCommon(fd, args, numArgs);
+    }
     ndk::ScopedAStatus updateOffloadMetadata(
             const ::aidl::android::hardware::audio::common::AudioOffloadMetadata&
                     in_offloadMetadata) override;
@@ -617,6 +627,11 @@ class StreamWrapper {
         if (s) return s->bluetoothParametersUpdated();
         return ndk::ScopedAStatus::ok();
     }
+    binder_status_t dump(int fd, const char** args, uint32_t numArgs) const {
+        auto s = mStream.lock();
+        if (s) return s->dumpCommon(fd, args, numArgs);
+        return STATUS_OK;
+    }
 
   private:
     std::weak_ptr<StreamCommonInterface> mStream;
@@ -653,6 +668,19 @@ class Streams {
         return isOk ? ndk::ScopedAStatus::ok()
                     : ndk::ScopedAStatus::fromExceptionCode(EX_UNSUPPORTED_OPERATION);
     }
+    binder_status_t dump(int fd, const char** args, uint32_t numArgs) const {
+        // Each stream is mapped both from its port id and its port config id.
+        std::set<AIBinder*> dumped;
+        for (const auto& it : mStreams) {
+            if (!it.second.isStreamOpen() || !dumped.insert(it.second.getBinder().get()).second) {
+                continue;
+            }
+            if (binder_status_t status = it.second.dump(fd, args, numArgs); status != STATUS_OK) {
+                return status;
+            }
+        }
+        return STATUS_OK;
+    }
 
   private:
     // Maps port ids and port config ids to streams. Multimap because a port
@@ -16,10 +16,15 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <vector>
 
+#include <android-base/thread_annotations.h>
+
 #include "Stream.h"
+#include "alsa/DeviceWriter.h"
 #include "alsa/Utils.h"
 
 namespace aidl::android::hardware::audio::core {
@@ -31,6 +36,14 @@ namespace aidl::android::hardware::audio::core {
 // provide necessary overrides for all interface methods omitted here.
 class StreamAlsa : public StreamCommonImpl {
   public:
+    struct DeviceStats {
+        alsa::DeviceProfile device;
+        // The number of xruns on the device since the stream first used it.
+        int64_t xruns;
+        // The latency of the device as of the last transfer.
+        int32_t latencyMs;
+    };
+
     StreamAlsa(StreamContext* context, const Metadata& metadata, int readWriteRetries);
     // Methods of 'DriverInterface'.
     ::android::status_t init() override;
@@ -44,6 +57,12 @@ class StreamAlsa : public StreamCommonImpl {
     ::android::status_t refinePosition(StreamDescriptor::Position* position) override;
     void shutdown() override;
 
+    // Adds the stats of the devices to the dump of the stream.
+    binder_status_t dumpCommon(int fd, const char** args, uint32_t numArgs) override;
+
+    // Returns the stats of the devices used by the stream. Can be called from any thread.
+    std::vector<DeviceStats> getDeviceStats();
+
   protected:
     // Called from 'start' to initialize 'mAlsaDeviceProxies', the vector must be non-empty.
     virtual std::vector<alsa::DeviceProfile> getDeviceProfiles() = 0;
@@ -56,6 +75,19 @@ class StreamAlsa : public StreamCommonImpl {
     const int mReadWriteRetries;
     // All fields below are only used on the worker thread.
     std::vector<alsa::DeviceProxy> mAlsaDeviceProxies;
+
+  private:
+    int32_t updateDeviceStats();
+
+    // When writing to several devices, the worker writes to the first device itself while these
+    // write to the others, so that a transfer takes as long as the slowest device rather than as
+    // long as all the devices together.
+    std::vector<std::unique_ptr<alsa::DeviceWriter>> mDeviceWriters;
+    // The xrun count of each proxy as of the last transfer.
+    std::vector<int> mProxyXruns;
+
+    std::mutex mStatsLock;
+    std::vector<DeviceStats> mDeviceStats GUARDED_BY(mStatsLock);
 };
 
 }  // namespace aidl::android::hardware::audio::core
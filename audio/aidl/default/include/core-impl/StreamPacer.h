@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace aidl::android::hardware::audio::core {
+
+// Paces the transfers of a stream which has no hardware clock to block on.
+//
+// Rather than sleeping for the duration of each transfer, which accumulates the scheduling delay
+// of every wakeup, the pacer sleeps until the absolute time at which all the frames transferred
+// since the reference are due. The reference is taken by the first transfer after a reset, so
+// that the stream keeps the nominal rate on average however late the thread wakes up.
+//
+// Times are in nanoseconds of CLOCK_MONOTONIC, which is also the clock of std::steady_clock.
+class StreamPacer {
+  public:
+    explicit StreamPacer(int sampleRate) : mSampleRate(sampleRate) {}
+
+    // Forgets the frames transferred so far, the next transfer takes a new reference. Must be
+    // called when the stream stops transferring, for example on standby or pause.
+    void reset() { mStarted = false; }
+
+    // Accounts for the transferred frames and sleeps until they are due. A transfer which is late
+    // by more than its own duration takes a new reference instead of trying to catch up, as this
+    // means the stream was not transferring in the meantime.
+    void pace(size_t frameCount);
+
+    int64_t getReferenceTimeNs() const { return mReferenceNs; }
+    int64_t getFramesSinceReference() const { return mFrames; }
+
+    // Returns the time at which the given number of frames transferred since referenceNs are due.
+    static int64_t getDueTimeNs(int64_t referenceNs, int64_t frames, int sampleRate);
+    static int64_t getNowNs();
+    // Sleeps until the absolute time, returns right away if it has passed.
+    static void sleepUntil(int64_t timeNs);
+
+  private:
+    const int mSampleRate;
+    bool mStarted = false;
+    int64_t mReferenceNs = 0;
+    int64_t mFrames = 0;
+};
+
+}  // namespace aidl::android::hardware::audio::core
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "core-impl/Stream.h"
+#include "core-impl/StreamPacer.h"
 #include "core-impl/StreamSwitcher.h"
 #include "r_submix/SubmixRoute.h"
 
@@ -55,6 +56,10 @@ class StreamRemoteSubmix : public StreamCommonImpl {
     const bool mIsInput;
     r_submix::AudioConfig mStreamConfig;
     std::shared_ptr<r_submix::SubmixRoute> mCurrentRoute = nullptr;
+    // The pipe of the route, looked up once when the stream is initialized.
+    std::shared_ptr<r_submix::SubmixPipe> mPipe = nullptr;
+    // Paces the transfers which can't block on the pipe.
+    StreamPacer mPacer;
 
     // Mutex lock to protect vector of submix routes, each of these submix routes have their mutex
     // locks and none of the mutex locks should be taken together.
@@ -63,8 +68,6 @@ class StreamRemoteSubmix : public StreamCommonImpl {
                     std::shared_ptr<r_submix::SubmixRoute>>
             sSubmixRoutes GUARDED_BY(sSubmixRoutesLock);
 
-    // limit for number of read error log entries to avoid spamming the logs
-    static constexpr int kMaxReadErrorLogs = 5;
     // The duration of kMaxReadFailureAttempts * READ_ATTEMPT_SLEEP_MS must be strictly inferior
     // to the duration of a record buffer at the current record sample rate (of the device, not of
     // the recording itself). Here we have: 3 * 5ms = 15ms < 1024 frames * 1000 / 48000 = 21.333ms
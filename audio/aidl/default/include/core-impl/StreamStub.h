@@ -17,6 +17,7 @@
 #pragma once
 
 #include "core-impl/Stream.h"
+#include "core-impl/StreamPacer.h"
 
 namespace aidl::android::hardware::audio::core {
 
@@ -42,6 +43,7 @@ class StreamStub : public StreamCommonImpl {
     const bool mIsInput;
     bool mIsInitialized = false;  // Used for validating the state machine logic.
     bool mIsStandby = true;       // Used for validating the state machine logic.
+    StreamPacer mPacer;
 };
 
 class StreamInStub final : public StreamIn, public StreamStub {
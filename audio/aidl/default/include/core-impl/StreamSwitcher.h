@@ -130,6 +130,7 @@ class StreamSwitcher : virtual public StreamCommonInterface {
             const std::vector<::aidl::android::media::audio::common::AudioDevice>& devices)
             override;
     ndk::ScopedAStatus bluetoothParametersUpdated() override;
+    binder_status_t dumpCommon(int fd, const char** args, uint32_t numArgs) override;
 
   protected:
     // Since switching a stream requires closing down the current stream, StreamSwitcher
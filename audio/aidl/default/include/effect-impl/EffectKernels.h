@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace aidl::android::hardware::audio::effect {
+
+/**
+ * Signal processing kernels shared by the software effects.
+ *
+ * All the kernels work on interleaved float samples, in place or out of place. Filters and
+ * dynamics are vectorized across the channels of a frame, since each channel depends on its own
+ * previous samples, while gains are vectorized across samples.
+ */
+
+// Coefficients of a biquad section, normalized so that a0 is 1.
+struct BiquadCoefs {
+    float b0;
+    float b1;
+    float b2;
+    float a1;
+    float a2;
+};
+
+// RBJ cookbook filters. The frequencies are in Hz and the gains in dB.
+BiquadCoefs makeLowShelf(float sampleRate, float frequency, float gainDb);
+BiquadCoefs makeHighShelf(float sampleRate, float frequency, float gainDb);
+BiquadCoefs makePeaking(float sampleRate, float frequency, float gainDb, float q);
+
+/**
+ * Per channel parameters and state of the limiter kernel, each pointing to one float per channel.
+ *
+ * The envelope follows the input level with the attack coefficient when the level rises and with
+ * the release coefficient when it falls. Above the threshold the output level only rises by
+ * 1 / ratio dB for each dB of input, which is done by applying (envelope / threshold) ^ slope.
+ */
+struct LimiterChannels {
+    // Linear gain applied to the input.
+    const float* inputGain;
+    // 1 / linear threshold.
+    const float* invThreshold;
+    // 1 / ratio - 1, 0 for a channel that isn't limited.
+    const float* slope;
+    // One-pole smoothing coefficients, see limiterCoef().
+    const float* attack;
+    const float* release;
+    // Linear gain applied to the output.
+    const float* outputGain;
+    // State, updated by the kernel.
+    float* envelope;
+};
+
+// Smoothing coefficient reaching 1 - 1/e of a step in the given time.
+float limiterCoef(float sampleRate, float timeMs);
+
+// Kernels of one instruction set.
+struct EffectKernels {
+    const char* name;
+
+    // out = in * gain.
+    void (*scale)(const float* in, float* out, size_t samples, float gain);
+
+    // Ramps the gain linearly from startGain, excluded, to endGain, reached on the last frame.
+    void (*ramp)(const float* in, float* out, size_t frames, size_t channels, float startGain,
+                 float endGain);
+
+    // Runs each channel through the same cascade of biquads in transposed direct form II.
+    // state holds the 2 delay elements of each stage and channel, [stage][2][channel].
+    void (*biquads)(const float* in, float* out, size_t frames, size_t channels,
+                    const BiquadCoefs* coefs, size_t stages, float* state);
+
+    // Limits each channel independently.
+    void (*limiter)(const float* in, float* out, size_t frames, size_t channels,
+                    const LimiterChannels& limiter);
+};
+
+// Kernels for each instruction set, or nullptr if not available on this architecture or CPU.
+const EffectKernels* getScalarEffectKernels();
+const EffectKernels* getNeonEffectKernels();
+const EffectKernels* getSse2EffectKernels();
+const EffectKernels* getAvx2EffectKernels();
+
+// The fastest kernels available, selected on first use.
+const EffectKernels& getEffectKernels();
+
+/**
+ * A cascade of biquads applied to all the channels of a stream.
+ *
+ * Not thread-safe, the coefficients must be updated from the processing thread.
+ */
+class BiquadCascade {
+  public:
+    // Changing the number of channels or stages clears the filter state.
+    void setStages(size_t channels, const std::vector<BiquadCoefs>& stages);
+    void reset();
+    void process(const float* in, float* out, size_t frames);
+
+  private:
+    size_t mChannels = 0;
+    std::vector<BiquadCoefs> mStages;
+    std::vector<float> mState;
+};
+
+}  // namespace aidl::android::hardware::audio::effect
@@ -59,6 +59,11 @@ class EffectThread {
      * effectProcessImpl implementation must not call any EffectThread interface, otherwise it will
      * cause deadlock.
      *
+     * When the input and output frame sizes are the same, the samples are processed straight from
+     * the input FMQ into the output FMQ, so in and out are different buffers and the samples of one
+     * period may be passed in two or three calls where the FMQs wrap around. Each call always
+     * covers whole frames. Otherwise the samples are processed in place in the work buffer.
+     *
      * @param in address of input float buffer.
      * @param out address of output float buffer.
      * @param samples number of samples to process.
@@ -76,6 +81,14 @@ class EffectThread {
   private:
     static constexpr int kMaxTaskNameLen = 15;
 
+    /**
+     * Process the samples without copying them through the work buffer, which saves the two
+     * copies of each period done by the copy path.
+     *
+     * @return false if the samples can't be processed in the FMQs, in which case nothing was done.
+     */
+    bool processInFmq_l(size_t samples, IEffect::Status* status) REQUIRES(mThreadMutex);
+
     std::mutex mThreadMutex;
     std::condition_variable mCv;
     bool mStop GUARDED_BY(mThreadMutex) = true;
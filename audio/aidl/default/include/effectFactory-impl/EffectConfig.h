@@ -23,6 +23,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <android/binder_parcel.h>
 #include <cutils/properties.h>
 #include <tinyxml2.h>
 
@@ -35,6 +36,8 @@ namespace aidl::android::hardware::audio::effect {
  *  Library contains a mapping from library name to path.
  *  Effect contains a mapping from effect name to Libraries and implementation UUID.
  *  Pre/post processor contains a mapping from processing name to effect names.
+ *
+ *  The parsed result is cached, see ConfigCache, so the file is only parsed when it changes.
  */
 class EffectConfig {
   public:
@@ -71,7 +74,7 @@ class EffectConfig {
             {"/odm/lib/soundfx", "/vendor/lib/soundfx", "/system/lib/soundfx"};
 #endif
 
-    int mSkippedElements;
+    int mSkippedElements = 0;
     /* Parsed Libraries result */
     std::unordered_map<std::string, std::string> mLibraryMap;
     /* Parsed Effects result */
@@ -82,6 +85,13 @@ class EffectConfig {
      */
     ProcessingLibrariesMap mProcessingMap;
 
+    /** Parse the file into the maps, return false if it can't be loaded. */
+    bool parse(const std::string& file);
+
+    /** Serialize the maps for the cache. */
+    binder_status_t readFromParcel(const AParcel* parcel);
+    binder_status_t writeToParcel(AParcel* parcel) const;
+
     /** @return all `node`s children that are elements and match the tag if provided. */
     std::vector<std::reference_wrapper<const tinyxml2::XMLElement>> getChildren(
             const tinyxml2::XMLNode& node, const char* childTag = nullptr);
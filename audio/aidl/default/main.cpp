@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <cstdlib>
 #include <ctime>
 #include <sstream>
@@ -33,6 +34,8 @@ using aidl::android::hardware::audio::core::Config;
 using aidl::android::hardware::audio::core::Module;
 
 int main() {
+    const auto startTime = std::chrono::steady_clock::now();
+
     // Random values are used in the implementation.
     std::srand(std::time(nullptr));
 
@@ -68,6 +71,11 @@ int main() {
                     createModule(Module::Type::USB), createModule(Module::Type::STUB),
                     createModule(Module::Type::BLUETOOTH)};
     (void)modules;
+    LOG(INFO) << "Audio AIDL HAL services registered in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::steady_clock::now() - startTime)
+                         .count()
+              << " ms";
 
     ABinderProcess_joinThreadPool();
     return EXIT_FAILURE;  // should not reach
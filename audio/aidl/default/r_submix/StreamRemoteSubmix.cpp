@@ -17,12 +17,14 @@
 #define LOG_TAG "AHAL_StreamRemoteSubmix"
 #include <android-base/logging.h>
 
+#include <algorithm>
 #include <cmath>
 
 #include "core-impl/StreamRemoteSubmix.h"
 
 using aidl::android::hardware::audio::common::SinkMetadata;
 using aidl::android::hardware::audio::common::SourceMetadata;
+using aidl::android::hardware::audio::core::r_submix::SubmixPipe;
 using aidl::android::hardware::audio::core::r_submix::SubmixRoute;
 using aidl::android::media::audio::common::AudioDeviceAddress;
 using aidl::android::media::audio::common::AudioOffloadInfo;
@@ -35,7 +37,8 @@ StreamRemoteSubmix::StreamRemoteSubmix(StreamContext* context, const Metadata& m
                                        const AudioDeviceAddress& deviceAddress)
     : StreamCommonImpl(context, metadata),
       mDeviceAddress(deviceAddress),
-      mIsInput(isInput(metadata)) {
+      mIsInput(isInput(metadata)),
+      mPacer(context->getSampleRate()) {
     mStreamConfig.frameSize = context->getFrameSize();
     mStreamConfig.format = context->getFormat();
     mStreamConfig.channelLayout = context->getChannelLayout();
@@ -70,15 +73,14 @@ std::map<AudioDeviceAddress, std::shared_ptr<SubmixRoute>> StreamRemoteSubmix::s
             LOG(ERROR) << __func__ << ": invalid stream config";
             return ::android::NO_INIT;
         }
-        sp<MonoPipe> sink = mCurrentRoute->getSink();
-        if (sink == nullptr) {
-            LOG(ERROR) << __func__ << ": nullptr sink when opening stream";
+        std::shared_ptr<SubmixPipe> pipe = mCurrentRoute->getPipe();
+        if (pipe == nullptr) {
+            LOG(ERROR) << __func__ << ": nullptr pipe when opening stream";
             return ::android::NO_INIT;
         }
-        // If the sink has been shutdown or pipe recreation is forced, delete the pipe and
-        // recreate it.
-        if (sink->isShutdown()) {
-            LOG(DEBUG) << __func__ << ": Non-nullptr shut down sink when opening stream";
+        // If the pipe has been shutdown or pipe recreation is forced, reset the pipe.
+        if (pipe->isShutdown()) {
+            LOG(DEBUG) << __func__ << ": Non-nullptr shut down pipe when opening stream";
             if (::android::OK != mCurrentRoute->resetPipe()) {
                 LOG(ERROR) << __func__ << ": reset pipe failed";
                 return ::android::NO_INIT;
@@ -86,32 +88,34 @@ std::map<AudioDeviceAddress, std::shared_ptr<SubmixRoute>> StreamRemoteSubmix::s
         }
     }
 
+    // The pipe stays the same for the whole life of the route, so it's only looked up once.
+    mPipe = mCurrentRoute->getPipe();
     mCurrentRoute->openStream(mIsInput);
     return ::android::OK;
 }
 
 ::android::status_t StreamRemoteSubmix::drain(StreamDescriptor::DrainMode) {
-    usleep(1000);
     return ::android::OK;
 }
 
 ::android::status_t StreamRemoteSubmix::flush() {
-    usleep(1000);
     return ::android::OK;
 }
 
 ::android::status_t StreamRemoteSubmix::pause() {
-    usleep(1000);
+    mPacer.reset();
     return ::android::OK;
 }
 
 ::android::status_t StreamRemoteSubmix::standby() {
     mCurrentRoute->standby(mIsInput);
+    mPacer.reset();
     return ::android::OK;
 }
 
 ::android::status_t StreamRemoteSubmix::start() {
     mCurrentRoute->exitStandby(mIsInput);
+    mPacer.reset();
     return ::android::OK;
 }
 
@@ -126,13 +130,13 @@ ndk::ScopedAStatus StreamRemoteSubmix::prepareToClose() {
             }
         }
         if (route != nullptr) {
-            sp<MonoPipe> sink = route->getSink();
-            if (sink == nullptr) {
+            std::shared_ptr<SubmixPipe> pipe = route->getPipe();
+            if (pipe == nullptr) {
                 ndk::ScopedAStatus::fromExceptionCode(EX_ILLEGAL_STATE);
             }
-            LOG(DEBUG) << __func__ << ": shutting down MonoPipe sink";
+            LOG(DEBUG) << __func__ << ": shutting down the pipe";
 
-            sink->shutdown(true);
+            pipe->shutdown();
         } else {
             LOG(DEBUG) << __func__ << ": stream already closed.";
             ndk::ScopedAStatus::fromExceptionCode(EX_ILLEGAL_STATE);
@@ -154,6 +158,7 @@ void StreamRemoteSubmix::shutdown() {
         sSubmixRoutes.erase(mDeviceAddress);
     }
     mCurrentRoute.reset();
+    mPipe.reset();
 }
 
 ::android::status_t StreamRemoteSubmix::transfer(void* buffer, size_t frameCount,
@@ -161,23 +166,13 @@ void StreamRemoteSubmix::shutdown() {
     *latencyMs = (getStreamPipeSizeInFrames() * MILLIS_PER_SECOND) / mStreamConfig.sampleRate;
     LOG(VERBOSE) << __func__ << ": Latency " << *latencyMs << "ms";
 
-    sp<MonoPipe> sink = mCurrentRoute->getSink();
-    if (sink != nullptr) {
-        if (sink->isShutdown()) {
-            sink.clear();
-            LOG(VERBOSE) << __func__ << ": pipe shutdown, ignoring the transfer.";
-            // the pipe has already been shutdown, this buffer will be lost but we must simulate
-            // timing so we don't drain the output faster than realtime
-            const size_t delayUs = static_cast<size_t>(
-                    std::roundf(frameCount * MICROS_PER_SECOND / mStreamConfig.sampleRate));
-            usleep(delayUs);
-
-            *actualFrameCount = frameCount;
-            return ::android::OK;
-        }
-    } else {
-        LOG(ERROR) << __func__ << ": transfer without a pipe!";
-        return ::android::UNEXPECTED_NULL;
+    if (mPipe->isShutdown()) {
+        LOG(VERBOSE) << __func__ << ": pipe shutdown, ignoring the transfer.";
+        // the pipe has already been shutdown, this buffer will be lost but we must simulate
+        // timing so we don't drain the output faster than realtime
+        mPacer.pace(frameCount);
+        *actualFrameCount = frameCount;
+        return ::android::OK;
     }
     mCurrentRoute->exitStandby(mIsInput);
     return (mIsInput ? inRead(buffer, frameCount, actualFrameCount)
@@ -185,11 +180,7 @@ void StreamRemoteSubmix::shutdown() {
 }
 
 ::android::status_t StreamRemoteSubmix::refinePosition(StreamDescriptor::Position* position) {
-    sp<MonoPipeReader> source = mCurrentRoute->getSource();
-    if (source == nullptr) {
-        return ::android::NO_INIT;
-    }
-    const ssize_t framesInPipe = source->availableToRead();
+    const ssize_t framesInPipe = mPipe->availableToRead();
     if (framesInPipe <= 0) {
         // No need to update the position frames
         return ::android::OK;
@@ -211,107 +202,37 @@ size_t StreamRemoteSubmix::getStreamPipeSizeInFrames() {
 
 ::android::status_t StreamRemoteSubmix::outWrite(void* buffer, size_t frameCount,
                                                  size_t* actualFrameCount) {
-    sp<MonoPipe> sink = mCurrentRoute->getSink();
-    if (sink != nullptr) {
-        if (sink->isShutdown()) {
-            sink.clear();
-            LOG(VERBOSE) << __func__ << ": pipe shutdown, ignoring the write.";
-            // the pipe has already been shutdown, this buffer will be lost but we must
-            // simulate timing so we don't drain the output faster than realtime
-            const size_t delayUs = static_cast<size_t>(
-                    std::roundf(frameCount * MICROS_PER_SECOND / mStreamConfig.sampleRate));
-            usleep(delayUs);
-            *actualFrameCount = frameCount;
-            return ::android::OK;
-        }
-    } else {
-        LOG(FATAL) << __func__ << ": without a pipe!";
-        return ::android::UNKNOWN_ERROR;
-    }
-
-    const size_t availableToWrite = sink->availableToWrite();
-    // NOTE: sink has been checked above and sink and source life cycles are synchronized
-    sp<MonoPipeReader> source = mCurrentRoute->getSource();
-    // If the write to the sink should be blocked, flush enough frames from the pipe to make space
-    // to write the most recent data.
-    if (!mCurrentRoute->shouldBlockWrite() && availableToWrite < frameCount) {
-        static uint8_t flushBuffer[64];
-        const size_t flushBufferSizeFrames = sizeof(flushBuffer) / mStreamConfig.frameSize;
-        size_t framesToFlushFromSource = frameCount - availableToWrite;
-        LOG(VERBOSE) << __func__ << ": flushing " << framesToFlushFromSource
-                     << " frames from the pipe to avoid blocking";
-        while (framesToFlushFromSource) {
-            const size_t flushSize = std::min(framesToFlushFromSource, flushBufferSizeFrames);
-            framesToFlushFromSource -= flushSize;
-            // read does not block
-            source->read(flushBuffer, flushSize);
-        }
-    }
-
-    ssize_t writtenFrames = sink->write(buffer, frameCount);
-    if (writtenFrames < 0) {
-        if (writtenFrames == (ssize_t)::android::NEGOTIATE) {
-            LOG(ERROR) << __func__ << ": write to pipe returned NEGOTIATE";
-            sink.clear();
-            *actualFrameCount = 0;
-            return ::android::UNKNOWN_ERROR;
-        } else {
-            // write() returned UNDERRUN or WOULD_BLOCK, retry
-            LOG(ERROR) << __func__ << ": write to pipe returned unexpected " << writtenFrames;
-            writtenFrames = sink->write(buffer, frameCount);
-        }
-    }
-    sink.clear();
-
-    if (writtenFrames < 0) {
-        LOG(ERROR) << __func__ << ": failed writing to pipe with " << writtenFrames;
-        *actualFrameCount = 0;
-        return ::android::UNKNOWN_ERROR;
-    }
+    // If the write to the pipe should not block, the pipe drops the oldest frames to make space
+    // for the most recent data.
+    const size_t writtenFrames =
+            mPipe->write(buffer, frameCount, mCurrentRoute->shouldBlockWrite());
     LOG(VERBOSE) << __func__ << ": wrote " << writtenFrames << "frames";
-    *actualFrameCount = writtenFrames;
+    // Frames not written because the pipe was shut down during the write are lost, like the
+    // ones written after.
+    *actualFrameCount = frameCount;
     return ::android::OK;
 }
 
 ::android::status_t StreamRemoteSubmix::inRead(void* buffer, size_t frameCount,
                                                size_t* actualFrameCount) {
-    // about to read from audio source
-    sp<MonoPipeReader> source = mCurrentRoute->getSource();
-    if (source == nullptr) {
-        int readErrorCount = mCurrentRoute->notifyReadError();
-        if (readErrorCount < kMaxReadErrorLogs) {
-            LOG(ERROR) << __func__
-                       << ": no audio pipe yet we're trying to read! (not all errors will be "
-                          "logged)";
-        } else {
-            LOG(ERROR) << __func__ << ": Read errors " << readErrorCount;
-        }
-        const size_t delayUs = static_cast<size_t>(
-                std::roundf(frameCount * MICROS_PER_SECOND / mStreamConfig.sampleRate));
-        usleep(delayUs);
-        memset(buffer, 0, mStreamConfig.frameSize * frameCount);
-        *actualFrameCount = frameCount;
-        return ::android::OK;
-    }
-
     // read the data from the pipe
     int attempts = 0;
     const size_t delayUs = static_cast<size_t>(std::roundf(kReadAttemptSleepUs));
     char* buff = (char*)buffer;
     size_t remainingFrames = frameCount;
-    int availableToRead = source->availableToRead();
+    size_t availableToRead = mPipe->availableToRead();
 
     while ((remainingFrames > 0) && (availableToRead > 0) && (attempts < kMaxReadFailureAttempts)) {
         LOG(VERBOSE) << __func__ << ": frames available to read " << availableToRead;
 
-        ssize_t framesRead = source->read(buff, remainingFrames);
+        const size_t framesRead = mPipe->read(buff, remainingFrames);
 
         LOG(VERBOSE) << __func__ << ": frames read " << framesRead;
 
         if (framesRead > 0) {
             remainingFrames -= framesRead;
             buff += framesRead * mStreamConfig.frameSize;
-            availableToRead -= framesRead;
+            availableToRead -= std::min(availableToRead, framesRead);
             LOG(VERBOSE) << __func__ << ": (attempts = " << attempts << ") got " << framesRead
                          << " frames, remaining=" << remainingFrames;
         } else {
@@ -321,9 +242,6 @@ size_t StreamRemoteSubmix::getStreamPipeSizeInFrames() {
             usleep(delayUs);
         }
     }
-    // done using the source
-    source.clear();
-
     if (remainingFrames > 0) {
         const size_t remainingBytes = remainingFrames * mStreamConfig.frameSize;
         LOG(VERBOSE) << __func__ << ": clearing remaining_frames = " << remainingFrames;
@@ -331,27 +249,20 @@ size_t StreamRemoteSubmix::getStreamPipeSizeInFrames() {
                remainingBytes);
     }
 
-    long readCounterFrames = mCurrentRoute->updateReadCounterFrames(frameCount);
+    const int64_t readCounterFrames = mCurrentRoute->updateReadCounterFrames(frameCount);
     *actualFrameCount = frameCount;
 
-    // compute how much we need to sleep after reading the data by comparing the wall clock with
-    //   the projected time at which we should return.
-    // wall clock after reading from the pipe
-    auto recordDurationUs = std::chrono::steady_clock::now() - mCurrentRoute->getRecordStartTime();
-
-    // readCounterFrames contains the number of frames that have been read since the beginning of
-    // recording (including this call): it's converted to usec and compared to how long we've been
-    // recording for, which gives us how long we must wait to sync the projected recording time, and
-    // the observed recording time.
-    const int projectedVsObservedOffsetUs =
-            std::roundf((readCounterFrames * MICROS_PER_SECOND / mStreamConfig.sampleRate) -
-                        recordDurationUs.count());
-
-    LOG(VERBOSE) << __func__ << ": record duration " << recordDurationUs.count()
-                 << " microseconds, will wait: " << projectedVsObservedOffsetUs << " microseconds";
-    if (projectedVsObservedOffsetUs > 0) {
-        usleep(projectedVsObservedOffsetUs);
-    }
+    // Sleep until the frames read since the beginning of recording, including these ones, are due.
+    // The reference is the time at which the route started recording rather than the time of the
+    // first transfer, and is shared by all the input streams of the route.
+    const int64_t recordStartNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          mCurrentRoute->getRecordStartTime().time_since_epoch())
+                                          .count();
+    const int64_t dueTimeNs =
+            StreamPacer::getDueTimeNs(recordStartNs, readCounterFrames, mStreamConfig.sampleRate);
+    LOG(VERBOSE) << __func__ << ": " << readCounterFrames << " frames read since the start, "
+                 << "will wait: " << dueTimeNs - StreamPacer::getNowNs() << " ns";
+    StreamPacer::sleepUntil(dueTimeNs);
     return ::android::OK;
 }
 
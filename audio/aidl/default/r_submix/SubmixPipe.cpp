@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include "SubmixPipe.h"
+
+namespace aidl::android::hardware::audio::core::r_submix {
+
+namespace {
+
+size_t roundUpToPowerOf2(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+}  // namespace
+
+SubmixPipe::SubmixPipe(size_t frameCount, size_t frameSize, int sampleRate)
+    : mFrameCount(roundUpToPowerOf2(frameCount)),
+      mFrameSize(frameSize),
+      mSampleRate(sampleRate),
+      mBuffer(new uint8_t[mFrameCount * mFrameSize]) {}
+
+size_t SubmixPipe::availableToWrite() const {
+    return mFrameCount - (mWriteIndex.load(std::memory_order_relaxed) -
+                          mReadIndex.load(std::memory_order_acquire));
+}
+
+int SubmixPipe::getWriteRegions(size_t frames, Region regions[2]) const {
+    return getRegions(mWriteIndex.load(std::memory_order_relaxed),
+                      std::min(frames, availableToWrite()), regions);
+}
+
+void SubmixPipe::commitWrite(size_t frames) {
+    mWriteIndex.fetch_add(frames, std::memory_order_release);
+}
+
+size_t SubmixPipe::write(const void* buffer, size_t frames, bool canBlock) {
+    const uint8_t* data = static_cast<const uint8_t*>(buffer);
+    if (!canBlock && frames > availableToWrite()) {
+        // Only keep the most recent frames if there are more than the pipe can hold.
+        if (frames > mFrameCount) {
+            data += (frames - mFrameCount) * mFrameSize;
+            frames = mFrameCount;
+        }
+        advanceReadIndex(mWriteIndex.load(std::memory_order_relaxed) + frames - mFrameCount);
+    }
+
+    size_t written = 0;
+    while (written < frames) {
+        Region regions[2];
+        const int regionCount = getWriteRegions(frames - written, regions);
+        size_t regionFrames = 0;
+        for (int i = 0; i < regionCount; ++i) {
+            memcpy(regions[i].data, data, regions[i].frames * mFrameSize);
+            data += regions[i].frames * mFrameSize;
+            regionFrames += regions[i].frames;
+        }
+        commitWrite(regionFrames);
+        written += regionFrames;
+        if (written == frames || !canBlock || isShutdown()) {
+            break;
+        }
+        // Wait for the reader, which consumes frames at the nominal rate, to make room for the
+        // remaining frames.
+        std::this_thread::sleep_for(std::chrono::nanoseconds(
+                std::max<int64_t>((frames - written) * INT64_C(1000000000) / mSampleRate, 1000)));
+    }
+    return written;
+}
+
+size_t SubmixPipe::availableToRead() const {
+    const uint64_t readIndex = mReadIndex.load(std::memory_order_acquire);
+    return mWriteIndex.load(std::memory_order_acquire) - readIndex;
+}
+
+int SubmixPipe::getReadRegions(size_t frames, Region regions[2]) {
+    // The write index is loaded last, so that it is never behind the read index.
+    mReadRegionsIndex = mReadIndex.load(std::memory_order_acquire);
+    const uint64_t writeIndex = mWriteIndex.load(std::memory_order_acquire);
+    return getRegions(mReadRegionsIndex,
+                      std::min<uint64_t>(frames, writeIndex - mReadRegionsIndex), regions);
+}
+
+void SubmixPipe::commitRead(size_t frames) {
+    // Relative to the regions rather than to the current read index, which the writer may have
+    // moved in the meantime.
+    advanceReadIndex(mReadRegionsIndex + frames);
+}
+
+size_t SubmixPipe::read(void* buffer, size_t frames) {
+    uint8_t* data = static_cast<uint8_t*>(buffer);
+    Region regions[2];
+    const int regionCount = getReadRegions(frames, regions);
+    size_t read = 0;
+    for (int i = 0; i < regionCount; ++i) {
+        memcpy(data, regions[i].data, regions[i].frames * mFrameSize);
+        data += regions[i].frames * mFrameSize;
+        read += regions[i].frames;
+    }
+    commitRead(read);
+    return read;
+}
+
+void SubmixPipe::reset() {
+    advanceReadIndex(mWriteIndex.load(std::memory_order_acquire));
+    mShutdown.store(false, std::memory_order_release);
+}
+
+int SubmixPipe::getRegions(uint64_t index, size_t frames, Region regions[2]) const {
+    if (frames == 0) {
+        return 0;
+    }
+    const size_t position = index & (mFrameCount - 1);
+    const size_t firstFrames = std::min(frames, mFrameCount - position);
+    regions[0] = {&mBuffer[position * mFrameSize], firstFrames};
+    if (firstFrames == frames) {
+        return 1;
+    }
+    regions[1] = {&mBuffer[0], frames - firstFrames};
+    return 2;
+}
+
+void SubmixPipe::advanceReadIndex(uint64_t index) {
+    uint64_t readIndex = mReadIndex.load(std::memory_order_relaxed);
+    while (readIndex < index && !mReadIndex.compare_exchange_weak(readIndex, index,
+                                                                  std::memory_order_acq_rel)) {
+    }
+}
+
+}  // namespace aidl::android::hardware::audio::core::r_submix
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace aidl::android::hardware::audio::core::r_submix {
+
+// A lock-free ring of audio frames carrying the audio of a route from its output stream, the
+// writer, to its input stream, the reader.
+//
+// The frames are exposed as regions of the ring, so that a transfer copies them straight between
+// the stream buffer and the ring. Each side only moves its own index, except that a writer which
+// must not block may drop the oldest frames to make room, and that a reset drops all the frames;
+// both move the read index forward with a compare and swap, and so does the reader, so that
+// concurrent commits never move it backwards.
+class SubmixPipe {
+  public:
+    // Frames stored contiguously in the ring.
+    struct Region {
+        void* data;
+        size_t frames;
+    };
+
+    // The frame count is rounded up to a power of 2.
+    SubmixPipe(size_t frameCount, size_t frameSize, int sampleRate);
+
+    size_t getFrameCount() const { return mFrameCount; }
+    size_t getFrameSize() const { return mFrameSize; }
+
+    // Writer side.
+    size_t availableToWrite() const;
+    // Fills regions with the free space for up to 'frames' frames, returns the number of regions
+    // filled, 0 to 2. The frames are only visible to the reader once committed.
+    int getWriteRegions(size_t frames, Region regions[2]) const;
+    void commitWrite(size_t frames);
+    // Writes all the frames. If canBlock, waits for the reader to make room, unless the pipe is
+    // shut down in the meantime, otherwise drops the oldest frames to make room. Returns the
+    // number of frames written.
+    size_t write(const void* buffer, size_t frames, bool canBlock);
+
+    // Reader side.
+    // Can also be called by the writer.
+    size_t availableToRead() const;
+    // Fills regions with up to 'frames' frames ready to be read, returns the number of regions
+    // filled, 0 to 2. The frames stay in the pipe until committed.
+    int getReadRegions(size_t frames, Region regions[2]);
+    void commitRead(size_t frames);
+    // Reads up to 'frames' frames, returns the number of frames read.
+    size_t read(void* buffer, size_t frames);
+
+    // Once shut down, writes are expected to be dropped by the writer, and blocking writes return.
+    void shutdown() { mShutdown.store(true, std::memory_order_release); }
+    bool isShutdown() const { return mShutdown.load(std::memory_order_acquire); }
+    // Makes a pipe which was shut down usable again by a new pair of streams, dropping the frames
+    // it holds.
+    void reset();
+
+  private:
+    int getRegions(uint64_t index, size_t frames, Region regions[2]) const;
+    void advanceReadIndex(uint64_t index);
+
+    const size_t mFrameCount;
+    const size_t mFrameSize;
+    const int mSampleRate;
+    const std::unique_ptr<uint8_t[]> mBuffer;
+    // Frame counts since the creation of the pipe, they never wrap around in practice.
+    std::atomic<uint64_t> mWriteIndex = 0;
+    std::atomic<uint64_t> mReadIndex = 0;
+    std::atomic<bool> mShutdown = false;
+    // The read index the last read regions start from, only used by the reader.
+    uint64_t mReadRegionsIndex = 0;
+};
+
+}  // namespace aidl::android::hardware::audio::core::r_submix
@@ -16,14 +16,9 @@
 
 #define LOG_TAG "AHAL_SubmixRoute"
 #include <android-base/logging.h>
-#include <media/AidlConversionCppNdk.h>
-
-#include <Utils.h>
 
 #include "SubmixRoute.h"
 
-using aidl::android::hardware::audio::common::getChannelCount;
-
 namespace aidl::android::hardware::audio::core::r_submix {
 
 // Verify a submix input or output stream can be opened.
@@ -86,7 +81,7 @@ int SubmixRoute::notifyReadError() {
     return ++mReadErrorCount;
 }
 
-long SubmixRoute::updateReadCounterFrames(size_t frameCount) {
+int64_t SubmixRoute::updateReadCounterFrames(size_t frameCount) {
     std::lock_guard guard(mLock);
     mReadCounterFrames += frameCount;
     return mReadCounterFrames;
@@ -115,8 +110,8 @@ void SubmixRoute::closeStream(bool isInput) {
         mInputRefCount--;
         if (mInputRefCount == 0) {
             mStreamInOpen = false;
-            if (mSink != nullptr) {
-                mSink->shutdown(true);
+            if (mPipe != nullptr) {
+                mPipe->shutdown();
             }
         }
     } else {
@@ -127,73 +122,42 @@ void SubmixRoute::closeStream(bool isInput) {
 // If SubmixRoute doesn't exist for a port, create a pipe for the submix audio device of size
 // buffer_size_frames and store config of the submix audio device.
 ::android::status_t SubmixRoute::createPipe(const AudioConfig& streamConfig) {
-    const int channelCount = getChannelCount(streamConfig.channelLayout);
-    const audio_format_t audioFormat = VALUE_OR_RETURN_STATUS(
-            aidl2legacy_AudioFormatDescription_audio_format_t(streamConfig.format));
-    const ::android::NBAIO_Format format =
-            ::android::Format_from_SR_C(streamConfig.sampleRate, channelCount, audioFormat);
-    const ::android::NBAIO_Format offers[1] = {format};
-    size_t numCounterOffers = 0;
-
     const size_t pipeSizeInFrames =
             r_submix::kDefaultPipeSizeInFrames *
             ((float)streamConfig.sampleRate / r_submix::kDefaultSampleRateHz);
     LOG(VERBOSE) << __func__ << ": creating pipe, rate : " << streamConfig.sampleRate
                  << ", pipe size : " << pipeSizeInFrames;
 
-    // Create a MonoPipe with optional blocking set to true.
-    sp<MonoPipe> sink = sp<MonoPipe>::make(pipeSizeInFrames, format, true /*writeCanBlock*/);
-    if (sink == nullptr) {
-        LOG(FATAL) << __func__ << ": sink is null";
-        return ::android::UNEXPECTED_NULL;
-    }
-
-    // Negotiation between the source and sink cannot fail as the device open operation
-    // creates both ends of the pipe using the same audio format.
-    ssize_t index = sink->negotiate(offers, 1, nullptr, numCounterOffers);
-    if (index != 0) {
-        LOG(FATAL) << __func__ << ": Negotiation for the sink failed, index = " << index;
-        return ::android::BAD_INDEX;
-    }
-    sp<MonoPipeReader> source = sp<MonoPipeReader>::make(sink.get());
-    if (source == nullptr) {
-        LOG(FATAL) << __func__ << ": source is null";
-        return ::android::UNEXPECTED_NULL;
-    }
-    numCounterOffers = 0;
-    index = source->negotiate(offers, 1, nullptr, numCounterOffers);
-    if (index != 0) {
-        LOG(FATAL) << __func__ << ": Negotiation for the source failed, index = " << index;
-        return ::android::BAD_INDEX;
-    }
+    auto pipe = std::make_shared<SubmixPipe>(pipeSizeInFrames, streamConfig.frameSize,
+                                             streamConfig.sampleRate);
     LOG(VERBOSE) << __func__ << ": created pipe";
 
     mPipeConfig = streamConfig;
-    mPipeConfig.frameCount = sink->maxFrames();
+    mPipeConfig.frameCount = pipe->getFrameCount();
 
     LOG(VERBOSE) << __func__ << ": Pipe frame size : " << mPipeConfig.frameSize
                  << ", pipe frames : " << mPipeConfig.frameCount;
 
-    // Save references to the source and sink.
-    {
-        std::lock_guard guard(mLock);
-        mSink = std::move(sink);
-        mSource = std::move(source);
-    }
-
+    std::lock_guard guard(mLock);
+    mPipe = std::move(pipe);
     return ::android::OK;
 }
 
-// Release references to the sink and source.
+// Release the reference to the pipe, the streams may keep theirs until they are closed.
 void SubmixRoute::releasePipe() {
     std::lock_guard guard(mLock);
-    mSink.clear();
-    mSource.clear();
+    mPipe.reset();
 }
 
+// The pipe is reset in place rather than recreated, so that the streams still using it don't need
+// to look it up again.
 ::android::status_t SubmixRoute::resetPipe() {
-    releasePipe();
-    return createPipe(mPipeConfig);
+    std::lock_guard guard(mLock);
+    if (mPipe == nullptr) {
+        return ::android::NO_INIT;
+    }
+    mPipe->reset();
+    return ::android::OK;
 }
 
 void SubmixRoute::standby(bool isInput) {
@@ -14,30 +14,26 @@
  * limitations under the License.
  */
 
+#include <memory>
 #include <mutex>
 
 #include <audio_utils/clock.h>
 
-#include <media/nbaio/MonoPipe.h>
-#include <media/nbaio/MonoPipeReader.h>
-
 #include <aidl/android/media/audio/common/AudioChannelLayout.h>
 
 #include "core-impl/Stream.h"
+#include "r_submix/SubmixPipe.h"
 
 using aidl::android::media::audio::common::AudioChannelLayout;
 using aidl::android::media::audio::common::AudioFormatDescription;
 using aidl::android::media::audio::common::AudioFormatType;
 using aidl::android::media::audio::common::PcmType;
-using ::android::MonoPipe;
-using ::android::MonoPipeReader;
-using ::android::sp;
 
 namespace aidl::android::hardware::audio::core::r_submix {
 
 static constexpr int kDefaultSampleRateHz = 48000;
 // Size at default sample rate
-// NOTE: This value will be rounded up to the nearest power of 2 by MonoPipe().
+// NOTE: This value will be rounded up to the nearest power of 2 by SubmixPipe.
 static constexpr int kDefaultPipeSizeInFrames = (1024 * 4);
 
 // Configuration of the audio stream.
@@ -72,7 +68,7 @@ class SubmixRoute {
         std::lock_guard guard(mLock);
         return mStreamOutStandby;
     }
-    long getReadCounterFrames() {
+    int64_t getReadCounterFrames() {
         std::lock_guard guard(mLock);
         return mReadCounterFrames;
     }
@@ -84,13 +80,10 @@ class SubmixRoute {
         std::lock_guard guard(mLock);
         return mRecordStartTime;
     }
-    sp<MonoPipe> getSink() {
-        std::lock_guard guard(mLock);
-        return mSink;
-    }
-    sp<MonoPipeReader> getSource() {
+    // The streams look the pipe up once, it stays the same until all the streams are closed.
+    std::shared_ptr<SubmixPipe> getPipe() {
         std::lock_guard guard(mLock);
-        return mSource;
+        return mPipe;
     }
 
     bool isStreamConfigValid(bool isInput, const AudioConfig& streamConfig);
@@ -104,7 +97,7 @@ class SubmixRoute {
     ::android::status_t resetPipe();
     bool shouldBlockWrite();
     void standby(bool isInput);
-    long updateReadCounterFrames(size_t frameCount);
+    int64_t updateReadCounterFrames(size_t frameCount);
 
   private:
     bool isStreamConfigCompatible(const AudioConfig& streamConfig);
@@ -118,7 +111,7 @@ class SubmixRoute {
     bool mStreamOutOpen GUARDED_BY(mLock) = false;
     bool mStreamOutStandby GUARDED_BY(mLock) = true;
     // how many frames have been requested to be read since standby
-    long mReadCounterFrames GUARDED_BY(mLock) = 0;
+    int64_t mReadCounterFrames GUARDED_BY(mLock) = 0;
     int mReadErrorCount GUARDED_BY(mLock) = 0;
     // wall clock when recording starts
     std::chrono::time_point<std::chrono::steady_clock> mRecordStartTime GUARDED_BY(mLock);
@@ -131,8 +124,7 @@ class SubmixRoute {
     // A usecase example is one where the component capturing the audio is then sending it over
     // Wifi for presentation on a remote Wifi Display device (e.g. a dongle attached to a TV, or a
     // TV with Wifi Display capabilities), or to a wireless audio player.
-    sp<MonoPipe> mSink GUARDED_BY(mLock);
-    sp<MonoPipeReader> mSource GUARDED_BY(mLock);
+    std::shared_ptr<SubmixPipe> mPipe GUARDED_BY(mLock);
 };
 
 }  // namespace aidl::android::hardware::audio::core::r_submix
@@ -14,11 +14,8 @@
  * limitations under the License.
  */
 
-#include <cmath>
-
 #define LOG_TAG "AHAL_Stream"
 #include <android-base/logging.h>
-#include <audio_utils/clock.h>
 
 #include "core-impl/Module.h"
 #include "core-impl/StreamStub.h"
@@ -37,7 +34,8 @@ StreamStub::StreamStub(StreamContext* context, const Metadata& metadata)
       mFrameSizeBytes(getContext().getFrameSize()),
       mSampleRate(getContext().getSampleRate()),
       mIsAsynchronous(!!getContext().getAsyncCallback()),
-      mIsInput(isInput(metadata)) {}
+      mIsInput(isInput(metadata)),
+      mPacer(mSampleRate) {}
 
 ::android::status_t StreamStub::init() {
     mIsInitialized = true;
@@ -48,15 +46,10 @@ StreamStub::StreamStub(StreamContext* context, const Metadata& metadata)
     if (!mIsInitialized) {
         LOG(FATAL) << __func__ << ": must not happen for an uninitialized driver";
     }
-    if (!mIsInput) {
-        if (!mIsAsynchronous) {
-            static constexpr float kMicrosPerSecond = MICROS_PER_SECOND;
-            const size_t delayUs = static_cast<size_t>(
-                    std::roundf(mBufferSizeFrames * kMicrosPerSecond / mSampleRate));
-            usleep(delayUs);
-        } else {
-            usleep(500);
-        }
+    if (!mIsInput && !mIsAsynchronous) {
+        // Play out the buffer, following the frames transferred before. Asynchronous drains
+        // complete after the transient state delay, see transfer().
+        mPacer.pace(mBufferSizeFrames);
     }
     return ::android::OK;
 }
@@ -72,6 +65,7 @@ StreamStub::StreamStub(StreamContext* context, const Metadata& metadata)
     if (!mIsInitialized) {
         LOG(FATAL) << __func__ << ": must not happen for an uninitialized driver";
     }
+    mPacer.reset();
     return ::android::OK;
 }
 
@@ -79,7 +73,7 @@ StreamStub::StreamStub(StreamContext* context, const Metadata& metadata)
     if (!mIsInitialized) {
         LOG(FATAL) << __func__ << ": must not happen for an uninitialized driver";
     }
-    usleep(500);
+    mPacer.reset();
     mIsStandby = true;
     return ::android::OK;
 }
@@ -88,7 +82,7 @@ StreamStub::StreamStub(StreamContext* context, const Metadata& metadata)
     if (!mIsInitialized) {
         LOG(FATAL) << __func__ << ": must not happen for an uninitialized driver";
     }
-    usleep(500);
+    mPacer.reset();
     mIsStandby = false;
     return ::android::OK;
 }
@@ -101,14 +95,11 @@ StreamStub::StreamStub(StreamContext* context, const Metadata& metadata)
     if (mIsStandby) {
         LOG(FATAL) << __func__ << ": must not happen while in standby";
     }
-    static constexpr float kMicrosPerSecond = MICROS_PER_SECOND;
-    static constexpr float kScaleFactor = .8f;
-    if (mIsAsynchronous) {
-        usleep(500);
-    } else {
-        const size_t delayUs = static_cast<size_t>(
-                std::roundf(kScaleFactor * frameCount * kMicrosPerSecond / mSampleRate));
-        usleep(delayUs);
+    // Asynchronous streams are not paced here: the commands of a non-blocking stream must be
+    // replied to without waiting, and the worker already holds the TRANSFERRING and DRAINING
+    // states for the transient state delay of the context before calling back.
+    if (!mIsAsynchronous) {
+        mPacer.pace(frameCount);
     }
     if (mIsInput) {
         uint8_t* byteBuffer = static_cast<uint8_t*>(buffer);
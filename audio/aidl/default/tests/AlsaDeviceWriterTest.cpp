@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alsa/DeviceWriter.h"
+
+using aidl::android::hardware::audio::core::alsa::DeviceWriter;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr auto kTimeout = 5s;
+
+}  // namespace
+
+TEST(AlsaDeviceWriterTest, WritesTheBuffer) {
+    const void* writtenBuffer = nullptr;
+    size_t writtenBytes = 0;
+    DeviceWriter writer([&](const void* buffer, size_t bytes) {
+        writtenBuffer = buffer;
+        writtenBytes = bytes;
+        return 0;
+    });
+    const std::vector<char> data(480);
+    writer.startWrite(data.data(), data.size());
+    EXPECT_EQ(0, writer.waitForWrite());
+    EXPECT_EQ(data.data(), writtenBuffer);
+    EXPECT_EQ(data.size(), writtenBytes);
+}
+
+TEST(AlsaDeviceWriterTest, ReturnsTheResultOfEachWrite) {
+    int nextResult = -EIO;
+    DeviceWriter writer([&](const void*, size_t) { return nextResult; });
+    const char data[16] = {};
+    writer.startWrite(data, sizeof(data));
+    EXPECT_EQ(-EIO, writer.waitForWrite());
+
+    nextResult = 0;
+    writer.startWrite(data, sizeof(data));
+    EXPECT_EQ(0, writer.waitForWrite());
+}
+
+TEST(AlsaDeviceWriterTest, ConsecutiveWrites) {
+    std::atomic<int> writes = 0;
+    DeviceWriter writer([&](const void*, size_t) {
+        writes++;
+        return 0;
+    });
+    const char data[16] = {};
+    for (int i = 0; i < 100; ++i) {
+        writer.startWrite(data, sizeof(data));
+        ASSERT_EQ(0, writer.waitForWrite());
+        EXPECT_EQ(i + 1, writes.load());
+    }
+}
+
+TEST(AlsaDeviceWriterTest, WaitsForTheWriteToComplete) {
+    std::promise<void> unblock;
+    std::shared_future<void> unblocked = unblock.get_future().share();
+    std::atomic<bool> writeDone = false;
+    DeviceWriter writer([&](const void*, size_t) {
+        unblocked.wait();
+        writeDone = true;
+        return 0;
+    });
+    const char data[16] = {};
+    writer.startWrite(data, sizeof(data));
+    auto waiter = std::async(std::launch::async, [&] { return writer.waitForWrite(); });
+    EXPECT_EQ(std::future_status::timeout, waiter.wait_for(50ms));
+
+    unblock.set_value();
+    ASSERT_EQ(std::future_status::ready, waiter.wait_for(kTimeout));
+    EXPECT_EQ(0, waiter.get());
+    EXPECT_TRUE(writeDone);
+}
+
+TEST(AlsaDeviceWriterTest, DevicesAreWrittenConcurrently) {
+    // Like StreamAlsa, the calling thread writes to the first device while the writers write to
+    // the others. Each write waits for all of them to start, which only happens if they overlap.
+    constexpr int kDeviceCount = 3;
+    std::atomic<int> started = 0;
+    auto write = [&](const void*, size_t) {
+        started++;
+        const auto deadline = std::chrono::steady_clock::now() + kTimeout;
+        while (started.load() < kDeviceCount) {
+            if (std::chrono::steady_clock::now() > deadline) return -ETIMEDOUT;
+            std::this_thread::yield();
+        }
+        return 0;
+    };
+    std::vector<std::unique_ptr<DeviceWriter>> writers;
+    for (int i = 1; i < kDeviceCount; ++i) {
+        writers.push_back(std::make_unique<DeviceWriter>(write));
+    }
+
+    const char data[16] = {};
+    for (int transfer = 0; transfer < 10; ++transfer) {
+        started = 0;
+        for (auto& writer : writers) {
+            writer->startWrite(data, sizeof(data));
+        }
+        EXPECT_EQ(0, write(data, sizeof(data))) << "transfer " << transfer;
+        for (auto& writer : writers) {
+            EXPECT_EQ(0, writer->waitForWrite()) << "transfer " << transfer;
+        }
+    }
+}
+
+TEST(AlsaDeviceWriterTest, RunsWithThePriorityOfItsCreator) {
+    std::atomic<int> creatorNice = 0;
+    std::atomic<int> writerNice = 0;
+    // Lower the priority on a thread of its own, which stands for the stream worker.
+    std::thread creator([&] {
+        creatorNice = std::min(getpriority(PRIO_PROCESS, 0) + 1, 19);
+        ASSERT_EQ(0, setpriority(PRIO_PROCESS, 0, creatorNice));
+        DeviceWriter writer([&](const void*, size_t) {
+            writerNice = getpriority(PRIO_PROCESS, 0);
+            return 0;
+        });
+        const char data[16] = {};
+        writer.startWrite(data, sizeof(data));
+        EXPECT_EQ(0, writer.waitForWrite());
+    });
+    creator.join();
+    EXPECT_EQ(creatorNice.load(), writerNice.load());
+}
+
+TEST(AlsaDeviceWriterTest, DestroyedWhileIdle) {
+    std::atomic<int> writes = 0;
+    {
+        DeviceWriter writer([&](const void*, size_t) {
+            writes++;
+            return 0;
+        });
+    }
+    EXPECT_EQ(0, writes.load());
+}
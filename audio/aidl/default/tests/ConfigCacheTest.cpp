@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include <unistd.h>
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+#define LOG_TAG "ConfigCacheTest"
+#include <log/log.h>
+
+#include <core-impl/ConfigCache.h>
+
+using aidl::android::hardware::audio::core::internal::ConfigCache;
+
+namespace {
+
+constexpr const char* kCacheName = "test_config";
+
+// Stands for a parcelable converted from XML.
+struct TestConfig {
+    int32_t value = 0;
+
+    binder_status_t readFromParcel(const AParcel* parcel) {
+        return AParcel_readInt32(parcel, &value);
+    }
+    binder_status_t writeToParcel(AParcel* parcel) const {
+        return AParcel_writeInt32(parcel, value);
+    }
+};
+
+class ConfigCacheTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        mSourceFile = std::string(mSourceDir.path) + "/config.xml";
+        mIncludedFile = std::string(mSourceDir.path) + "/included.xml";
+        writeSource(mSourceFile, "<config><xi:include href=\"included.xml\"/></config>");
+        writeSource(mIncludedFile, "<included/>");
+    }
+
+    void writeSource(const std::string& file, const std::string& contents) {
+        ASSERT_TRUE(android::base::WriteStringToFile(contents, file));
+    }
+
+    // Returns the value from the cache, or the given value if the config had to be created.
+    int32_t getOrCreate(int32_t createdValue, bool cacheable = true) {
+        ConfigCache cache(kCacheName, {mSourceFile}, mCacheDir.path);
+        TestConfig config;
+        cache.getOrCreate<TestConfig>(&config, [&](TestConfig* created) {
+            created->value = createdValue;
+            return cacheable;
+        });
+        return config.value;
+    }
+
+    std::string getCacheFile() const {
+        return std::string(mCacheDir.path) + "/" + kCacheName + ".cache";
+    }
+
+    TemporaryDir mSourceDir;
+    TemporaryDir mCacheDir;
+    std::string mSourceFile;
+    std::string mIncludedFile;
+};
+
+}  // namespace
+
+TEST_F(ConfigCacheTest, LoadsCreatedConfig) {
+    EXPECT_EQ(1, getOrCreate(1));
+    EXPECT_EQ(1, getOrCreate(2));
+}
+
+TEST_F(ConfigCacheTest, SourceChangeInvalidates) {
+    EXPECT_EQ(1, getOrCreate(1));
+    writeSource(mSourceFile, "<config/>");
+    EXPECT_EQ(2, getOrCreate(2));
+    EXPECT_EQ(2, getOrCreate(3));
+}
+
+TEST_F(ConfigCacheTest, IncludedFileChangeInvalidates) {
+    EXPECT_EQ(1, getOrCreate(1));
+    writeSource(mIncludedFile, "<included></included>");
+    EXPECT_EQ(2, getOrCreate(2));
+}
+
+TEST_F(ConfigCacheTest, MissingSourceIsPartOfKey) {
+    ConfigCache withSource(kCacheName, {mSourceFile}, mCacheDir.path);
+    ASSERT_EQ(0, unlink(mIncludedFile.c_str()));
+    ConfigCache withoutInclude(kCacheName, {mSourceFile}, mCacheDir.path);
+    EXPECT_NE(withSource.getKey(), withoutInclude.getKey());
+}
+
+TEST_F(ConfigCacheTest, CorruptedCacheIsIgnored) {
+    EXPECT_EQ(1, getOrCreate(1));
+    std::string contents;
+    ASSERT_TRUE(android::base::ReadFileToString(getCacheFile(), &contents));
+    contents.back() ^= 0xff;
+    ASSERT_TRUE(android::base::WriteStringToFile(contents, getCacheFile()));
+    EXPECT_EQ(2, getOrCreate(2));
+    EXPECT_EQ(2, getOrCreate(3));
+}
+
+TEST_F(ConfigCacheTest, TruncatedCacheIsIgnored) {
+    EXPECT_EQ(1, getOrCreate(1));
+    ASSERT_EQ(0, truncate(getCacheFile().c_str(), 4));
+    EXPECT_EQ(2, getOrCreate(2));
+}
+
+TEST_F(ConfigCacheTest, NotCacheableIsNotStored) {
+    EXPECT_EQ(1, getOrCreate(1, false /*cacheable*/));
+    EXPECT_NE(0, access(getCacheFile().c_str(), F_OK));
+    EXPECT_EQ(2, getOrCreate(2));
+}
+
+TEST_F(ConfigCacheTest, MissingCacheDirFallsBack) {
+    ConfigCache cache(kCacheName, {mSourceFile}, std::string(mCacheDir.path) + "/missing");
+    TestConfig config;
+    cache.getOrCreate<TestConfig>(&config, [](TestConfig* created) {
+        created->value = 1;
+        return true;
+    });
+    EXPECT_EQ(1, config.value);
+}
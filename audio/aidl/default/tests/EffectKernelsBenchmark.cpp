@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include "effect-impl/EffectKernels.h"
+
+using namespace aidl::android::hardware::audio::effect;
+using ::benchmark::State;
+
+namespace {
+
+constexpr float kSampleRate = 48000;
+// 10ms blocks, like the audio framework uses for the effects of a mixer.
+constexpr size_t kFrames = 480;
+
+// Which kernels are measured, passed as the second benchmark argument.
+enum Kernels {
+    SCALAR = 0,
+    BEST = 1,
+};
+
+const EffectKernels& kernels(State& state) {
+    const EffectKernels& kernels =
+            state.range(1) == SCALAR ? *getScalarEffectKernels() : getEffectKernels();
+    state.SetLabel(kernels.name);
+    return kernels;
+}
+
+std::vector<float> randomBlock(size_t channels) {
+    std::vector<float> block(kFrames * channels);
+    for (auto& sample : block) {
+        sample = static_cast<float>(rand()) / RAND_MAX * 2.f - 1.f;
+    }
+    return block;
+}
+
+void BM_VolumeRamp(State& state) {
+    const size_t channels = state.range(0);
+    const EffectKernels& k = kernels(state);
+    auto in = randomBlock(channels);
+    std::vector<float> out(in.size());
+    for (auto _ : state) {
+        k.ramp(in.data(), out.data(), kFrames, channels, 0.5f, 0.25f);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+}
+
+void runBiquads(State& state, const std::vector<BiquadCoefs>& coefs) {
+    const size_t channels = state.range(0);
+    const EffectKernels& k = kernels(state);
+    auto in = randomBlock(channels);
+    std::vector<float> out(in.size());
+    std::vector<float> filterState(2 * coefs.size() * channels);
+    for (auto _ : state) {
+        k.biquads(in.data(), out.data(), kFrames, channels, coefs.data(), coefs.size(),
+                  filterState.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+}
+
+// The five bands of EqualizerSw.
+void BM_Equalizer(State& state) {
+    runBiquads(state, {makeLowShelf(kSampleRate, 60, 3), makePeaking(kSampleRate, 230, -2, 1),
+                       makePeaking(kSampleRate, 910, 1, 1), makePeaking(kSampleRate, 3600, -4, 1),
+                       makeHighShelf(kSampleRate, 14000, 6)});
+}
+
+void BM_BassBoost(State& state) {
+    runBiquads(state, {makeLowShelf(kSampleRate, 100, 9)});
+}
+
+void BM_Limiter(State& state) {
+    const size_t channels = state.range(0);
+    const EffectKernels& k = kernels(state);
+    auto in = randomBlock(channels);
+    std::vector<float> out(in.size());
+    std::vector<float> inputGain(channels, 2.f), invThreshold(channels, 2.f),
+            slope(channels, 1.f / 4 - 1), attack(channels, limiterCoef(kSampleRate, 1)),
+            release(channels, limiterCoef(kSampleRate, 60)), outputGain(channels, 1.f),
+            envelope(channels);
+    const LimiterChannels limiter = {
+            .inputGain = inputGain.data(),
+            .invThreshold = invThreshold.data(),
+            .slope = slope.data(),
+            .attack = attack.data(),
+            .release = release.data(),
+            .outputGain = outputGain.data(),
+            .envelope = envelope.data(),
+    };
+    for (auto _ : state) {
+        k.limiter(in.data(), out.data(), kFrames, channels, limiter);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kFrames);
+}
+
+void layouts(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({"channels", "kernels"});
+    for (int kernels : {SCALAR, BEST}) {
+        // Stereo, 5.1 and 7.1.
+        for (int channels : {2, 6, 8}) {
+            benchmark->Args({channels, kernels});
+        }
+    }
+}
+
+}  // anonymous namespace
+
+BENCHMARK(BM_VolumeRamp)->Apply(layouts);
+BENCHMARK(BM_Equalizer)->Apply(layouts);
+BENCHMARK(BM_BassBoost)->Apply(layouts);
+BENCHMARK(BM_Limiter)->Apply(layouts);
+
+BENCHMARK_MAIN();
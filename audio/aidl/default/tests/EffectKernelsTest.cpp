@@ -0,0 +1,379 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "effect-impl/EffectKernels.h"
+
+using namespace aidl::android::hardware::audio::effect;
+
+namespace {
+
+constexpr float kSampleRate = 48000;
+// The vectorized kernels may fuse multiply-adds the scalar ones don't, and the limiter
+// approximates log2() and exp2(), so the outputs are compared within a tolerance.
+constexpr float kTolerance = 1e-5f;
+// The rounding differences are amplified by the feedback of the filters.
+constexpr float kFilterTolerance = 1e-4f;
+
+// Channel counts covering the full registers, the partial ones and the scalar tail of each
+// instruction set, and frame counts that don't fill the last group of ramped frames.
+const std::vector<size_t> kChannelCounts = {1, 2, 3, 6, 8, 12, 40};
+const std::vector<size_t> kFrameCounts = {1, 7, 480, 481};
+
+std::vector<float> makeNoise(size_t samples, uint32_t seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<float> noise(samples);
+    for (auto& sample : noise) {
+        sample = distribution(generator);
+    }
+    return noise;
+}
+
+std::vector<float> makeSine(float frequency, size_t frames) {
+    std::vector<float> sine(frames);
+    for (size_t i = 0; i < frames; ++i) {
+        sine[i] = std::sin(2 * M_PI * frequency * i / kSampleRate);
+    }
+    return sine;
+}
+
+float rms(const float* samples, size_t count) {
+    double sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        sum += samples[i] * samples[i];
+    }
+    return std::sqrt(sum / count);
+}
+
+// Gain in dB of a mono cascade at the given frequency, measured once the filter has settled.
+float responseDb(const std::vector<BiquadCoefs>& stages, float frequency) {
+    constexpr size_t kFrames = kSampleRate / 2;
+    BiquadCascade cascade;
+    cascade.setStages(1, stages);
+    const auto in = makeSine(frequency, kFrames);
+    std::vector<float> out(kFrames);
+    cascade.process(in.data(), out.data(), kFrames);
+    constexpr size_t kSettled = kFrames / 2;
+    return 20 * std::log10(rms(out.data() + kSettled, kFrames - kSettled) /
+                           rms(in.data() + kSettled, kFrames - kSettled));
+}
+
+void expectNear(const std::vector<float>& expected, const std::vector<float>& actual,
+                const std::string& context, float tolerance = kTolerance) {
+    ASSERT_EQ(expected.size(), actual.size()) << context;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_NEAR(expected[i], actual[i], tolerance) << context << ", sample " << i;
+    }
+}
+
+// Per channel limiter settings, with different ones on each channel.
+struct LimiterSettings {
+    explicit LimiterSettings(size_t channels)
+        : inputGain(channels),
+          invThreshold(channels),
+          slope(channels),
+          attack(channels),
+          release(channels),
+          outputGain(channels),
+          envelope(channels) {
+        for (size_t i = 0; i < channels; ++i) {
+            inputGain[i] = 1.f + 0.25f * (i % 3);
+            invThreshold[i] = 1.f / (0.1f + 0.05f * (i % 5));
+            slope[i] = i % 4 == 3 ? 0.f : 1.f / (2 + i % 4) - 1.f;
+            attack[i] = limiterCoef(kSampleRate, 0.5f + i % 2);
+            release[i] = limiterCoef(kSampleRate, 20.f + i);
+            outputGain[i] = 1.f - 0.1f * (i % 2);
+        }
+    }
+
+    LimiterChannels channels() {
+        return {inputGain.data(), invThreshold.data(), slope.data(), attack.data(),
+                release.data(),   outputGain.data(),   envelope.data()};
+    }
+
+    std::vector<float> inputGain;
+    std::vector<float> invThreshold;
+    std::vector<float> slope;
+    std::vector<float> attack;
+    std::vector<float> release;
+    std::vector<float> outputGain;
+    std::vector<float> envelope;
+};
+
+using KernelsGetter = const EffectKernels* (*)();
+
+}  // namespace
+
+// Checks each available instruction set against the scalar kernels.
+class EffectKernelsTest : public testing::TestWithParam<std::tuple<std::string, KernelsGetter>> {
+  public:
+    void SetUp() override {
+        mKernels = std::get<1>(GetParam())();
+        if (mKernels == nullptr) {
+            GTEST_SKIP() << "Not available on this architecture or CPU";
+        }
+    }
+
+  protected:
+    const EffectKernels& mScalar = *getScalarEffectKernels();
+    const EffectKernels* mKernels = nullptr;
+};
+
+TEST_P(EffectKernelsTest, Scale) {
+    for (size_t samples : {1, 3, 8, 17, 960, 963}) {
+        const auto in = makeNoise(samples, samples);
+        std::vector<float> expected(samples), actual(samples);
+        mScalar.scale(in.data(), expected.data(), samples, 0.7f);
+        mKernels->scale(in.data(), actual.data(), samples, 0.7f);
+        EXPECT_EQ(expected, actual) << samples << " samples";
+    }
+}
+
+TEST_P(EffectKernelsTest, Ramp) {
+    for (size_t channels : kChannelCounts) {
+        for (size_t frames : kFrameCounts) {
+            const auto in = makeNoise(frames * channels, channels);
+            std::vector<float> expected(in.size()), actual(in.size());
+            mScalar.ramp(in.data(), expected.data(), frames, channels, 0.2f, 1.3f);
+            mKernels->ramp(in.data(), actual.data(), frames, channels, 0.2f, 1.3f);
+            expectNear(expected, actual,
+                       std::to_string(channels) + " channels, " + std::to_string(frames) +
+                               " frames");
+        }
+    }
+}
+
+TEST_P(EffectKernelsTest, RampReachesEndGain) {
+    constexpr size_t kChannels = 2;
+    constexpr size_t kFrames = 100;
+    const std::vector<float> in(kFrames * kChannels, 1.f);
+    std::vector<float> out(in.size());
+    mKernels->ramp(in.data(), out.data(), kFrames, kChannels, 0.f, 1.f);
+    EXPECT_NEAR(1.f / kFrames, out[0], kTolerance);
+    EXPECT_NEAR(1.f, out[out.size() - 1], kTolerance);
+}
+
+TEST_P(EffectKernelsTest, Biquads) {
+    // More stages than run in one pass, so the later passes run in place. The lowest band is kept
+    // above the bass, where the poles get close enough to the unit circle for the rounding
+    // differences to dominate.
+    std::vector<BiquadCoefs> coefs;
+    for (int i = 0; i < 10; ++i) {
+        coefs.push_back(makePeaking(kSampleRate, 250.f * (i + 1), i % 2 ? 6.f : -6.f, 1.f));
+    }
+    for (size_t stages : {size_t(1), size_t(3), coefs.size()}) {
+        for (size_t channels : kChannelCounts) {
+            const std::string context = std::to_string(stages) + " stages, " +
+                                        std::to_string(channels) + " channels";
+            std::vector<float> expectedState(2 * stages * channels);
+            std::vector<float> actualState(expectedState.size());
+            // Consecutive blocks, so that the state is carried from one to the next.
+            for (int block = 0; block < 3; ++block) {
+                const auto in = makeNoise(kFrameCounts.back() * channels, block);
+                std::vector<float> expected(in.size()), actual(in.size());
+                mScalar.biquads(in.data(), expected.data(), kFrameCounts.back(), channels,
+                                coefs.data(), stages, expectedState.data());
+                mKernels->biquads(in.data(), actual.data(), kFrameCounts.back(), channels,
+                                  coefs.data(), stages, actualState.data());
+                expectNear(expected, actual, context + ", block " + std::to_string(block),
+                           kFilterTolerance);
+            }
+            expectNear(expectedState, actualState, context + ", state", kFilterTolerance);
+        }
+    }
+}
+
+TEST_P(EffectKernelsTest, BiquadsInPlace) {
+    constexpr size_t kChannels = 6;
+    constexpr size_t kFrames = 480;
+    const std::vector<BiquadCoefs> coefs = {makeLowShelf(kSampleRate, 200.f, 6.f),
+                                            makeHighShelf(kSampleRate, 4000.f, -6.f)};
+    auto expected = makeNoise(kFrames * kChannels, 1);
+    auto actual = expected;
+    std::vector<float> expectedState(2 * coefs.size() * kChannels);
+    std::vector<float> actualState(expectedState.size());
+    mScalar.biquads(expected.data(), expected.data(), kFrames, kChannels, coefs.data(),
+                    coefs.size(), expectedState.data());
+    mKernels->biquads(actual.data(), actual.data(), kFrames, kChannels, coefs.data(),
+                      coefs.size(), actualState.data());
+    expectNear(expected, actual, "in place", kFilterTolerance);
+}
+
+TEST_P(EffectKernelsTest, Limiter) {
+    for (size_t channels : kChannelCounts) {
+        LimiterSettings expectedSettings(channels);
+        LimiterSettings actualSettings(channels);
+        for (int block = 0; block < 3; ++block) {
+            const std::string context =
+                    std::to_string(channels) + " channels, block " + std::to_string(block);
+            // Louder blocks first, then a quieter one for the release.
+            auto in = makeNoise(kFrameCounts.back() * channels, block);
+            mScalar.scale(in.data(), in.data(), in.size(), block == 2 ? 0.05f : 1.f);
+            std::vector<float> expected(in.size()), actual(in.size());
+            mScalar.limiter(in.data(), expected.data(), kFrameCounts.back(), channels,
+                            expectedSettings.channels());
+            mKernels->limiter(in.data(), actual.data(), kFrameCounts.back(), channels,
+                              actualSettings.channels());
+            expectNear(expected, actual, context);
+            expectNear(expectedSettings.envelope, actualSettings.envelope, context + ", envelope");
+        }
+    }
+}
+
+TEST_P(EffectKernelsTest, LimiterPassesSignalsBelowThreshold) {
+    constexpr size_t kFrames = 480;
+    const float inputGain = 2.f, invThreshold = 1.f / 0.5f, slope = 1.f / 4 - 1.f;
+    const float attack = limiterCoef(kSampleRate, 1.f), release = limiterCoef(kSampleRate, 50.f);
+    const float outputGain = 0.25f;
+    float envelope = 0.f;
+    const LimiterChannels limiter = {&inputGain, &invThreshold, &slope,   &attack,
+                                     &release,   &outputGain,   &envelope};
+    // Peaks at 0.2 after the input gain, below the 0.5 threshold.
+    auto in = makeSine(1000.f, kFrames);
+    mScalar.scale(in.data(), in.data(), kFrames, 0.1f);
+    std::vector<float> out(kFrames);
+    mKernels->limiter(in.data(), out.data(), kFrames, 1, limiter);
+    for (size_t i = 0; i < kFrames; ++i) {
+        ASSERT_NEAR(in[i] * inputGain * outputGain, out[i], kTolerance) << "sample " << i;
+    }
+}
+
+TEST_P(EffectKernelsTest, LimiterReducesSignalsAboveThreshold) {
+    constexpr size_t kFrames = 4800;
+    const float inputGain = 1.f, invThreshold = 1.f / 0.25f, slope = 1.f / 4 - 1.f;
+    const float attack = limiterCoef(kSampleRate, 1.f), release = limiterCoef(kSampleRate, 50.f);
+    const float outputGain = 1.f;
+    float envelope = 0.f;
+    const LimiterChannels limiter = {&inputGain, &invThreshold, &slope,   &attack,
+                                     &release,   &outputGain,   &envelope};
+    // 12 dB above the threshold, so with a ratio of 4 the output settles 3 dB above it.
+    const std::vector<float> in(kFrames, 1.f);
+    std::vector<float> out(kFrames);
+    mKernels->limiter(in.data(), out.data(), kFrames, 1, limiter);
+    EXPECT_NEAR(1.f, envelope, 1e-3f);
+    EXPECT_NEAR(0.25f * std::pow(10.f, 3.f / 20), out.back(), 1e-3f);
+    // The gain is only reduced as the envelope catches up with the input.
+    EXPECT_GT(out.front(), out.back());
+}
+
+TEST_P(EffectKernelsTest, LimiterWithZeroSlopeOnlyAppliesGains) {
+    constexpr size_t kFrames = 480;
+    const float inputGain = 1.5f, invThreshold = 1.f / 0.1f, slope = 0.f;
+    const float attack = limiterCoef(kSampleRate, 0.f), release = limiterCoef(kSampleRate, 0.f);
+    const float outputGain = 0.5f;
+    float envelope = 0.f;
+    const LimiterChannels limiter = {&inputGain, &invThreshold, &slope,   &attack,
+                                     &release,   &outputGain,   &envelope};
+    const auto in = makeNoise(kFrames, 1);
+    std::vector<float> out(kFrames);
+    mKernels->limiter(in.data(), out.data(), kFrames, 1, limiter);
+    for (size_t i = 0; i < kFrames; ++i) {
+        ASSERT_NEAR(in[i] * inputGain * outputGain, out[i], kTolerance) << "sample " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+        EffectKernels, EffectKernelsTest,
+        testing::Values(std::make_tuple("Scalar", getScalarEffectKernels),
+                        std::make_tuple("Neon", getNeonEffectKernels),
+                        std::make_tuple("Sse2", getSse2EffectKernels),
+                        std::make_tuple("Avx2", getAvx2EffectKernels)),
+        [](const testing::TestParamInfo<EffectKernelsTest::ParamType>& info) {
+            return std::get<0>(info.param);
+        });
+
+// NEON is part of every ARM build, so the Neon cases above must run there rather than be skipped.
+TEST(EffectKernelsSelectionTest, UsesNeonOnArm) {
+#if defined(__ARM_NEON)
+    ASSERT_NE(nullptr, getNeonEffectKernels());
+    EXPECT_STREQ("neon", getEffectKernels().name);
+#else
+    GTEST_SKIP() << "Not an ARM build";
+#endif
+}
+
+TEST(EffectFiltersTest, LowShelf) {
+    const std::vector<BiquadCoefs> stages = {makeLowShelf(kSampleRate, 300.f, 12.f)};
+    EXPECT_NEAR(12.f, responseDb(stages, 30.f), 0.5f);
+    EXPECT_NEAR(6.f, responseDb(stages, 300.f), 0.5f);
+    EXPECT_NEAR(0.f, responseDb(stages, 10000.f), 0.5f);
+}
+
+TEST(EffectFiltersTest, HighShelf) {
+    const std::vector<BiquadCoefs> stages = {makeHighShelf(kSampleRate, 3000.f, -12.f)};
+    EXPECT_NEAR(0.f, responseDb(stages, 100.f), 0.5f);
+    EXPECT_NEAR(-6.f, responseDb(stages, 3000.f), 0.5f);
+    EXPECT_NEAR(-12.f, responseDb(stages, 18000.f), 0.5f);
+}
+
+TEST(EffectFiltersTest, Peaking) {
+    const std::vector<BiquadCoefs> stages = {makePeaking(kSampleRate, 1000.f, 9.f, 2.f)};
+    EXPECT_NEAR(9.f, responseDb(stages, 1000.f), 0.1f);
+    EXPECT_NEAR(0.f, responseDb(stages, 50.f), 0.5f);
+    EXPECT_NEAR(0.f, responseDb(stages, 15000.f), 0.5f);
+}
+
+TEST(EffectFiltersTest, CascadeAddsGains) {
+    const std::vector<BiquadCoefs> stages = {makePeaking(kSampleRate, 1000.f, 4.f, 1.f),
+                                             makePeaking(kSampleRate, 1000.f, 5.f, 1.f)};
+    EXPECT_NEAR(9.f, responseDb(stages, 1000.f), 0.1f);
+}
+
+TEST(EffectFiltersTest, CascadeCarriesStateAcrossBlocks) {
+    constexpr size_t kChannels = 2;
+    constexpr size_t kFrames = 480;
+    const std::vector<BiquadCoefs> stages = {makeLowShelf(kSampleRate, 200.f, 6.f),
+                                             makePeaking(kSampleRate, 2000.f, -3.f, 0.7f)};
+    const auto in = makeNoise(2 * kFrames * kChannels, 1);
+
+    BiquadCascade whole;
+    whole.setStages(kChannels, stages);
+    std::vector<float> expected(in.size());
+    whole.process(in.data(), expected.data(), 2 * kFrames);
+
+    BiquadCascade split;
+    split.setStages(kChannels, stages);
+    std::vector<float> actual(in.size());
+    split.process(in.data(), actual.data(), kFrames);
+    split.process(in.data() + kFrames * kChannels, actual.data() + kFrames * kChannels, kFrames);
+    EXPECT_EQ(expected, actual);
+
+    // After a reset the cascade starts over.
+    split.reset();
+    split.process(in.data(), actual.data(), kFrames);
+    EXPECT_TRUE(std::equal(actual.begin(), actual.begin() + kFrames * kChannels,
+                           expected.begin()));
+}
+
+TEST(EffectFiltersTest, LimiterCoef) {
+    EXPECT_EQ(1.f, limiterCoef(kSampleRate, 0.f));
+    // A step reaches 1 - 1/e in the given time.
+    const float coef = limiterCoef(kSampleRate, 10.f);
+    float envelope = 0.f;
+    for (int i = 0; i < kSampleRate / 100; ++i) {
+        envelope += coef * (1.f - envelope);
+    }
+    EXPECT_NEAR(1.f - std::exp(-1.f), envelope, 1e-3f);
+}
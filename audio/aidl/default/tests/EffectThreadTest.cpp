@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+#define LOG_TAG "EffectThreadTest"
+#include <log/log.h>
+
+#include "effect-impl/EffectContext.h"
+#include "effect-impl/EffectThread.h"
+#include "effect-impl/EffectTypes.h"
+
+using aidl::android::hardware::audio::effect::EffectContext;
+using aidl::android::hardware::audio::effect::EffectThread;
+using aidl::android::hardware::audio::effect::IEffect;
+using aidl::android::hardware::audio::effect::kEventFlagNotEmpty;
+using aidl::android::hardware::audio::effect::Parameter;
+using aidl::android::media::audio::common::AudioChannelLayout;
+using aidl::android::media::audio::common::AudioFormatDescription;
+using aidl::android::media::audio::common::AudioFormatType;
+using aidl::android::media::audio::common::PcmType;
+using ::android::hardware::EventFlag;
+
+namespace {
+
+constexpr size_t kChannelCount = 2;
+// Capacity of the data FMQs, in frames.
+constexpr long kFmqFrameCount = 10;
+// Not a divisor of the FMQ capacity, so that the periods wrap around at different offsets.
+constexpr size_t kPeriodFrames = 6;
+constexpr size_t kPeriodSamples = kPeriodFrames * kChannelCount;
+
+// Doubles the samples and records how they were split.
+class DoublingEffectThread : public EffectThread {
+  public:
+    IEffect::Status effectProcessImpl(float* in, float* out, int samples) override {
+        for (int i = 0; i < samples; ++i) {
+            out[i] = in[i] * 2;
+        }
+        std::lock_guard lock(mLock);
+        mCalls.push_back(samples);
+        return {STATUS_OK, samples, samples};
+    }
+
+    std::vector<int> takeCalls() {
+        std::lock_guard lock(mLock);
+        return std::move(mCalls);
+    }
+
+  private:
+    std::mutex mLock;
+    std::vector<int> mCalls;
+};
+
+class EffectThreadTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        Parameter::Common common;
+        const auto layout = AudioChannelLayout::make<AudioChannelLayout::layoutMask>(
+                AudioChannelLayout::LAYOUT_STEREO);
+        const AudioFormatDescription format = {.type = AudioFormatType::PCM,
+                                               .pcm = PcmType::FLOAT_32_BIT};
+        for (auto* config : {&common.input, &common.output}) {
+            config->base.sampleRate = 48000;
+            config->base.channelMask = layout;
+            config->base.format = format;
+            config->frameCount = kFmqFrameCount;
+        }
+        mContext = std::make_shared<EffectContext>(1 /*statusDepth*/, common);
+        ASSERT_EQ(mContext->getInputFrameSize(), kChannelCount * sizeof(float));
+
+        EventFlag* efGroup = nullptr;
+        ASSERT_EQ(::android::OK, EventFlag::createEventFlag(
+                                         mContext->getStatusFmq()->getEventFlagWord(), &efGroup));
+        mEfGroup = efGroup;
+        ASSERT_EQ(aidl::android::hardware::audio::effect::RetCode::SUCCESS,
+                  mThread.createThread(mContext, "EffectThreadTest"));
+        mThread.startThread();
+    }
+
+    void TearDown() override {
+        mThread.stopThread();
+        mThread.destroyThread();
+        if (mEfGroup) {
+            EventFlag::deleteEventFlag(&mEfGroup);
+        }
+    }
+
+    // Sends the samples through the effect thread and returns what the effect produced.
+    std::vector<float> process(const std::vector<float>& samples) {
+        EXPECT_TRUE(mContext->getInputDataFmq()->write(samples.data(), samples.size()));
+        mEfGroup->wake(kEventFlagNotEmpty);
+        IEffect::Status status{};
+        EXPECT_TRUE(mContext->getStatusFmq()->readBlocking(&status, 1));
+        EXPECT_EQ(STATUS_OK, status.status);
+        EXPECT_EQ(static_cast<int>(samples.size()), status.fmqConsumed);
+        std::vector<float> produced(status.fmqProduced);
+        EXPECT_TRUE(mContext->getOutputDataFmq()->read(produced.data(), produced.size()));
+        return produced;
+    }
+
+    static std::vector<float> makeSamples(size_t count, float first) {
+        std::vector<float> samples(count);
+        for (size_t i = 0; i < count; ++i) {
+            samples[i] = first + i;
+        }
+        return samples;
+    }
+
+    static std::vector<float> doubled(std::vector<float> samples) {
+        for (auto& sample : samples) {
+            sample *= 2;
+        }
+        return samples;
+    }
+
+    std::shared_ptr<EffectContext> mContext;
+    DoublingEffectThread mThread;
+    EventFlag* mEfGroup = nullptr;
+};
+
+}  // namespace
+
+TEST_F(EffectThreadTest, SplitsPeriodsWhereTheFmqsWrapAround) {
+    const size_t capacity = kFmqFrameCount * kChannelCount;
+    size_t position = 0;
+    bool sawSplit = false;
+    for (int period = 0; period < 5; ++period) {
+        const auto samples = makeSamples(kPeriodSamples, period * 100.f);
+        EXPECT_EQ(doubled(samples), process(samples)) << "period " << period;
+
+        const auto calls = mThread.takeCalls();
+        const size_t toWrap = capacity - position % capacity;
+        if (toWrap < kPeriodSamples) {
+            // The period is split at the end of the FMQs, which is a frame boundary.
+            EXPECT_EQ((std::vector<int>{static_cast<int>(toWrap),
+                                        static_cast<int>(kPeriodSamples - toWrap)}),
+                      calls)
+                    << "period " << period;
+            sawSplit = true;
+        } else {
+            EXPECT_EQ(std::vector<int>{static_cast<int>(kPeriodSamples)}, calls)
+                    << "period " << period;
+        }
+        for (int samplesInCall : calls) {
+            EXPECT_EQ(0, samplesInCall % static_cast<int>(kChannelCount)) << "period " << period;
+        }
+        position += kPeriodSamples;
+    }
+    EXPECT_TRUE(sawSplit);
+}
+
+TEST_F(EffectThreadTest, PartialFrameIsNotSplit) {
+    // Move the FMQ positions off a frame boundary, then process a period wrapping around.
+    const auto partial = makeSamples(kChannelCount + 1, 0.f);
+    EXPECT_EQ(doubled(partial), process(partial));
+    EXPECT_EQ(std::vector<int>{static_cast<int>(partial.size())}, mThread.takeCalls());
+
+    for (int period = 0; period < 3; ++period) {
+        const auto samples = makeSamples(kPeriodSamples, period * 100.f);
+        EXPECT_EQ(doubled(samples), process(samples)) << "period " << period;
+        // Splitting the FMQ regions would cut a frame, so each period is processed in one call.
+        EXPECT_EQ(std::vector<int>{static_cast<int>(kPeriodSamples)}, mThread.takeCalls())
+                << "period " << period;
+    }
+}
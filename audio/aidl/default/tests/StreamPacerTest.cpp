@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+#define LOG_TAG "StreamPacerTest"
+#include <log/log.h>
+
+#include <core-impl/StreamPacer.h>
+
+using aidl::android::hardware::audio::core::StreamPacer;
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr size_t kPeriodFrames = 480;
+constexpr int64_t kPeriodNs = 10'000'000;
+// Wakeups can be late by any amount on a loaded test machine, so only the lower bounds that the
+// pacer guarantees are checked for each period. The upper bound is on the drift accumulated over
+// all the periods, which must not grow with the scheduling delay of each wakeup.
+constexpr int64_t kMaxDriftNs = 50'000'000;
+
+}  // namespace
+
+TEST(StreamPacerTest, ComputesDueTimes) {
+    EXPECT_EQ(1000, StreamPacer::getDueTimeNs(1000, 0, kSampleRate));
+    EXPECT_EQ(1000 + kPeriodNs, StreamPacer::getDueTimeNs(1000, kPeriodFrames, kSampleRate));
+    EXPECT_EQ(3'600'000'000'000, StreamPacer::getDueTimeNs(0, 3600LL * kSampleRate, kSampleRate));
+}
+
+TEST(StreamPacerTest, ComputesDueTimesForLongStreams) {
+    // 2^40 frames is about 8 months at 48 kHz, multiplied by 10^9 it doesn't fit into int64.
+    constexpr int64_t kFrames = 1LL << 40;
+    EXPECT_EQ(22'906'492'245'333'333, StreamPacer::getDueTimeNs(0, kFrames, kSampleRate));
+    EXPECT_EQ(22'906'492'255'333'333,
+              StreamPacer::getDueTimeNs(0, kFrames + kPeriodFrames, kSampleRate));
+}
+
+TEST(StreamPacerTest, SleepUntilPastTimeReturns) {
+    const int64_t startNs = StreamPacer::getNowNs();
+    StreamPacer::sleepUntil(startNs - kPeriodNs);
+    EXPECT_LT(StreamPacer::getNowNs() - startNs, kMaxDriftNs);
+}
+
+TEST(StreamPacerTest, PacesAtNominalRate) {
+    StreamPacer pacer(kSampleRate);
+    const int64_t startNs = StreamPacer::getNowNs();
+    constexpr int kPeriods = 100;
+    for (int i = 1; i <= kPeriods; ++i) {
+        pacer.pace(kPeriodFrames);
+        ASSERT_GE(StreamPacer::getNowNs() - startNs, i * kPeriodNs) << "period " << i;
+    }
+    EXPECT_LT(StreamPacer::getNowNs() - startNs, kPeriods * kPeriodNs + kMaxDriftNs);
+    EXPECT_EQ(kPeriods * static_cast<int64_t>(kPeriodFrames), pacer.getFramesSinceReference());
+}
+
+TEST(StreamPacerTest, CatchesUpWithoutDrift) {
+    StreamPacer pacer(kSampleRate);
+    const int64_t startNs = StreamPacer::getNowNs();
+    pacer.pace(kPeriodFrames);
+    // Late by less than a period, the next period is shortened to keep the rate.
+    usleep(kPeriodNs / 2000);
+    pacer.pace(kPeriodFrames);
+    pacer.pace(kPeriodFrames);
+    const int64_t elapsedNs = StreamPacer::getNowNs() - startNs;
+    EXPECT_GE(elapsedNs, 3 * kPeriodNs);
+    EXPECT_LT(elapsedNs, 3 * kPeriodNs + kMaxDriftNs);
+}
+
+TEST(StreamPacerTest, RestartsAfterStall) {
+    StreamPacer pacer(kSampleRate);
+    pacer.pace(kPeriodFrames);
+    const int64_t referenceNs = pacer.getReferenceTimeNs();
+    // Not transferring for several periods must not make the next transfers return at once.
+    usleep(3 * kPeriodNs / 1000);
+    const int64_t resumeNs = StreamPacer::getNowNs();
+    pacer.pace(kPeriodFrames);
+    EXPECT_GT(pacer.getReferenceTimeNs(), referenceNs);
+    EXPECT_EQ(static_cast<int64_t>(kPeriodFrames), pacer.getFramesSinceReference());
+    EXPECT_GE(StreamPacer::getNowNs() - resumeNs, kPeriodNs);
+}
+
+TEST(StreamPacerTest, ResetTakesNewReference) {
+    StreamPacer pacer(kSampleRate);
+    pacer.pace(kPeriodFrames);
+    pacer.reset();
+    const int64_t startNs = StreamPacer::getNowNs();
+    pacer.pace(kPeriodFrames);
+    EXPECT_GE(pacer.getReferenceTimeNs(), startNs);
+    EXPECT_EQ(static_cast<int64_t>(kPeriodFrames), pacer.getFramesSinceReference());
+}
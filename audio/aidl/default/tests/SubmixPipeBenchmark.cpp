@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "r_submix/SubmixPipe.h"
+
+using aidl::android::hardware::audio::core::r_submix::SubmixPipe;
+using ::benchmark::State;
+
+namespace {
+
+// 48kHz stereo PCM 16, the configuration used for casting.
+constexpr int kSampleRate = 48000;
+constexpr size_t kFrameSize = 2 * sizeof(int16_t);
+// The default size of the remote submix pipe.
+constexpr size_t kPipeFrames = 4096;
+
+// Each iteration moves one second of audio through the pipe, in periods of state.range(0) frames,
+// so the reported time is the CPU time spent per second of audio.
+void BM_SubmixPipeTransfer(State& state) {
+    const size_t periodFrames = state.range(0);
+    SubmixPipe pipe(kPipeFrames, kFrameSize, kSampleRate);
+    std::vector<int16_t> out(periodFrames * 2, 1);
+    std::vector<int16_t> in(periodFrames * 2);
+    for (auto _ : state) {
+        for (size_t frames = 0; frames < kSampleRate; frames += periodFrames) {
+            pipe.write(out.data(), periodFrames, true /*canBlock*/);
+            benchmark::DoNotOptimize(pipe.read(in.data(), periodFrames));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kSampleRate);
+}
+
+// The output keeps writing while the input is in standby, so the pipe drops the oldest frames.
+void BM_SubmixPipeOverwrite(State& state) {
+    const size_t periodFrames = state.range(0);
+    SubmixPipe pipe(kPipeFrames, kFrameSize, kSampleRate);
+    std::vector<int16_t> out(periodFrames * 2, 1);
+    for (auto _ : state) {
+        for (size_t frames = 0; frames < kSampleRate; frames += periodFrames) {
+            benchmark::DoNotOptimize(pipe.write(out.data(), periodFrames, false /*canBlock*/));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kSampleRate);
+}
+
+}  // namespace
+
+BENCHMARK(BM_SubmixPipeTransfer)->Arg(240)->Arg(480)->Arg(960);
+BENCHMARK(BM_SubmixPipeOverwrite)->Arg(240)->Arg(480)->Arg(960);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "r_submix/SubmixPipe.h"
+
+using aidl::android::hardware::audio::core::r_submix::SubmixPipe;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+// Each frame is a single int32_t holding its index in the stream, so that the tests can tell
+// which frames came out of the pipe.
+constexpr size_t kFrameSize = sizeof(int32_t);
+constexpr size_t kPipeFrames = 8;
+constexpr int kSampleRate = 48000;
+
+std::vector<int32_t> makeFrames(int32_t first, size_t count) {
+    std::vector<int32_t> frames(count);
+    std::iota(frames.begin(), frames.end(), first);
+    return frames;
+}
+
+std::vector<int32_t> readAll(SubmixPipe& pipe) {
+    std::vector<int32_t> frames(pipe.getFrameCount());
+    frames.resize(pipe.read(frames.data(), frames.size()));
+    return frames;
+}
+
+// Writes the frames through the write regions, returns the number of regions used.
+int writeThroughRegions(SubmixPipe& pipe, const std::vector<int32_t>& frames) {
+    SubmixPipe::Region regions[2];
+    const int regionCount = pipe.getWriteRegions(frames.size(), regions);
+    size_t written = 0;
+    for (int i = 0; i < regionCount; ++i) {
+        memcpy(regions[i].data, &frames[written], regions[i].frames * kFrameSize);
+        written += regions[i].frames;
+    }
+    EXPECT_EQ(frames.size(), written);
+    pipe.commitWrite(written);
+    return regionCount;
+}
+
+// Reads the frames through the read regions, without committing them.
+std::vector<int32_t> peekThroughRegions(SubmixPipe& pipe, size_t count, int* regionCount) {
+    SubmixPipe::Region regions[2];
+    *regionCount = pipe.getReadRegions(count, regions);
+    std::vector<int32_t> frames;
+    for (int i = 0; i < *regionCount; ++i) {
+        const int32_t* data = static_cast<const int32_t*>(regions[i].data);
+        frames.insert(frames.end(), data, data + regions[i].frames);
+    }
+    return frames;
+}
+
+}  // namespace
+
+TEST(SubmixPipeTest, FrameCountIsRoundedUpToPowerOf2) {
+    SubmixPipe pipe(kPipeFrames - 1, kFrameSize, kSampleRate);
+    EXPECT_EQ(kPipeFrames, pipe.getFrameCount());
+    EXPECT_EQ(kPipeFrames, pipe.availableToWrite());
+    EXPECT_EQ(0u, pipe.availableToRead());
+}
+
+TEST(SubmixPipeTest, RegionsWrapAround) {
+    SubmixPipe pipe(kPipeFrames, kFrameSize, kSampleRate);
+    // Move both indexes near the end of the ring.
+    ASSERT_EQ(6u, pipe.write(makeFrames(0, 6).data(), 6, false /*canBlock*/));
+    ASSERT_EQ(makeFrames(0, 6), readAll(pipe));
+
+    // The next 6 frames are split between the end and the start of the ring.
+    const auto frames = makeFrames(6, 6);
+    EXPECT_EQ(2, writeThroughRegions(pipe, frames));
+    EXPECT_EQ(6u, pipe.availableToRead());
+    EXPECT_EQ(kPipeFrames - 6, pipe.availableToWrite());
+
+    int regionCount = 0;
+    EXPECT_EQ(frames, peekThroughRegions(pipe, frames.size(), &regionCount));
+    EXPECT_EQ(2, regionCount);
+    pipe.commitRead(frames.size());
+    EXPECT_EQ(0u, pipe.availableToRead());
+    EXPECT_EQ(kPipeFrames, pipe.availableToWrite());
+}
+
+TEST(SubmixPipeTest, CopyingTransfersWrapAround) {
+    SubmixPipe pipe(kPipeFrames, kFrameSize, kSampleRate);
+    int32_t next = 0;
+    for (int i = 0; i < 10; ++i) {
+        // 5 is prime with the frame count, so the transfers wrap around at every offset.
+        const auto frames = makeFrames(next, 5);
+        next += frames.size();
+        ASSERT_EQ(frames.size(), pipe.write(frames.data(), frames.size(), true /*canBlock*/));
+        EXPECT_EQ(frames, readAll(pipe)) << "transfer " << i;
+    }
+}
+
+TEST(SubmixPipeTest, OverwriteKeepsNewestFrames) {
+    SubmixPipe pipe(kPipeFrames, kFrameSize, kSampleRate);
+    ASSERT_EQ(5u, pipe.write(makeFrames(0, 5).data(), 5, false /*canBlock*/));
+    // There is only room for 3 more frames, so the 3 oldest are dropped.
+    ASSERT_EQ(6u, pipe.write(makeFrames(5, 6).data(), 6, false /*canBlock*/));
+    EXPECT_EQ(makeFrames(3, kPipeFrames), readAll(pipe));
+}
+
+TEST(SubmixPipeTest, OverwriteWithMoreFramesThanThePipeHolds) {
+    SubmixPipe pipe(kPipeFrames, kFrameSize, kSampleRate);
+    ASSERT_EQ(3u, pipe.write(makeFrames(0, 3).data(), 3, false /*canBlock*/));
+    // Only the last frames of the write fit, everything before them is dropped.
+    const size_t frames = 2 * kPipeFrames + 3;
+    EXPECT_EQ(kPipeFrames, pipe.write(makeFrames(3, frames).data(), frames, false /*canBlock*/));
+    EXPECT_EQ(makeFrames(3 + frames - kPipeFrames, kPipeFrames), readAll(pipe));
+}
+
+TEST(SubmixPipeTest, CommitReadAfterOverwriteDoesNotMoveBack) {
+    SubmixPipe pipe(kPipeFrames, kFrameSize, kSampleRate);
+    ASSERT_EQ(kPipeFrames,
+              pipe.write(makeFrames(0, kPipeFrames).data(), kPipeFrames, false /*canBlock*/));
+    int regionCount = 0;
+    peekThroughRegions(pipe, 2, &regionCount);
+
+    // While the reader holds its regions, the writer drops the 4 oldest frames.
+    ASSERT_EQ(4u, pipe.write(makeFrames(kPipeFrames, 4).data(), 4, false /*canBlock*/));
+    // Committing the 2 frames read must not bring the dropped frames back.
+    pipe.commitRead(2);
+    EXPECT_EQ(kPipeFrames, pipe.availableToRead());
+    EXPECT_EQ(makeFrames(4, kPipeFrames), readAll(pipe));
+}
+
+TEST(SubmixPipeTest, CommitReadPastOverwriteMovesForward) {
+    SubmixPipe pipe(kPipeFrames, kFrameSize, kSampleRate);
+    ASSERT_EQ(kPipeFrames,
+              pipe.write(makeFrames(0, kPipeFrames).data(), kPipeFrames, false /*canBlock*/));
+    int regionCount = 0;
+    peekThroughRegions(pipe, 6, &regionCount);
+
+    // The writer drops 2 frames, fewer than the reader is about to commit.
+    ASSERT_EQ(2u, pipe.write(makeFrames(kPipeFrames, 2).data(), 2, false /*canBlock*/));
+    pipe.commitRead(6);
+    EXPECT_EQ(makeFrames(6, 4), readAll(pipe));
+}
+
+TEST(SubmixPipeTest, BlockingWriteWaitsForReader) {
+    SubmixPipe pipe(kPipeFrames, kFrameSize, kSampleRate);
+    const size_t frames = 3 * kPipeFrames;
+    auto writer = std::async(std::launch::async, [&] {
+        return pipe.write(makeFrames(0, frames).data(), frames, true /*canBlock*/);
+    });
+
+    std::vector<int32_t> received;
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (received.size() < frames && std::chrono::steady_clock::now() < deadline) {
+        const auto chunk = readAll(pipe);
+        received.insert(received.end(), chunk.begin(), chunk.end());
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(frames, writer.get());
+    // Nothing was dropped.
+    EXPECT_EQ(makeFrames(0, frames), received);
+}
+
+TEST(SubmixPipeTest, BlockingWriteReturnsOnShutdown) {
+    SubmixPipe pipe(kPipeFrames, kFrameSize, kSampleRate);
+    const size_t frames = 2 * kPipeFrames;
+    auto writer = std::async(std::launch::async, [&] {
+        return pipe.write(makeFrames(0, frames).data(), frames, true /*canBlock*/);
+    });
+    // Nobody reads, so the writer fills the pipe and waits.
+    EXPECT_EQ(std::future_status::timeout, writer.wait_for(50ms));
+
+    pipe.shutdown();
+    ASSERT_EQ(std::future_status::ready, writer.wait_for(5s));
+    EXPECT_EQ(kPipeFrames, writer.get());
+    EXPECT_TRUE(pipe.isShutdown());
+}
+
+TEST(SubmixPipeTest, ResetAfterShutdown) {
+    SubmixPipe pipe(kPipeFrames, kFrameSize, kSampleRate);
+    ASSERT_EQ(5u, pipe.write(makeFrames(0, 5).data(), 5, false /*canBlock*/));
+    pipe.shutdown();
+
+    pipe.reset();
+    EXPECT_FALSE(pipe.isShutdown());
+    EXPECT_EQ(0u, pipe.availableToRead());
+    EXPECT_EQ(kPipeFrames, pipe.availableToWrite());
+
+    // The pipe is usable again, from where the previous streams left it.
+    ASSERT_EQ(6u, pipe.write(makeFrames(100, 6).data(), 6, true /*canBlock*/));
+    EXPECT_EQ(makeFrames(100, 6), readAll(pipe));
+}
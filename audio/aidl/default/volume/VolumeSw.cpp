@@ -15,6 +15,7 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 
 #define LOG_TAG "AHAL_VolumeSw"
@@ -23,6 +24,7 @@
 #include <system/audio_effects/effect_uuid.h>
 
 #include "VolumeSw.h"
+#include "effect-impl/EffectKernels.h"
 
 using aidl::android::hardware::audio::effect::Descriptor;
 using aidl::android::hardware::audio::effect::getEffectImplUuidVolumeSw;
@@ -173,23 +175,42 @@ RetCode VolumeSw::releaseContext() {
 
 // Processing method running in EffectWorker thread.
 IEffect::Status VolumeSw::effectProcessImpl(float* in, float* out, int samples) {
-    // TODO: get data buffer and process.
-    LOG(DEBUG) << __func__ << " in " << in << " out " << out << " samples " << samples;
-    for (int i = 0; i < samples; i++) {
-        *out++ = *in++;
-    }
-    return {STATUS_OK, samples, samples};
+    RETURN_VALUE_IF(!mContext, (IEffect::Status{EX_NULL_POINTER, 0, 0}), "nullContext");
+    return mContext->process(in, out, samples);
 }
 
 RetCode VolumeSwContext::setVolLevel(int level) {
     mLevel = level;
+    updateTargetGain();
     return RetCode::SUCCESS;
 }
 
 RetCode VolumeSwContext::setVolMute(bool mute) {
-    // TODO : Add implementation to modify mute
     mMute = mute;
+    updateTargetGain();
     return RetCode::SUCCESS;
 }
 
+void VolumeSwContext::updateTargetGain() {
+    // mLevel is in millibels, like the levels of the legacy volume effect.
+    mTargetGain = mMute ? 0.f : std::pow(10.f, mLevel / 2000.f);
+}
+
+IEffect::Status VolumeSwContext::process(float* in, float* out, int samples) {
+    const size_t channels = ::aidl::android::hardware::audio::common::getChannelCount(
+            mCommon.input.base.channelMask);
+    RETURN_VALUE_IF(channels == 0, (IEffect::Status{EX_ILLEGAL_STATE, 0, 0}), "noChannels");
+
+    // Ramp to a new gain over one block to avoid a click.
+    const float targetGain = mTargetGain;
+    const EffectKernels& kernels = getEffectKernels();
+    if (targetGain != mGain) {
+        kernels.ramp(in, out, samples / channels, channels, mGain, targetGain);
+        mGain = targetGain;
+    } else {
+        kernels.scale(in, out, samples, mGain);
+    }
+    return {STATUS_OK, samples, samples};
+}
+
 }  // namespace aidl::android::hardware::audio::effect
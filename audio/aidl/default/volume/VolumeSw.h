@@ -18,6 +18,7 @@
 
 #include <aidl/android/hardware/audio/effect/BnEffect.h>
 #include <fmq/AidlMessageQueue.h>
+#include <atomic>
 #include <cstdlib>
 #include <memory>
 
@@ -40,9 +41,18 @@ class VolumeSwContext final : public EffectContext {
 
     bool getVolMute() const { return mMute; }
 
+    IEffect::Status process(float* in, float* out, int samples);
+
   private:
+    // In millibels, from -9600 to 0.
     int mLevel = 0;
     bool mMute = false;
+    // Gain matching mLevel and mMute, set from the binder thread.
+    std::atomic<float> mTargetGain = 1.f;
+    // Gain applied at the end of the last block, only used by the processing thread.
+    float mGain = 1.f;
+
+    void updateTargetGain();
 };
 
 class VolumeSw final : public EffectImpl {
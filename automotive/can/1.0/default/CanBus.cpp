@@ -25,31 +25,98 @@
 #include <linux/can/error.h>
 #include <linux/can/raw.h>
 
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
 namespace android::hardware::automotive::can::V1_0::implementation {
 
 /** Whether to log sent/received packets. */
 static constexpr bool kSuperVerbose = false;
 
-Return<Result> CanBus::send(const CanMessage& message) {
-    std::lock_guard<std::mutex> lck(mIsUpGuard);
-    if (!mIsUp) return Result::INTERFACE_DOWN;
+/** How many received messages may wait for delivery to a single listener. */
+static constexpr size_t kListenerQueueCapacity = 1024;
+
+/** What to do with received messages when a listener can't keep up. */
+static constexpr auto kListenerQueueOverflowPolicy = ListenerQueue::OverflowPolicy::DROP_OLDEST;
 
+Return<Result> CanBus::send(const CanMessage& message) {
     if (UNLIKELY(kSuperVerbose)) {
         LOG(VERBOSE) << "Sending " << toString(message);
     }
 
     if (message.payload.size() > CAN_MAX_DLEN) return Result::PAYLOAD_TOO_LONG;
 
-    struct canfd_frame frame = {};
-    frame.can_id = message.id;
-    if (message.isExtendedId) frame.can_id |= CAN_EFF_FLAG;
-    if (message.remoteTransmissionRequest) frame.can_id |= CAN_RTR_FLAG;
-    frame.len = message.payload.size();
-    memcpy(frame.data, message.payload.data(), message.payload.size());
+    PendingSend pending = {};
+    pending.frame.can_id = message.id;
+    if (message.isExtendedId) pending.frame.can_id |= CAN_EFF_FLAG;
+    if (message.remoteTransmissionRequest) pending.frame.can_id |= CAN_RTR_FLAG;
+    pending.frame.len = message.payload.size();
+    memcpy(pending.frame.data, message.payload.data(), message.payload.size());
+
+    /* ICanBus sends a single message per call, so frames are batched across concurrent calls
+     * instead: whoever finds the bus idle sends everything queued so far, while the other callers
+     * wait for their results. */
+    {
+        std::unique_lock<std::mutex> lck(mTxGuard);
+        mTxQueue.push_back(&pending);
+        while (!pending.result.has_value() && mTxBusy) mTxDone.wait(lck);
+        if (pending.result.has_value()) return *pending.result;
+        mTxBusy = true;
+    }
+    sendQueued();
+
+    std::lock_guard<std::mutex> lck(mTxGuard);
+    return *pending.result;
+}
+
+static Result toResult(CanSocket::SendError err) {
+    switch (err) {
+        case CanSocket::SendError::OK:
+            return Result::OK;
+        case CanSocket::SendError::QUEUE_FULL:
+            return Result::TRANSMISSION_FAILURE;
+        case CanSocket::SendError::INTERFACE_DOWN:
+            return Result::INTERFACE_DOWN;
+        case CanSocket::SendError::FAILED:
+            return Result::UNKNOWN_ERROR;
+    }
+}
+
+void CanBus::sendQueued() {
+    std::vector<PendingSend*> batch;
+    {
+        std::lock_guard<std::mutex> lck(mTxGuard);
+        batch.swap(mTxQueue);
+    }
+
+    std::vector<struct canfd_frame> frames;
+    frames.reserve(batch.size());
+    for (const auto pending : batch) frames.push_back(pending->frame);
 
-    if (!mSocket->send(frame)) return Result::TRANSMISSION_FAILURE;
+    std::vector<Result> results(batch.size(), Result::INTERFACE_DOWN);
+    {
+        std::lock_guard<std::mutex> upLck(mIsUpGuard);
+        size_t done = 0;
+        while (mIsUp && done < frames.size()) {
+            const auto res = mSocket->send(frames.data() + done, frames.size() - done);
+            std::fill_n(results.begin() + done, res.sent, Result::OK);
+            done += res.sent;
+            if (res.error == CanSocket::SendError::OK) break;
+
+            // A frame rejected on its own doesn't fail the frames of other callers queued after it.
+            const auto failed = res.error == CanSocket::SendError::FAILED ? 1 : frames.size() - done;
+            std::fill_n(results.begin() + done, failed, toResult(res.error));
+            done += failed;
+        }
+    }
 
-    return Result::OK;
+    {
+        std::lock_guard<std::mutex> lck(mTxGuard);
+        for (size_t i = 0; i < batch.size(); i++) batch[i]->result = results[i];
+        mTxBusy = false;
+    }
+    mTxDone.notify_all();
 }
 
 Return<void> CanBus::listen(const hidl_vec<CanMessageFilter>& filter,
@@ -68,15 +135,33 @@ Return<void> CanBus::listen(const hidl_vec<CanMessageFilter>& filter,
     std::lock_guard<std::mutex> lckListeners(mMsgListenersGuard);
 
     sp<CloseHandle> closeHandle = new CloseHandle([this, listenerCb]() {
+        // Destroyed without holding the lock, since it waits for an ongoing delivery to finish.
+        std::vector<std::unique_ptr<ListenerQueue>> removedQueues;
+
         std::lock_guard<std::mutex> lck(mMsgListenersGuard);
-        std::erase_if(mMsgListeners, [&](const auto& e) { return e.callback == listenerCb; });
+        const auto removed =
+                std::stable_partition(mMsgListeners.begin(), mMsgListeners.end(),
+                                      [&](const auto& e) { return e.callback != listenerCb; });
+        if (removed == mMsgListeners.end()) return;
+        for (auto it = removed; it != mMsgListeners.end(); it++) {
+            removedQueues.push_back(std::move(it->queue));
+        }
+        mMsgListeners.erase(removed, mMsgListeners.end());
+
+        /* The interface might be going down, but mSocket is only reset after all listeners were
+         * already removed (see clearMsgListeners), so it's still there if we erased something. */
+        updateFiltersLocked();
     });
-    mMsgListeners.emplace_back(CanMessageListener{listenerCb, filter, closeHandle});
+    auto queue = std::make_unique<ListenerQueue>(listenerCb, kListenerQueueCapacity,
+                                                 kListenerQueueOverflowPolicy);
+    mMsgListeners.emplace_back(
+            CanMessageListener{listenerCb, filter, closeHandle, std::move(queue)});
     auto& listener = mMsgListeners.back();
 
     // fix message IDs to have all zeros on bits not covered by mask
     std::for_each(listener.filter.begin(), listener.filter.end(),
                   [](auto& rule) { rule.id &= rule.mask; });
+    updateFiltersLocked();
 
     _hidl_cb(Result::OK, closeHandle);
     return {};
@@ -134,13 +219,18 @@ ICanController::Result CanBus::up() {
     mDownAfterUse = !*isUp;
 
     using namespace std::placeholders;
-    CanSocket::ReadCallback rdcb = std::bind(&CanBus::onRead, this, _1, _2);
+    CanSocket::ReadCallback rdcb = std::bind(&CanBus::onRead, this, _1);
     CanSocket::ErrorCallback errcb = std::bind(&CanBus::onError, this, _1);
     mSocket = CanSocket::open(mIfname, rdcb, errcb);
     if (!mSocket) {
         if (mDownAfterUse) netdevice::down(mIfname);
         return ICanController::Result::UNKNOWN_ERROR;
     }
+    {
+        // There are no listeners yet, so there is no point in receiving anything.
+        std::lock_guard<std::mutex> lckListeners(mMsgListenersGuard);
+        updateFiltersLocked();
+    }
 
     mIsUp = true;
     return ICanController::Result::OK;
@@ -218,50 +308,50 @@ bool CanBus::down() {
     return success;
 }
 
-/**
- * Helper function to determine if a flag meets the requirements of a
- * FilterFlag. See definition of FilterFlag in types.hal
- *
- * \param filterFlag FilterFlag object to match flag against
- * \param flag bool object from CanMessage object
- */
-static bool satisfiesFilterFlag(FilterFlag filterFlag, bool flag) {
-    if (filterFlag == FilterFlag::DONT_CARE) return true;
-    if (filterFlag == FilterFlag::SET) return flag;
-    if (filterFlag == FilterFlag::NOT_SET) return !flag;
-    return false;
+void CanBus::updateFiltersLocked() {
+    mFilterIndex.clear();
+    for (const auto& listener : mMsgListeners) {
+        mFilterIndex.addListener(listener.filter);
+    }
+
+    /* Kernel filters are just an optimization: if they can't express listener filters, or can't
+     * be applied, we need to receive everything and rely on mFilterIndex alone. */
+    static const std::vector<struct can_filter> kAcceptAll = {{.can_id = 0, .can_mask = 0}};
+    const auto kernelFilters = mFilterIndex.kernelFilters();
+    if (!mSocket->setFilters(kernelFilters.value_or(kAcceptAll)) && kernelFilters.has_value()) {
+        mSocket->setFilters(kAcceptAll);
+    }
 }
 
-/**
- * Match the filter set against message id.
- *
- * For details on the filters syntax, please see CanMessageFilter at
- * the HAL definition (types.hal).
- *
- * \param filter Filter to match against
- * \param id Message id to filter
- * \return true if the message id matches the filter, false otherwise
- */
-static bool match(const hidl_vec<CanMessageFilter>& filter, CanMessageId id, bool isRtr,
-                  bool isExtendedId) {
-    if (filter.size() == 0) return true;
-
-    bool anyNonExcludeRulePresent = false;
-    bool anyNonExcludeRuleSatisfied = false;
-    for (auto& rule : filter) {
-        const bool satisfied = ((id & rule.mask) == rule.id) &&
-                               satisfiesFilterFlag(rule.rtr, isRtr) &&
-                               satisfiesFilterFlag(rule.extendedFormat, isExtendedId);
-
-        if (rule.exclude) {
-            // Any exclude rule being satisfied invalidates the whole filter set.
-            if (satisfied) return false;
+Return<void> CanBus::debug(const hidl_handle& fd, const hidl_vec<hidl_string>&) {
+    if (fd.getNativeHandle() == nullptr || fd->numFds < 1) return {};
+    const int out = fd->data[0];
+
+    {
+        std::lock_guard<std::mutex> lckUp(mIsUpGuard);
+        if (mSocket) {
+            const auto tx = mSocket->getTxStats();
+            dprintf(out,
+                    "TX: sent %" PRIu64 ", failed %" PRIu64 ", queue full retries %" PRIu64
+                    ", queued %d byte(s)\n",
+                    tx.sentFrames, tx.failedFrames, tx.queueFullRetries, tx.queuedBytes);
         } else {
-            anyNonExcludeRulePresent = true;
-            if (satisfied) anyNonExcludeRuleSatisfied = true;
+            dprintf(out, "Interface is down\n");
         }
     }
-    return !anyNonExcludeRulePresent || anyNonExcludeRuleSatisfied;
+
+    std::lock_guard<std::mutex> lck(mMsgListenersGuard);
+    dprintf(out, "%zu message listener(s), queue capacity %zu, overflow policy %s\n",
+            mMsgListeners.size(), kListenerQueueCapacity, toString(kListenerQueueOverflowPolicy));
+    for (size_t i = 0; i < mMsgListeners.size(); i++) {
+        const auto stats = mMsgListeners[i].queue->getStats();
+        dprintf(out,
+                "  #%zu: %zu filter rule(s), delivered %" PRIu64 ", dropped %" PRIu64
+                ", failed %" PRIu64 ", queued %zu\n",
+                i, mMsgListeners[i].filter.size(), stats.delivered, stats.dropped, stats.failed,
+                stats.depth);
+    }
+    return {};
 }
 
 void CanBus::notifyErrorListeners(ErrorEvent err, bool isFatal) {
@@ -297,34 +387,44 @@ static ErrorEvent parseErrorFrame(const struct canfd_frame& frame) {
     return ErrorEvent::UNKNOWN_ERROR;
 }
 
-void CanBus::onRead(const struct canfd_frame& frame, std::chrono::nanoseconds timestamp) {
-    if ((frame.can_id & CAN_ERR_FLAG) != 0) {
-        // error bit is set
-        LOG(WARNING) << "CAN Error frame received";
-        notifyErrorListeners(parseErrorFrame(frame), false);
-        return;
-    }
+void CanBus::onRead(const std::vector<CanSocket::Frame>& frames) {
+    // Listeners lock is taken once per batch, unless there are error frames in it.
+    std::unique_lock<std::mutex> lck(mMsgListenersGuard, std::defer_lock);
 
-    CanMessage message = {};
-    message.id = frame.can_id & CAN_EFF_MASK;  // mask out eff/rtr/err flags
-    message.payload = hidl_vec<uint8_t>(frame.data, frame.data + frame.len);
-    message.timestamp = timestamp.count();
-    message.isExtendedId = (frame.can_id & CAN_EFF_FLAG) != 0;
-    message.remoteTransmissionRequest = (frame.can_id & CAN_RTR_FLAG) != 0;
+    for (const auto& [frame, timestamp] : frames) {
+        if ((frame.can_id & CAN_ERR_FLAG) != 0) {
+            // error bit is set
+            LOG(WARNING) << "CAN Error frame received";
+            if (lck.owns_lock()) lck.unlock();
+            notifyErrorListeners(parseErrorFrame(frame), false);
+            continue;
+        }
 
-    if (UNLIKELY(kSuperVerbose)) {
-        LOG(VERBOSE) << "Got message " << toString(message);
-    }
+        const CanMessageId id = frame.can_id & CAN_EFF_MASK;  // mask out eff/rtr/err flags
+        const bool isExtendedId = (frame.can_id & CAN_EFF_FLAG) != 0;
+        const bool isRtr = (frame.can_id & CAN_RTR_FLAG) != 0;
 
-    std::lock_guard<std::mutex> lck(mMsgListenersGuard);
-    for (auto& listener : mMsgListeners) {
-        if (!match(listener.filter, message.id, message.remoteTransmissionRequest,
-                   message.isExtendedId))
-            continue;
-        if (!listener.callback->onReceive(message).isOk() && !listener.failedOnce) {
-            listener.failedOnce = true;
-            LOG(WARNING) << "Failed to notify listener about message";
+        if (!lck.owns_lock()) lck.lock();
+        mFilterIndex.match(id, isRtr, isExtendedId, mMatchedListeners);
+        // Nobody is interested, don't bother building the message.
+        if (mMatchedListeners.empty()) continue;
+
+        CanMessage message = {};
+        message.id = id;
+        message.payload = hidl_vec<uint8_t>(frame.data, frame.data + frame.len);
+        message.timestamp = timestamp.count();
+        message.isExtendedId = isExtendedId;
+        message.remoteTransmissionRequest = isRtr;
+
+        if (UNLIKELY(kSuperVerbose)) {
+            LOG(VERBOSE) << "Got message " << toString(message);
+        }
+
+        // Listeners are notified from their own threads, so a slow one can't stall the reader.
+        for (size_t i = 0; i + 1 < mMatchedListeners.size(); i++) {
+            mMsgListeners[mMatchedListeners[i]].queue->push(message);
         }
+        mMsgListeners[mMatchedListeners.back()].queue->push(std::move(message));
     }
 }
 
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include "CanFilterIndex.h"
 #include "CanSocket.h"
+#include "ListenerQueue.h"
 
 #include <android-base/unique_fd.h>
 #include <android/hardware/automotive/can/1.0/ICanBus.h>
@@ -24,6 +26,8 @@
 #include <utils/Mutex.h>
 
 #include <atomic>
+#include <condition_variable>
+#include <optional>
 #include <thread>
 
 namespace android::hardware::automotive::can::V1_0::implementation {
@@ -37,6 +41,7 @@ struct CanBus : public ICanBus {
     Return<void> listen(const hidl_vec<CanMessageFilter>& filter,
                         const sp<ICanMessageListener>& listener, listen_cb _hidl_cb) override;
     Return<sp<ICloseHandle>> listenForErrors(const sp<ICanErrorListener>& listener) override;
+    Return<void> debug(const hidl_handle& fd, const hidl_vec<hidl_string>& options) override;
 
     void setErrorCallback(ErrorCallback errcb);
     ICanController::Result up();
@@ -79,22 +84,46 @@ struct CanBus : public ICanBus {
         sp<ICanMessageListener> callback;
         hidl_vec<CanMessageFilter> filter;
         wp<ICloseHandle> closeHandle;
-        bool failedOnce = false;
+        std::unique_ptr<ListenerQueue> queue;
     };
+    /** A send() call waiting for its frame to be sent. */
+    struct PendingSend {
+        struct canfd_frame frame;
+        std::optional<Result> result;
+    };
+
     void clearMsgListeners();
     void clearErrListeners();
 
     void notifyErrorListeners(ErrorEvent err, bool isFatal);
 
-    void onRead(const struct canfd_frame& frame, std::chrono::nanoseconds timestamp);
+    /** Recompiles mFilterIndex after listeners were changed and pushes it to the kernel. */
+    void updateFiltersLocked() REQUIRES(mMsgListenersGuard);
+
+    /** Sends all frames in mTxQueue as one batch. Must only be called by the mTxBusy owner. */
+    void sendQueued();
+
+    void onRead(const std::vector<CanSocket::Frame>& frames);
     void onError(int errnoVal);
 
     std::mutex mMsgListenersGuard;
     std::vector<CanMessageListener> mMsgListeners GUARDED_BY(mMsgListenersGuard);
+    /** Filters of mMsgListeners, indexed in the same order. */
+    CanFilterIndex mFilterIndex GUARDED_BY(mMsgListenersGuard);
+    /** Scratch buffer for listeners matching a received message. */
+    std::vector<size_t> mMatchedListeners GUARDED_BY(mMsgListenersGuard);
 
     std::mutex mErrListenersGuard;
     std::vector<sp<ICanErrorListener>> mErrListeners GUARDED_BY(mErrListenersGuard);
 
+    std::mutex mTxGuard;
+    /** Signalled when a batch was sent and its results are available. */
+    std::condition_variable mTxDone;
+    /** Frames of send() calls waiting to be sent, in order of arrival. */
+    std::vector<PendingSend*> mTxQueue GUARDED_BY(mTxGuard);
+    /** Whether some send() call is sending a batch. */
+    bool mTxBusy GUARDED_BY(mTxGuard) = false;
+
     std::unique_ptr<CanSocket> mSocket;
     bool mDownAfterUse;
 
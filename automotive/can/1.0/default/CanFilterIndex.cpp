@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CanFilterIndex.h"
+
+#include <linux/can/raw.h>
+
+#include <algorithm>
+
+namespace android::hardware::automotive::can::V1_0::implementation {
+
+/**
+ * Helper function to determine if a flag meets the requirements of a
+ * FilterFlag. See definition of FilterFlag in types.hal
+ *
+ * \param filterFlag FilterFlag object to match flag against
+ * \param flag bool object from CanMessage object
+ */
+static bool satisfiesFilterFlag(FilterFlag filterFlag, bool flag) {
+    if (filterFlag == FilterFlag::DONT_CARE) return true;
+    if (filterFlag == FilterFlag::SET) return flag;
+    if (filterFlag == FilterFlag::NOT_SET) return !flag;
+    return false;
+}
+
+/**
+ * Translate FilterFlag to kernel filter ID and mask bits.
+ *
+ * \param filterFlag FilterFlag to translate
+ * \param flagBit Corresponding flag bit in can_id (such as CAN_RTR_FLAG)
+ * \param filter Kernel filter to update
+ * \return false, if the FilterFlag can't be satisfied at all
+ */
+static bool applyFilterFlag(FilterFlag filterFlag, canid_t flagBit, struct can_filter& filter) {
+    if (filterFlag == FilterFlag::DONT_CARE) return true;
+    if (filterFlag == FilterFlag::SET) {
+        filter.can_id |= flagBit;
+        filter.can_mask |= flagBit;
+        return true;
+    }
+    if (filterFlag == FilterFlag::NOT_SET) {
+        filter.can_mask |= flagBit;
+        return true;
+    }
+    return false;
+}
+
+void CanFilterIndex::clear() {
+    mMaskGroups.clear();
+    mHasIncludeRules.clear();
+    mIncludeRules.clear();
+    mExcludedGeneration.clear();
+    mIncludedGeneration.clear();
+}
+
+void CanFilterIndex::addListener(const hidl_vec<CanMessageFilter>& filter) {
+    const size_t listener = mHasIncludeRules.size();
+    bool hasIncludeRules = false;
+
+    for (const auto& rule : filter) {
+        auto group = std::find_if(mMaskGroups.begin(), mMaskGroups.end(),
+                                  [&rule](const auto& g) { return g.mask == rule.mask; });
+        if (group == mMaskGroups.end()) {
+            group = mMaskGroups.insert(mMaskGroups.end(), MaskGroup{rule.mask, {}});
+        }
+        group->entriesById[rule.id & rule.mask].push_back(
+                {listener, rule.rtr, rule.extendedFormat, rule.exclude});
+
+        if (!rule.exclude) {
+            hasIncludeRules = true;
+            mIncludeRules.push_back(rule);
+        }
+    }
+
+    mHasIncludeRules.push_back(hasIncludeRules);
+    mExcludedGeneration.push_back(0);
+    mIncludedGeneration.push_back(0);
+}
+
+void CanFilterIndex::match(CanMessageId id, bool isRtr, bool isExtendedId,
+                           std::vector<size_t>& matches) {
+    matches.clear();
+
+    if (++mGeneration == 0) {
+        // Generation counter wrapped around, stale entries could match it again.
+        std::fill(mExcludedGeneration.begin(), mExcludedGeneration.end(), 0);
+        std::fill(mIncludedGeneration.begin(), mIncludedGeneration.end(), 0);
+        mGeneration = 1;
+    }
+
+    for (const auto& group : mMaskGroups) {
+        const auto it = group.entriesById.find(id & group.mask);
+        if (it == group.entriesById.end()) continue;
+
+        for (const auto& entry : it->second) {
+            if (!satisfiesFilterFlag(entry.rtr, isRtr)) continue;
+            if (!satisfiesFilterFlag(entry.extendedFormat, isExtendedId)) continue;
+
+            if (entry.exclude) {
+                // Any exclude rule being satisfied invalidates the whole filter set.
+                mExcludedGeneration[entry.listener] = mGeneration;
+            } else {
+                mIncludedGeneration[entry.listener] = mGeneration;
+            }
+        }
+    }
+
+    for (size_t listener = 0; listener < mHasIncludeRules.size(); listener++) {
+        if (mExcludedGeneration[listener] == mGeneration) continue;
+        if (mHasIncludeRules[listener] && mIncludedGeneration[listener] != mGeneration) continue;
+        matches.push_back(listener);
+    }
+}
+
+std::optional<std::vector<struct can_filter>> CanFilterIndex::kernelFilters() const {
+    if (std::find(mHasIncludeRules.begin(), mHasIncludeRules.end(), false) !=
+        mHasIncludeRules.end()) {
+        return std::nullopt;
+    }
+
+    std::vector<struct can_filter> filters;
+    for (const auto& rule : mIncludeRules) {
+        struct can_filter filter = {};
+        filter.can_id = rule.id & rule.mask & CAN_EFF_MASK;
+        filter.can_mask = rule.mask & CAN_EFF_MASK;
+        if (!applyFilterFlag(rule.rtr, CAN_RTR_FLAG, filter)) continue;
+        if (!applyFilterFlag(rule.extendedFormat, CAN_EFF_FLAG, filter)) continue;
+
+        const bool duplicate = std::any_of(filters.begin(), filters.end(), [&filter](auto& f) {
+            return f.can_id == filter.can_id && f.can_mask == filter.can_mask;
+        });
+        if (!duplicate) filters.push_back(filter);
+    }
+
+    if (filters.size() > CAN_RAW_FILTER_MAX) return std::nullopt;
+    return filters;
+}
+
+}  // namespace android::hardware::automotive::can::V1_0::implementation
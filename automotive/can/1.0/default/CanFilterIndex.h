@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <android/hardware/automotive/can/1.0/types.h>
+#include <linux/can.h>
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace android::hardware::automotive::can::V1_0::implementation {
+
+/**
+ * Filter sets of all message listeners, compiled into a structure for matching received messages.
+ *
+ * Rules are grouped by their mask. Within a group, rules are kept in a hash map keyed by the masked
+ * message ID, so matching a message costs one lookup per distinct mask, regardless of the number of
+ * listeners and rules. Rules for exact message IDs all end up in the CAN_EFF_MASK group.
+ *
+ * For details on the filters syntax, please see CanMessageFilter at the HAL definition
+ * (types.hal).
+ */
+class CanFilterIndex {
+  public:
+    /** Removes all listeners. */
+    void clear();
+
+    /**
+     * Adds filter set of the next listener.
+     *
+     * Listeners are identified by consecutive indices, in the order they were added.
+     *
+     * \param filter Filter set of the listener, empty one matches all messages
+     */
+    void addListener(const hidl_vec<CanMessageFilter>& filter);
+
+    /**
+     * Finds listeners interested in a message.
+     *
+     * Not thread safe, even for concurrent calls, since it uses internal scratch buffers.
+     *
+     * \param id Message id
+     * \param isRtr Whether the message is a Remote Transmission Request
+     * \param isExtendedId Whether the message has an extended (29 bit) ID
+     * \param matches Populated with indices of all matching listeners, in ascending order
+     */
+    void match(CanMessageId id, bool isRtr, bool isExtendedId, std::vector<size_t>& matches);
+
+    /**
+     * Builds kernel-side (CAN_RAW_FILTER) equivalent of the filters.
+     *
+     * Kernel filters can only express a union of accepted messages, so they are a pre-filter and
+     * match() still has to be used for the exact decision.
+     *
+     * \return Kernel filters, or std::nullopt if there is a listener that can't be expressed with
+     *         them (i.e. one with no non-exclude rules, thus accepting most of the traffic)
+     */
+    std::optional<std::vector<struct can_filter>> kernelFilters() const;
+
+  private:
+    struct Entry {
+        size_t listener;
+        FilterFlag rtr;
+        FilterFlag extendedFormat;
+        bool exclude;
+    };
+
+    struct MaskGroup {
+        uint32_t mask;
+        std::unordered_map<CanMessageId, std::vector<Entry>> entriesById;
+    };
+
+    std::vector<MaskGroup> mMaskGroups;
+
+    /** Whether a listener has any non-exclude rules, so one of them has to be satisfied. */
+    std::vector<bool> mHasIncludeRules;
+
+    /** Non-exclude rules of all listeners, for building the kernel filters. */
+    std::vector<CanMessageFilter> mIncludeRules;
+
+    /*
+     * Scratch buffers for match(). Instead of clearing them for every message, a listener is
+     * considered excluded (or included) if its entry is equal to the current generation.
+     */
+    uint32_t mGeneration = 0;
+    std::vector<uint32_t> mExcludedGeneration;
+    std::vector<uint32_t> mIncludedGeneration;
+};
+
+}  // namespace android::hardware::automotive::can::V1_0::implementation
@@ -20,19 +20,137 @@
 #include <libnetdevice/can.h>
 #include <libnetdevice/libnetdevice.h>
 #include <linux/can.h>
+#include <linux/can/raw.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#include <linux/sockios.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <utils/SystemClock.h>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstring>
 
 namespace android::hardware::automotive::can::V1_0::implementation {
 
 using namespace std::chrono_literals;
 
-/* How frequently the read thread checks whether the interface was asked to be down.
+/** Maximum number of frames received with a single recvmmsg(2) call. */
+static constexpr size_t kReadBatchSize = 32;
+
+/** Maximum number of frames sent with a single sendmmsg(2) call. */
+static constexpr size_t kWriteBatchSize = 32;
+
+/* Backoff when the interface TX queue is full (ENOBUFS).
+ *
+ * SocketCAN doesn't block the writer nor signal POLLOUT when the queue drains, so we have to poll.
+ * The delay starts short (a classic frame takes ~0.25ms on a 500kbit bus) and doubles up to
+ * kTxBackoffMax, giving up once kTxBackoffLimit was spent waiting without any progress. The limit
+ * is kept short, since the caller holds the bus lock for the whole send. */
+static constexpr auto kTxBackoffMin = 100us;
+static constexpr auto kTxBackoffMax = 1ms;
+static constexpr auto kTxBackoffLimit = 3ms;
+
+/* Timestamps requested from the kernel.
+ *
+ * Software timestamps are taken when the frame enters the network stack, hardware ones (if the
+ * driver supports them) when it was received by the controller. Either is much closer to the
+ * actual arrival than taking the time after the reader thread wakes up. */
+static constexpr uint32_t kTimestampingFlags = SOF_TIMESTAMPING_RX_HARDWARE |
+                                               SOF_TIMESTAMPING_RAW_HARDWARE |
+                                               SOF_TIMESTAMPING_RX_SOFTWARE |
+                                               SOF_TIMESTAMPING_SOFTWARE;
+
+/* How far a hardware timestamp may precede the software one.
+ *
+ * Hardware timestamps are only used if they look like UNIX time. Many CAN controllers report a
+ * free-running counter instead, which would be nowhere near the software timestamp taken right
+ * after the frame left the controller. */
+static constexpr auto kMaxHwTimestampLead = 10ms;
+
+/** How often to re-measure the offset between the UNIX and boot clocks. */
+static constexpr auto kClockResyncPeriod = 1s;
+
+/** How many clock readings to take when measuring the offset between clocks. */
+static constexpr int kClockSyncSamples = 3;
+
+static std::chrono::nanoseconds toNanoseconds(const struct timespec& ts) {
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+static std::chrono::nanoseconds realtimeNow() {
+    struct timespec ts = {};
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return toNanoseconds(ts);
+}
+
+/**
+ * Converts kernel packet timestamps (UNIX time) to time since boot.
+ *
+ * There is no direct way to convert between these clocks, so we measure the difference between
+ * them, picking the reading with the narrowest window. Since UNIX time might be adjusted at any
+ * moment, the difference is re-measured periodically.
+ */
+class BootClockConverter {
+  public:
+    std::chrono::nanoseconds toBootTime(std::chrono::nanoseconds realtime) {
+        const std::chrono::nanoseconds now(elapsedRealtimeNano());
+        if (!mSynced || now - mLastSync >= kClockResyncPeriod) resync();
+        return realtime - mRealtimeToBootOffset;
+    }
+
+  private:
+    void resync() {
+        auto bestWindow = std::chrono::nanoseconds::max();
+        for (int i = 0; i < kClockSyncSamples; i++) {
+            const std::chrono::nanoseconds before(elapsedRealtimeNano());
+            const auto realtime = realtimeNow();
+            const std::chrono::nanoseconds after(elapsedRealtimeNano());
+
+            if (after - before >= bestWindow) continue;
+            bestWindow = after - before;
+            mRealtimeToBootOffset = realtime - (before + (after - before) / 2);
+            mLastSync = after;
+        }
+        mSynced = true;
+    }
+
+    bool mSynced = false;
+    std::chrono::nanoseconds mLastSync = {};
+    std::chrono::nanoseconds mRealtimeToBootOffset = {};
+};
+
+/**
+ * Extracts the packet timestamp from SCM_TIMESTAMPING control message.
+ *
+ * The software timestamp is always UNIX time. The hardware timestamp is in whatever time base the
+ * driver uses, so it's only preferred if it's slightly before the software one (see
+ * kMaxHwTimestampLead).
  *
- * Note: This does *not* affect read timing or bandwidth, just CPU load vs time to
- *       down the interface. */
-static constexpr auto kReadPooling = 100ms;
+ * \return UNIX timestamp, or zero if there was none
+ */
+static std::chrono::nanoseconds getPacketTimestamp(const struct msghdr& msg) {
+    // CMSG_FIRSTHDR and CMSG_NXTHDR take non-const pointers, but don't modify the message.
+    auto* mutableMsg = const_cast<struct msghdr*>(&msg);
+    for (auto* cmsg = CMSG_FIRSTHDR(mutableMsg); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(mutableMsg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_TIMESTAMPING) continue;
+
+        struct scm_timestamping tss;
+        memcpy(&tss, CMSG_DATA(cmsg), sizeof(tss));
+        // ts[0] is the software timestamp, ts[2] is the raw hardware timestamp.
+        const auto swTs = toNanoseconds(tss.ts[0]);
+        const auto hwTs = toNanoseconds(tss.ts[2]);
+        if (swTs == 0ns) return 0ns;  // hardware timestamp can't be verified without it
+        if (hwTs != 0ns && hwTs <= swTs && swTs - hwTs <= kMaxHwTimestampLead) return hwTs;
+        return swTs;
+    }
+    return 0ns;
+}
 
 std::unique_ptr<CanSocket> CanSocket::open(const std::string& ifname, ReadCallback rdcb,
                                            ErrorCallback errcb) {
@@ -42,18 +160,49 @@ std::unique_ptr<CanSocket> CanSocket::open(const std::string& ifname, ReadCallba
         return nullptr;
     }
 
+    if (setsockopt(sock.get(), SOL_SOCKET, SO_TIMESTAMPING, &kTimestampingFlags,
+                   sizeof(kTimestampingFlags)) < 0) {
+        // Not fatal, we'll fall back to taking the time after receiving a frame.
+        PLOG(WARNING) << "Can't enable packet timestamping on " << ifname;
+    }
+
+    base::unique_fd epoll(epoll_create1(EPOLL_CLOEXEC));
+    base::unique_fd wakeup(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK));
+    if (!epoll.ok() || !wakeup.ok()) {
+        PLOG(ERROR) << "Can't create CAN socket reader wakeup descriptors";
+        return nullptr;
+    }
+
+    for (const auto& fd : {sock.get(), wakeup.get()}) {
+        struct epoll_event ev = {};
+        ev.events = EPOLLIN;
+        ev.data.fd = fd;
+        if (epoll_ctl(epoll.get(), EPOLL_CTL_ADD, fd, &ev) < 0) {
+            PLOG(ERROR) << "Can't add a descriptor to CAN socket epoll";
+            return nullptr;
+        }
+    }
+
     // Can't use std::make_unique due to private CanSocket constructor.
-    return std::unique_ptr<CanSocket>(new CanSocket(std::move(sock), rdcb, errcb));
+    return std::unique_ptr<CanSocket>(
+            new CanSocket(std::move(sock), std::move(epoll), std::move(wakeup), rdcb, errcb));
 }
 
-CanSocket::CanSocket(base::unique_fd socket, ReadCallback rdcb, ErrorCallback errcb)
+CanSocket::CanSocket(base::unique_fd socket, base::unique_fd epoll, base::unique_fd wakeup,
+                     ReadCallback rdcb, ErrorCallback errcb)
     : mReadCallback(rdcb),
       mErrorCallback(errcb),
       mSocket(std::move(socket)),
+      mEpoll(std::move(epoll)),
+      mWakeup(std::move(wakeup)),
       mReaderThread(&CanSocket::readerThread, this) {}
 
 CanSocket::~CanSocket() {
     mStopReaderThread = true;
+    const uint64_t one = 1;
+    if (write(mWakeup.get(), &one, sizeof(one)) < 0) {
+        PLOG(ERROR) << "Can't wake up CAN socket reader thread";
+    }
 
     /* CanSocket can be brought down as a result of read failure, from the same thread,
      * so let's just detach and let it finish on its own. */
@@ -64,80 +213,153 @@ CanSocket::~CanSocket() {
     }
 }
 
-bool CanSocket::send(const struct canfd_frame& frame) {
-    const auto res = write(mSocket.get(), &frame, CAN_MTU);
-    if (res < 0) {
-        PLOG(DEBUG) << "CanSocket send failed";
-        return false;
-    }
-    if (res != CAN_MTU) {
-        LOG(DEBUG) << "CanSocket sent wrong number of bytes: " << res;
-        return false;
+/** Classic CAN frame is a canfd_frame prefix, so it's just sent with a shorter length. */
+static size_t getFrameSize(const struct canfd_frame& frame) {
+    return frame.len > CAN_MAX_DLEN ? CANFD_MTU : CAN_MTU;
+}
+
+CanSocket::SendResult CanSocket::send(const struct canfd_frame* frames, size_t count) {
+    std::array<struct iovec, kWriteBatchSize> iovecs;
+    std::array<struct mmsghdr, kWriteBatchSize> msgs;
+
+    SendResult result = {.sent = 0, .error = SendError::OK};
+    auto backoff = kTxBackoffMin;
+    std::chrono::microseconds waited = 0us;
+    while (result.sent < count) {
+        const auto batchSize = std::min(count - result.sent, kWriteBatchSize);
+        for (size_t i = 0; i < batchSize; i++) {
+            const auto& frame = frames[result.sent + i];
+            // sendmmsg doesn't modify the data, iovec just isn't const-qualified.
+            iovecs[i] = {.iov_base = const_cast<struct canfd_frame*>(&frame),
+                         .iov_len = getFrameSize(frame)};
+            msgs[i] = {};
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const auto res = sendmmsg(mSocket.get(), msgs.data(), batchSize, 0);
+        if (res < 0) {
+            if (errno == EINTR) continue;
+            if (errno == ENOBUFS) {
+                if (waited < kTxBackoffLimit) {
+                    mTxQueueFullRetries++;
+                    std::this_thread::sleep_for(backoff);
+                    waited += backoff;
+                    backoff = std::min<std::chrono::microseconds>(backoff * 2, kTxBackoffMax);
+                    continue;
+                }
+                LOG(DEBUG) << "CanSocket TX queue is still full after " << waited.count() << "us";
+                result.error = SendError::QUEUE_FULL;
+            } else {
+                PLOG(DEBUG) << "CanSocket send failed";
+                result.error = errno == ENETDOWN ? SendError::INTERFACE_DOWN : SendError::FAILED;
+            }
+            break;
+        }
+
+        result.sent += res;
+        backoff = kTxBackoffMin;
+        waited = 0us;
     }
-    return true;
+
+    mTxSentFrames += result.sent;
+    mTxFailedFrames += count - result.sent;
+    return result;
 }
 
-static struct timeval toTimeval(std::chrono::microseconds t) {
-    struct timeval tv;
-    tv.tv_sec = t / 1s;
-    tv.tv_usec = (t % 1s) / 1us;
-    return tv;
+CanSocket::TxStats CanSocket::getTxStats() const {
+    int queuedBytes = 0;
+    if (ioctl(mSocket.get(), SIOCOUTQ, &queuedBytes) < 0) queuedBytes = -1;
+
+    return {
+            .sentFrames = mTxSentFrames,
+            .failedFrames = mTxFailedFrames,
+            .queueFullRetries = mTxQueueFullRetries,
+            .queuedBytes = queuedBytes,
+    };
 }
 
-static int selectRead(const base::unique_fd& fd, std::chrono::microseconds timeout) {
-    auto timeouttv = toTimeval(timeout);
-    fd_set readfds;
-    FD_ZERO(&readfds);
-    FD_SET(fd.get(), &readfds);
-    return select(fd.get() + 1, &readfds, nullptr, nullptr, &timeouttv);
+bool CanSocket::setFilters(const std::vector<struct can_filter>& filters) {
+    if (setsockopt(mSocket.get(), SOL_CAN_RAW, CAN_RAW_FILTER, filters.data(),
+                   filters.size() * sizeof(struct can_filter)) < 0) {
+        PLOG(WARNING) << "Can't set " << filters.size() << " CAN filters";
+        return false;
+    }
+    return true;
 }
 
 void CanSocket::readerThread() {
     LOG(VERBOSE) << "Reader thread started";
     int errnoCopy = 0;
 
-    while (!mStopReaderThread) {
-        /* The ideal would be to have a blocking read(3) call and interrupt it with shutdown(3).
-         * This is unfortunately not supported for SocketCAN, so we need to rely on select(3). */
-        const auto sel = selectRead(mSocket, kReadPooling);
-        if (sel == 0) continue;  // timeout
-        if (sel == -1) {
-            PLOG(ERROR) << "Select failed";
+    // Receive buffers are allocated once and reused for every batch.
+    std::array<struct canfd_frame, kReadBatchSize> frames;
+    std::array<struct iovec, kReadBatchSize> iovecs;
+    std::array<struct mmsghdr, kReadBatchSize> msgs;
+    union ControlBuffer {
+        char buf[CMSG_SPACE(sizeof(struct scm_timestamping))];
+        struct cmsghdr align;
+    };
+    std::array<ControlBuffer, kReadBatchSize> controls;
+
+    std::vector<Frame> batch;
+    batch.reserve(kReadBatchSize);
+    BootClockConverter clockConverter;
+
+    bool failed = false;
+    while (!mStopReaderThread && !failed) {
+        struct epoll_event ev;
+        const auto nfds = epoll_wait(mEpoll.get(), &ev, 1, -1);
+        if (nfds < 0) {
+            if (errno == EINTR) continue;
+            PLOG(ERROR) << "epoll_wait failed";
             break;
         }
+        if (nfds == 0 || ev.data.fd != mSocket.get()) continue;  // woken up to stop
+
+        // Drain everything that's pending, kReadBatchSize frames at a time.
+        int received;
+        do {
+            for (size_t i = 0; i < kReadBatchSize; i++) {
+                iovecs[i] = {.iov_base = &frames[i], .iov_len = CAN_MTU};
+                msgs[i] = {};
+                msgs[i].msg_hdr.msg_iov = &iovecs[i];
+                msgs[i].msg_hdr.msg_iovlen = 1;
+                msgs[i].msg_hdr.msg_control = controls[i].buf;
+                msgs[i].msg_hdr.msg_controllen = sizeof(controls[i].buf);
+            }
 
-        struct canfd_frame frame;
-        const auto nbytes = read(mSocket.get(), &frame, CAN_MTU);
-
-        /* We could use SIOCGSTAMP to get a precise UNIX timestamp for a given packet, but what
-         * we really need is a time since boot. There is no direct way to convert between these
-         * clocks. We could implement a class to calculate the difference between the clocks
-         * (querying both several times and picking the smallest difference); apply the difference
-         * to a SIOCGSTAMP returned value; re-synchronize if the elapsed time is too much in the
-         * past (indicating the UNIX timestamp might have been adjusted).
-         *
-         * Apart from the added complexity, it's possible the added calculations and system calls
-         * would add so much time to the processing pipeline so the precision of the reported time
-         * was buried under the subsystem latency. Let's just use a local time since boot here and
-         * leave precise hardware timestamps for custom proprietary implementations (if needed). */
-        const std::chrono::nanoseconds ts(elapsedRealtimeNano());
-
-        if (nbytes != CAN_MTU) {
-            if (nbytes >= 0) {
-                LOG(ERROR) << "Failed to read CAN packet, got " << nbytes << " bytes";
+            received = recvmmsg(mSocket.get(), msgs.data(), kReadBatchSize, MSG_DONTWAIT, nullptr);
+            if (received < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) break;
+                errnoCopy = errno;
+                PLOG(ERROR) << "Failed to read CAN packets";
+                failed = true;
                 break;
             }
-            if (errno == EAGAIN) continue;
 
-            errnoCopy = errno;
-            PLOG(ERROR) << "Failed to read CAN packet";
-            break;
-        }
+            // Only used for frames the kernel didn't timestamp.
+            const std::chrono::nanoseconds fallbackTs(elapsedRealtimeNano());
+
+            batch.clear();
+            for (int i = 0; i < received; i++) {
+                if (msgs[i].msg_len != CAN_MTU) {
+                    LOG(ERROR) << "Failed to read CAN packet, got " << msgs[i].msg_len
+                               << " bytes";
+                    failed = true;
+                    break;
+                }
+                const auto realtime = getPacketTimestamp(msgs[i].msg_hdr);
+                const auto ts = realtime != 0ns ? clockConverter.toBootTime(realtime) : fallbackTs;
+                batch.push_back({frames[i], ts});
+            }
 
-        mReadCallback(frame, ts);
+            if (!batch.empty()) mReadCallback(batch);
+        } while (!failed && !mStopReaderThread &&
+                 static_cast<size_t>(received) == kReadBatchSize);
     }
 
-    bool failed = !mStopReaderThread;
+    failed = !mStopReaderThread;
     auto errCb = mErrorCallback;
     mReaderThreadFinished = true;
 
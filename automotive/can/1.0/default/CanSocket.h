@@ -22,15 +22,39 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <thread>
+#include <vector>
 
 namespace android::hardware::automotive::can::V1_0::implementation {
 
 /** Wrapper around SocketCAN socket. */
 struct CanSocket {
-    using ReadCallback = std::function<void(const struct canfd_frame&, std::chrono::nanoseconds)>;
+    /** Received frame along with its time of arrival, as time since boot. */
+    struct Frame {
+        struct canfd_frame frame;
+        std::chrono::nanoseconds timestamp;
+    };
+
+    /**
+     * Callback on received messages.
+     *
+     * All frames that were pending in the socket at wakeup are passed in a single call, in the
+     * order of arrival. The vector is only valid for the duration of the call.
+     */
+    using ReadCallback = std::function<void(const std::vector<Frame>& frames)>;
     using ErrorCallback = std::function<void(int errnoVal)>;
 
+    /** Transmit statistics since the socket was opened. */
+    struct TxStats {
+        uint64_t sentFrames;
+        uint64_t failedFrames;
+        /** How many times the interface TX queue was full and we had to back off. */
+        uint64_t queueFullRetries;
+        /** Bytes queued in the kernel, but not yet transmitted. */
+        int queuedBytes;
+    };
+
     /**
      * Open and bind SocketCAN socket.
      *
@@ -43,26 +67,70 @@ struct CanSocket {
                                            ErrorCallback errcb);
     virtual ~CanSocket();
 
+    /** Why send() stopped before sending all frames. */
+    enum class SendError {
+        OK,
+        /** The interface TX queue stayed full for the whole backoff time. */
+        QUEUE_FULL,
+        /** The interface went down. */
+        INTERFACE_DOWN,
+        /** Any other failure, retrying is not expected to help. */
+        FAILED,
+    };
+
+    /** Outcome of send(). */
+    struct SendResult {
+        /** Number of frames sent; these are always the first ones of the batch. */
+        size_t sent;
+        /** OK if all frames were sent, the reason for stopping otherwise. */
+        SendError error;
+    };
+
     /**
-     * Send CAN frame.
+     * Send multiple CAN frames, batching them into as few system calls as possible.
+     *
+     * Frames with payload longer than CAN_MAX_DLEN are sent as CAN FD frames. If the interface TX
+     * queue is full, sending is retried for a short, bounded time instead of dropping the frames.
      *
-     * \param frame Frame to send
+     * \param frames Frames to send, in order
+     * \param count Number of frames
+     * \return How many frames were sent and why sending stopped, if it did
+     */
+    SendResult send(const struct canfd_frame* frames, size_t count);
+
+    TxStats getTxStats() const;
+
+    /**
+     * Replace kernel-side receive filters (CAN_RAW_FILTER).
+     *
+     * Error frames are not affected. An empty filter list means no frames are received.
+     *
+     * \param filters Filters to apply, a frame is received if it matches any of them
      * \return true in case of success, false otherwise
      */
-    bool send(const struct canfd_frame& frame);
+    bool setFilters(const std::vector<struct can_filter>& filters);
 
   private:
-    CanSocket(base::unique_fd socket, ReadCallback rdcb, ErrorCallback errcb);
+    CanSocket(base::unique_fd socket, base::unique_fd epoll, base::unique_fd wakeup,
+              ReadCallback rdcb, ErrorCallback errcb);
     void readerThread();
 
     ReadCallback mReadCallback;
     ErrorCallback mErrorCallback;
 
     const base::unique_fd mSocket;
+    /** Waits for either mSocket being readable or mWakeup being signalled. */
+    const base::unique_fd mEpoll;
+    /** eventfd used to wake the reader thread up on shutdown. */
+    const base::unique_fd mWakeup;
     std::thread mReaderThread;
     std::atomic<bool> mStopReaderThread = false;
     std::atomic<bool> mReaderThreadFinished = false;
 
+    std::atomic<uint64_t> mTxSentFrames = 0;
+    std::atomic<uint64_t> mTxFailedFrames = 0;
+    std::atomic<uint64_t> mTxQueueFullRetries = 0;
+
     DISALLOW_COPY_AND_ASSIGN(CanSocket);
 };
 
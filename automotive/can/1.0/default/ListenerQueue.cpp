@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ListenerQueue.h"
+
+#include <android-base/logging.h>
+#include <android-base/thread_annotations.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace android::hardware::automotive::can::V1_0::implementation {
+
+struct ListenerQueue::State {
+    State(sp<ICanMessageListener> listener, size_t capacity, OverflowPolicy policy)
+        : listener(listener), capacity(capacity), policy(policy) {}
+
+    const sp<ICanMessageListener> listener;
+    const size_t capacity;
+    const OverflowPolicy policy;
+
+    std::mutex guard;
+    std::condition_variable queueChanged;
+    std::deque<CanMessage> queue GUARDED_BY(guard);
+    /** Set while holding guard, so the delivery thread can't miss the notification. */
+    std::atomic<bool> stop = false;
+
+    std::atomic<uint64_t> delivered = 0;
+    std::atomic<uint64_t> dropped = 0;
+    std::atomic<uint64_t> failed = 0;
+};
+
+ListenerQueue::ListenerQueue(sp<ICanMessageListener> listener, size_t capacity,
+                             OverflowPolicy policy)
+    : mState(std::make_shared<State>(listener, capacity, policy)),
+      mDeliveryThread(&ListenerQueue::deliveryThread, mState) {}
+
+ListenerQueue::~ListenerQueue() {
+    {
+        std::lock_guard<std::mutex> lck(mState->guard);
+        mState->stop = true;
+    }
+    mState->queueChanged.notify_all();
+
+    /* The listener may close its handle from within the onReceive callback, destroying the queue
+     * on the delivery thread. Let it finish on its own then, it keeps the state alive. */
+    if (mDeliveryThread.get_id() == std::this_thread::get_id()) {
+        mDeliveryThread.detach();
+    } else {
+        mDeliveryThread.join();
+    }
+}
+
+void ListenerQueue::push(CanMessage message) {
+    auto& state = *mState;
+    {
+        std::lock_guard<std::mutex> lck(state.guard);
+        if (state.queue.size() < state.capacity) {
+            state.queue.push_back(std::move(message));
+        } else {
+            if (state.policy == OverflowPolicy::DROP_OLDEST) {
+                state.queue.pop_front();
+                state.queue.push_back(std::move(message));
+            }
+            const auto dropped = ++state.dropped;
+            // Log the first drop and then every time the count doubles, not to flood the log.
+            if ((dropped & (dropped - 1)) == 0) {
+                LOG(WARNING) << "Listener queue is full, dropped " << dropped << " message(s)";
+            }
+            return;
+        }
+    }
+    state.queueChanged.notify_one();
+}
+
+ListenerQueue::Stats ListenerQueue::getStats() const {
+    auto& state = *mState;
+    std::lock_guard<std::mutex> lck(state.guard);
+    return {
+            .delivered = state.delivered,
+            .dropped = state.dropped,
+            .failed = state.failed,
+            .depth = state.queue.size(),
+    };
+}
+
+ListenerQueue::OverflowPolicy ListenerQueue::getOverflowPolicy() const {
+    return mState->policy;
+}
+
+void ListenerQueue::deliveryThread(std::shared_ptr<State> statePtr) {
+    auto& state = *statePtr;
+    std::deque<CanMessage> batch;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lck(state.guard);
+            state.queueChanged.wait(lck, [&state] {
+                base::ScopedLockAssertion lockAssertion(state.guard);
+                return state.stop || !state.queue.empty();
+            });
+            if (state.stop) break;
+
+            // Take everything that's queued at once, so the reader thread is blocked only briefly.
+            batch.swap(state.queue);
+        }
+
+        /* ICanMessageListener@1.0 only takes a single message per call, so the batch is delivered
+         * message by message, without holding the lock. */
+        for (auto& message : batch) {
+            if (state.stop) break;
+            if (!state.listener->onReceive(message).isOk()) {
+                if (state.failed++ == 0) LOG(WARNING) << "Failed to notify listener about message";
+                continue;
+            }
+            state.delivered++;
+        }
+        batch.clear();
+    }
+}
+
+const char* toString(ListenerQueue::OverflowPolicy policy) {
+    switch (policy) {
+        case ListenerQueue::OverflowPolicy::DROP_OLDEST:
+            return "DROP_OLDEST";
+        case ListenerQueue::OverflowPolicy::DROP_NEWEST:
+            return "DROP_NEWEST";
+    }
+    return "UNKNOWN";
+}
+
+}  // namespace android::hardware::automotive::can::V1_0::implementation
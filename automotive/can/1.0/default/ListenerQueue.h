@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <android-base/macros.h>
+#include <android/hardware/automotive/can/1.0/ICanMessageListener.h>
+
+#include <memory>
+#include <thread>
+
+namespace android::hardware::automotive::can::V1_0::implementation {
+
+/**
+ * Bounded queue delivering messages to a single listener from its own worker thread.
+ *
+ * This way a slow listener can't stall the socket reader thread (which would overflow the kernel
+ * receive buffer and drop frames for everyone); it only loses its own messages.
+ */
+struct ListenerQueue {
+    /** What to do with a new message when the queue is full. */
+    enum class OverflowPolicy {
+        /** Drop the oldest queued message, so the listener gets the most recent data. */
+        DROP_OLDEST,
+        /** Drop the new message, so the listener gets a contiguous (but stale) stream. */
+        DROP_NEWEST,
+    };
+
+    struct Stats {
+        uint64_t delivered;
+        uint64_t dropped;
+        uint64_t failed;
+        size_t depth;
+    };
+
+    /**
+     * Create a queue and start its delivery thread.
+     *
+     * \param listener Listener to deliver messages to
+     * \param capacity Maximum number of messages waiting for delivery
+     * \param policy What to do when the queue is full
+     */
+    ListenerQueue(sp<ICanMessageListener> listener, size_t capacity, OverflowPolicy policy);
+    ~ListenerQueue();
+
+    /**
+     * Queue a message for delivery. Never blocks on the listener.
+     *
+     * \param message Message to deliver
+     */
+    void push(CanMessage message);
+
+    /** Delivery statistics since the queue was created. */
+    Stats getStats() const;
+
+    OverflowPolicy getOverflowPolicy() const;
+
+  private:
+    struct State;
+
+    static void deliveryThread(std::shared_ptr<State> state);
+
+    /* Shared with the delivery thread, so it can outlive ListenerQueue if the queue gets destroyed
+     * from within the listener callback (i.e. on the delivery thread itself). */
+    const std::shared_ptr<State> mState;
+    std::thread mDeliveryThread;
+
+    DISALLOW_COPY_AND_ASSIGN(ListenerQueue);
+};
+
+const char* toString(ListenerQueue::OverflowPolicy policy);
+
+}  // namespace android::hardware::automotive::can::V1_0::implementation
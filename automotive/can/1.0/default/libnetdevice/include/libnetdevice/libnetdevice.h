@@ -111,6 +111,27 @@ bool up(std::string ifname);
  */
 bool down(std::string ifname);
 
+/**
+ * Brings multiple network interfaces up.
+ *
+ * Unlike calling up(std::string) for every interface, this pipelines the requests in Netlink
+ * batches and collects the ACKs per batch, saving a round trip per interface.
+ *
+ * \param ifnames Interfaces to bring up
+ * \return true if all interfaces were brought up, false otherwise
+ */
+bool upAll(const std::set<std::string>& ifnames);
+
+/**
+ * Brings multiple network interfaces down.
+ *
+ * \see upAll(const std::set<std::string>&)
+ *
+ * \param ifnames Interfaces to bring down
+ * \return true if all interfaces were brought down, false otherwise
+ */
+bool downAll(const std::set<std::string>& ifnames);
+
 /**
  * Adds virtual link.
  *
@@ -20,6 +20,7 @@
 #include "ifreqs.h"
 
 #include <android-base/logging.h>
+#include <libnl++/MessageArena.h>
 #include <libnl++/MessageFactory.h>
 #include <libnl++/Socket.h>
 
@@ -31,6 +32,12 @@
 
 namespace android::netdevice {
 
+/** Maximum number of link requests sent to the Kernel in a single Netlink batch. */
+static constexpr size_t kLinkBatchSize = 32;
+
+/** Space for a single link request: header, ifinfomsg and IFLA_IFNAME, with some margin. */
+static constexpr size_t kLinkRequestSize = 64;
+
 void useSocketDomain(int domain) {
     ifreqs::socketDomain = domain;
 }
@@ -53,6 +60,42 @@ bool down(std::string ifname) {
     return ifreqs::send(SIOCSIFFLAGS, ifr);
 }
 
+static bool setUpAll(const std::set<std::string>& ifnames, bool up) {
+    alignas(NLMSG_ALIGNTO) uint8_t buffer[kLinkBatchSize * kLinkRequestSize];
+    nl::MessageArena batch(buffer, sizeof(buffer));
+    nl::Socket sock(NETLINK_ROUTE);
+
+    bool succeeded = true;
+    const auto flush = [&sock, &batch, &succeeded]() {
+        if (!sock.send(batch) || !sock.receiveAcks(batch)) succeeded = false;
+        batch.clear();
+    };
+
+    for (const auto& ifname : ifnames) {
+        if (batch.count() == kLinkBatchSize) flush();
+
+        auto req = batch.add<ifinfomsg>(RTM_NEWLINK, NLM_F_REQUEST | NLM_F_ACK);
+        if (!req.has_value()) {
+            LOG(ERROR) << "Can't fit link request for " << ifname << " in the batch";
+            return false;
+        }
+        req->data.ifi_flags = up ? IFF_UP : 0;
+        req->data.ifi_change = IFF_UP;
+        req->add(IFLA_IFNAME, ifname);
+    }
+    flush();
+
+    return succeeded;
+}
+
+bool upAll(const std::set<std::string>& ifnames) {
+    return setUpAll(ifnames, true);
+}
+
+bool downAll(const std::set<std::string>& ifnames) {
+    return setUpAll(ifnames, false);
+}
+
 bool add(std::string dev, std::string type) {
     nl::MessageFactory<ifinfomsg> req(RTM_NEWLINK,
                                       NLM_F_REQUEST | NLM_F_CREATE | NLM_F_EXCL | NLM_F_ACK);
@@ -199,7 +242,8 @@ std::optional<std::string> waitFor(std::set<std::string> ifnames, WaitCondition
         if (const auto msg = nl::Message<ifinfomsg>::parse(rawMsg, {RTM_NEWLINK, RTM_DELLINK});
             msg.has_value()) {
             // Interface added / removed
-            const auto ifname = msg->attributes.get<std::string>(IFLA_IFNAME);
+            const auto ifname =
+                    std::string(msg->attributes.find<std::string_view>(IFLA_IFNAME).value_or(""));
             if (ifnames.count(ifname) == 0) continue;
 
             auto& state = states[ifname];
@@ -211,7 +255,8 @@ std::optional<std::string> waitFor(std::set<std::string> ifnames, WaitCondition
                            nl::Message<ifaddrmsg>::parse(rawMsg, {RTM_NEWADDR, RTM_DELADDR});
                    msg.has_value()) {
             // Address added / removed
-            const auto ifname = msg->attributes.get<std::string>(IFLA_IFNAME);
+            const auto ifname =
+                    std::string(msg->attributes.find<std::string_view>(IFLA_IFNAME).value_or(""));
             if (ifnames.count(ifname) == 0) continue;
 
             if (msg->header.nlmsg_type == RTM_NEWADDR) {
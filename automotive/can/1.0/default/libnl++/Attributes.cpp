@@ -35,6 +35,20 @@ const Attributes::Index& Attributes::index() const {
     return index;
 }
 
+std::optional<Buffer<nlattr>> Attributes::findBuffer(nlattrtype_t attrtype) const {
+    if (mIndex.has_value()) {
+        const auto it = mIndex->find(attrtype);
+        if (it == mIndex->end()) return std::nullopt;
+        return it->second;
+    }
+
+    // The first occurrence wins, the same as in the index.
+    for (const auto attr : static_cast<Buffer<nlattr>>(*this)) {
+        if (attr->nla_type == attrtype) return attr;
+    }
+    return std::nullopt;
+}
+
 bool Attributes::contains(nlattrtype_t attrtype) const {
     return index().count(attrtype) > 0;
 }
@@ -47,13 +61,16 @@ Attributes Attributes::parse(Buffer<nlattr> buf) {
 }
 
 template <>
-std::string Attributes::parse(Buffer<nlattr> buf) {
+std::string_view Attributes::parse(Buffer<nlattr> buf) {
     const auto rawString = buf.data<char>().getRaw();
-    std::string str(rawString.ptr(), rawString.len());
+    std::string_view str(rawString.ptr(), rawString.len());
 
-    str.erase(std::find(str.begin(), str.end(), '\0'), str.end());
+    return str.substr(0, str.find('\0'));
+}
 
-    return str;
+template <>
+std::string Attributes::parse(Buffer<nlattr> buf) {
+    return std::string(parse<std::string_view>(buf));
 }
 
 template <typename T>
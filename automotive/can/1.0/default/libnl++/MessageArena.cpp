@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <libnl++/MessageArena.h>
+
+#include <android-base/logging.h>
+#include <libnl++/bits.h>
+
+namespace android::nl {
+
+MessageArena::MessageArena(void* buffer, size_t size)
+    : mBuffer(static_cast<uint8_t*>(buffer)), mSize(size) {
+    CHECK(uintptr_t(buffer) % NLMSG_ALIGNTO == 0) << "Message arena buffer is not aligned";
+}
+
+size_t MessageArena::usedLength() const {
+    if (mLast == nullptr) return 0;
+    return uintptr_t(mLast) - uintptr_t(mBuffer) + mLast->nlmsg_len;
+}
+
+nlmsghdr* MessageArena::allocate(size_t headerLen) {
+    const auto offset = impl::align(usedLength());
+    if (offset + headerLen > mSize) return nullptr;
+
+    auto hdr = reinterpret_cast<nlmsghdr*>(mBuffer + offset);
+    memset(hdr, 0, headerLen);
+    hdr->nlmsg_len = headerLen;
+
+    mLast = hdr;
+    mCount++;
+    return hdr;
+}
+
+size_t MessageArena::count() const {
+    return mCount;
+}
+
+void MessageArena::setSequenceNumbers(uint32_t firstSeq) {
+    auto hdr = reinterpret_cast<nlmsghdr*>(mBuffer);
+    for (size_t i = 0; i < mCount; i++) {
+        hdr->nlmsg_seq = firstSeq + i;
+        hdr = reinterpret_cast<nlmsghdr*>(uintptr_t(hdr) + impl::align(hdr->nlmsg_len));
+    }
+}
+
+uint32_t MessageArena::firstSequenceNumber() const {
+    if (mCount == 0) return 0;
+    return reinterpret_cast<const nlmsghdr*>(mBuffer)->nlmsg_seq;
+}
+
+std::optional<Buffer<nlmsghdr>> MessageArena::build() const {
+    if (!mIsGood || mCount == 0) return std::nullopt;
+    return {{reinterpret_cast<const nlmsghdr*>(mBuffer), usedLength()}};
+}
+
+void MessageArena::clear() {
+    mLast = nullptr;
+    mCount = 0;
+    mIsGood = true;
+}
+
+}  // namespace android::nl
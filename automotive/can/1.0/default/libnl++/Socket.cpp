@@ -79,6 +79,24 @@ bool Socket::send(const Buffer<nlmsghdr>& msg, const sockaddr_nl& sa) {
     return true;
 }
 
+bool Socket::send(MessageArena& batch) {
+    if (batch.count() == 0) return true;
+
+    const auto firstSeq = mSeq + 1;
+    batch.setSequenceNumbers(firstSeq);
+
+    const auto msgs = batch.build();
+    if (!msgs.has_value()) return false;
+
+    sockaddr_nl sa = {};
+    sa.nl_family = AF_NETLINK;
+    sa.nl_pid = 0;  // Kernel
+    if (!send(*msgs, sa)) return false;
+
+    mSeq = firstSeq + batch.count() - 1;
+    return true;
+}
+
 bool Socket::send(const Buffer<nlmsghdr>& msg, uint32_t destination) {
     sockaddr_nl sa = {.nl_family = AF_NETLINK, .nl_pad = 0, .nl_pid = destination, .nl_groups = 0};
     return send(msg, sa);
@@ -132,18 +150,47 @@ std::pair<std::optional<Buffer<nlmsghdr>>, sockaddr_nl> Socket::receiveFrom(size
 }
 
 bool Socket::receiveAck(uint32_t seq) {
-    const auto nlerr = receive<nlmsgerr>({NLMSG_ERROR});
-    if (!nlerr.has_value()) return false;
+    return receiveAcks(seq, 1);
+}
 
-    if (nlerr->data.msg.nlmsg_seq != seq) {
-        LOG(ERROR) << "Received ACK for a different message (" << nlerr->data.msg.nlmsg_seq
-                   << ", expected " << seq << "). Multi-message tracking is not implemented.";
-        return false;
-    }
+bool Socket::receiveAcks(const MessageArena& batch) {
+    return receiveAcks(batch.firstSequenceNumber(), batch.count());
+}
+
+bool Socket::receiveAcks(uint32_t firstSeq, size_t count) {
+    if (count == 0) return true;
+    if (mFailed) return false;
+
+    size_t acked = 0;
+    bool allSucceeded = true;
+    for (const auto rawMsg : *this) {
+        if (rawMsg->nlmsg_type != NLMSG_ERROR) {
+            LOG(WARNING) << "Received (and ignored) unexpected Netlink message of type "
+                         << rawMsg->nlmsg_type;
+            continue;
+        }
 
-    if (nlerr->data.error == 0) return true;
+        const auto nlerr = Message<nlmsgerr>::parse(rawMsg);
+        if (!nlerr.has_value()) {
+            LOG(WARNING) << "Received matching Netlink message, but couldn't parse it";
+            return false;
+        }
+
+        const auto seq = nlerr->data.msg.nlmsg_seq;
+        if (seq - firstSeq >= count) {
+            LOG(ERROR) << "Received ACK for a different message (" << seq << ", expected "
+                       << firstSeq << (count > 1 ? "+" : "") << ")";
+            return false;
+        }
+
+        if (nlerr->data.error != 0) {
+            LOG(WARNING) << "Received Netlink error message: " << strerror(-nlerr->data.error);
+            allSucceeded = false;
+        }
+
+        if (++acked == count) return allSucceeded;
+    }
 
-    LOG(WARNING) << "Received Netlink error message: " << strerror(-nlerr->data.error);
     return false;
 }
 
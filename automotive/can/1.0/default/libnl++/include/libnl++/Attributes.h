@@ -22,6 +22,7 @@
 #include <utils/Mutex.h>
 
 #include <map>
+#include <optional>
 
 namespace android::nl {
 
@@ -102,6 +103,27 @@ class Attributes : private Buffer<nlattr> {
         return parse<T>(*buffer);
     }
 
+    /**
+     * Fetches attribute of a given type without copying its data.
+     *
+     * Unlike get(nlattrtype_t), this method doesn't calculate the index (but uses it, if it's
+     * already there), scanning the attributes instead. For the usual case of looking up a few
+     * attributes of a short-lived message, this is cheaper and doesn't allocate any memory.
+     *
+     * Variable-length data is returned as views of the underlying buffer: use std::string_view for
+     * strings and nl::Attributes for nested attributes. These are valid as long as the buffer is.
+     *
+     * \param attrtype Attribute to fetch.
+     * \return Attribute value or std::nullopt, if the attribute doesn't exist.
+     */
+    template <typename T>
+    std::optional<T> find(nlattrtype_t attrtype) const {
+        const auto buffer = findBuffer(attrtype);
+        if (!buffer.has_value()) return std::nullopt;
+
+        return parse<T>(*buffer);
+    }
+
     /**
      * Fetches underlying buffer of a given attribute.
      *
@@ -172,6 +194,14 @@ class Attributes : private Buffer<nlattr> {
      */
     const Index& index() const;
 
+    /**
+     * Look up attribute buffer without calculating the index.
+     *
+     * \param attrtype Attribute to fetch.
+     * \return Attribute buffer or std::nullopt, if the attribute doesn't exist.
+     */
+    std::optional<Buffer<nlattr>> findBuffer(nlattrtype_t attrtype) const;
+
     /**
      * Parse attribute data into a specific type.
      *
@@ -19,6 +19,8 @@
 #include <libnl++/Attributes.h>
 #include <libnl++/Buffer.h>
 
+#include <algorithm>
+#include <initializer_list>
 #include <set>
 
 namespace android::nl {
@@ -72,6 +74,29 @@ class Message : public Buffer<nlmsghdr> {
         return parse(buf);
     }
 
+    /**
+     * Validate buffer contents as a message of a given type and create instance of parsed message.
+     *
+     * This overload is picked for inline lists of types, such as {RTM_NEWLINK, RTM_DELLINK},
+     * which don't need to be copied into a std::set for every parsed message.
+     *
+     * \param buf Buffer containing the message.
+     * \param msgtypes Acceptable message types (within a specific Netlink protocol)
+     * \return Parsed message or nullopt, if the buffer data is invalid or message type
+     *         doesn't match.
+     */
+    static std::optional<Message<T>> parse(Buffer<nlmsghdr> buf,
+                                           std::initializer_list<nlmsgtype_t> msgtypes) {
+        const auto& [nlOk, nlHeader] = buf.getFirst();
+        if (!nlOk) return std::nullopt;
+
+        if (std::find(msgtypes.begin(), msgtypes.end(), nlHeader.nlmsg_type) == msgtypes.end()) {
+            return std::nullopt;
+        }
+
+        return parse(buf);
+    }
+
     /**
      * Netlink message header.
      *
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <android-base/macros.h>
+#include <libnl++/Buffer.h>
+#include <libnl++/MessageFactory.h>
+#include <libnl++/types.h>
+
+#include <linux/netlink.h>
+
+#include <optional>
+
+namespace android::nl {
+
+/**
+ * Builds a batch of Netlink messages in a caller-provided buffer.
+ *
+ * The messages are laid out back to back, the same way the kernel expects multiple requests in a
+ * single datagram, so the whole batch can be sent with one Socket::send(MessageArena&) call and
+ * acknowledged with one Socket::receiveAcks(const MessageArena&) call. Nothing is allocated on the
+ * heap.
+ *
+ * Only the most recently added message may get new attributes, since it's the one growing into
+ * the remaining space of the buffer.
+ *
+ * Example usage:
+ *    alignas(NLMSG_ALIGNTO) uint8_t buffer[1024];
+ *    MessageArena batch(buffer, sizeof(buffer));
+ *    for (const auto& ifname : ifnames) {
+ *        auto req = batch.add<ifinfomsg>(RTM_NEWLINK, NLM_F_REQUEST | NLM_F_ACK);
+ *        if (!req.has_value()) break;  // buffer is full, send what we have so far
+ *        req->add(IFLA_IFNAME, ifname);
+ *    }
+ *    sock.send(batch) && sock.receiveAcks(batch);
+ */
+class MessageArena {
+  public:
+    /**
+     * Create empty batch.
+     *
+     * \param buffer Memory to build messages in, aligned to NLMSG_ALIGNTO. It must outlive the
+     *        arena and any messages built from it.
+     * \param size Buffer size.
+     */
+    MessageArena(void* buffer, size_t size);
+
+    /**
+     * Start a new message at the end of the batch.
+     *
+     * \param type Message type (such as RTM_NEWLINK).
+     * \param flags Message flags (such as NLM_F_REQUEST).
+     * \return Builder for the new message, or std::nullopt if there is no space left for its
+     *         header and payload.
+     */
+    template <class T>
+    std::optional<MessageBuilder<T>> add(nlmsgtype_t type, uint16_t flags) {
+        static_assert(alignof(T) <= NLMSG_ALIGNTO, "Payload can't be aligned in the batch");
+
+        auto hdr = allocate(NLMSG_HDRLEN + sizeof(T));
+        if (hdr == nullptr) return std::nullopt;
+        hdr->nlmsg_type = type;
+        hdr->nlmsg_flags = flags;
+        return MessageBuilder<T>(*hdr, mSize - (uintptr_t(hdr) - uintptr_t(mBuffer)), mIsGood);
+    }
+
+    /**
+     * Number of messages in the batch.
+     */
+    size_t count() const;
+
+    /**
+     * Assign consecutive sequence numbers to the messages.
+     *
+     * \param firstSeq Sequence number of the first message.
+     */
+    void setSequenceNumbers(uint32_t firstSeq);
+
+    /**
+     * Sequence number of the first message, as set by setSequenceNumbers(uint32_t).
+     */
+    uint32_t firstSequenceNumber() const;
+
+    /**
+     * Build the batch.
+     *
+     * \return All messages in one buffer or std::nullopt, if the batch is empty or any attribute
+     *         couldn't be added.
+     */
+    std::optional<Buffer<nlmsghdr>> build() const;
+
+    /**
+     * Remove all messages, to reuse the buffer for a new batch.
+     */
+    void clear();
+
+  private:
+    uint8_t* const mBuffer;
+    const size_t mSize;
+
+    nlmsghdr* mLast = nullptr;
+    size_t mCount = 0;
+    bool mIsGood = true;
+
+    nlmsghdr* allocate(size_t headerLen);
+    size_t usedLength() const;
+
+    DISALLOW_COPY_AND_ASSIGN(MessageArena);
+};
+
+}  // namespace android::nl
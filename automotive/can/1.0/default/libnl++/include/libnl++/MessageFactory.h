@@ -33,34 +33,20 @@ class MessageFactoryBase {
     static void closeNested(nlmsghdr* msg, nlattr* nested);
 };
 
+class MessageArena;
+
 /**
- * Wrapper around NETLINK_ROUTE messages, to build them in C++ style.
+ * Netlink message builder, writing the message in place into memory it doesn't own.
+ *
+ * This is the common part of MessageFactory (building a message in its own, fixed-size buffer) and
+ * MessageArena (building multiple messages in a caller-provided buffer), use one of these to get
+ * an instance.
  *
  * \param T Message payload type (such as ifinfomsg).
- * \param BUFSIZE how much space to reserve for attributes.
  */
-template <class T, unsigned int BUFSIZE = 128>
-class MessageFactory : private MessageFactoryBase {
-    struct alignas(NLMSG_ALIGNTO) Message {
-        nlmsghdr header;
-        T data;
-        uint8_t attributesBuffer[BUFSIZE];
-    };
-
+template <class T>
+class MessageBuilder : private MessageFactoryBase {
   public:
-    /**
-     * Create empty message.
-     *
-     * \param type Message type (such as RTM_NEWLINK).
-     * \param flags Message flags (such as NLM_F_REQUEST).
-     */
-    MessageFactory(nlmsgtype_t type, uint16_t flags)
-        : header(mMessage.header), data(mMessage.data) {
-        mMessage.header.nlmsg_len = offsetof(Message, attributesBuffer);
-        mMessage.header.nlmsg_type = type;
-        mMessage.header.nlmsg_flags = flags;
-    }
-
     /**
      * Netlink message header.
      *
@@ -75,22 +61,23 @@ class MessageFactory : private MessageFactoryBase {
      */
     T& data;
 
-    T* operator->() { return &mMessage.data; }
+    T* operator->() { return &data; }
 
     /**
      * Build netlink message.
      *
-     * In fact, this operation is almost a no-op, since the factory builds the message in a single
-     * buffer, using native data structures.
+     * In fact, this operation is almost a no-op, since the builder writes the message directly
+     * into the target buffer, using native data structures.
      *
-     * A likely failure case is when the BUFSIZE template parameter is too small to acommodate
-     * added attributes. In such a case, please increase this parameter.
+     * A likely failure case is when the buffer is too small to acommodate added attributes. In such
+     * a case, please increase the BUFSIZE template parameter of MessageFactory or the MessageArena
+     * buffer size.
      *
      * \return Netlink message or std::nullopt in case of failure.
      */
     std::optional<Buffer<nlmsghdr>> build() const {
         if (!mIsGood) return std::nullopt;
-        return {{&mMessage.header, mMessage.header.nlmsg_len}};
+        return {{&header, header.nlmsg_len}};
     }
 
     /**
@@ -123,12 +110,12 @@ class MessageFactory : private MessageFactoryBase {
     /** Guard class to frame nested attributes. \see addNested(nlattrtype_t). */
     class [[nodiscard]] NestedGuard {
       public:
-        NestedGuard(MessageFactory& req, nlattrtype_t type)
+        NestedGuard(MessageBuilder& req, nlattrtype_t type)
             : mReq(req), mAttr(req.addInternal(type)) {}
-        ~NestedGuard() { closeNested(&mReq.mMessage.header, mAttr); }
+        ~NestedGuard() { closeNested(&mReq.header, mAttr); }
 
       private:
-        MessageFactory& mReq;
+        MessageBuilder& mReq;
         nlattr* mAttr;
 
         DISALLOW_COPY_AND_ASSIGN(NestedGuard);
@@ -157,16 +144,70 @@ class MessageFactory : private MessageFactoryBase {
      */
     NestedGuard addNested(nlattrtype_t type) { return {*this, type}; }
 
+  protected:
+    /**
+     * Wrap already initialized message header and payload.
+     *
+     * \param hdr Message header, followed by the payload.
+     * \param maxLen Space available for the whole message, starting at the header.
+     * \param isGood Message state, set to false if any attribute couldn't be added.
+     */
+    MessageBuilder(nlmsghdr& hdr, size_t maxLen, bool& isGood)
+        : header(hdr), data(*impl::data<nlmsghdr, T>(&hdr)), mMaxLen(maxLen), mIsGood(isGood) {}
+
   private:
-    Message mMessage = {};
-    bool mIsGood = true;
+    const size_t mMaxLen;
+    bool& mIsGood;
 
     nlattr* addInternal(nlattrtype_t type, const void* data = nullptr, size_t len = 0) {
         if (!mIsGood) return nullptr;
-        auto attr = MessageFactoryBase::add(&mMessage.header, sizeof(mMessage), type, data, len);
+        auto attr = MessageFactoryBase::add(&header, mMaxLen, type, data, len);
         if (attr == nullptr) mIsGood = false;
         return attr;
     }
+
+    friend class MessageArena;
+};
+
+/**
+ * Wrapper around NETLINK_ROUTE messages, to build them in C++ style.
+ *
+ * The message is built in a buffer embedded in the factory, so it doesn't allocate. To build
+ * multiple messages to send in one go, \see MessageArena.
+ *
+ * \param T Message payload type (such as ifinfomsg).
+ * \param BUFSIZE how much space to reserve for attributes.
+ */
+template <class T, unsigned int BUFSIZE = 128>
+class MessageFactory : public MessageBuilder<T> {
+    struct alignas(NLMSG_ALIGNTO) Message {
+        nlmsghdr header;
+        T data;
+        uint8_t attributesBuffer[BUFSIZE];
+    };
+    static_assert(offsetof(Message, data) == NLMSG_HDRLEN);
+
+  public:
+    /**
+     * Create empty message.
+     *
+     * \param type Message type (such as RTM_NEWLINK).
+     * \param flags Message flags (such as NLM_F_REQUEST).
+     */
+    MessageFactory(nlmsgtype_t type, uint16_t flags)
+        : MessageBuilder<T>(mMessage.header, sizeof(mMessage), mIsGood) {
+        mMessage.header.nlmsg_len = offsetof(Message, attributesBuffer);
+        mMessage.header.nlmsg_type = type;
+        mMessage.header.nlmsg_flags = flags;
+    }
+
+  private:
+    // Initialized after MessageBuilder, which only keeps references to these fields.
+    Message mMessage = {};
+    bool mIsGood = true;
+
+    // A copy would keep the MessageBuilder references to the fields of the original.
+    DISALLOW_COPY_AND_ASSIGN(MessageFactory);
 };
 
 }  // namespace android::nl
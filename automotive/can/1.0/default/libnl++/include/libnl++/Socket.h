@@ -20,6 +20,7 @@
 #include <android-base/unique_fd.h>
 #include <libnl++/Buffer.h>
 #include <libnl++/Message.h>
+#include <libnl++/MessageArena.h>
 #include <libnl++/MessageFactory.h>
 
 #include <linux/netlink.h>
@@ -66,8 +67,8 @@ class Socket {
      * \param msg Message to send. Its sequence number will be updated.
      * \return true, if succeeded.
      */
-    template <typename T, unsigned BUFSIZE>
-    bool send(MessageFactory<T, BUFSIZE>& req) {
+    template <typename T>
+    bool send(MessageBuilder<T>& req) {
         sockaddr_nl sa = {};
         sa.nl_family = AF_NETLINK;
         sa.nl_pid = 0;  // Kernel
@@ -81,8 +82,8 @@ class Socket {
      * \param sa Destination address.
      * \return true, if succeeded.
      */
-    template <typename T, unsigned BUFSIZE>
-    bool send(MessageFactory<T, BUFSIZE>& req, const sockaddr_nl& sa) {
+    template <typename T>
+    bool send(MessageBuilder<T>& req, const sockaddr_nl& sa) {
         req.header.nlmsg_seq = mSeq + 1;
 
         const auto msg = req.build();
@@ -91,6 +92,18 @@ class Socket {
         return send(*msg, sa);
     }
 
+    /**
+     * Send a batch of Netlink messages to the Kernel, in a single datagram.
+     *
+     * The Kernel processes all of them before replying, so this saves a round trip per message
+     * compared to sending them one by one. Use receiveAcks(const MessageArena&) to collect the
+     * ACKs afterwards.
+     *
+     * \param batch Messages to send. Their sequence numbers will be updated.
+     * \return true, if succeeded (or there was nothing to send).
+     */
+    bool send(MessageArena& batch);
+
     /**
      * Send Netlink message.
      *
@@ -169,8 +182,8 @@ class Socket {
      * \param req Message to match sequence number against.
      * \return true if received ACK message, false in case of error.
      */
-    template <typename T, unsigned BUFSIZE>
-    bool receiveAck(MessageFactory<T, BUFSIZE>& req) {
+    template <typename T>
+    bool receiveAck(MessageBuilder<T>& req) {
         return receiveAck(req.header.nlmsg_seq);
     }
 
@@ -182,6 +195,25 @@ class Socket {
      */
     bool receiveAck(uint32_t seq);
 
+    /**
+     * Receive Netlink ACK messages for a batch sent with send(MessageArena&).
+     *
+     * \param batch Messages to match sequence numbers against.
+     * \return true if all messages were ACKed without an error, false otherwise.
+     */
+    bool receiveAcks(const MessageArena& batch);
+
+    /**
+     * Receive Netlink ACK messages for consecutive sequence numbers.
+     *
+     * All ACKs are collected, even if some of them carry an error. They may arrive in any order.
+     *
+     * \param firstSeq Sequence number of the first message to ACK.
+     * \param count Number of messages to ACK.
+     * \return true if all messages were ACKed without an error, false otherwise.
+     */
+    bool receiveAcks(uint32_t firstSeq, size_t count);
+
     /**
      * Fetches the socket PID.
      *
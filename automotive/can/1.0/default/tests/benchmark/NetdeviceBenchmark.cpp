@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <libnetdevice/libnetdevice.h>
+#include <libnl++/Message.h>
+#include <libnl++/MessageFactory.h>
+
+#include <benchmark/benchmark.h>
+#include <linux/if.h>
+#include <linux/rtnetlink.h>
+
+#include <set>
+#include <string>
+
+namespace android::netdevice::benchmark {
+
+using ::benchmark::State;
+
+/**
+ * Virtual CAN interfaces to run the bring-up benchmarks on.
+ *
+ * Creating them requires root and vcan support in the kernel; the benchmarks are skipped otherwise.
+ */
+class VcanInterfaces {
+  public:
+    VcanInterfaces(size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            const auto ifname = "bmvcan" + std::to_string(i);
+            if (exists(ifname) || add(ifname, "vcan")) mIfnames.insert(ifname);
+        }
+        mOk = mIfnames.size() == count;
+    }
+
+    ~VcanInterfaces() {
+        for (const auto& ifname : mIfnames) del(ifname);
+    }
+
+    bool ok() const { return mOk; }
+    const std::set<std::string>& ifnames() const { return mIfnames; }
+
+  private:
+    std::set<std::string> mIfnames;
+    bool mOk;
+};
+
+static void BM_UpOneByOne(State& state) {
+    VcanInterfaces vcans(state.range(0));
+    if (!vcans.ok()) return state.SkipWithError("Can't create vcan interfaces (not root?)");
+
+    for (auto _ : state) {
+        for (const auto& ifname : vcans.ifnames()) {
+            if (!up(ifname)) return state.SkipWithError("Failed to bring interface up");
+        }
+
+        state.PauseTiming();
+        downAll(vcans.ifnames());
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_UpOneByOne)->Arg(1)->Arg(8)->Arg(64)->UseRealTime();
+
+static void BM_UpBatched(State& state) {
+    VcanInterfaces vcans(state.range(0));
+    if (!vcans.ok()) return state.SkipWithError("Can't create vcan interfaces (not root?)");
+
+    for (auto _ : state) {
+        if (!upAll(vcans.ifnames())) return state.SkipWithError("Failed to bring interfaces up");
+
+        state.PauseTiming();
+        downAll(vcans.ifnames());
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_UpBatched)->Arg(1)->Arg(8)->Arg(64)->UseRealTime();
+
+using LinkMessage = nl::MessageFactory<ifinfomsg, 256>;
+
+/** Fill RTM_NEWLINK message similar to the ones received while monitoring link state. */
+static void fillLinkMessage(LinkMessage& msg) {
+    msg->ifi_index = 42;
+    msg->ifi_flags = IFF_UP | IFF_RUNNING | IFF_NOARP;
+    msg.add(IFLA_MTU, uint32_t(72));
+    msg.add(IFLA_TXQLEN, uint32_t(10));
+    msg.add(IFLA_OPERSTATE, uint8_t(IF_OPER_UP));
+    msg.add(IFLA_GROUP, uint32_t(0));
+    msg.add(IFLA_PROMISCUITY, uint32_t(0));
+    msg.add(IFLA_NUM_TX_QUEUES, uint32_t(1));
+    {
+        auto linkinfo = msg.addNested(IFLA_LINKINFO);
+        msg.addBuffer(IFLA_INFO_KIND, "vcan");
+    }
+    msg.add(IFLA_IFNAME, std::string("bmvcan0"));
+}
+
+static void BM_ParseLinkIndexed(State& state) {
+    LinkMessage factory(RTM_NEWLINK, 0);
+    fillLinkMessage(factory);
+    const auto buffer = *factory.build();
+
+    for (auto _ : state) {
+        const auto msg = nl::Message<ifinfomsg>::parse(buffer, std::set<nl::nlmsgtype_t>{
+                                                                       RTM_NEWLINK, RTM_DELLINK});
+        ::benchmark::DoNotOptimize(msg->attributes.get<std::string>(IFLA_IFNAME));
+    }
+}
+BENCHMARK(BM_ParseLinkIndexed);
+
+static void BM_ParseLinkView(State& state) {
+    LinkMessage factory(RTM_NEWLINK, 0);
+    fillLinkMessage(factory);
+    const auto buffer = *factory.build();
+
+    for (auto _ : state) {
+        const auto msg = nl::Message<ifinfomsg>::parse(buffer, {RTM_NEWLINK, RTM_DELLINK});
+        ::benchmark::DoNotOptimize(msg->attributes.find<std::string_view>(IFLA_IFNAME));
+    }
+}
+BENCHMARK(BM_ParseLinkView);
+
+}  // namespace android::netdevice::benchmark
+
+BENCHMARK_MAIN();
@@ -22,6 +22,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace android::hardware::automotive::can {
 
@@ -31,11 +32,12 @@ using Result = V1_0::Result;
 static void usage() {
     std::cerr << "canhalsend - simple command line tool to send raw CAN frames" << std::endl;
     std::cerr << std::endl << "usage:" << std::endl << std::endl;
-    std::cerr << "canhalsend <bus name> <can id>#<data>" << std::endl;
+    std::cerr << "canhalsend <bus name> <can id>#<data> [<can id>#<data> ...]" << std::endl;
     std::cerr << "where:" << std::endl;
     std::cerr << " bus name - name under which ICanBus is published" << std::endl;
     std::cerr << " can id - such as 1a5 or 1fab5982" << std::endl;
     std::cerr << " data - such as deadbeef, 010203, or R for a remote frame" << std::endl;
+    std::cerr << "Multiple messages are sent in order, stopping at the first failure." << std::endl;
 }
 
 // TODO(b/135918744): extract to a new library
@@ -55,17 +57,23 @@ static sp<ICanBus> tryOpen(const std::string& busname) {
     return ICanBus::castFrom(ret);
 }
 
-static int cansend(const std::string& busname, const V1_0::CanMessage& msg) {
+static int cansend(const std::string& busname, const std::vector<V1_0::CanMessage>& msgs) {
     auto bus = tryOpen(busname);
     if (bus == nullptr) {
         std::cerr << "Bus " << busname << " is not available" << std::endl;
         return -1;
     }
 
-    const auto result = bus->send(msg);
-    if (result != Result::OK) {
-        std::cerr << "Send call failed: " << toString(result) << std::endl;
-        return -1;
+    /* Bus handle is fetched once for the whole burst, so only the send calls remain per message.
+     * They are issued one at a time on purpose: the HAL batches frames of concurrent send() calls,
+     * but that wouldn't keep them in order. */
+    for (size_t i = 0; i < msgs.size(); i++) {
+        const auto result = bus->send(msgs[i]);
+        if (result != Result::OK) {
+            std::cerr << "Send call failed for message #" << i << ": " << toString(result)
+                      << std::endl;
+            return -1;
+        }
     }
     return 0;
 }
@@ -129,20 +137,24 @@ static int main(int argc, char* argv[]) {
         return 0;
     }
 
-    if (argc != 2) {
+    if (argc < 2) {
         std::cerr << "Invalid number of arguments" << std::endl;
         usage();
         return -1;
     }
 
     std::string busname(argv[0]);
-    const auto canmsg = parseCanMessage(argv[1]);
-    if (!canmsg) {
-        std::cerr << "Failed to parse CAN message argument" << std::endl;
-        return -1;
+    std::vector<V1_0::CanMessage> canmsgs;
+    for (int i = 1; i < argc; i++) {
+        const auto canmsg = parseCanMessage(argv[i]);
+        if (!canmsg) {
+            std::cerr << "Failed to parse CAN message argument: " << argv[i] << std::endl;
+            return -1;
+        }
+        canmsgs.push_back(*canmsg);
     }
 
-    return cansend(busname, *canmsg);
+    return cansend(busname, canmsgs);
 }
 
 }  // namespace android::hardware::automotive::can
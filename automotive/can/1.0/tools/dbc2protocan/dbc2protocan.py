@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2023 The Android Open Source Project
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+"""Generates constexpr libprotocan message tables from DBC files.
+
+   The output is a C++ header with a protocan::SignalSpec table and signal index constants for
+   every message, a protocan::MessageSpec table of all messages and a protocan::MessageDecoder over
+   it. Everything is constexpr, so using the tables costs nothing at startup.
+
+   Only little-endian (Intel, @1) signals are supported by libprotocan. Big-endian and multiplexed
+   signals are skipped with a warning, signals that can't be parsed are an error.
+
+   Usage:
+   $ dbc2protocan.py --namespace my::vehicle [--counter MESSAGE.SIGNAL ...] -o out.h in.dbc ...
+
+   Typically used from a genrule:
+   genrule {
+       name: "my_vehicle_can_tables",
+       tools: ["dbc2protocan"],
+       cmd: "$(location dbc2protocan) --namespace my::vehicle -o $(out) $(in)",
+       srcs: ["my_vehicle.dbc"],
+       out: ["MyVehicleCan.h"],
+   }
+"""
+import argparse
+import os
+import re
+import sys
+
+# DBC message IDs have this bit set for extended (29 bit) IDs.
+DBC_EXTENDED_ID_FLAG = 0x80000000
+CAN_EFF_MASK = 0x1FFFFFFF
+# CAN FD maximum payload length, as supported by protocan::MessageLayout.
+MAX_PAYLOAD = 64
+
+RE_MESSAGE = re.compile(r"^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)")
+RE_SIGNAL = re.compile(
+    r"^SG_\s+(\w+)\s*(M|m\d+M?)?\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*"
+    r"\(\s*([-+.\deE]+)\s*,\s*([-+.\deE]+)\s*\)")
+RE_START_VALUE = re.compile(r'^BA_\s+"GenSigStartValue"\s+SG_\s+(\d+)\s+(\w+)\s+([-+.\deE]+)\s*;')
+
+# Identifiers generated next to the k<signal name> index constants of each message.
+RESERVED_SIGNAL_NAMES = {"Signals", "Fields"}
+
+NAMESPACE = "::android::hardware::automotive::protocan"
+
+LICENSE = """/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+"""
+
+
+class Signal:
+    def __init__(self, name, start, length, is_signed, factor, offset):
+        self.name = name
+        self.start = start
+        self.length = length
+        self.is_signed = is_signed
+        self.factor = factor
+        self.offset = offset
+        self.default = 0
+
+
+class Message:
+    def __init__(self, dbc_id, name, length):
+        self.id = dbc_id & CAN_EFF_MASK
+        self.is_extended_id = (dbc_id & DBC_EXTENDED_ID_FLAG) != 0
+        self.dbc_id = dbc_id
+        self.name = name
+        self.length = length
+        self.signals = []
+        self.counter = None
+
+
+def warn(msg):
+    sys.stderr.write("WARNING: " + msg + "\n")
+
+
+def parse_dbc(path, messages):
+    """Parses messages and signals of a DBC file into the messages dict, keyed by DBC ID."""
+    current = None
+    start_values = []
+    with open(path, encoding="latin-1") as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.strip()
+
+            m = RE_MESSAGE.match(line)
+            if m:
+                dbc_id, name, length = int(m.group(1)), m.group(2), int(m.group(3))
+                if length > MAX_PAYLOAD:
+                    raise ValueError("%s:%d: message %s is longer than %d bytes" %
+                                     (path, lineno, name, MAX_PAYLOAD))
+                if dbc_id in messages:
+                    raise ValueError("%s:%d: duplicate message ID %d" % (path, lineno, dbc_id))
+                current = Message(dbc_id, name, length)
+                messages[dbc_id] = current
+                continue
+
+            m = RE_SIGNAL.match(line)
+            if m:
+                if current is None:
+                    raise ValueError("%s:%d: signal outside of a message" % (path, lineno))
+                name, mux, start, length = m.group(1), m.group(2), int(m.group(3)), int(m.group(4))
+                little_endian, is_signed = m.group(5) == "1", m.group(6) == "-"
+                factor, offset = float(m.group(7)), float(m.group(8))
+
+                if mux is not None:
+                    warn("%s.%s: multiplexed signals are not supported" % (current.name, name))
+                    continue
+                if not little_endian:
+                    warn("%s.%s: big-endian signals are not supported" % (current.name, name))
+                    continue
+                if length < 1 or length > 64 or start + length > current.length * 8:
+                    raise ValueError("%s:%d: signal %s doesn't fit in message %s" %
+                                     (path, lineno, name, current.name))
+                if name in RESERVED_SIGNAL_NAMES:
+                    raise ValueError("%s:%d: signal name %s collides with generated k%s" %
+                                     (path, lineno, name, name))
+                if any(s.name == name for s in current.signals):
+                    raise ValueError("%s:%d: duplicate signal %s in message %s" %
+                                     (path, lineno, name, current.name))
+                current.signals.append(Signal(name, start, length, is_signed, factor, offset))
+                continue
+
+            if line.startswith("SG_"):
+                raise ValueError("%s:%d: unparsable signal" % (path, lineno))
+
+            m = RE_START_VALUE.match(line)
+            if m:
+                start_values.append((int(m.group(1)), m.group(2), float(m.group(3))))
+                continue
+
+            if line:
+                current = None
+
+    for dbc_id, signal_name, value in start_values:
+        message = messages.get(dbc_id)
+        signal = next((s for s in message.signals if s.name == signal_name), None) if message else None
+        if signal is None:
+            continue
+        # GenSigStartValue is a raw value, stored as two's complement for signed signals.
+        signal.default = int(value) & ((1 << signal.length) - 1)
+
+
+def format_double(value):
+    return repr(float(value))
+
+
+def generate(messages, namespace, sources):
+    out = [LICENSE]
+    out.append("/**")
+    out.append(" * DO NOT EDIT MANUALLY!!!")
+    out.append(" *")
+    out.append(" * Generated by dbc2protocan.py from: " + ", ".join(sources))
+    out.append(" */")
+    out.append("")
+    out.append("#pragma once")
+    out.append("")
+    out.append("#include <libprotocan/MessageDecoder.h>")
+    out.append("#include <libprotocan/MessageSpec.h>")
+    out.append("")
+    out.append("#include <iterator>")
+    out.append("")
+    out.append("namespace %s {" % namespace)
+    out.append("")
+
+    for msg in messages:
+        out.append("namespace %s {" % msg.name)
+        out.append("")
+        out.append("inline constexpr %s::SignalSpec kSignals[] = {" % NAMESPACE)
+        for s in msg.signals:
+            out.append("        {.name = \"%s\", .start = %d, .length = %d, .isSigned = %s, "
+                       ".factor = %s, .offset = %s, .defaultValue = %du}," %
+                       (s.name, s.start, s.length, "true" if s.is_signed else "false",
+                        format_double(s.factor), format_double(s.offset), s.default))
+        out.append("};")
+        out.append("inline constexpr auto kFields = %s::makeFields(kSignals);" % NAMESPACE)
+        out.append("")
+        out.append("/** Signal indices, for accessing decoded values. */")
+        out.append("enum : size_t {")
+        for i, s in enumerate(msg.signals):
+            out.append("    k%s = %d," % (s.name, i))
+        out.append("};")
+        out.append("")
+        out.append("}  // namespace %s" % msg.name)
+        out.append("")
+
+    out.append("inline constexpr %s::MessageSpec kMessages[] = {" % NAMESPACE)
+    for msg in messages:
+        counter = ("%s::k%s" % (msg.name, msg.counter) if msg.counter
+                   else "%s::MessageSpec::kNoSignal" % NAMESPACE)
+        out.append("        {")
+        out.append("                .name = \"%s\"," % msg.name)
+        out.append("                .id = 0x%X," % msg.id)
+        out.append("                .isExtendedId = %s," % ("true" if msg.is_extended_id else "false"))
+        out.append("                .length = %d," % msg.length)
+        out.append("                .signals = %s::kSignals," % msg.name)
+        out.append("                .fields = %s::kFields.data()," % msg.name)
+        out.append("                .signalCount = std::size(%s::kSignals)," % msg.name)
+        out.append("                .counterIndex = %s," % counter)
+        out.append("        },")
+    out.append("};")
+    out.append("")
+    out.append("inline constexpr %s::MessageDecoder kDecoder(kMessages, std::size(kMessages));" %
+               NAMESPACE)
+    out.append("")
+    out.append("/** Largest signal count of all messages, for sizing decoded value buffers. */")
+    out.append("inline constexpr size_t kMaxSignals = %d;" %
+               max([len(m.signals) for m in messages] + [1]))
+    out.append("")
+    out.append("}  // namespace %s" % namespace)
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--namespace", required=True, help="C++ namespace of generated tables")
+    parser.add_argument("--counter", action="append", default=[], metavar="MESSAGE.SIGNAL",
+                        help="designate a message counter signal (may be repeated)")
+    parser.add_argument("-o", "--output", required=True, help="output header file")
+    parser.add_argument("dbc", nargs="+", help="input DBC file(s)")
+    args = parser.parse_args()
+
+    messages = {}
+    for path in args.dbc:
+        parse_dbc(path, messages)
+
+    for counter in args.counter:
+        msg_name, _, signal_name = counter.partition(".")
+        msg = next((m for m in messages.values() if m.name == msg_name), None)
+        if msg is None or not any(s.name == signal_name for s in msg.signals):
+            parser.error("counter signal %s doesn't exist" % counter)
+        msg.counter = signal_name
+
+    for msg in messages.values():
+        if not msg.signals:
+            warn("%s: no supported signals, skipping message" % msg.name)
+
+    # MessageDecoder does a binary search by (id, isExtendedId).
+    ordered = sorted((m for m in messages.values() if m.signals),
+                     key=lambda m: (m.id, m.is_extended_id))
+    with open(args.output, "w") as f:
+        f.write(generate(ordered, args.namespace, [os.path.basename(p) for p in args.dbc]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <libprotocan/MessageDecoder.h>
+
+#include <algorithm>
+#include <tuple>
+
+namespace android::hardware::automotive::protocan {
+
+const MessageSpec* MessageDecoder::find(can::V1_0::CanMessageId id, bool isExtendedId) const {
+  const auto end = mMessages + mCount;
+  const auto it = std::lower_bound(
+      mMessages, end, std::make_tuple(id, isExtendedId), [](const MessageSpec& spec, auto key) {
+        return std::make_tuple(spec.id, spec.isExtendedId) < key;
+      });
+  if (it == end || it->id != id || it->isExtendedId != isExtendedId) return nullptr;
+  return it;
+}
+
+const MessageSpec* MessageDecoder::decode(const can::V1_0::CanMessage& msg,
+                                          Signal::value* values) const {
+  const auto spec = find(msg.id, msg.isExtendedId);
+  if (spec == nullptr || msg.payload.size() < spec->length) return nullptr;
+
+  MessageLayout::decode(spec->fields, spec->signalCount, msg, values);
+  return spec;
+}
+
+}  // namespace android::hardware::automotive::protocan
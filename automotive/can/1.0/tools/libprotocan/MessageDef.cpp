@@ -23,24 +23,67 @@ namespace android::hardware::automotive::protocan {
 using can::V1_0::CanMessage;
 using can::V1_0::CanMessageId;
 
-MessageDef::MessageDef(CanMessageId id, uint16_t len, std::map<std::string, Signal> signals,
+static std::vector<Signal> getSignals(const std::vector<std::pair<std::string, Signal>>& signals) {
+  std::vector<Signal> result;
+  result.reserve(signals.size());
+  for (const auto& [name, signal] : signals) result.push_back(signal);
+  return result;
+}
+
+static std::map<std::string, size_t> getSignalIndices(
+    const std::vector<std::pair<std::string, Signal>>& signals) {
+  std::map<std::string, size_t> indices;
+  for (size_t i = 0; i < signals.size(); i++) {
+    const auto [it, inserted] = indices.emplace(signals[i].first, i);
+    CHECK(inserted) << "Duplicate signal " << signals[i].first;
+  }
+  return indices;
+}
+
+static std::vector<Signal::value> getDefaults(const std::vector<Signal>& signals) {
+  std::vector<Signal::value> defaults;
+  defaults.reserve(signals.size());
+  for (const auto& signal : signals) defaults.push_back(signal.getDefault());
+  return defaults;
+}
+
+MessageDef::MessageDef(CanMessageId id, uint16_t len,
+                       std::vector<std::pair<std::string, Signal>> signals,
                        std::optional<Signal> counter, std::optional<Checksum> checksum)
-    : id(id), kLen(len), kSignals(std::move(signals)), kCounter(counter), kChecksum(checksum) {}
+    : id(id),
+      kLen(len),
+      kSignals(getSignals(signals)),
+      kSignalIndices(getSignalIndices(signals)),
+      kLayout(kSignals),
+      kDefaults(getDefaults(kSignals)),
+      kCounter(counter),
+      kChecksum(checksum) {
+  CHECK(kLayout.minPayload() <= kLen) << "Signals don't fit in message of length " << kLen;
+}
 
 const Signal& MessageDef::operator[](const std::string& signalName) const {
-  auto it = kSignals.find(signalName);
-  CHECK(it != kSignals.end()) << "Signal " << signalName << " doesn't exist";
+  return kSignals[indexOf(signalName)];
+}
+
+const Signal& MessageDef::operator[](size_t signalIndex) const {
+  CHECK(signalIndex < kSignals.size()) << "Signal #" << signalIndex << " doesn't exist";
+  return kSignals[signalIndex];
+}
+
+size_t MessageDef::indexOf(const std::string& signalName) const {
+  auto it = kSignalIndices.find(signalName);
+  CHECK(it != kSignalIndices.end()) << "Signal " << signalName << " doesn't exist";
   return it->second;
 }
 
+const MessageLayout& MessageDef::layout() const { return kLayout; }
+
 CanMessage MessageDef::makeDefault() const {
   CanMessage msg = {};
   msg.id = id;
   msg.payload.resize(kLen);
 
-  for (auto const& [name, signal] : kSignals) {
-    signal.setDefault(msg);
-  }
+  kLayout.encode(msg, kDefaults.data());
 
   return msg;
 }
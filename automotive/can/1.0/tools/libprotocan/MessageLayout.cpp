@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <libprotocan/MessageLayout.h>
+
+#include <android-base/logging.h>
+#include <endian.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace android::hardware::automotive::protocan {
+
+MessageLayout::MessageLayout(const std::vector<Signal>& signals) {
+  mFields.reserve(signals.size());
+  for (const auto& signal : signals) {
+    const size_t end = signal.getStart() + signal.getLength();
+    CHECK(end <= kMaxPayload * 8) << "Signal at bit " << signal.getStart()
+                                  << " doesn't fit in a " << kMaxPayload << " byte payload";
+
+    mFields.push_back(makeField(signal.getStart(), signal.getLength()));
+    mMinPayload = std::max(mMinPayload, (end + 7) / 8);
+  }
+}
+
+size_t MessageLayout::size() const { return mFields.size(); }
+
+size_t MessageLayout::minPayload() const { return mMinPayload; }
+
+size_t MessageLayout::load(const can::V1_0::CanMessage& msg, Words& words) {
+  const size_t len = std::min(msg.payload.size(), kMaxPayload);
+  memset(words, 0, sizeof(Words));
+  memcpy(words, msg.payload.data(), len);
+  for (size_t i = 0; i < (len + 7) / 8; i++) words[i] = le64toh(words[i]);
+  return len;
+}
+
+/*
+ * A field spans words[word] and words[word + 1]. The high word is shifted in two steps, since
+ * shifting a 64-bit value by 64 is undefined (and it has to contribute nothing for shift == 0).
+ */
+
+void MessageLayout::decode(const Field* fields, size_t count, const can::V1_0::CanMessage& msg,
+                           Signal::value* values) {
+  Words words;
+  load(msg, words);
+
+  for (size_t i = 0; i < count; i++) {
+    const auto& f = fields[i];
+    const uint64_t lo = words[f.word] >> f.shift;
+    const uint64_t hi = (words[f.word + 1] << 1) << (63 - f.shift);
+    values[i] = (lo | hi) & f.mask;
+  }
+}
+
+void MessageLayout::decode(const can::V1_0::CanMessage& msg, Signal::value* values) const {
+  CHECK(msg.payload.size() >= mMinPayload)
+      << "Message is too short. Did you call MessageDef::validate?";
+  decode(mFields.data(), mFields.size(), msg, values);
+}
+
+void MessageLayout::encode(can::V1_0::CanMessage& msg, const Signal::value* values) const {
+  CHECK(msg.payload.size() >= mMinPayload)
+      << "Message is too short. Did you call MessageDef::validate?";
+
+  Words words;
+  const size_t len = load(msg, words);
+
+  for (size_t i = 0; i < mFields.size(); i++) {
+    const auto& f = mFields[i];
+    const uint64_t val = values[i] & f.mask;
+    words[f.word] = (words[f.word] & ~(f.mask << f.shift)) | (val << f.shift);
+    const uint64_t hiMask = (f.mask >> 1) >> (63 - f.shift);
+    words[f.word + 1] = (words[f.word + 1] & ~hiMask) | ((val >> 1) >> (63 - f.shift));
+  }
+
+  for (size_t i = 0; i < (len + 7) / 8; i++) words[i] = htole64(words[i]);
+  memcpy(msg.payload.data(), words, len);
+}
+
+}  // namespace android::hardware::automotive::protocan
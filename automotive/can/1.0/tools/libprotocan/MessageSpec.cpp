@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <libprotocan/MessageSpec.h>
+
+namespace android::hardware::automotive::protocan {
+
+MessageDef makeMessageDef(const MessageSpec& spec, std::optional<Checksum> checksum) {
+  std::vector<std::pair<std::string, Signal>> signals;
+  signals.reserve(spec.signalCount);
+  for (size_t i = 0; i < spec.signalCount; i++) {
+    signals.emplace_back(spec.signals[i].name, spec.signals[i].makeSignal());
+  }
+
+  // Signal is not assignable, so the optional has to be constructed in one go.
+  const auto counter = spec.counterIndex != MessageSpec::kNoSignal
+                           ? std::make_optional(spec.signals[spec.counterIndex].makeSignal())
+                           : std::nullopt;
+
+  return MessageDef(spec.id, spec.length, std::move(signals), counter, checksum);
+}
+
+}  // namespace android::hardware::automotive::protocan
@@ -17,6 +17,10 @@
 #include <libprotocan/Signal.h>
 
 #include <android-base/logging.h>
+#include <endian.h>
+
+#include <algorithm>
+#include <cstring>
 
 namespace android::hardware::automotive::protocan {
 
@@ -26,37 +30,59 @@ static uint8_t calculateLastByteMask(uint16_t start, uint8_t length) {
   return 0xFF >> lastBytePadding;
 }
 
-static uint8_t calculateFirstByteMask(uint16_t firstByte, uint8_t firstBit, uint16_t lastByte,
-                                      uint8_t lastMask) {
-  uint8_t firstMask = 0xFF << firstBit;
-  if (firstByte == lastByte) firstMask &= lastMask;
-  return firstMask;
+static Signal::value calculateMaxValue(uint8_t length) {
+  if (length >= 64) return ~Signal::value(0);
+  return (Signal::value(1) << length) - 1;
+}
+
+/**
+ * Load up to 8 bytes of payload, starting at a given byte, as a little-endian word.
+ *
+ * Bytes past the end of the payload read as zero.
+ */
+static uint64_t loadWord(const hidl_vec<uint8_t>& payload, size_t byte) {
+  uint64_t word = 0;
+  memcpy(&word, payload.data() + byte, std::min<size_t>(sizeof(word), payload.size() - byte));
+  return le64toh(word);
+}
+
+/**
+ * Store a little-endian word to payload, starting at a given byte.
+ *
+ * Bytes past the end of the payload are not written.
+ */
+static void storeWord(hidl_vec<uint8_t>& payload, size_t byte, uint64_t word) {
+  word = htole64(word);
+  memcpy(payload.data() + byte, &word, std::min<size_t>(sizeof(word), payload.size() - byte));
 }
 
 Signal::Signal(uint16_t start, uint8_t length, value defVal)
-    : maxValue((1u << length) - 1),
+    : maxValue(calculateMaxValue(length)),
+      kStart(start),
+      kLength(length),
       kFirstByte(start / 8),
       kFirstBit(start % 8),
-      kFirstByteBits(8 - kFirstBit),
       kLastByte((start + length - 1) / 8),
       kLastMask(calculateLastByteMask(start, length)),
-      kFirstMask(calculateFirstByteMask(kFirstByte, kFirstBit, kLastByte, kLastMask)),
       kDefVal(defVal) {
   CHECK(length > 0) << "Signal length must not be zero";
+  CHECK(length <= 64) << "Signal length must not exceed 64 bits";
 }
 
+/*
+ * Signals are read and written with a single 64-bit load of the bytes holding them. Only a signal
+ * that is not byte aligned and longer than 56 bits spills over to a ninth byte.
+ */
+
 Signal::value Signal::get(const can::V1_0::CanMessage& msg) const {
     CHECK(msg.payload.size() > kLastByte)
             << "Message is too short. Did you call MessageDef::validate?";
 
-    Signal::value v = 0;
-    if (kLastByte != kFirstByte) v = kLastMask & msg.payload[kLastByte];
-
-    for (int i = kLastByte - 1; i > kFirstByte; i--) {
-        v = (v << 8) | msg.payload[i];
+    Signal::value v = loadWord(msg.payload, kFirstByte) >> kFirstBit;
+    if (kFirstBit + kLength > 64) {
+        v |= Signal::value(msg.payload[kFirstByte + 8] & kLastMask) << (64 - kFirstBit);
     }
-
-    return (v << kFirstByteBits) | ((msg.payload[kFirstByte] & kFirstMask) >> kFirstBit);
+    return v & maxValue;
 }
 
 void Signal::set(can::V1_0::CanMessage& msg, Signal::value val) const {
@@ -64,21 +90,23 @@ void Signal::set(can::V1_0::CanMessage& msg, Signal::value val) const {
       << "Signal requires message of length " << (kLastByte + 1)
       << " which is beyond message length of " << msg.payload.size();
 
-  uint8_t firstByte = val << kFirstBit;
-  val >>= kFirstByteBits;
-
-  msg.payload[kFirstByte] = (msg.payload[kFirstByte] & ~kFirstMask) | (firstByte & kFirstMask);
+  const uint64_t mask = maxValue << kFirstBit;
+  const uint64_t word = loadWord(msg.payload, kFirstByte);
+  storeWord(msg.payload, kFirstByte, (word & ~mask) | ((val << kFirstBit) & mask));
 
-  for (int i = kFirstByte + 1; i < kLastByte; i++) {
-    msg.payload[i] = val & 0xFF;
-    val >>= 8;
-  }
-
-  if (kLastByte != kFirstByte) {
-    msg.payload[kLastByte] = (msg.payload[kLastByte] & ~kLastMask) | (val & kLastMask);
+  if (kFirstBit + kLength > 64) {
+    const uint8_t spill = val >> (64 - kFirstBit);
+    auto& lastByte = msg.payload[kFirstByte + 8];
+    lastByte = (lastByte & ~kLastMask) | (spill & kLastMask);
   }
 }
 
 void Signal::setDefault(can::V1_0::CanMessage& msg) const { set(msg, kDefVal); }
 
+uint16_t Signal::getStart() const { return kStart; }
+
+uint8_t Signal::getLength() const { return kLength; }
+
+Signal::value Signal::getDefault() const { return kDefVal; }
+
 }  // namespace android::hardware::automotive::protocan
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <android/hardware/automotive/can/1.0/types.h>
+#include <libprotocan/MessageSpec.h>
+
+namespace android::hardware::automotive::protocan {
+
+/**
+ * Decodes received messages according to a static message table (see dbc2protocan).
+ *
+ * It's a literal type, so a decoder over a generated table can be constexpr as well.
+ */
+class MessageDecoder {
+ public:
+  /**
+   * Create a decoder.
+   *
+   * \param messages Message table, sorted by (id, isExtendedId)
+   * \param count Number of messages in the table
+   */
+  constexpr MessageDecoder(const MessageSpec* messages, size_t count)
+      : mMessages(messages), mCount(count) {}
+
+  /**
+   * Look up message description.
+   *
+   * \param id Message ID
+   * \param isExtendedId Whether the message has an extended (29 bit) ID
+   * \return Message description, or nullptr if the message is not known
+   */
+  const MessageSpec* find(can::V1_0::CanMessageId id, bool isExtendedId) const;
+
+  /**
+   * Decode all signals of a message.
+   *
+   * \param msg Message to decode
+   * \param values Decoded raw values, indexed as the message signals; must have room for the
+   *        largest signal count in the table
+   * \return Message description, or nullptr if the message is not known or too short
+   */
+  const MessageSpec* decode(const can::V1_0::CanMessage& msg, Signal::value* values) const;
+
+ private:
+  const MessageSpec* mMessages;
+  size_t mCount;
+};
+
+}  // namespace android::hardware::automotive::protocan
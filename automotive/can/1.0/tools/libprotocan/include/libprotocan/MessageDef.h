@@ -19,8 +19,14 @@
 #include <android/hardware/automotive/can/1.0/types.h>
 #include <libprotocan/Checksum.h>
 #include <libprotocan/MessageCounter.h>
+#include <libprotocan/MessageLayout.h>
 #include <libprotocan/Signal.h>
 
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace android::hardware::automotive::protocan {
 
 /**
@@ -39,15 +45,29 @@ class MessageDef {
    *
    * \param id CAN message ID
    * \param len CAN message length
-   * \param signals CAN signal definitions
+   * \param signals CAN signal definitions, their order determines signal indices
    * \param counter Designated CAN signal definition for message counter, if the message has one
    * \param checksum Designated CAN signal definition for payload checksum, if the message has one
    */
-  MessageDef(can::V1_0::CanMessageId id, uint16_t len, std::map<std::string, Signal> signals,
+  MessageDef(can::V1_0::CanMessageId id, uint16_t len,
+             std::vector<std::pair<std::string, Signal>> signals,
              std::optional<Signal> counter = std::nullopt,
              std::optional<Checksum> checksum = std::nullopt);
 
   const Signal& operator[](const std::string& signalName) const;
+  const Signal& operator[](size_t signalIndex) const;
+
+  /**
+   * Look up signal index by name.
+   *
+   * Intended to be called once, at initialization - use the index for accessing signals later on.
+   */
+  size_t indexOf(const std::string& signalName) const;
+
+  /**
+   * Compiled layout of all signals, indexed in the same order as the message definition.
+   */
+  const MessageLayout& layout() const;
 
   can::V1_0::CanMessage makeDefault() const;
   MessageCounter makeCounter() const;
@@ -61,7 +81,10 @@ class MessageDef {
 
 private:
   const uint16_t kLen;
-  const std::map<std::string, Signal> kSignals;
+  const std::vector<Signal> kSignals;
+  const std::map<std::string, size_t> kSignalIndices;
+  const MessageLayout kLayout;
+  const std::vector<Signal::value> kDefaults;
   const std::optional<Signal> kCounter;
   const std::optional<Checksum> kChecksum;
 };
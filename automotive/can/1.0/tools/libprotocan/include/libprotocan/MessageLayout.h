@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <android/hardware/automotive/can/1.0/types.h>
+#include <libprotocan/Signal.h>
+
+#include <vector>
+
+namespace android::hardware::automotive::protocan {
+
+/**
+ * Signals of a message compiled into a table, for decoding or encoding all of them at once.
+ *
+ * The payload is loaded as an array of little-endian 64-bit words, then every signal is extracted
+ * with a shift and a mask of at most two adjacent words. Both classic CAN and CAN FD (up to 64
+ * bytes) payloads are supported.
+ *
+ * Signals are identified by their index in the list the layout was created from.
+ */
+class MessageLayout {
+ public:
+  /** Maximum payload length, as defined for CAN FD. */
+  static constexpr size_t kMaxPayload = 64;
+
+  /** Location of a single signal in the payload words. */
+  struct Field {
+    uint8_t word;        ///< Index of the word holding the least significant bit
+    uint8_t shift;       ///< Index of the least significant bit within that word
+    Signal::value mask;  ///< Mask of signal value bits, before shifting
+  };
+
+  /**
+   * Build a field for a signal, usable in constant expressions.
+   *
+   * \param start Index of the least significant bit of the signal
+   * \param length Signal length in bits, 1 to 64
+   */
+  static constexpr Field makeField(uint16_t start, uint8_t length) {
+    return {
+        .word = static_cast<uint8_t>(start / 64),
+        .shift = static_cast<uint8_t>(start % 64),
+        .mask = length >= 64 ? ~Signal::value(0) : (Signal::value(1) << length) - 1,
+    };
+  }
+
+  /**
+   * Decode signals described by a field table.
+   *
+   * Payload bytes past the end of the message read as zero.
+   *
+   * \param fields Field table, all fields must lie within kMaxPayload
+   * \param count Number of fields
+   * \param msg Message to decode
+   * \param values Decoded values, must have room for count elements
+   */
+  static void decode(const Field* fields, size_t count, const can::V1_0::CanMessage& msg,
+                     Signal::value* values);
+
+  explicit MessageLayout(const std::vector<Signal>& signals);
+
+  /** Number of signals. */
+  size_t size() const;
+
+  /** Minimum payload length that holds all the signals. */
+  size_t minPayload() const;
+
+  /**
+   * Decode all signals of a message.
+   *
+   * \param msg Message to decode, its payload must be at least minPayload() bytes long
+   * \param values Decoded values, must have room for size() elements
+   */
+  void decode(const can::V1_0::CanMessage& msg, Signal::value* values) const;
+
+  /**
+   * Encode all signals to a message, leaving the other bits intact.
+   *
+   * \param msg Message to update, its payload must be at least minPayload() bytes long
+   * \param values Values to encode, size() elements; bits beyond signal length are ignored
+   */
+  void encode(can::V1_0::CanMessage& msg, const Signal::value* values) const;
+
+ private:
+  static constexpr size_t kMaxWords = kMaxPayload / sizeof(uint64_t);
+
+  /** Array of payload words, with a zeroed spare one so fields can always access word + 1. */
+  using Words = uint64_t[kMaxWords + 1];
+
+  static size_t load(const can::V1_0::CanMessage& msg, Words& words);
+
+  std::vector<Field> mFields;
+  size_t mMinPayload = 0;
+};
+
+}  // namespace android::hardware::automotive::protocan
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <android/hardware/automotive/can/1.0/types.h>
+#include <libprotocan/Checksum.h>
+#include <libprotocan/MessageDef.h>
+#include <libprotocan/MessageLayout.h>
+#include <libprotocan/Signal.h>
+
+#include <array>
+#include <limits>
+#include <optional>
+
+namespace android::hardware::automotive::protocan {
+
+/**
+ * Static signal description, for tables generated at build time (see dbc2protocan).
+ *
+ * Unlike Signal, it's a literal type, so whole message tables can be constexpr and don't cost
+ * anything at startup.
+ */
+struct SignalSpec {
+  const char* name;
+  uint16_t start;  ///< Index of the least significant bit of the signal
+  uint8_t length;  ///< Signal length in bits
+  bool isSigned = false;
+  double factor = 1;
+  double offset = 0;
+  Signal::value defaultValue = 0;
+
+  constexpr MessageLayout::Field field() const { return MessageLayout::makeField(start, length); }
+
+  /**
+   * Convert raw signal value to physical one: physical = raw * factor + offset.
+   */
+  constexpr double toPhysical(Signal::value raw) const {
+    if (!isSigned) return double(raw) * factor + offset;
+    // Sign-extend a two's complement value of signal length.
+    const Signal::value signBit = Signal::value(1) << (length - 1);
+    return double(int64_t((raw ^ signBit) - signBit)) * factor + offset;
+  }
+
+  Signal makeSignal() const { return Signal(start, length, defaultValue); }
+};
+
+/**
+ * Static message description, for tables generated at build time (see dbc2protocan).
+ */
+struct MessageSpec {
+  static constexpr size_t kNoSignal = std::numeric_limits<size_t>::max();
+
+  const char* name;
+  can::V1_0::CanMessageId id;
+  bool isExtendedId;
+  uint16_t length;
+  const SignalSpec* signals;
+  /** Fields of signals, in the same order, for MessageLayout::decode. */
+  const MessageLayout::Field* fields;
+  size_t signalCount;
+  /** Index of the message counter signal, if there is one. */
+  size_t counterIndex = kNoSignal;
+};
+
+/**
+ * Build field table for signals at compile time.
+ */
+template <size_t N>
+constexpr std::array<MessageLayout::Field, N> makeFields(const SignalSpec (&signals)[N]) {
+  std::array<MessageLayout::Field, N> fields = {};
+  for (size_t i = 0; i < N; i++) fields[i] = signals[i].field();
+  return fields;
+}
+
+/**
+ * Build a runtime message definition, i.e. for use with MessageInjector.
+ *
+ * \param spec Static message description
+ * \param checksum Payload checksum, if the message has one
+ */
+MessageDef makeMessageDef(const MessageSpec& spec,
+                          std::optional<Checksum> checksum = std::nullopt);
+
+}  // namespace android::hardware::automotive::protocan
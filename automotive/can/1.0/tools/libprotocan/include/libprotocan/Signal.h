@@ -36,13 +36,17 @@ class Signal {
   void set(can::V1_0::CanMessage& msg, value val) const;
   void setDefault(can::V1_0::CanMessage& msg) const;
 
+  uint16_t getStart() const;
+  uint8_t getLength() const;
+  value getDefault() const;
+
  private:
-  const uint16_t kFirstByte;     ///< Index of first byte that holds the signal
-  const uint8_t kFirstBit;       ///< Index of first bit within first byte
-  const uint8_t kFirstByteBits;  ///< How many bits of the first byte belong to the signal
-  const uint16_t kLastByte;      ///< Index of last byte that holds the signal
-  const uint8_t kLastMask;       ///< Bits of the last byte that belong to the signal
-  const uint8_t kFirstMask;      ///< Bits of the first byte that belong to the signal
+  const uint16_t kStart;      ///< Index of the least significant bit of the signal
+  const uint8_t kLength;      ///< Signal length in bits
+  const uint16_t kFirstByte;  ///< Index of first byte that holds the signal
+  const uint8_t kFirstBit;    ///< Index of first bit within first byte
+  const uint16_t kLastByte;   ///< Index of last byte that holds the signal
+  const uint8_t kLastMask;    ///< Bits of the last byte that belong to the signal
 
   const value kDefVal;
 };
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <libprotocan/MessageDecoder.h>
+#include <libprotocan/MessageSpec.h>
+
+#include <LibprotocanTestDbc.h>
+#include <gtest/gtest.h>
+
+namespace android::hardware::automotive::protocan::unittest {
+
+static_assert(std::size(test::dbc::kMessages) == 2, "Unsupported message should be skipped");
+static_assert(test::dbc::EngineData::kFields[test::dbc::EngineData::kCounter].shift == 56);
+
+TEST(MessageDecoderTest, TestDecode) {
+  can::V1_0::CanMessage msg = {};
+  msg.id = 0x100;
+  msg.payload = {0x40, 0x1F, 0xFB, 0, 0, 0, 0, 0x0A};
+
+  Signal::value values[test::dbc::kMaxSignals];
+  const auto spec = test::dbc::kDecoder.decode(msg, values);
+  ASSERT_NE(nullptr, spec);
+  ASSERT_STREQ("EngineData", spec->name);
+  ASSERT_EQ(3u, spec->signalCount);
+
+  using namespace test::dbc::EngineData;
+  ASSERT_EQ(0x1F40u, values[kEngineSpeed]);
+  ASSERT_DOUBLE_EQ(2000.0, kSignals[kEngineSpeed].toPhysical(values[kEngineSpeed]));
+  ASSERT_EQ(0xFBu, values[kCoolantTemp]);
+  ASSERT_DOUBLE_EQ(-45.0, kSignals[kCoolantTemp].toPhysical(values[kCoolantTemp]));
+  ASSERT_EQ(0xAu, values[kCounter]);
+}
+
+TEST(MessageDecoderTest, TestDecodeCanFd) {
+  can::V1_0::CanMessage msg = {};
+  msg.id = 0x400;
+  msg.isExtendedId = true;
+  msg.payload.resize(64);
+  msg.payload[0] = 0xF8;
+  msg.payload[1] = 0xFF;
+  msg.payload[62] = 0x30;
+  msg.payload[63] = 0xFF;
+
+  Signal::value values[test::dbc::kMaxSignals];
+  const auto spec = test::dbc::kDecoder.decode(msg, values);
+  ASSERT_NE(nullptr, spec);
+  ASSERT_STREQ("BatteryStatus", spec->name);
+
+  using namespace test::dbc::BatteryStatus;
+  ASSERT_EQ(0x1FFFu, values[kCellVoltage]);
+  ASSERT_EQ(0xFF3u, values[kCurrent]);
+  ASSERT_DOUBLE_EQ(-1.3, kSignals[kCurrent].toPhysical(values[kCurrent]));
+}
+
+TEST(MessageDecoderTest, TestUnknownMessages) {
+  Signal::value values[test::dbc::kMaxSignals];
+  can::V1_0::CanMessage msg = {};
+  msg.payload.resize(64);
+
+  msg.id = 0x400;  // Known ID, but in standard format
+  ASSERT_EQ(nullptr, test::dbc::kDecoder.decode(msg, values));
+
+  msg.id = 0x200;  // Skipped message
+  ASSERT_EQ(nullptr, test::dbc::kDecoder.decode(msg, values));
+
+  msg.id = 0x100;
+  msg.payload.resize(7);  // Too short
+  ASSERT_EQ(nullptr, test::dbc::kDecoder.decode(msg, values));
+}
+
+TEST(MessageDecoderTest, TestMakeMessageDef) {
+  const auto def = makeMessageDef(test::dbc::kMessages[0]);
+  const auto msg = def.makeDefault();
+
+  using namespace test::dbc::EngineData;
+  ASSERT_EQ(8u, msg.payload.size());
+  ASSERT_EQ(200u, def[kCoolantTemp].get(msg));
+  ASSERT_EQ(kSignals[kCounter].start, def[def.indexOf("Counter")].getStart());
+  ASSERT_EQ(16u, def.makeCounter().upperBound);
+}
+
+}  // namespace android::hardware::automotive::protocan::unittest
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <libprotocan/MessageDef.h>
+
+#include <benchmark/benchmark.h>
+
+namespace android::hardware::automotive::protocan::benchmark {
+
+using ::benchmark::State;
+
+/** Message with 20 signals of mixed lengths, packed back to back. */
+static MessageDef makeMessageDef(uint16_t len) {
+  std::vector<std::pair<std::string, Signal>> signals;
+  const unsigned payloadBits = len * 8;
+  const unsigned signalBits = payloadBits / 20;
+  for (unsigned i = 0; i < 20; i++) {
+    // Alternate lengths around the average, so signals are not byte aligned.
+    const unsigned length = (i % 2 == 0) ? signalBits - 1 : signalBits + 1;
+    const unsigned start = i * signalBits - (i % 2 == 0 ? 0 : 1);
+    signals.emplace_back("signal" + std::to_string(i), Signal(start, std::min(length, 64u)));
+  }
+  return MessageDef(1, len, std::move(signals));
+}
+
+static can::V1_0::CanMessage makeMessage(const MessageDef& def) {
+  auto msg = def.makeDefault();
+  for (size_t i = 0; i < msg.payload.size(); i++) msg.payload[i] = 0xA5 ^ (i * 37);
+  return msg;
+}
+
+static void BM_DecodeByName(State& state) {
+  const auto def = makeMessageDef(state.range(0));
+  const auto msg = makeMessage(def);
+  std::vector<std::string> names;
+  for (unsigned i = 0; i < 20; i++) names.push_back("signal" + std::to_string(i));
+
+  for (auto _ : state) {
+    for (const auto& name : names) ::benchmark::DoNotOptimize(def[name].get(msg));
+  }
+}
+BENCHMARK(BM_DecodeByName)->Arg(8)->Arg(64);
+
+static void BM_DecodeByIndex(State& state) {
+  const auto def = makeMessageDef(state.range(0));
+  const auto msg = makeMessage(def);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < 20; i++) ::benchmark::DoNotOptimize(def[i].get(msg));
+  }
+}
+BENCHMARK(BM_DecodeByIndex)->Arg(8)->Arg(64);
+
+static void BM_DecodeLayout(State& state) {
+  const auto def = makeMessageDef(state.range(0));
+  const auto msg = makeMessage(def);
+  std::vector<Signal::value> values(def.layout().size());
+
+  for (auto _ : state) {
+    def.layout().decode(msg, values.data());
+    ::benchmark::DoNotOptimize(values.data());
+  }
+}
+BENCHMARK(BM_DecodeLayout)->Arg(8)->Arg(64);
+
+static void BM_EncodeLayout(State& state) {
+  const auto def = makeMessageDef(state.range(0));
+  auto msg = makeMessage(def);
+  std::vector<Signal::value> values(def.layout().size());
+  def.layout().decode(msg, values.data());
+
+  for (auto _ : state) {
+    def.layout().encode(msg, values.data());
+    ::benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_EncodeLayout)->Arg(8)->Arg(64);
+
+}  // namespace android::hardware::automotive::protocan::benchmark
+
+BENCHMARK_MAIN();
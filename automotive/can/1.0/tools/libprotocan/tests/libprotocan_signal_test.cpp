@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <libprotocan/MessageDef.h>
+#include <libprotocan/MessageLayout.h>
 #include <libprotocan/Signal.h>
 
 #include <gtest/gtest.h>
@@ -215,4 +217,74 @@ TEST(SignalTest, TestSetAllStarts) {
   }
 }
 
+static std::vector<Signal> makeSignals(unsigned payloadBits) {
+  std::vector<Signal> signals;
+  for (unsigned length : {1, 3, 8, 13, 32, 57, 63, 64}) {
+    for (unsigned start = 0; start + length <= payloadBits; start += 5) {
+      signals.emplace_back(start, length);
+    }
+  }
+  return signals;
+}
+
+static hidl_vec<uint8_t> makePayload(size_t len) {
+  hidl_vec<uint8_t> payload(len);
+  for (size_t i = 0; i < len; i++) payload[i] = 0xA5 ^ (i * 37);
+  return payload;
+}
+
+TEST(MessageLayoutTest, TestDecodeMatchesSignals) {
+  for (size_t len : {8, 64}) {
+    const auto signals = makeSignals(len * 8);
+    MessageLayout layout(signals);
+    ASSERT_EQ(len, layout.minPayload());
+
+    can::V1_0::CanMessage msg = {};
+    msg.payload = makePayload(len);
+
+    std::vector<Signal::value> values(layout.size());
+    layout.decode(msg, values.data());
+
+    for (size_t i = 0; i < signals.size(); i++) {
+      ASSERT_EQ(signals[i].get(msg), values[i])
+          << "len=" << len << " start=" << signals[i].getStart()
+          << " length=" << unsigned(signals[i].getLength());
+    }
+  }
+}
+
+TEST(MessageLayoutTest, TestEncodeMatchesSignals) {
+  for (size_t len : {8, 64}) {
+    for (const auto& signal : makeSignals(len * 8)) {
+      MessageLayout layout({signal});
+      const Signal::value value = 0xDEADBEEFCAFEF00Du;
+
+      can::V1_0::CanMessage expected = {};
+      expected.payload = makePayload(len);
+      auto encoded = expected;
+
+      signal.set(expected, value);
+      layout.encode(encoded, &value);
+
+      ASSERT_EQ(expected, encoded) << "len=" << len << " start=" << signal.getStart()
+                                   << " length=" << unsigned(signal.getLength());
+    }
+  }
+}
+
+TEST(MessageLayoutTest, TestMessageDefIndices) {
+  MessageDef def(1, 8, {{"b", Signal(8, 8, 0xB)}, {"a", Signal(0, 8, 0xA)}});
+
+  ASSERT_EQ(0u, def.indexOf("b"));
+  ASSERT_EQ(1u, def.indexOf("a"));
+  ASSERT_EQ(8u, def[def.indexOf("b")].getStart());
+
+  const auto msg = def.makeDefault();
+  std::vector<Signal::value> values(def.layout().size());
+  def.layout().decode(msg, values.data());
+  ASSERT_EQ(0xBu, values[0]);
+  ASSERT_EQ(0xAu, values[1]);
+  ASSERT_EQ(0xAu, def["a"].get(msg));
+}
+
 }  // namespace android::hardware::automotive::protocan::unittest
@@ -62,6 +62,9 @@ class EvsEnumerator final : public ::aidl::android::hardware::automotive::evs::B
     ndk::ScopedAStatus getUltrasonicsArrayList(
             std::vector<evs::UltrasonicsArrayDesc>* list) override;
 
+    // Dumps the state and frame statistics of all cameras.
+    binder_status_t dump(int fd, const char** args, uint32_t numArgs) override;
+
     // Implementation details
     EvsEnumerator(const std::shared_ptr<
                   ::aidl::android::frameworks::automotive::display::ICarDisplayProxy>&
@@ -30,6 +30,7 @@
 // #include <android-base/result.h>
 #include <android/hardware_buffer.h>
 #include <ui/GraphicBuffer.h>
+#include <utils/Timers.h>
 
 #include <functional>
 #include <thread>
@@ -85,6 +86,9 @@ class EvsMockCamera : public evs::BnEvsCamera {
 
     const evs::CameraDesc& getDesc() { return mDescription; }
 
+    // Writes the state and frame statistics of this camera's video stream to fd.
+    void dump(int fd);
+
     // Constructors
     EvsMockCamera(Sigil sigil, const char* deviceName,
                   std::unique_ptr<ConfigManager::CameraInfo>& camInfo);
@@ -98,6 +102,7 @@ class EvsMockCamera : public evs::BnEvsCamera {
     void generateFrames();
     void fillMockFrame(buffer_handle_t handle, const AHardwareBuffer_Desc* pDesc);
     void returnBufferLocked(const uint32_t bufferId);
+    void storeBufferLocked(buffer_handle_t handle);
     ndk::ScopedAStatus stopVideoStream_impl();
 
     CameraDesc mDescription = {};  // The properties of this camera
@@ -118,18 +123,36 @@ class EvsMockCamera : public evs::BnEvsCamera {
             GRALLOC_USAGE_HW_TEXTURE | GRALLOC_USAGE_SW_READ_RARELY | GRALLOC_USAGE_SW_WRITE_OFTEN;
     // Bytes per line in the buffers
     uint32_t mStride = 0;
+    // Frames generated per second
+    int32_t mFramerate;
 
     struct BufferRecord {
         buffer_handle_t handle;
         bool inUse;
+        bool hasPattern;  // Whether the test pattern has already been drawn into this buffer
 
-        explicit BufferRecord(buffer_handle_t h) : handle(h), inUse(false){};
+        explicit BufferRecord(buffer_handle_t h) : handle(h), inUse(false), hasPattern(false){};
     };
 
     std::vector<BufferRecord> mBuffers;  // Graphics buffers to transfer images
+    std::vector<unsigned> mFreeBuffers;  // Indices of the mBuffers ready to be filled, LIFO
     unsigned mFramesAllowed;             // How many buffers are we currently using
     unsigned mFramesInUse;               // How many buffers are currently outstanding
 
+    // One row of the test pattern, copied into each row of a buffer that needs it
+    std::vector<uint32_t> mPatternRow;
+
+    // Frame statistics of the current (or last) video stream
+    struct StreamStats {
+        uint64_t framesDelivered = 0;
+        uint64_t framesDropped = 0;  // Frames skipped because no buffer was available
+        uint64_t framesLate = 0;     // Frame intervals missed because generation fell behind
+        // Time from a frame's scheduled capture time until deliverFrame() returned
+        nsecs_t totalLatency = 0;
+        nsecs_t maxLatency = 0;
+    };
+    StreamStats mStats;
+
     enum StreamStateValues {
         STOPPED,
         RUNNING,
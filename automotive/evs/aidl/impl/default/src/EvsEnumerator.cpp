@@ -557,4 +557,20 @@ ScopedAStatus EvsEnumerator::closeUltrasonicsArray(
     return ScopedAStatus::ok();
 }
 
+binder_status_t EvsEnumerator::dump(int fd, [[maybe_unused]] const char** args,
+                                    [[maybe_unused]] uint32_t numArgs) {
+    std::lock_guard lock(sLock);
+    dprintf(fd, "Cameras:\n");
+    for (const auto& [id, record] : sCameraList) {
+        std::shared_ptr<EvsMockCamera> pActiveCamera = record.activeInstance.lock();
+        if (!pActiveCamera) {
+            dprintf(fd, "%s: not open\n", id.c_str());
+            continue;
+        }
+        pActiveCamera->dump(fd);
+    }
+
+    return STATUS_OK;
+}
+
 }  // namespace aidl::android::hardware::automotive::evs::implementation
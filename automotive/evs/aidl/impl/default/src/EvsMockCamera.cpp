@@ -23,6 +23,11 @@
 #include <ui/GraphicBufferMapper.h>
 #include <utils/SystemClock.h>
 
+#include <time.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
 #include <memory>
 
 namespace {
@@ -37,6 +42,18 @@ constexpr unsigned kMaxBuffersInFlight = 100;
 // Minimum number of buffers to run a video stream
 constexpr int kMinimumBuffersInFlight = 1;
 
+// Frame rate used if the stream configuration doesn't give one.  We arbitrarily choose 15 fps to
+// ensure we pass the 10fps test requirement.
+constexpr int32_t kDefaultFramerate = 15;
+
+// Names of EvsMockCamera::StreamStateValues, for dumps
+constexpr const char* kStreamStateNames[] = {
+        "STOPPED",
+        "RUNNING",
+        "STOPPING",
+        "DEAD",
+};
+
 // Colors for the colorbar test pattern in ABGR format
 constexpr uint32_t kColors[] = {
         0xFFFFFFFF,  // white
@@ -56,7 +73,11 @@ namespace aidl::android::hardware::automotive::evs::implementation {
 
 EvsMockCamera::EvsMockCamera([[maybe_unused]] Sigil sigil, const char* id,
                              std::unique_ptr<ConfigManager::CameraInfo>& camInfo)
-    : mFramesAllowed(0), mFramesInUse(0), mStreamState(STOPPED), mCameraInfo(camInfo) {
+    : mFramerate(kDefaultFramerate),
+      mFramesAllowed(0),
+      mFramesInUse(0),
+      mStreamState(STOPPED),
+      mCameraInfo(camInfo) {
     LOG(DEBUG) << __FUNCTION__;
 
     /* set a camera id */
@@ -112,6 +133,7 @@ void EvsMockCamera::shutdown() {
             rec.handle = nullptr;
         }
         mBuffers.clear();
+        mFreeBuffers.clear();
     }
 
     // Put this object into an unrecoverable error state since somebody else
@@ -188,6 +210,7 @@ ScopedAStatus EvsMockCamera::startVideoStream(const std::shared_ptr<IEvsCameraSt
 
     // Record the user's callback for use when we have a frame ready
     mStream = cb;
+    mStats = {};
 
     // Start the frame generation thread
     mStreamState = RUNNING;
@@ -383,23 +406,7 @@ ScopedAStatus EvsMockCamera::importExternalBuffers(const std::vector<BufferDesc>
             continue;
         }
 
-        bool stored = false;
-        for (auto&& rec : mBuffers) {
-            if (rec.handle != nullptr) {
-                continue;
-            }
-
-            // Use this existing entry.
-            rec.handle = handleToStore;
-            rec.inUse = false;
-            stored = true;
-            break;
-        }
-
-        if (!stored) {
-            // Add a BufferRecord wrapping this handle to our set of available buffers.
-            mBuffers.push_back(BufferRecord(handleToStore));
-        }
+        storeBufferLocked(handleToStore);
         ++mFramesAllowed;
     }
 
@@ -475,22 +482,7 @@ unsigned EvsMockCamera::increaseAvailableFrames_Locked(unsigned numToAdd) {
             mStride = pixelsPerLine;
         }
 
-        // Find a place to store the new buffer
-        auto stored = false;
-        for (auto&& rec : mBuffers) {
-            if (rec.handle == nullptr) {
-                // Use this existing entry
-                rec.handle = memHandle;
-                rec.inUse = false;
-                stored = true;
-                break;
-            }
-        }
-        if (!stored) {
-            // Add a BufferRecord wrapping this handle to our set of available buffers
-            mBuffers.push_back(BufferRecord(memHandle));
-        }
-
+        storeBufferLocked(memHandle);
         ++mFramesAllowed;
         ++added;
     }
@@ -502,35 +494,50 @@ unsigned EvsMockCamera::decreaseAvailableFrames_Locked(unsigned numToRemove) {
     // Acquire the graphics buffer allocator
     ::android::GraphicBufferAllocator& alloc(::android::GraphicBufferAllocator::get());
 
+    // Only the buffers in the free list are not in use and can be released
     unsigned removed = 0;
-    for (auto&& rec : mBuffers) {
-        // Is this record not in use, but holding a buffer that we can free?
-        if ((rec.inUse == false) && (rec.handle != nullptr)) {
-            // Release buffer and update the record so we can recognize it as "empty"
-            alloc.free(rec.handle);
-            rec.handle = nullptr;
-
-            --mFramesAllowed;
-            ++removed;
+    while (removed < numToRemove && !mFreeBuffers.empty()) {
+        // Release buffer and update the record so we can recognize it as "empty"
+        auto& rec = mBuffers[mFreeBuffers.back()];
+        mFreeBuffers.pop_back();
+        alloc.free(rec.handle);
+        rec.handle = nullptr;
 
-            if (removed == numToRemove) {
-                break;
-            }
-        }
+        --mFramesAllowed;
+        ++removed;
     }
 
     return removed;
 }
 
+void EvsMockCamera::storeBufferLocked(buffer_handle_t handle) {
+    // Find a place to store the new buffer, preferring an existing empty entry
+    unsigned id = 0;
+    while (id < mBuffers.size() && mBuffers[id].handle != nullptr) {
+        ++id;
+    }
+    if (id < mBuffers.size()) {
+        mBuffers[id] = BufferRecord(handle);
+    } else {
+        // Add a BufferRecord wrapping this handle to our set of available buffers
+        mBuffers.push_back(BufferRecord(handle));
+    }
+    mFreeBuffers.push_back(id);
+}
+
 // This is the asynchronous frame generation thread that runs in parallel with the
 // main serving thread.  There is one for each active camera instance.
 void EvsMockCamera::generateFrames() {
     LOG(DEBUG) << "Frame generation loop started.";
 
-    unsigned idx = 0;
+    // Frames are scheduled at absolute deadlines, so the time it takes to generate and deliver
+    // them doesn't make the stream drift.
+    const nsecs_t frameInterval = s2ns(1) / mFramerate;
+    nsecs_t deadline = systemTime(SYSTEM_TIME_MONOTONIC);
     while (true) {
-        bool timeForFrame = false;
-        const nsecs_t startTime = systemTime(SYSTEM_TIME_MONOTONIC);
+        unsigned idx = 0;
+        buffer_handle_t memHandle = nullptr;
+        bool needsPattern = false;
 
         // Lock scope for updating shared state
         {
@@ -542,36 +549,30 @@ void EvsMockCamera::generateFrames() {
             }
 
             // Are we allowed to issue another buffer?
-            if (mFramesInUse >= mFramesAllowed) {
+            if (mFreeBuffers.empty()) {
                 // Can't do anything right now -- skip this frame
                 LOG(WARNING) << "Skipped a frame because too many are in flight.";
+                mStats.framesDropped++;
             } else {
-                // Identify an available buffer to fill
-                for (idx = 0; idx < mBuffers.size(); idx++) {
-                    if (!mBuffers[idx].inUse) {
-                        if (mBuffers[idx].handle != nullptr) {
-                            // Found an available record, so stop looking
-                            break;
-                        }
-                    }
-                }
-                if (idx >= mBuffers.size()) {
-                    // This shouldn't happen since we already checked mFramesInUse vs mFramesAllowed
-                    ALOGE("Failed to find an available buffer slot\n");
-                } else {
-                    // We're going to make the frame busy
-                    mBuffers[idx].inUse = true;
-                    mFramesInUse++;
-                    timeForFrame = true;
-                }
+                // Take the most recently returned buffer, which is the most likely to be cached
+                idx = mFreeBuffers.back();
+                mFreeBuffers.pop_back();
+
+                // We're going to make the frame busy
+                mBuffers[idx].inUse = true;
+                mFramesInUse++;
+                memHandle = mBuffers[idx].handle;
+
+                // The test pattern never changes, so each buffer only needs to be drawn once
+                needsPattern = !mBuffers[idx].hasPattern;
+                mBuffers[idx].hasPattern = true;
             }
         }
 
-        if (timeForFrame) {
+        if (memHandle != nullptr) {
             using AidlPixelFormat = ::aidl::android::hardware::graphics::common::PixelFormat;
 
             // Assemble the buffer description we'll transmit below
-            buffer_handle_t memHandle = mBuffers[idx].handle;
             BufferDesc newBuffer = {
                     .buffer =
                             {
@@ -593,8 +594,10 @@ void EvsMockCamera::generateFrames() {
             };
 
             // Write test data into the image buffer
-            fillMockFrame(memHandle, reinterpret_cast<const AHardwareBuffer_Desc*>(
-                                             &newBuffer.buffer.description));
+            if (needsPattern) {
+                fillMockFrame(memHandle, reinterpret_cast<const AHardwareBuffer_Desc*>(
+                                                 &newBuffer.buffer.description));
+            }
 
             // Issue the (asynchronous) callback to the client -- can't be holding the lock
             auto flag = false;
@@ -603,9 +606,14 @@ void EvsMockCamera::generateFrames() {
                 frames.push_back(std::move(newBuffer));
                 flag = mStream->deliverFrame(frames).isOk();
             }
+            const nsecs_t latency = systemTime(SYSTEM_TIME_MONOTONIC) - deadline;
 
+            std::lock_guard<std::mutex> lock(mAccessLock);
             if (flag) {
-                LOG(DEBUG) << "Delivered " << memHandle << ", id = " << mBuffers[idx].handle;
+                LOG(DEBUG) << "Delivered " << memHandle << ", id = " << idx;
+                mStats.framesDelivered++;
+                mStats.totalLatency += latency;
+                mStats.maxLatency = std::max(mStats.maxLatency, latency);
             } else {
                 // This can happen if the client dies and is likely unrecoverable.
                 // To avoid consuming resources generating failing calls, we stop sending
@@ -614,21 +622,29 @@ void EvsMockCamera::generateFrames() {
                 LOG(ERROR) << "Frame delivery call failed in the transport layer.";
 
                 // Since we didn't actually deliver it, mark the frame as available
-                std::lock_guard<std::mutex> lock(mAccessLock);
                 mBuffers[idx].inUse = false;
                 mFramesInUse--;
+                mFreeBuffers.push_back(idx);
             }
         }
 
-        // We arbitrarily choose to generate frames at 15 fps to ensure we pass the 10fps test
-        // requirement
-        static const int kTargetFrameRate = 15;
-        static const nsecs_t kTargetFrameIntervalUs = 1000 * 1000 / kTargetFrameRate;
+        deadline += frameInterval;
         const nsecs_t now = systemTime(SYSTEM_TIME_MONOTONIC);
-        const nsecs_t elapsedTimeUs = (now - startTime) / 1000;
-        const nsecs_t sleepDurationUs = kTargetFrameIntervalUs - elapsedTimeUs;
-        if (sleepDurationUs > 0) {
-            usleep(sleepDurationUs);
+        if (now - deadline >= frameInterval) {
+            // We fell behind by whole frames; skip them rather than sending a burst to catch up
+            const nsecs_t missed = (now - deadline) / frameInterval;
+            deadline += missed * frameInterval;
+
+            std::lock_guard<std::mutex> lock(mAccessLock);
+            mStats.framesLate += missed;
+        }
+
+        const struct timespec wakeup = {
+                .tv_sec = static_cast<time_t>(deadline / s2ns(1)),
+                .tv_nsec = static_cast<long>(deadline % s2ns(1)),
+        };
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeup, nullptr) == EINTR) {
+            // Keep sleeping until the deadline
         }
     }
 
@@ -656,12 +672,18 @@ void EvsMockCamera::fillMockFrame(buffer_handle_t handle, const AHardwareBuffer_
         return;
     }
 
-    // Fill in the test pixels; the colorbar in ABGR format
-    for (unsigned row = 0; row < pDesc->height; row++) {
+    // The colorbar in ABGR format is the same in every row, so we draw a single row and copy it
+    if (mPatternRow.size() != pDesc->width) {
+        mPatternRow.resize(pDesc->width);
         for (unsigned col = 0; col < pDesc->width; col++) {
             const uint32_t index = col * kNumColors / pDesc->width;
-            pixels[col] = kColors[index];
+            mPatternRow[col] = kColors[index];
         }
+    }
+
+    const size_t rowSize = pDesc->width * sizeof(uint32_t);
+    for (unsigned row = 0; row < pDesc->height; row++) {
+        memcpy(pixels, mPatternRow.data(), rowSize);
         // Point to the next row
         // NOTE:  stride retrieved from gralloc is in units of pixels
         pixels = pixels + pDesc->stride;
@@ -689,16 +711,34 @@ void EvsMockCamera::returnBufferLocked(const uint32_t bufferId) {
 
     // If this frame's index is high in the array, try to move it down
     // to improve locality after mFramesAllowed has been reduced.
+    unsigned freeId = bufferId;
     if (bufferId >= mFramesAllowed) {
         // Find an empty slot lower in the array (which should always exist in this case)
-        for (auto&& rec : mBuffers) {
-            if (rec.handle == nullptr) {
-                rec.handle = mBuffers[bufferId].handle;
+        for (unsigned id = 0; id < mBuffers.size(); id++) {
+            if (mBuffers[id].handle == nullptr) {
+                mBuffers[id] = mBuffers[bufferId];
                 mBuffers[bufferId].handle = nullptr;
+                freeId = id;
                 break;
             }
         }
     }
+    mFreeBuffers.push_back(freeId);
+}
+
+void EvsMockCamera::dump(int fd) {
+    std::lock_guard lock(mAccessLock);
+
+    dprintf(fd, "%s: %s, %ux%u at %d fps, %u of %u buffers in use\n", mDescription.id.c_str(),
+            kStreamStateNames[mStreamState], mWidth, mHeight, mFramerate, mFramesInUse,
+            mFramesAllowed);
+    dprintf(fd, "  frames delivered: %" PRIu64 ", dropped: %" PRIu64 ", late: %" PRIu64 "\n",
+            mStats.framesDelivered, mStats.framesDropped, mStats.framesLate);
+
+    const nsecs_t avgLatency =
+            mStats.framesDelivered > 0 ? mStats.totalLatency / mStats.framesDelivered : 0;
+    dprintf(fd, "  delivery latency: avg %" PRId64 " us, max %" PRId64 " us\n",
+            ns2us(avgLatency), ns2us(mStats.maxLatency));
 }
 
 std::shared_ptr<EvsMockCamera> EvsMockCamera::Create(const char* deviceName) {
@@ -723,6 +763,9 @@ std::shared_ptr<EvsMockCamera> EvsMockCamera::Create(
     auto it = camInfo->streamConfigurations.begin();
     c->mWidth = it->second.width;
     c->mHeight = it->second.height;
+    if (it->second.framerate > 0) {
+        c->mFramerate = it->second.framerate;
+    }
     c->mDescription.vendorFlags = 0xFFFFFFFF;  // Arbitrary test value
 
     c->mFormat = HAL_PIXEL_FORMAT_RGBA_8888;
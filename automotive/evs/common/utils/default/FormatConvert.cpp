@@ -17,6 +17,13 @@
 #define LOG_TAG "VtsHalEvsTest"
 
 #include "FormatConvert.h"
+#include "FormatConvertKernels.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
 
 namespace android {
 namespace hardware {
@@ -35,11 +42,60 @@ int Utils::align(int value) {
 }
 
 
-// Limit the given value to the provided range.  :)
-inline float Utils::clamp(float v, float min, float max) {
-    if (v < min) return min;
-    if (v > max) return max;
-    return v;
+namespace {
+
+// Rows converted by each thread at least, so small frames aren't split into tiny bands.
+constexpr unsigned kMinBandRows = 16;
+
+std::atomic<Utils::Kernels> gKernels = Utils::Kernels::AUTO;
+std::atomic<unsigned> gThreadCount = 1;
+
+// Returns the SIMD row kernels to use, or nullptr to convert with the scalar code only.
+const kernels::RowKernels* getRowKernels() {
+    static const kernels::RowKernels* const sBestKernels = []() {
+        const kernels::RowKernels* best = kernels::getNeonKernels();
+        if (best == nullptr) best = kernels::getAvx2Kernels();
+        if (best == nullptr) best = kernels::getSse2Kernels();
+        return best;
+    }();
+
+    if (gKernels == Utils::Kernels::SCALAR) return nullptr;
+    return sBestKernels;
+}
+
+// Calls convertRows(firstRow, endRow) on horizontal bands covering the whole image, in parallel if
+// more than one thread is configured.  Bands start on even rows, so chroma rows are never shared.
+template <typename ConvertRowsFn>
+void forEachBand(unsigned height, ConvertRowsFn convertRows) {
+    const unsigned bands = std::max(1u, std::min(gThreadCount.load(), height / kMinBandRows));
+    const unsigned bandRows = ((height + bands - 1) / bands + 1) & ~1u;
+
+    std::vector<std::thread> threads;
+    for (unsigned first = bandRows; first < height; first += bandRows) {
+        threads.emplace_back(convertRows, first, std::min(first + bandRows, height));
+    }
+    convertRows(0, std::min(bandRows, height));
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+} // anonymous namespace
+
+
+void Utils::setKernels(Kernels kernels) {
+    gKernels = kernels;
+}
+
+
+const char* Utils::getKernelsName() {
+    const kernels::RowKernels* rowKernels = getRowKernels();
+    return rowKernels != nullptr ? rowKernels->name : "scalar";
+}
+
+
+void Utils::setThreadCount(unsigned threads) {
+    gThreadCount = std::max(1u, threads);
 }
 
 
@@ -47,18 +103,19 @@ uint32_t Utils::yuvToRgbx(const unsigned char Y,
                           const unsigned char Uin,
                           const unsigned char Vin,
                           bool bgrxFormat) {
-    // Don't use this if you want to see the best performance.  :)
-    // Better to do this in a pixel shader if we really have to, but on actual
-    // embedded hardware we expect to be able to texture directly from the YUV data
-    float U = Uin - 128.0f;
-    float V = Vin - 128.0f;
-
-    float Rf = Y + 1.140f*V;
-    float Gf = Y - 0.395f*U - 0.581f*V;
-    float Bf = Y + 2.032f*U;
-    unsigned char R = (unsigned char)clamp(Rf, 0.0f, 255.0f);
-    unsigned char G = (unsigned char)clamp(Gf, 0.0f, 255.0f);
-    unsigned char B = (unsigned char)clamp(Bf, 0.0f, 255.0f);
+    // Fixed-point version of the conversion, see FormatConvertKernels.h.  This handles the pixels
+    // the SIMD kernels leave over at the end of a row, and all of them when no kernels are
+    // available, so it has to round exactly like they do.
+    const int U = Uin - 128;
+    const int V = Vin - 128;
+    const int Yf = Y << kernels::kFixedShift;
+
+    auto toChannel = [](int value) -> uint32_t {
+        return std::clamp(value >> kernels::kFixedShift, 0, 255);
+    };
+    const uint32_t R = toChannel(Yf + kernels::kCoefRV * V);
+    const uint32_t G = toChannel(Yf - kernels::kCoefGU * U - kernels::kCoefGV * V);
+    const uint32_t B = toChannel(Yf + kernels::kCoefBU * U);
 
     if (!bgrxFormat) {
         return (R      ) |
@@ -90,19 +147,26 @@ void Utils::copyNV21toRGB32(unsigned width, unsigned height,
     uint8_t* srcY = src;
     uint8_t* srcUV = src+offsetUV;
 
-    for (unsigned r = 0; r < height; r++) {
-        // Note that we're walking the same UV row twice for even/odd luminance rows
-        uint8_t* rowY  = srcY  + r*strideLum;
-        uint8_t* rowUV = srcUV + (r/2 * strideColor);
-
-        uint32_t* rowDest = dst + r*dstStridePixels;
-
-        for (unsigned c = 0; c < width; c++) {
-            unsigned uCol = (c & ~1);   // uCol is always even and repeats 1:2 with Y values
-            unsigned vCol = uCol | 1;   // vCol is always odd
-            rowDest[c] = yuvToRgbx(rowY[c], rowUV[uCol], rowUV[vCol], bgrxFormat);
+    const kernels::RowKernels* rowKernels = getRowKernels();
+    forEachBand(height, [=](unsigned firstRow, unsigned endRow) {
+        for (unsigned r = firstRow; r < endRow; r++) {
+            // Note that we're walking the same UV row twice for even/odd luminance rows
+            uint8_t* rowY  = srcY  + r*strideLum;
+            uint8_t* rowUV = srcUV + (r/2 * strideColor);
+
+            uint32_t* rowDest = dst + r*dstStridePixels;
+
+            unsigned c = 0;
+            if (rowKernels != nullptr) {
+                c = rowKernels->nv21(rowY, rowUV, rowDest, width, bgrxFormat);
+            }
+            for (; c < width; c++) {
+                unsigned uCol = (c & ~1);   // uCol is always even and repeats 1:2 with Y values
+                unsigned vCol = uCol | 1;   // vCol is always odd
+                rowDest[c] = yuvToRgbx(rowY[c], rowUV[uCol], rowUV[vCol], bgrxFormat);
+            }
         }
-    }
+    });
 }
 
 
@@ -126,18 +190,26 @@ void Utils::copyYV12toRGB32(unsigned width, unsigned height,
     uint8_t* srcU = src+offsetU;
     uint8_t* srcV = src+offsetV;
 
-    for (unsigned r = 0; r < height; r++) {
-        // Note that we're walking the same U and V rows twice for even/odd luminance rows
-        uint8_t* rowY = srcY + r*strideLum;
-        uint8_t* rowU = srcU + (r/2 * strideColor);
-        uint8_t* rowV = srcV + (r/2 * strideColor);
-
-        uint32_t* rowDest = dst + r*dstStridePixels;
-
-        for (unsigned c = 0; c < width; c++) {
-            rowDest[c] = yuvToRgbx(rowY[c], rowU[c], rowV[c], bgrxFormat);
+    const kernels::RowKernels* rowKernels = getRowKernels();
+    forEachBand(height, [=](unsigned firstRow, unsigned endRow) {
+        for (unsigned r = firstRow; r < endRow; r++) {
+            // Note that we're walking the same U and V rows twice for even/odd luminance rows
+            uint8_t* rowY = srcY + r*strideLum;
+            uint8_t* rowU = srcU + (r/2 * strideColor);
+            uint8_t* rowV = srcV + (r/2 * strideColor);
+
+            uint32_t* rowDest = dst + r*dstStridePixels;
+
+            unsigned c = 0;
+            if (rowKernels != nullptr) {
+                c = rowKernels->yv12(rowY, rowU, rowV, rowDest, width, bgrxFormat);
+            }
+            for (; c < width; c++) {
+                // Chroma samples repeat 1:2 with Y values
+                rowDest[c] = yuvToRgbx(rowY[c], rowU[c/2], rowV[c/2], bgrxFormat);
+            }
         }
-    }
+    });
 }
 
 
@@ -146,31 +218,33 @@ void Utils::copyYUYVtoRGB32(unsigned width, unsigned height,
                             uint32_t* dst, unsigned dstStridePixels,
                             bool bgrxFormat)
 {
-    uint32_t* srcWords = (uint32_t*)src;
-
-    const int srcRowPadding32 = srcStridePixels/2 - width/2;  // 2 bytes per pixel, 4 bytes per word
-    const int dstRowPadding32 = dstStridePixels   - width;    // 4 bytes per pixel, 4 bytes per word
-
-    for (unsigned r = 0; r < height; r++) {
-        for (unsigned c = 0; c < width/2; c++) {
-            // Note:  we're walking two pixels at a time here (even/odd)
-            uint32_t srcPixel = *srcWords++;
-
-            uint8_t Y1 = (srcPixel)       & 0xFF;
-            uint8_t U  = (srcPixel >> 8)  & 0xFF;
-            uint8_t Y2 = (srcPixel >> 16) & 0xFF;
-            uint8_t V  = (srcPixel >> 24) & 0xFF;
-
-            // On the RGB output, we're writing one pixel at a time
-            *(dst+0) = yuvToRgbx(Y1, U, V, bgrxFormat);
-            *(dst+1) = yuvToRgbx(Y2, U, V, bgrxFormat);
-            dst += 2;
+    // Every 2 pixels share one Y0 U Y1 V macropixel, so rows only hold whole pixel pairs
+    const unsigned pairedWidth = width & ~1;
+
+    const kernels::RowKernels* rowKernels = getRowKernels();
+    forEachBand(height, [=](unsigned firstRow, unsigned endRow) {
+        for (unsigned r = firstRow; r < endRow; r++) {
+            uint8_t* rowSrc = src + r*srcStridePixels*2;    // 2 bytes per pixel
+            uint32_t* rowDest = dst + r*dstStridePixels;
+
+            unsigned c = 0;
+            if (rowKernels != nullptr) {
+                c = rowKernels->yuyv(rowSrc, rowDest, pairedWidth, bgrxFormat);
+            }
+            for (; c < pairedWidth; c += 2) {
+                // Note:  we're walking two pixels at a time here (even/odd)
+                const uint8_t* macroPixel = rowSrc + c*2;
+                uint8_t Y1 = macroPixel[0];
+                uint8_t U  = macroPixel[1];
+                uint8_t Y2 = macroPixel[2];
+                uint8_t V  = macroPixel[3];
+
+                // On the RGB output, we're writing one pixel at a time
+                rowDest[c+0] = yuvToRgbx(Y1, U, V, bgrxFormat);
+                rowDest[c+1] = yuvToRgbx(Y2, U, V, bgrxFormat);
+            }
         }
-
-        // Skip over any extra data or end of row alignment padding
-        srcWords += srcRowPadding32;
-        dst += dstRowPadding32;
-    }
+    });
 }
 
 
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef EVS_FORMATCONVERT_KERNELS_H
+#define EVS_FORMATCONVERT_KERNELS_H
+
+#include <stdint.h>
+
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace evs {
+namespace common {
+namespace kernels {
+
+// Fixed-point YUV to RGB coefficients, scaled by 2^kFixedShift:
+//     R = Y + 1.140*V
+//     G = Y - 0.395*U - 0.581*V
+//     B = Y + 2.032*U
+// The scale is small enough for all intermediate values to fit in 16 bits (saturating only where
+// the result clamps to 255 anyway), so the SIMD kernels can work on 16-bit lanes and produce the
+// same output as the scalar code.  Results are rounded down, like the original float conversion.
+constexpr int kFixedShift = 6;
+constexpr int kCoefRV = 73;   // 1.140 * 64
+constexpr int kCoefGU = 25;   // 0.395 * 64
+constexpr int kCoefGV = 37;   // 0.581 * 64
+constexpr int kCoefBU = 130;  // 2.032 * 64
+
+// Row conversion kernels of one instruction set.  Each kernel converts the first N pixels of a
+// row, for the largest N <= width it can handle in whole SIMD blocks, and returns N.  The caller
+// converts the remaining pixels with the scalar code.
+struct RowKernels {
+    const char* name;
+
+    // Interleaved U/V samples, one pair for every two pixels.
+    unsigned (*nv21)(const uint8_t* y, const uint8_t* uv,
+                     uint32_t* dst, unsigned width, bool bgrxFormat);
+
+    // Separate U and V samples, one of each for every two pixels.
+    unsigned (*yv12)(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                     uint32_t* dst, unsigned width, bool bgrxFormat);
+
+    // Y0 U Y1 V macropixels.
+    unsigned (*yuyv)(const uint8_t* src, uint32_t* dst, unsigned width, bool bgrxFormat);
+};
+
+// Kernels for each instruction set, or nullptr if it's not available on this architecture or CPU.
+const RowKernels* getNeonKernels();
+const RowKernels* getSse2Kernels();
+const RowKernels* getAvx2Kernels();
+
+} // namespace kernels
+} // namespace common
+} // namespace evs
+} // namespace automotive
+} // namespace hardware
+} // namespace android
+
+#endif // EVS_FORMATCONVERT_KERNELS_H
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FormatConvertKernels.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace evs {
+namespace common {
+namespace kernels {
+
+#if defined(__ARM_NEON)
+
+namespace {
+
+// Pixels converted per iteration.
+constexpr unsigned kBlock = 16;
+
+// Converts 8 pixel pairs, given as even and odd luma samples and their shared chroma samples,
+// and stores 16 RGBx/BGRx pixels.
+inline void convertBlock(uint8x8_t yEven, uint8x8_t yOdd, uint8x8_t u, uint8x8_t v,
+                         uint32_t* dst, bool bgrxFormat) {
+    const uint8x8_t bias = vdup_n_u8(128);
+    const int16x8_t u16 = vreinterpretq_s16_u16(vsubl_u8(u, bias));
+    const int16x8_t v16 = vreinterpretq_s16_u16(vsubl_u8(v, bias));
+
+    const int16x8_t rv = vmulq_n_s16(v16, kCoefRV);
+    const int16x8_t guv = vmlaq_n_s16(vmulq_n_s16(u16, kCoefGU), v16, kCoefGV);
+    const int16x8_t bu = vmulq_n_s16(u16, kCoefBU);
+
+    const int16x8_t ye = vreinterpretq_s16_u16(vshll_n_u8(yEven, kFixedShift));
+    const int16x8_t yo = vreinterpretq_s16_u16(vshll_n_u8(yOdd, kFixedShift));
+
+    // vqshrun rounds down and clamps to [0, 255], just like the scalar code.
+    const uint8x8x2_t r = vzip_u8(vqshrun_n_s16(vqaddq_s16(ye, rv), kFixedShift),
+                                  vqshrun_n_s16(vqaddq_s16(yo, rv), kFixedShift));
+    const uint8x8x2_t g = vzip_u8(vqshrun_n_s16(vqsubq_s16(ye, guv), kFixedShift),
+                                  vqshrun_n_s16(vqsubq_s16(yo, guv), kFixedShift));
+    const uint8x8x2_t b = vzip_u8(vqshrun_n_s16(vqaddq_s16(ye, bu), kFixedShift),
+                                  vqshrun_n_s16(vqaddq_s16(yo, bu), kFixedShift));
+
+    const uint8x16_t r16 = vcombine_u8(r.val[0], r.val[1]);
+    const uint8x16_t b16 = vcombine_u8(b.val[0], b.val[1]);
+    uint8x16x4_t pixels;
+    pixels.val[0] = bgrxFormat ? b16 : r16;
+    pixels.val[1] = vcombine_u8(g.val[0], g.val[1]);
+    pixels.val[2] = bgrxFormat ? r16 : b16;
+    pixels.val[3] = vdupq_n_u8(0xFF);
+    vst4q_u8(reinterpret_cast<uint8_t*>(dst), pixels);
+}
+
+unsigned nv21Row(const uint8_t* y, const uint8_t* uv,
+                 uint32_t* dst, unsigned width, bool bgrxFormat) {
+    const unsigned blocks = width / kBlock;
+    for (unsigned i = 0; i < blocks; i++) {
+        const uint8x8x2_t luma = vld2_u8(y + i * kBlock);
+        const uint8x8x2_t chroma = vld2_u8(uv + i * kBlock);
+        convertBlock(luma.val[0], luma.val[1], chroma.val[0], chroma.val[1],
+                     dst + i * kBlock, bgrxFormat);
+    }
+    return blocks * kBlock;
+}
+
+unsigned yv12Row(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                 uint32_t* dst, unsigned width, bool bgrxFormat) {
+    const unsigned blocks = width / kBlock;
+    for (unsigned i = 0; i < blocks; i++) {
+        const uint8x8x2_t luma = vld2_u8(y + i * kBlock);
+        convertBlock(luma.val[0], luma.val[1], vld1_u8(u + i * kBlock / 2),
+                     vld1_u8(v + i * kBlock / 2), dst + i * kBlock, bgrxFormat);
+    }
+    return blocks * kBlock;
+}
+
+unsigned yuyvRow(const uint8_t* src, uint32_t* dst, unsigned width, bool bgrxFormat) {
+    const unsigned blocks = width / kBlock;
+    for (unsigned i = 0; i < blocks; i++) {
+        // Deinterleaves Y0, U, Y1 and V of 8 macropixels.
+        const uint8x8x4_t yuyv = vld4_u8(src + i * kBlock * 2);
+        convertBlock(yuyv.val[0], yuyv.val[2], yuyv.val[1], yuyv.val[3],
+                     dst + i * kBlock, bgrxFormat);
+    }
+    return blocks * kBlock;
+}
+
+constexpr RowKernels kNeonKernels = {
+    .name = "neon",
+    .nv21 = nv21Row,
+    .yv12 = yv12Row,
+    .yuyv = yuyvRow,
+};
+
+} // namespace
+
+// NEON is a mandatory part of all ARM ABIs Android supports, no need to check for it at runtime.
+const RowKernels* getNeonKernels() {
+    return &kNeonKernels;
+}
+
+#else  // !defined(__ARM_NEON)
+
+const RowKernels* getNeonKernels() {
+    return nullptr;
+}
+
+#endif
+
+} // namespace kernels
+} // namespace common
+} // namespace evs
+} // namespace automotive
+} // namespace hardware
+} // namespace android
@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FormatConvertKernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace evs {
+namespace common {
+namespace kernels {
+
+#if defined(__x86_64__) || defined(__i386__)
+
+namespace {
+
+// SSE2 is part of the baseline of all x86 ABIs Android supports.  AVX2 kernels are compiled for
+// it with the target attribute and only used if the CPU supports it.
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+namespace sse2 {
+
+// Pixels converted per iteration.
+constexpr unsigned kBlock = 16;
+
+// Applies chroma contributions of 8 pixel pairs to their 16 pixels, returning one 8-bit channel.
+inline __m128i channel(__m128i yLo, __m128i yHi, __m128i c, bool add) {
+    const __m128i cLo = _mm_unpacklo_epi16(c, c);
+    const __m128i cHi = _mm_unpackhi_epi16(c, c);
+    const __m128i lo = add ? _mm_adds_epi16(yLo, cLo) : _mm_subs_epi16(yLo, cLo);
+    const __m128i hi = add ? _mm_adds_epi16(yHi, cHi) : _mm_subs_epi16(yHi, cHi);
+    // Arithmetic shift rounds down, packus clamps to [0, 255], just like the scalar code.
+    return _mm_packus_epi16(_mm_srai_epi16(lo, kFixedShift), _mm_srai_epi16(hi, kFixedShift));
+}
+
+// Converts 16 pixels, given as 16-bit luma samples of pixels 0-7 and 8-15 and 16-bit chroma
+// samples of the 8 pixel pairs, and stores them as RGBx/BGRx.
+inline void convertBlock(__m128i yLo, __m128i yHi, __m128i u, __m128i v,
+                         uint32_t* dst, bool bgrxFormat) {
+    const __m128i bias = _mm_set1_epi16(128);
+    u = _mm_sub_epi16(u, bias);
+    v = _mm_sub_epi16(v, bias);
+
+    // Chroma contributions are calculated once for each pixel pair.
+    const __m128i rv = _mm_mullo_epi16(v, _mm_set1_epi16(kCoefRV));
+    const __m128i guv = _mm_add_epi16(_mm_mullo_epi16(u, _mm_set1_epi16(kCoefGU)),
+                                      _mm_mullo_epi16(v, _mm_set1_epi16(kCoefGV)));
+    const __m128i bu = _mm_mullo_epi16(u, _mm_set1_epi16(kCoefBU));
+
+    yLo = _mm_slli_epi16(yLo, kFixedShift);
+    yHi = _mm_slli_epi16(yHi, kFixedShift);
+    const __m128i r = channel(yLo, yHi, rv, true);
+    const __m128i g = channel(yLo, yHi, guv, false);
+    const __m128i b = channel(yLo, yHi, bu, true);
+
+    const __m128i alpha = _mm_set1_epi8(static_cast<char>(0xFF));
+    const __m128i first = bgrxFormat ? b : r;
+    const __m128i third = bgrxFormat ? r : b;
+    const __m128i rg = _mm_unpacklo_epi8(first, g);
+    const __m128i rgHi = _mm_unpackhi_epi8(first, g);
+    const __m128i ba = _mm_unpacklo_epi8(third, alpha);
+    const __m128i baHi = _mm_unpackhi_epi8(third, alpha);
+
+    __m128i* out = reinterpret_cast<__m128i*>(dst);
+    _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(rg, ba));
+    _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(rgHi, baHi));
+    _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(rgHi, baHi));
+}
+
+unsigned nv21Row(const uint8_t* y, const uint8_t* uv,
+                 uint32_t* dst, unsigned width, bool bgrxFormat) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lowBytes = _mm_set1_epi16(0xFF);
+    const unsigned blocks = width / kBlock;
+    for (unsigned i = 0; i < blocks; i++) {
+        const __m128i luma = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i * kBlock));
+        const __m128i chroma = _mm_loadu_si128(reinterpret_cast<const __m128i*>(uv + i * kBlock));
+        convertBlock(_mm_unpacklo_epi8(luma, zero), _mm_unpackhi_epi8(luma, zero),
+                     _mm_and_si128(chroma, lowBytes), _mm_srli_epi16(chroma, 8),
+                     dst + i * kBlock, bgrxFormat);
+    }
+    return blocks * kBlock;
+}
+
+unsigned yv12Row(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                 uint32_t* dst, unsigned width, bool bgrxFormat) {
+    const __m128i zero = _mm_setzero_si128();
+    const unsigned blocks = width / kBlock;
+    for (unsigned i = 0; i < blocks; i++) {
+        const __m128i luma = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i * kBlock));
+        const __m128i cb = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(u + i * kBlock / 2));
+        const __m128i cr = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + i * kBlock / 2));
+        convertBlock(_mm_unpacklo_epi8(luma, zero), _mm_unpackhi_epi8(luma, zero),
+                     _mm_unpacklo_epi8(cb, zero), _mm_unpacklo_epi8(cr, zero),
+                     dst + i * kBlock, bgrxFormat);
+    }
+    return blocks * kBlock;
+}
+
+unsigned yuyvRow(const uint8_t* src, uint32_t* dst, unsigned width, bool bgrxFormat) {
+    const __m128i lowBytes = _mm_set1_epi16(0xFF);
+    const __m128i lowWords = _mm_set1_epi32(0xFFFF);
+    const unsigned blocks = width / kBlock;
+    for (unsigned i = 0; i < blocks; i++) {
+        const __m128i* in = reinterpret_cast<const __m128i*>(src + i * kBlock * 2);
+        const __m128i lo = _mm_loadu_si128(in);
+        const __m128i hi = _mm_loadu_si128(in + 1);
+
+        // Chroma bytes as 16-bit U, V, U, V... values, then separated into U and V.
+        const __m128i chromaLo = _mm_srli_epi16(lo, 8);
+        const __m128i chromaHi = _mm_srli_epi16(hi, 8);
+        const __m128i u = _mm_packs_epi32(_mm_and_si128(chromaLo, lowWords),
+                                          _mm_and_si128(chromaHi, lowWords));
+        const __m128i v = _mm_packs_epi32(_mm_srli_epi32(chromaLo, 16),
+                                          _mm_srli_epi32(chromaHi, 16));
+        convertBlock(_mm_and_si128(lo, lowBytes), _mm_and_si128(hi, lowBytes), u, v,
+                     dst + i * kBlock, bgrxFormat);
+    }
+    return blocks * kBlock;
+}
+
+} // namespace sse2
+
+namespace avx2 {
+
+// Pixels converted per iteration.
+constexpr unsigned kBlock = 32;
+
+// Duplicates 16-bit values of 16 pixel pairs for both pixels of each pair, returning pixels 0-15
+// and 16-31.
+AVX2_TARGET inline void duplicate(__m256i c, __m256i& lo, __m256i& hi) {
+    // unpack works within 128-bit lanes, leaving pixels 0-7 and 16-23 in a, 8-15 and 24-31 in b.
+    const __m256i a = _mm256_unpacklo_epi16(c, c);
+    const __m256i b = _mm256_unpackhi_epi16(c, c);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+}
+
+// Applies chroma contributions of 16 pixel pairs to their 32 pixels, returning one 8-bit channel.
+AVX2_TARGET inline __m256i channel(__m256i yLo, __m256i yHi, __m256i c, bool add) {
+    __m256i cLo, cHi;
+    duplicate(c, cLo, cHi);
+    const __m256i lo = add ? _mm256_adds_epi16(yLo, cLo) : _mm256_subs_epi16(yLo, cLo);
+    const __m256i hi = add ? _mm256_adds_epi16(yHi, cHi) : _mm256_subs_epi16(yHi, cHi);
+    const __m256i packed = _mm256_packus_epi16(_mm256_srai_epi16(lo, kFixedShift),
+                                               _mm256_srai_epi16(hi, kFixedShift));
+    // packus works within 128-bit lanes too, restore pixel order.
+    return _mm256_permute4x64_epi64(packed, 0xD8);
+}
+
+// Converts 32 pixels, given as 16-bit luma samples of pixels 0-15 and 16-31 and 16-bit chroma
+// samples of the 16 pixel pairs, and stores them as RGBx/BGRx.
+AVX2_TARGET inline void convertBlock(__m256i yLo, __m256i yHi, __m256i u, __m256i v,
+                                     uint32_t* dst, bool bgrxFormat) {
+    const __m256i bias = _mm256_set1_epi16(128);
+    u = _mm256_sub_epi16(u, bias);
+    v = _mm256_sub_epi16(v, bias);
+
+    const __m256i rv = _mm256_mullo_epi16(v, _mm256_set1_epi16(kCoefRV));
+    const __m256i guv = _mm256_add_epi16(_mm256_mullo_epi16(u, _mm256_set1_epi16(kCoefGU)),
+                                         _mm256_mullo_epi16(v, _mm256_set1_epi16(kCoefGV)));
+    const __m256i bu = _mm256_mullo_epi16(u, _mm256_set1_epi16(kCoefBU));
+
+    yLo = _mm256_slli_epi16(yLo, kFixedShift);
+    yHi = _mm256_slli_epi16(yHi, kFixedShift);
+    const __m256i r = channel(yLo, yHi, rv, true);
+    const __m256i g = channel(yLo, yHi, guv, false);
+    const __m256i b = channel(yLo, yHi, bu, true);
+
+    const __m256i alpha = _mm256_set1_epi8(static_cast<char>(0xFF));
+    const __m256i first = bgrxFormat ? b : r;
+    const __m256i third = bgrxFormat ? r : b;
+
+    // Pixels 0-7 and 16-23 in the low halves, 8-15 and 24-31 in the high halves.
+    const __m256i rg = _mm256_unpacklo_epi8(first, g);
+    const __m256i rgHi = _mm256_unpackhi_epi8(first, g);
+    const __m256i ba = _mm256_unpacklo_epi8(third, alpha);
+    const __m256i baHi = _mm256_unpackhi_epi8(third, alpha);
+
+    const __m256i p0 = _mm256_unpacklo_epi16(rg, ba);      // 0-3, 16-19
+    const __m256i p1 = _mm256_unpackhi_epi16(rg, ba);      // 4-7, 20-23
+    const __m256i p2 = _mm256_unpacklo_epi16(rgHi, baHi);  // 8-11, 24-27
+    const __m256i p3 = _mm256_unpackhi_epi16(rgHi, baHi);  // 12-15, 28-31
+
+    __m256i* out = reinterpret_cast<__m256i*>(dst);
+    _mm256_storeu_si256(out + 0, _mm256_permute2x128_si256(p0, p1, 0x20));
+    _mm256_storeu_si256(out + 1, _mm256_permute2x128_si256(p2, p3, 0x20));
+    _mm256_storeu_si256(out + 2, _mm256_permute2x128_si256(p0, p1, 0x31));
+    _mm256_storeu_si256(out + 3, _mm256_permute2x128_si256(p2, p3, 0x31));
+}
+
+AVX2_TARGET unsigned nv21Row(const uint8_t* y, const uint8_t* uv,
+                             uint32_t* dst, unsigned width, bool bgrxFormat) {
+    const __m256i lowBytes = _mm256_set1_epi16(0xFF);
+    const unsigned blocks = width / kBlock;
+    for (unsigned i = 0; i < blocks; i++) {
+        const __m128i* luma = reinterpret_cast<const __m128i*>(y + i * kBlock);
+        const __m256i chroma =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(uv + i * kBlock));
+        convertBlock(_mm256_cvtepu8_epi16(_mm_loadu_si128(luma)),
+                     _mm256_cvtepu8_epi16(_mm_loadu_si128(luma + 1)),
+                     _mm256_and_si256(chroma, lowBytes), _mm256_srli_epi16(chroma, 8),
+                     dst + i * kBlock, bgrxFormat);
+    }
+    return blocks * kBlock;
+}
+
+AVX2_TARGET unsigned yv12Row(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                             uint32_t* dst, unsigned width, bool bgrxFormat) {
+    const unsigned blocks = width / kBlock;
+    for (unsigned i = 0; i < blocks; i++) {
+        const __m128i* luma = reinterpret_cast<const __m128i*>(y + i * kBlock);
+        const __m128i cb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u + i * kBlock / 2));
+        const __m128i cr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v + i * kBlock / 2));
+        convertBlock(_mm256_cvtepu8_epi16(_mm_loadu_si128(luma)),
+                     _mm256_cvtepu8_epi16(_mm_loadu_si128(luma + 1)),
+                     _mm256_cvtepu8_epi16(cb), _mm256_cvtepu8_epi16(cr),
+                     dst + i * kBlock, bgrxFormat);
+    }
+    return blocks * kBlock;
+}
+
+AVX2_TARGET unsigned yuyvRow(const uint8_t* src, uint32_t* dst, unsigned width,
+                             bool bgrxFormat) {
+    const __m256i lowBytes = _mm256_set1_epi16(0xFF);
+    const __m256i lowWords = _mm256_set1_epi32(0xFFFF);
+    const unsigned blocks = width / kBlock;
+    for (unsigned i = 0; i < blocks; i++) {
+        const __m256i* in = reinterpret_cast<const __m256i*>(src + i * kBlock * 2);
+        const __m256i lo = _mm256_loadu_si256(in);
+        const __m256i hi = _mm256_loadu_si256(in + 1);
+
+        const __m256i chromaLo = _mm256_srli_epi16(lo, 8);
+        const __m256i chromaHi = _mm256_srli_epi16(hi, 8);
+        // packs works within 128-bit lanes, restore pixel pair order.
+        const __m256i u = _mm256_permute4x64_epi64(
+                _mm256_packs_epi32(_mm256_and_si256(chromaLo, lowWords),
+                                   _mm256_and_si256(chromaHi, lowWords)),
+                0xD8);
+        const __m256i v = _mm256_permute4x64_epi64(
+                _mm256_packs_epi32(_mm256_srli_epi32(chromaLo, 16),
+                                   _mm256_srli_epi32(chromaHi, 16)),
+                0xD8);
+        convertBlock(_mm256_and_si256(lo, lowBytes), _mm256_and_si256(hi, lowBytes), u, v,
+                     dst + i * kBlock, bgrxFormat);
+    }
+    return blocks * kBlock;
+}
+
+} // namespace avx2
+
+constexpr RowKernels kSse2Kernels = {
+    .name = "sse2",
+    .nv21 = sse2::nv21Row,
+    .yv12 = sse2::yv12Row,
+    .yuyv = sse2::yuyvRow,
+};
+
+constexpr RowKernels kAvx2Kernels = {
+    .name = "avx2",
+    .nv21 = avx2::nv21Row,
+    .yv12 = avx2::yv12Row,
+    .yuyv = avx2::yuyvRow,
+};
+
+} // namespace
+
+const RowKernels* getSse2Kernels() {
+    return &kSse2Kernels;
+}
+
+const RowKernels* getAvx2Kernels() {
+    return __builtin_cpu_supports("avx2") ? &kAvx2Kernels : nullptr;
+}
+
+#else  // !(defined(__x86_64__) || defined(__i386__))
+
+const RowKernels* getSse2Kernels() {
+    return nullptr;
+}
+
+const RowKernels* getAvx2Kernels() {
+    return nullptr;
+}
+
+#endif
+
+} // namespace kernels
+} // namespace common
+} // namespace evs
+} // namespace automotive
+} // namespace hardware
+} // namespace android
@@ -79,11 +79,26 @@ public:
                                               void* dst, unsigned dstStridePixels,
                                               unsigned pixelSize);
 
+    // Kernels used by the YUV to RGB conversions above.  AUTO picks the fastest SIMD kernels the CPU
+    // supports at runtime, SCALAR forces the portable code, which all SIMD kernels are bit-exact
+    // with.  This is a process-wide setting, meant for testing and benchmarking.
+    enum class Kernels {
+        AUTO,
+        SCALAR,
+    };
+    static void setKernels(Kernels kernels);
+
+    // Name of the kernels the YUV to RGB conversions currently use (such as "neon" or "scalar").
+    static const char* getKernelsName();
+
+    // Converts frames in up to this many horizontal bands, in parallel threads.  The default of 1
+    // converts on the calling thread only.  This is a process-wide setting.
+    static void setThreadCount(unsigned threads);
+
 private:
     template<unsigned alignment>
     static int align(int value);
 
-    static inline float clamp(float v, float min, float max);
     static uint32_t yuvToRgbx(const unsigned char Y,
                               const unsigned char Uin,
                               const unsigned char Vin,
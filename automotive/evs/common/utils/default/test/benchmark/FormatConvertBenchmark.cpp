@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FormatConvert.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <vector>
+
+using android::hardware::automotive::evs::common::Utils;
+using ::benchmark::State;
+
+namespace {
+
+// How the frames are converted, passed as the third benchmark argument.
+enum Mode {
+    SCALAR = 0,
+    SIMD = 1,
+    SIMD_THREADED = 2,
+};
+
+// Threads used by the SIMD_THREADED mode.
+constexpr unsigned kThreadCount = 4;
+
+void setMode(State& state) {
+    const auto mode = static_cast<Mode>(state.range(2));
+    Utils::setKernels(mode == SCALAR ? Utils::Kernels::SCALAR : Utils::Kernels::AUTO);
+    Utils::setThreadCount(mode == SIMD_THREADED ? kThreadCount : 1);
+    state.SetLabel(Utils::getKernelsName());
+}
+
+std::vector<uint8_t> randomFrame(size_t size) {
+    std::vector<uint8_t> frame(size);
+    for (auto& byte : frame) {
+        byte = rand();
+    }
+    return frame;
+}
+
+template <void (*convert)(unsigned, unsigned, uint8_t*, uint32_t*, unsigned)>
+void BM_Planar(State& state) {
+    const unsigned width = state.range(0);
+    const unsigned height = state.range(1);
+    setMode(state);
+
+    // Both NV21 and YV12 use 12 bits per pixel, with rows aligned to 16 bytes.
+    auto src = randomFrame(width * height * 3 / 2 + 16 * height);
+    std::vector<uint32_t> dst(width * height);
+    for (auto _ : state) {
+        convert(width, height, src.data(), dst.data(), width);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+
+template <void (*convert)(unsigned, unsigned, uint8_t*, unsigned, uint32_t*, unsigned)>
+void BM_Yuyv(State& state) {
+    const unsigned width = state.range(0);
+    const unsigned height = state.range(1);
+    setMode(state);
+
+    auto src = randomFrame(width * height * 2);
+    std::vector<uint32_t> dst(width * height);
+    for (auto _ : state) {
+        convert(width, height, src.data(), width, dst.data(), width);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+
+void resolutions(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({"width", "height", "mode"});
+    for (int mode : {SCALAR, SIMD, SIMD_THREADED}) {
+        benchmark->Args({640, 480, mode});
+        benchmark->Args({1280, 720, mode});
+        benchmark->Args({1920, 1080, mode});
+    }
+    benchmark->UseRealTime();
+}
+
+} // anonymous namespace
+
+BENCHMARK_TEMPLATE(BM_Planar, Utils::copyNV21toBGR32)->Apply(resolutions);
+BENCHMARK_TEMPLATE(BM_Planar, Utils::copyYV12toBGR32)->Apply(resolutions);
+BENCHMARK_TEMPLATE(BM_Yuyv, Utils::copyYUYVtoBGR32)->Apply(resolutions);
+
+BENCHMARK_MAIN();
@@ -21,6 +21,24 @@
 #include <ctime>
 #include "FormatConvert.h"
 
+using android::hardware::automotive::evs::common::Utils;
+
+static void convert(int width, int height, uint8_t* src, uint32_t* tgt) {
+#ifdef COPY_NV21_TO_RGB32
+    Utils::copyNV21toRGB32(width, height, src, tgt, width);
+#elif COPY_NV21_TO_BGR32
+    Utils::copyNV21toBGR32(width, height, src, tgt, width);
+#elif COPY_YV12_TO_RGB32
+    Utils::copyYV12toRGB32(width, height, src, tgt, width);
+#elif COPY_YV12_TO_BGR32
+    Utils::copyYV12toBGR32(width, height, src, tgt, width);
+#elif COPY_YUYV_TO_RGB32
+    Utils::copyYUYVtoRGB32(width, height, src, width, tgt, width);
+#elif COPY_YUYV_TO_BGR32
+    Utils::copyYUYVtoBGR32(width, height, src, width, tgt, width);
+#endif
+}
+
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, std::size_t size) {
     // 1 random value (4bytes) + min imagesize = 16*2 times bytes per pixel (worse case 2)
     if (size < (4 + 16 * 2 * 2)) {
@@ -38,28 +56,37 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, std::size_t size) {
     int width = (image_pixel_size / height) & ~(0xF);  // must be divisible by 16
 
     uint8_t* src = (uint8_t*)(data + 4);
-    uint32_t* tgt = (uint32_t*)malloc(sizeof(uint32_t) * image_pixel_size);
+    std::size_t tgt_size = sizeof(uint32_t) * image_pixel_size;
+    uint32_t* tgt = (uint32_t*)malloc(tgt_size);
+    uint32_t* ref = (uint32_t*)malloc(tgt_size);
+    memset(tgt, 0, tgt_size);
+    memset(ref, 0, tgt_size);
 
-#ifdef COPY_NV21_TO_RGB32
-    android::hardware::automotive::evs::common::Utils::copyNV21toRGB32(width, height, src, tgt,
-                                                                       width);
-#elif COPY_NV21_TO_BGR32
-    android::hardware::automotive::evs::common::Utils::copyNV21toBGR32(width, height, src, tgt,
-                                                                       width);
-#elif COPY_YV12_TO_RGB32
-    android::hardware::automotive::evs::common::Utils::copyYV12toRGB32(width, height, src, tgt,
-                                                                       width);
-#elif COPY_YV12_TO_BGR32
-    android::hardware::automotive::evs::common::Utils::copyYV12toBGR32(width, height, src, tgt,
-                                                                       width);
-#elif COPY_YUYV_TO_RGB32
-    android::hardware::automotive::evs::common::Utils::copyYUYVtoRGB32(width, height, src, width,
-                                                                       tgt, width);
-#elif COPY_YUYV_TO_BGR32
-    android::hardware::automotive::evs::common::Utils::copyYUYVtoBGR32(width, height, src, width,
-                                                                       tgt, width);
+    // The SIMD kernels, also when splitting the frame across threads, must produce exactly the
+    // same output as the scalar code.
+    Utils::setKernels(Utils::Kernels::SCALAR);
+    Utils::setThreadCount(1);
+    convert(width, height, src, ref);
+
+    Utils::setKernels(Utils::Kernels::AUTO);
+#if defined(__ARM_NEON)
+    // NEON is always available on ARM builds; the fuzzer must not silently test another kernel.
+    if (strcmp(Utils::getKernelsName(), "neon") != 0) {
+        abort();
+    }
 #endif
+    convert(width, height, src, tgt);
+    if (memcmp(tgt, ref, tgt_size) != 0) {
+        abort();
+    }
+
+    Utils::setThreadCount(4);
+    convert(width, height, src, tgt);
+    if (memcmp(tgt, ref, tgt_size) != 0) {
+        abort();
+    }
 
+    free(ref);
     free(tgt);
 
     return 0;
@@ -0,0 +1,1068 @@
+/*
+ * Copyright (C) 2022 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * DO NOT EDIT MANUALLY!!!
+ *
+ * Generated by tools/generate_annotation_enums.py.
+ */
+
+// clang-format off
+
+#ifndef android_hardware_automotive_vehicle_aidl_generated_lib_EnumConstantsForVehicleProperty_H_
+#define android_hardware_automotive_vehicle_aidl_generated_lib_EnumConstantsForVehicleProperty_H_
+
+#include <aidl/android/hardware/automotive/vehicle/AutomaticEmergencyBrakingState.h>
+#include <aidl/android/hardware/automotive/vehicle/BlindSpotWarningState.h>
+#include <aidl/android/hardware/automotive/vehicle/CreateUserStatus.h>
+#include <aidl/android/hardware/automotive/vehicle/CruiseControlCommand.h>
+#include <aidl/android/hardware/automotive/vehicle/CruiseControlState.h>
+#include <aidl/android/hardware/automotive/vehicle/CruiseControlType.h>
+#include <aidl/android/hardware/automotive/vehicle/CustomInputType.h>
+#include <aidl/android/hardware/automotive/vehicle/DiagnosticFloatSensorIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/DiagnosticIntegerSensorIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/ElectronicTollCollectionCardStatus.h>
+#include <aidl/android/hardware/automotive/vehicle/ElectronicTollCollectionCardType.h>
+#include <aidl/android/hardware/automotive/vehicle/EmergencyLaneKeepAssistState.h>
+#include <aidl/android/hardware/automotive/vehicle/ErrorState.h>
+#include <aidl/android/hardware/automotive/vehicle/EvChargeState.h>
+#include <aidl/android/hardware/automotive/vehicle/EvConnectorType.h>
+#include <aidl/android/hardware/automotive/vehicle/EvRegenerativeBrakingState.h>
+#include <aidl/android/hardware/automotive/vehicle/EvStoppingMode.h>
+#include <aidl/android/hardware/automotive/vehicle/EvsServiceRequestIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/EvsServiceState.h>
+#include <aidl/android/hardware/automotive/vehicle/EvsServiceType.h>
+#include <aidl/android/hardware/automotive/vehicle/ForwardCollisionWarningState.h>
+#include <aidl/android/hardware/automotive/vehicle/FuelType.h>
+#include <aidl/android/hardware/automotive/vehicle/GsrComplianceRequirementType.h>
+#include <aidl/android/hardware/automotive/vehicle/HandsOnDetectionDriverState.h>
+#include <aidl/android/hardware/automotive/vehicle/HandsOnDetectionWarning.h>
+#include <aidl/android/hardware/automotive/vehicle/InitialUserInfoRequestType.h>
+#include <aidl/android/hardware/automotive/vehicle/InitialUserInfoResponseAction.h>
+#include <aidl/android/hardware/automotive/vehicle/LaneCenteringAssistCommand.h>
+#include <aidl/android/hardware/automotive/vehicle/LaneCenteringAssistState.h>
+#include <aidl/android/hardware/automotive/vehicle/LaneDepartureWarningState.h>
+#include <aidl/android/hardware/automotive/vehicle/LaneKeepAssistState.h>
+#include <aidl/android/hardware/automotive/vehicle/LocationCharacterization.h>
+#include <aidl/android/hardware/automotive/vehicle/Obd2CommonIgnitionMonitors.h>
+#include <aidl/android/hardware/automotive/vehicle/Obd2CompressionIgnitionMonitors.h>
+#include <aidl/android/hardware/automotive/vehicle/Obd2FuelSystemStatus.h>
+#include <aidl/android/hardware/automotive/vehicle/Obd2FuelType.h>
+#include <aidl/android/hardware/automotive/vehicle/Obd2IgnitionMonitorKind.h>
+#include <aidl/android/hardware/automotive/vehicle/Obd2SecondaryAirStatus.h>
+#include <aidl/android/hardware/automotive/vehicle/Obd2SparkIgnitionMonitors.h>
+#include <aidl/android/hardware/automotive/vehicle/PortLocationType.h>
+#include <aidl/android/hardware/automotive/vehicle/ProcessTerminationReason.h>
+#include <aidl/android/hardware/automotive/vehicle/RotaryInputType.h>
+#include <aidl/android/hardware/automotive/vehicle/SwitchUserMessageType.h>
+#include <aidl/android/hardware/automotive/vehicle/SwitchUserStatus.h>
+#include <aidl/android/hardware/automotive/vehicle/TrailerState.h>
+#include <aidl/android/hardware/automotive/vehicle/UserIdentificationAssociationSetValue.h>
+#include <aidl/android/hardware/automotive/vehicle/UserIdentificationAssociationType.h>
+#include <aidl/android/hardware/automotive/vehicle/UserIdentificationAssociationValue.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleApPowerBootupReason.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleApPowerStateConfigFlag.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleApPowerStateReport.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleApPowerStateReq.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleApPowerStateReqIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleApPowerStateShutdownParam.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleArea.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleAreaDoor.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleAreaMirror.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleAreaSeat.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleAreaWheel.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleAreaWindow.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleDisplay.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleGear.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleHvacFanDirection.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleHwKeyInputAction.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleHwMotionButtonStateFlag.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleHwMotionInputAction.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleHwMotionInputSource.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleHwMotionToolType.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleIgnitionState.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleLightState.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleLightSwitch.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleOilLevel.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleProperty.h>
+#include <aidl/android/hardware/automotive/vehicle/VehiclePropertyAccess.h>
+#include <aidl/android/hardware/automotive/vehicle/VehiclePropertyChangeMode.h>
+#include <aidl/android/hardware/automotive/vehicle/VehiclePropertyGroup.h>
+#include <aidl/android/hardware/automotive/vehicle/VehiclePropertyType.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleSeatOccupancyState.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleTurnSignal.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleUnit.h>
+#include <aidl/android/hardware/automotive/vehicle/VehicleVendorPermission.h>
+#include <aidl/android/hardware/automotive/vehicle/VmsAvailabilityStateIntegerValuesIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/VmsBaseMessageIntegerValuesIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/VmsMessageType.h>
+#include <aidl/android/hardware/automotive/vehicle/VmsMessageWithLayerAndPublisherIdIntegerValuesIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/VmsMessageWithLayerIntegerValuesIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/VmsOfferingMessageIntegerValuesIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/VmsPublisherInformationIntegerValuesIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/VmsStartSessionMessageIntegerValuesIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/VmsSubscriptionsStateIntegerValuesIndex.h>
+#include <aidl/android/hardware/automotive/vehicle/WindshieldWipersState.h>
+#include <aidl/android/hardware/automotive/vehicle/WindshieldWipersSwitch.h>
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+// All the enum constants defined for vehicle properties, in the format of "EnumType::NAME".
+constexpr std::pair<std::string_view, int32_t> EnumConstantsForVehicleProperty[] = {
+        {"AutomaticEmergencyBrakingState::OTHER", static_cast<int32_t>(AutomaticEmergencyBrakingState::OTHER)},
+        {"AutomaticEmergencyBrakingState::ENABLED", static_cast<int32_t>(AutomaticEmergencyBrakingState::ENABLED)},
+        {"AutomaticEmergencyBrakingState::ACTIVATED", static_cast<int32_t>(AutomaticEmergencyBrakingState::ACTIVATED)},
+        {"AutomaticEmergencyBrakingState::USER_OVERRIDE", static_cast<int32_t>(AutomaticEmergencyBrakingState::USER_OVERRIDE)},
+        {"BlindSpotWarningState::OTHER", static_cast<int32_t>(BlindSpotWarningState::OTHER)},
+        {"BlindSpotWarningState::NO_WARNING", static_cast<int32_t>(BlindSpotWarningState::NO_WARNING)},
+        {"BlindSpotWarningState::WARNING", static_cast<int32_t>(BlindSpotWarningState::WARNING)},
+        {"CreateUserStatus::SUCCESS", static_cast<int32_t>(CreateUserStatus::SUCCESS)},
+        {"CreateUserStatus::FAILURE", static_cast<int32_t>(CreateUserStatus::FAILURE)},
+        {"CruiseControlCommand::ACTIVATE", static_cast<int32_t>(CruiseControlCommand::ACTIVATE)},
+        {"CruiseControlCommand::SUSPEND", static_cast<int32_t>(CruiseControlCommand::SUSPEND)},
+        {"CruiseControlCommand::INCREASE_TARGET_SPEED", static_cast<int32_t>(CruiseControlCommand::INCREASE_TARGET_SPEED)},
+        {"CruiseControlCommand::DECREASE_TARGET_SPEED", static_cast<int32_t>(CruiseControlCommand::DECREASE_TARGET_SPEED)},
+        {"CruiseControlCommand::INCREASE_TARGET_TIME_GAP", static_cast<int32_t>(CruiseControlCommand::INCREASE_TARGET_TIME_GAP)},
+        {"CruiseControlCommand::DECREASE_TARGET_TIME_GAP", static_cast<int32_t>(CruiseControlCommand::DECREASE_TARGET_TIME_GAP)},
+        {"CruiseControlState::OTHER", static_cast<int32_t>(CruiseControlState::OTHER)},
+        {"CruiseControlState::ENABLED", static_cast<int32_t>(CruiseControlState::ENABLED)},
+        {"CruiseControlState::ACTIVATED", static_cast<int32_t>(CruiseControlState::ACTIVATED)},
+        {"CruiseControlState::USER_OVERRIDE", static_cast<int32_t>(CruiseControlState::USER_OVERRIDE)},
+        {"CruiseControlState::SUSPENDED", static_cast<int32_t>(CruiseControlState::SUSPENDED)},
+        {"CruiseControlState::FORCED_DEACTIVATION_WARNING", static_cast<int32_t>(CruiseControlState::FORCED_DEACTIVATION_WARNING)},
+        {"CruiseControlType::OTHER", static_cast<int32_t>(CruiseControlType::OTHER)},
+        {"CruiseControlType::STANDARD", static_cast<int32_t>(CruiseControlType::STANDARD)},
+        {"CruiseControlType::ADAPTIVE", static_cast<int32_t>(CruiseControlType::ADAPTIVE)},
+        {"CruiseControlType::PREDICTIVE", static_cast<int32_t>(CruiseControlType::PREDICTIVE)},
+        {"CustomInputType::CUSTOM_EVENT_F1", static_cast<int32_t>(CustomInputType::CUSTOM_EVENT_F1)},
+        {"CustomInputType::CUSTOM_EVENT_F2", static_cast<int32_t>(CustomInputType::CUSTOM_EVENT_F2)},
+        {"CustomInputType::CUSTOM_EVENT_F3", static_cast<int32_t>(CustomInputType::CUSTOM_EVENT_F3)},
+        {"CustomInputType::CUSTOM_EVENT_F4", static_cast<int32_t>(CustomInputType::CUSTOM_EVENT_F4)},
+        {"CustomInputType::CUSTOM_EVENT_F5", static_cast<int32_t>(CustomInputType::CUSTOM_EVENT_F5)},
+        {"CustomInputType::CUSTOM_EVENT_F6", static_cast<int32_t>(CustomInputType::CUSTOM_EVENT_F6)},
+        {"CustomInputType::CUSTOM_EVENT_F7", static_cast<int32_t>(CustomInputType::CUSTOM_EVENT_F7)},
+        {"CustomInputType::CUSTOM_EVENT_F8", static_cast<int32_t>(CustomInputType::CUSTOM_EVENT_F8)},
+        {"CustomInputType::CUSTOM_EVENT_F9", static_cast<int32_t>(CustomInputType::CUSTOM_EVENT_F9)},
+        {"CustomInputType::CUSTOM_EVENT_F10", static_cast<int32_t>(CustomInputType::CUSTOM_EVENT_F10)},
+        {"DiagnosticFloatSensorIndex::CALCULATED_ENGINE_LOAD", static_cast<int32_t>(DiagnosticFloatSensorIndex::CALCULATED_ENGINE_LOAD)},
+        {"DiagnosticFloatSensorIndex::ENGINE_COOLANT_TEMPERATURE", static_cast<int32_t>(DiagnosticFloatSensorIndex::ENGINE_COOLANT_TEMPERATURE)},
+        {"DiagnosticFloatSensorIndex::SHORT_TERM_FUEL_TRIM_BANK1", static_cast<int32_t>(DiagnosticFloatSensorIndex::SHORT_TERM_FUEL_TRIM_BANK1)},
+        {"DiagnosticFloatSensorIndex::LONG_TERM_FUEL_TRIM_BANK1", static_cast<int32_t>(DiagnosticFloatSensorIndex::LONG_TERM_FUEL_TRIM_BANK1)},
+        {"DiagnosticFloatSensorIndex::SHORT_TERM_FUEL_TRIM_BANK2", static_cast<int32_t>(DiagnosticFloatSensorIndex::SHORT_TERM_FUEL_TRIM_BANK2)},
+        {"DiagnosticFloatSensorIndex::LONG_TERM_FUEL_TRIM_BANK2", static_cast<int32_t>(DiagnosticFloatSensorIndex::LONG_TERM_FUEL_TRIM_BANK2)},
+        {"DiagnosticFloatSensorIndex::FUEL_PRESSURE", static_cast<int32_t>(DiagnosticFloatSensorIndex::FUEL_PRESSURE)},
+        {"DiagnosticFloatSensorIndex::INTAKE_MANIFOLD_ABSOLUTE_PRESSURE", static_cast<int32_t>(DiagnosticFloatSensorIndex::INTAKE_MANIFOLD_ABSOLUTE_PRESSURE)},
+        {"DiagnosticFloatSensorIndex::ENGINE_RPM", static_cast<int32_t>(DiagnosticFloatSensorIndex::ENGINE_RPM)},
+        {"DiagnosticFloatSensorIndex::VEHICLE_SPEED", static_cast<int32_t>(DiagnosticFloatSensorIndex::VEHICLE_SPEED)},
+        {"DiagnosticFloatSensorIndex::TIMING_ADVANCE", static_cast<int32_t>(DiagnosticFloatSensorIndex::TIMING_ADVANCE)},
+        {"DiagnosticFloatSensorIndex::MAF_AIR_FLOW_RATE", static_cast<int32_t>(DiagnosticFloatSensorIndex::MAF_AIR_FLOW_RATE)},
+        {"DiagnosticFloatSensorIndex::THROTTLE_POSITION", static_cast<int32_t>(DiagnosticFloatSensorIndex::THROTTLE_POSITION)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR1_VOLTAGE", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR1_VOLTAGE)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR1_SHORT_TERM_FUEL_TRIM", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR1_SHORT_TERM_FUEL_TRIM)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR1_FUEL_AIR_EQUIVALENCE_RATIO", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR1_FUEL_AIR_EQUIVALENCE_RATIO)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR2_VOLTAGE", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR2_VOLTAGE)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR2_SHORT_TERM_FUEL_TRIM", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR2_SHORT_TERM_FUEL_TRIM)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR2_FUEL_AIR_EQUIVALENCE_RATIO", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR2_FUEL_AIR_EQUIVALENCE_RATIO)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR3_VOLTAGE", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR3_VOLTAGE)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR3_SHORT_TERM_FUEL_TRIM", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR3_SHORT_TERM_FUEL_TRIM)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR3_FUEL_AIR_EQUIVALENCE_RATIO", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR3_FUEL_AIR_EQUIVALENCE_RATIO)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR4_VOLTAGE", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR4_VOLTAGE)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR4_SHORT_TERM_FUEL_TRIM", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR4_SHORT_TERM_FUEL_TRIM)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR4_FUEL_AIR_EQUIVALENCE_RATIO", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR4_FUEL_AIR_EQUIVALENCE_RATIO)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR5_VOLTAGE", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR5_VOLTAGE)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR5_SHORT_TERM_FUEL_TRIM", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR5_SHORT_TERM_FUEL_TRIM)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR5_FUEL_AIR_EQUIVALENCE_RATIO", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR5_FUEL_AIR_EQUIVALENCE_RATIO)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR6_VOLTAGE", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR6_VOLTAGE)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR6_SHORT_TERM_FUEL_TRIM", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR6_SHORT_TERM_FUEL_TRIM)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR6_FUEL_AIR_EQUIVALENCE_RATIO", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR6_FUEL_AIR_EQUIVALENCE_RATIO)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR7_VOLTAGE", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR7_VOLTAGE)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR7_SHORT_TERM_FUEL_TRIM", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR7_SHORT_TERM_FUEL_TRIM)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR7_FUEL_AIR_EQUIVALENCE_RATIO", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR7_FUEL_AIR_EQUIVALENCE_RATIO)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR8_VOLTAGE", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR8_VOLTAGE)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR8_SHORT_TERM_FUEL_TRIM", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR8_SHORT_TERM_FUEL_TRIM)},
+        {"DiagnosticFloatSensorIndex::OXYGEN_SENSOR8_FUEL_AIR_EQUIVALENCE_RATIO", static_cast<int32_t>(DiagnosticFloatSensorIndex::OXYGEN_SENSOR8_FUEL_AIR_EQUIVALENCE_RATIO)},
+        {"DiagnosticFloatSensorIndex::FUEL_RAIL_PRESSURE", static_cast<int32_t>(DiagnosticFloatSensorIndex::FUEL_RAIL_PRESSURE)},
+        {"DiagnosticFloatSensorIndex::FUEL_RAIL_GAUGE_PRESSURE", static_cast<int32_t>(DiagnosticFloatSensorIndex::FUEL_RAIL_GAUGE_PRESSURE)},
+        {"DiagnosticFloatSensorIndex::COMMANDED_EXHAUST_GAS_RECIRCULATION", static_cast<int32_t>(DiagnosticFloatSensorIndex::COMMANDED_EXHAUST_GAS_RECIRCULATION)},
+        {"DiagnosticFloatSensorIndex::EXHAUST_GAS_RECIRCULATION_ERROR", static_cast<int32_t>(DiagnosticFloatSensorIndex::EXHAUST_GAS_RECIRCULATION_ERROR)},
+        {"DiagnosticFloatSensorIndex::COMMANDED_EVAPORATIVE_PURGE", static_cast<int32_t>(DiagnosticFloatSensorIndex::COMMANDED_EVAPORATIVE_PURGE)},
+        {"DiagnosticFloatSensorIndex::FUEL_TANK_LEVEL_INPUT", static_cast<int32_t>(DiagnosticFloatSensorIndex::FUEL_TANK_LEVEL_INPUT)},
+        {"DiagnosticFloatSensorIndex::EVAPORATION_SYSTEM_VAPOR_PRESSURE", static_cast<int32_t>(DiagnosticFloatSensorIndex::EVAPORATION_SYSTEM_VAPOR_PRESSURE)},
+        {"DiagnosticFloatSensorIndex::CATALYST_TEMPERATURE_BANK1_SENSOR1", static_cast<int32_t>(DiagnosticFloatSensorIndex::CATALYST_TEMPERATURE_BANK1_SENSOR1)},
+        {"DiagnosticFloatSensorIndex::CATALYST_TEMPERATURE_BANK2_SENSOR1", static_cast<int32_t>(DiagnosticFloatSensorIndex::CATALYST_TEMPERATURE_BANK2_SENSOR1)},
+        {"DiagnosticFloatSensorIndex::CATALYST_TEMPERATURE_BANK1_SENSOR2", static_cast<int32_t>(DiagnosticFloatSensorIndex::CATALYST_TEMPERATURE_BANK1_SENSOR2)},
+        {"DiagnosticFloatSensorIndex::CATALYST_TEMPERATURE_BANK2_SENSOR2", static_cast<int32_t>(DiagnosticFloatSensorIndex::CATALYST_TEMPERATURE_BANK2_SENSOR2)},
+        {"DiagnosticFloatSensorIndex::ABSOLUTE_LOAD_VALUE", static_cast<int32_t>(DiagnosticFloatSensorIndex::ABSOLUTE_LOAD_VALUE)},
+        {"DiagnosticFloatSensorIndex::FUEL_AIR_COMMANDED_EQUIVALENCE_RATIO", static_cast<int32_t>(DiagnosticFloatSensorIndex::FUEL_AIR_COMMANDED_EQUIVALENCE_RATIO)},
+        {"DiagnosticFloatSensorIndex::RELATIVE_THROTTLE_POSITION", static_cast<int32_t>(DiagnosticFloatSensorIndex::RELATIVE_THROTTLE_POSITION)},
+        {"DiagnosticFloatSensorIndex::ABSOLUTE_THROTTLE_POSITION_B", static_cast<int32_t>(DiagnosticFloatSensorIndex::ABSOLUTE_THROTTLE_POSITION_B)},
+        {"DiagnosticFloatSensorIndex::ABSOLUTE_THROTTLE_POSITION_C", static_cast<int32_t>(DiagnosticFloatSensorIndex::ABSOLUTE_THROTTLE_POSITION_C)},
+        {"DiagnosticFloatSensorIndex::ACCELERATOR_PEDAL_POSITION_D", static_cast<int32_t>(DiagnosticFloatSensorIndex::ACCELERATOR_PEDAL_POSITION_D)},
+        {"DiagnosticFloatSensorIndex::ACCELERATOR_PEDAL_POSITION_E", static_cast<int32_t>(DiagnosticFloatSensorIndex::ACCELERATOR_PEDAL_POSITION_E)},
+        {"DiagnosticFloatSensorIndex::ACCELERATOR_PEDAL_POSITION_F", static_cast<int32_t>(DiagnosticFloatSensorIndex::ACCELERATOR_PEDAL_POSITION_F)},
+        {"DiagnosticFloatSensorIndex::COMMANDED_THROTTLE_ACTUATOR", static_cast<int32_t>(DiagnosticFloatSensorIndex::COMMANDED_THROTTLE_ACTUATOR)},
+        {"DiagnosticFloatSensorIndex::ETHANOL_FUEL_PERCENTAGE", static_cast<int32_t>(DiagnosticFloatSensorIndex::ETHANOL_FUEL_PERCENTAGE)},
+        {"DiagnosticFloatSensorIndex::ABSOLUTE_EVAPORATION_SYSTEM_VAPOR_PRESSURE", static_cast<int32_t>(DiagnosticFloatSensorIndex::ABSOLUTE_EVAPORATION_SYSTEM_VAPOR_PRESSURE)},
+        {"DiagnosticFloatSensorIndex::SHORT_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK1", static_cast<int32_t>(DiagnosticFloatSensorIndex::SHORT_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK1)},
+        {"DiagnosticFloatSensorIndex::SHORT_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK2", static_cast<int32_t>(DiagnosticFloatSensorIndex::SHORT_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK2)},
+        {"DiagnosticFloatSensorIndex::SHORT_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK3", static_cast<int32_t>(DiagnosticFloatSensorIndex::SHORT_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK3)},
+        {"DiagnosticFloatSensorIndex::SHORT_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK4", static_cast<int32_t>(DiagnosticFloatSensorIndex::SHORT_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK4)},
+        {"DiagnosticFloatSensorIndex::LONG_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK1", static_cast<int32_t>(DiagnosticFloatSensorIndex::LONG_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK1)},
+        {"DiagnosticFloatSensorIndex::LONG_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK2", static_cast<int32_t>(DiagnosticFloatSensorIndex::LONG_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK2)},
+        {"DiagnosticFloatSensorIndex::LONG_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK3", static_cast<int32_t>(DiagnosticFloatSensorIndex::LONG_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK3)},
+        {"DiagnosticFloatSensorIndex::LONG_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK4", static_cast<int32_t>(DiagnosticFloatSensorIndex::LONG_TERM_SECONDARY_OXYGEN_SENSOR_TRIM_BANK4)},
+        {"DiagnosticFloatSensorIndex::RELATIVE_ACCELERATOR_PEDAL_POSITION", static_cast<int32_t>(DiagnosticFloatSensorIndex::RELATIVE_ACCELERATOR_PEDAL_POSITION)},
+        {"DiagnosticFloatSensorIndex::HYBRID_BATTERY_PACK_REMAINING_LIFE", static_cast<int32_t>(DiagnosticFloatSensorIndex::HYBRID_BATTERY_PACK_REMAINING_LIFE)},
+        {"DiagnosticFloatSensorIndex::FUEL_INJECTION_TIMING", static_cast<int32_t>(DiagnosticFloatSensorIndex::FUEL_INJECTION_TIMING)},
+        {"DiagnosticFloatSensorIndex::ENGINE_FUEL_RATE", static_cast<int32_t>(DiagnosticFloatSensorIndex::ENGINE_FUEL_RATE)},
+        {"DiagnosticIntegerSensorIndex::FUEL_SYSTEM_STATUS", static_cast<int32_t>(DiagnosticIntegerSensorIndex::FUEL_SYSTEM_STATUS)},
+        {"DiagnosticIntegerSensorIndex::MALFUNCTION_INDICATOR_LIGHT_ON", static_cast<int32_t>(DiagnosticIntegerSensorIndex::MALFUNCTION_INDICATOR_LIGHT_ON)},
+        {"DiagnosticIntegerSensorIndex::IGNITION_MONITORS_SUPPORTED", static_cast<int32_t>(DiagnosticIntegerSensorIndex::IGNITION_MONITORS_SUPPORTED)},
+        {"DiagnosticIntegerSensorIndex::IGNITION_SPECIFIC_MONITORS", static_cast<int32_t>(DiagnosticIntegerSensorIndex::IGNITION_SPECIFIC_MONITORS)},
+        {"DiagnosticIntegerSensorIndex::INTAKE_AIR_TEMPERATURE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::INTAKE_AIR_TEMPERATURE)},
+        {"DiagnosticIntegerSensorIndex::COMMANDED_SECONDARY_AIR_STATUS", static_cast<int32_t>(DiagnosticIntegerSensorIndex::COMMANDED_SECONDARY_AIR_STATUS)},
+        {"DiagnosticIntegerSensorIndex::NUM_OXYGEN_SENSORS_PRESENT", static_cast<int32_t>(DiagnosticIntegerSensorIndex::NUM_OXYGEN_SENSORS_PRESENT)},
+        {"DiagnosticIntegerSensorIndex::RUNTIME_SINCE_ENGINE_START", static_cast<int32_t>(DiagnosticIntegerSensorIndex::RUNTIME_SINCE_ENGINE_START)},
+        {"DiagnosticIntegerSensorIndex::DISTANCE_TRAVELED_WITH_MALFUNCTION_INDICATOR_LIGHT_ON", static_cast<int32_t>(DiagnosticIntegerSensorIndex::DISTANCE_TRAVELED_WITH_MALFUNCTION_INDICATOR_LIGHT_ON)},
+        {"DiagnosticIntegerSensorIndex::WARMUPS_SINCE_CODES_CLEARED", static_cast<int32_t>(DiagnosticIntegerSensorIndex::WARMUPS_SINCE_CODES_CLEARED)},
+        {"DiagnosticIntegerSensorIndex::DISTANCE_TRAVELED_SINCE_CODES_CLEARED", static_cast<int32_t>(DiagnosticIntegerSensorIndex::DISTANCE_TRAVELED_SINCE_CODES_CLEARED)},
+        {"DiagnosticIntegerSensorIndex::ABSOLUTE_BAROMETRIC_PRESSURE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::ABSOLUTE_BAROMETRIC_PRESSURE)},
+        {"DiagnosticIntegerSensorIndex::CONTROL_MODULE_VOLTAGE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::CONTROL_MODULE_VOLTAGE)},
+        {"DiagnosticIntegerSensorIndex::AMBIENT_AIR_TEMPERATURE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::AMBIENT_AIR_TEMPERATURE)},
+        {"DiagnosticIntegerSensorIndex::TIME_WITH_MALFUNCTION_LIGHT_ON", static_cast<int32_t>(DiagnosticIntegerSensorIndex::TIME_WITH_MALFUNCTION_LIGHT_ON)},
+        {"DiagnosticIntegerSensorIndex::TIME_SINCE_TROUBLE_CODES_CLEARED", static_cast<int32_t>(DiagnosticIntegerSensorIndex::TIME_SINCE_TROUBLE_CODES_CLEARED)},
+        {"DiagnosticIntegerSensorIndex::MAX_FUEL_AIR_EQUIVALENCE_RATIO", static_cast<int32_t>(DiagnosticIntegerSensorIndex::MAX_FUEL_AIR_EQUIVALENCE_RATIO)},
+        {"DiagnosticIntegerSensorIndex::MAX_OXYGEN_SENSOR_VOLTAGE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::MAX_OXYGEN_SENSOR_VOLTAGE)},
+        {"DiagnosticIntegerSensorIndex::MAX_OXYGEN_SENSOR_CURRENT", static_cast<int32_t>(DiagnosticIntegerSensorIndex::MAX_OXYGEN_SENSOR_CURRENT)},
+        {"DiagnosticIntegerSensorIndex::MAX_INTAKE_MANIFOLD_ABSOLUTE_PRESSURE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::MAX_INTAKE_MANIFOLD_ABSOLUTE_PRESSURE)},
+        {"DiagnosticIntegerSensorIndex::MAX_AIR_FLOW_RATE_FROM_MASS_AIR_FLOW_SENSOR", static_cast<int32_t>(DiagnosticIntegerSensorIndex::MAX_AIR_FLOW_RATE_FROM_MASS_AIR_FLOW_SENSOR)},
+        {"DiagnosticIntegerSensorIndex::FUEL_TYPE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::FUEL_TYPE)},
+        {"DiagnosticIntegerSensorIndex::FUEL_RAIL_ABSOLUTE_PRESSURE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::FUEL_RAIL_ABSOLUTE_PRESSURE)},
+        {"DiagnosticIntegerSensorIndex::ENGINE_OIL_TEMPERATURE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::ENGINE_OIL_TEMPERATURE)},
+        {"DiagnosticIntegerSensorIndex::DRIVER_DEMAND_PERCENT_TORQUE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::DRIVER_DEMAND_PERCENT_TORQUE)},
+        {"DiagnosticIntegerSensorIndex::ENGINE_ACTUAL_PERCENT_TORQUE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::ENGINE_ACTUAL_PERCENT_TORQUE)},
+        {"DiagnosticIntegerSensorIndex::ENGINE_REFERENCE_PERCENT_TORQUE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::ENGINE_REFERENCE_PERCENT_TORQUE)},
+        {"DiagnosticIntegerSensorIndex::ENGINE_PERCENT_TORQUE_DATA_IDLE", static_cast<int32_t>(DiagnosticIntegerSensorIndex::ENGINE_PERCENT_TORQUE_DATA_IDLE)},
+        {"DiagnosticIntegerSensorIndex::ENGINE_PERCENT_TORQUE_DATA_POINT1", static_cast<int32_t>(DiagnosticIntegerSensorIndex::ENGINE_PERCENT_TORQUE_DATA_POINT1)},
+        {"DiagnosticIntegerSensorIndex::ENGINE_PERCENT_TORQUE_DATA_POINT2", static_cast<int32_t>(DiagnosticIntegerSensorIndex::ENGINE_PERCENT_TORQUE_DATA_POINT2)},
+        {"DiagnosticIntegerSensorIndex::ENGINE_PERCENT_TORQUE_DATA_POINT3", static_cast<int32_t>(DiagnosticIntegerSensorIndex::ENGINE_PERCENT_TORQUE_DATA_POINT3)},
+        {"DiagnosticIntegerSensorIndex::ENGINE_PERCENT_TORQUE_DATA_POINT4", static_cast<int32_t>(DiagnosticIntegerSensorIndex::ENGINE_PERCENT_TORQUE_DATA_POINT4)},
+        {"ElectronicTollCollectionCardStatus::UNKNOWN", static_cast<int32_t>(ElectronicTollCollectionCardStatus::UNKNOWN)},
+        {"ElectronicTollCollectionCardStatus::ELECTRONIC_TOLL_COLLECTION_CARD_VALID", static_cast<int32_t>(ElectronicTollCollectionCardStatus::ELECTRONIC_TOLL_COLLECTION_CARD_VALID)},
+        {"ElectronicTollCollectionCardStatus::ELECTRONIC_TOLL_COLLECTION_CARD_INVALID", static_cast<int32_t>(ElectronicTollCollectionCardStatus::ELECTRONIC_TOLL_COLLECTION_CARD_INVALID)},
+        {"ElectronicTollCollectionCardStatus::ELECTRONIC_TOLL_COLLECTION_CARD_NOT_INSERTED", static_cast<int32_t>(ElectronicTollCollectionCardStatus::ELECTRONIC_TOLL_COLLECTION_CARD_NOT_INSERTED)},
+        {"ElectronicTollCollectionCardType::UNKNOWN", static_cast<int32_t>(ElectronicTollCollectionCardType::UNKNOWN)},
+        {"ElectronicTollCollectionCardType::JP_ELECTRONIC_TOLL_COLLECTION_CARD", static_cast<int32_t>(ElectronicTollCollectionCardType::JP_ELECTRONIC_TOLL_COLLECTION_CARD)},
+        {"ElectronicTollCollectionCardType::JP_ELECTRONIC_TOLL_COLLECTION_CARD_V2", static_cast<int32_t>(ElectronicTollCollectionCardType::JP_ELECTRONIC_TOLL_COLLECTION_CARD_V2)},
+        {"EmergencyLaneKeepAssistState::OTHER", static_cast<int32_t>(EmergencyLaneKeepAssistState::OTHER)},
+        {"EmergencyLaneKeepAssistState::ENABLED", static_cast<int32_t>(EmergencyLaneKeepAssistState::ENABLED)},
+        {"EmergencyLaneKeepAssistState::WARNING_LEFT", static_cast<int32_t>(EmergencyLaneKeepAssistState::WARNING_LEFT)},
+        {"EmergencyLaneKeepAssistState::WARNING_RIGHT", static_cast<int32_t>(EmergencyLaneKeepAssistState::WARNING_RIGHT)},
+        {"EmergencyLaneKeepAssistState::ACTIVATED_STEER_LEFT", static_cast<int32_t>(EmergencyLaneKeepAssistState::ACTIVATED_STEER_LEFT)},
+        {"EmergencyLaneKeepAssistState::ACTIVATED_STEER_RIGHT", static_cast<int32_t>(EmergencyLaneKeepAssistState::ACTIVATED_STEER_RIGHT)},
+        {"EmergencyLaneKeepAssistState::USER_OVERRIDE", static_cast<int32_t>(EmergencyLaneKeepAssistState::USER_OVERRIDE)},
+        {"ErrorState::OTHER_ERROR_STATE", static_cast<int32_t>(ErrorState::OTHER_ERROR_STATE)},
+        {"ErrorState::NOT_AVAILABLE_DISABLED", static_cast<int32_t>(ErrorState::NOT_AVAILABLE_DISABLED)},
+        {"ErrorState::NOT_AVAILABLE_SPEED_LOW", static_cast<int32_t>(ErrorState::NOT_AVAILABLE_SPEED_LOW)},
+        {"ErrorState::NOT_AVAILABLE_SPEED_HIGH", static_cast<int32_t>(ErrorState::NOT_AVAILABLE_SPEED_HIGH)},
+        {"ErrorState::NOT_AVAILABLE_POOR_VISIBILITY", static_cast<int32_t>(ErrorState::NOT_AVAILABLE_POOR_VISIBILITY)},
+        {"ErrorState::NOT_AVAILABLE_SAFETY", static_cast<int32_t>(ErrorState::NOT_AVAILABLE_SAFETY)},
+        {"EvChargeState::UNKNOWN", static_cast<int32_t>(EvChargeState::UNKNOWN)},
+        {"EvChargeState::CHARGING", static_cast<int32_t>(EvChargeState::CHARGING)},
+        {"EvChargeState::FULLY_CHARGED", static_cast<int32_t>(EvChargeState::FULLY_CHARGED)},
+        {"EvChargeState::NOT_CHARGING", static_cast<int32_t>(EvChargeState::NOT_CHARGING)},
+        {"EvChargeState::ERROR", static_cast<int32_t>(EvChargeState::ERROR)},
+        {"EvConnectorType::UNKNOWN", static_cast<int32_t>(EvConnectorType::UNKNOWN)},
+        {"EvConnectorType::IEC_TYPE_1_AC", static_cast<int32_t>(EvConnectorType::IEC_TYPE_1_AC)},
+        {"EvConnectorType::IEC_TYPE_2_AC", static_cast<int32_t>(EvConnectorType::IEC_TYPE_2_AC)},
+        {"EvConnectorType::IEC_TYPE_3_AC", static_cast<int32_t>(EvConnectorType::IEC_TYPE_3_AC)},
+        {"EvConnectorType::IEC_TYPE_4_DC", static_cast<int32_t>(EvConnectorType::IEC_TYPE_4_DC)},
+        {"EvConnectorType::IEC_TYPE_1_CCS_DC", static_cast<int32_t>(EvConnectorType::IEC_TYPE_1_CCS_DC)},
+        {"EvConnectorType::IEC_TYPE_2_CCS_DC", static_cast<int32_t>(EvConnectorType::IEC_TYPE_2_CCS_DC)},
+        {"EvConnectorType::TESLA_ROADSTER", static_cast<int32_t>(EvConnectorType::TESLA_ROADSTER)},
+        {"EvConnectorType::TESLA_HPWC", static_cast<int32_t>(EvConnectorType::TESLA_HPWC)},
+        {"EvConnectorType::TESLA_SUPERCHARGER", static_cast<int32_t>(EvConnectorType::TESLA_SUPERCHARGER)},
+        {"EvConnectorType::GBT_AC", static_cast<int32_t>(EvConnectorType::GBT_AC)},
+        {"EvConnectorType::GBT_DC", static_cast<int32_t>(EvConnectorType::GBT_DC)},
+        {"EvConnectorType::OTHER", static_cast<int32_t>(EvConnectorType::OTHER)},
+        {"EvRegenerativeBrakingState::UNKNOWN", static_cast<int32_t>(EvRegenerativeBrakingState::UNKNOWN)},
+        {"EvRegenerativeBrakingState::DISABLED", static_cast<int32_t>(EvRegenerativeBrakingState::DISABLED)},
+        {"EvRegenerativeBrakingState::PARTIALLY_ENABLED", static_cast<int32_t>(EvRegenerativeBrakingState::PARTIALLY_ENABLED)},
+        {"EvRegenerativeBrakingState::FULLY_ENABLED", static_cast<int32_t>(EvRegenerativeBrakingState::FULLY_ENABLED)},
+        {"EvStoppingMode::OTHER", static_cast<int32_t>(EvStoppingMode::OTHER)},
+        {"EvStoppingMode::CREEP", static_cast<int32_t>(EvStoppingMode::CREEP)},
+        {"EvStoppingMode::ROLL", static_cast<int32_t>(EvStoppingMode::ROLL)},
+        {"EvStoppingMode::HOLD", static_cast<int32_t>(EvStoppingMode::HOLD)},
+        {"EvsServiceRequestIndex::TYPE", static_cast<int32_t>(EvsServiceRequestIndex::TYPE)},
+        {"EvsServiceRequestIndex::STATE", static_cast<int32_t>(EvsServiceRequestIndex::STATE)},
+        {"EvsServiceState::OFF", static_cast<int32_t>(EvsServiceState::OFF)},
+        {"EvsServiceState::ON", static_cast<int32_t>(EvsServiceState::ON)},
+        {"EvsServiceType::REARVIEW", static_cast<int32_t>(EvsServiceType::REARVIEW)},
+        {"EvsServiceType::SURROUNDVIEW", static_cast<int32_t>(EvsServiceType::SURROUNDVIEW)},
+        {"EvsServiceType::FRONTVIEW", static_cast<int32_t>(EvsServiceType::FRONTVIEW)},
+        {"EvsServiceType::LEFTVIEW", static_cast<int32_t>(EvsServiceType::LEFTVIEW)},
+        {"EvsServiceType::RIGHTVIEW", static_cast<int32_t>(EvsServiceType::RIGHTVIEW)},
+        {"EvsServiceType::DRIVERVIEW", static_cast<int32_t>(EvsServiceType::DRIVERVIEW)},
+        {"EvsServiceType::FRONTPASSENGERSVIEW", static_cast<int32_t>(EvsServiceType::FRONTPASSENGERSVIEW)},
+        {"EvsServiceType::REARPASSENGERSVIEW", static_cast<int32_t>(EvsServiceType::REARPASSENGERSVIEW)},
+        {"EvsServiceType::USER_DEFINED", static_cast<int32_t>(EvsServiceType::USER_DEFINED)},
+        {"ForwardCollisionWarningState::OTHER", static_cast<int32_t>(ForwardCollisionWarningState::OTHER)},
+        {"ForwardCollisionWarningState::NO_WARNING", static_cast<int32_t>(ForwardCollisionWarningState::NO_WARNING)},
+        {"ForwardCollisionWarningState::WARNING", static_cast<int32_t>(ForwardCollisionWarningState::WARNING)},
+        {"FuelType::FUEL_TYPE_UNKNOWN", static_cast<int32_t>(FuelType::FUEL_TYPE_UNKNOWN)},
+        {"FuelType::FUEL_TYPE_UNLEADED", static_cast<int32_t>(FuelType::FUEL_TYPE_UNLEADED)},
+        {"FuelType::FUEL_TYPE_LEADED", static_cast<int32_t>(FuelType::FUEL_TYPE_LEADED)},
+        {"FuelType::FUEL_TYPE_DIESEL_1", static_cast<int32_t>(FuelType::FUEL_TYPE_DIESEL_1)},
+        {"FuelType::FUEL_TYPE_DIESEL_2", static_cast<int32_t>(FuelType::FUEL_TYPE_DIESEL_2)},
+        {"FuelType::FUEL_TYPE_BIODIESEL", static_cast<int32_t>(FuelType::FUEL_TYPE_BIODIESEL)},
+        {"FuelType::FUEL_TYPE_E85", static_cast<int32_t>(FuelType::FUEL_TYPE_E85)},
+        {"FuelType::FUEL_TYPE_LPG", static_cast<int32_t>(FuelType::FUEL_TYPE_LPG)},
+        {"FuelType::FUEL_TYPE_CNG", static_cast<int32_t>(FuelType::FUEL_TYPE_CNG)},
+        {"FuelType::FUEL_TYPE_LNG", static_cast<int32_t>(FuelType::FUEL_TYPE_LNG)},
+        {"FuelType::FUEL_TYPE_ELECTRIC", static_cast<int32_t>(FuelType::FUEL_TYPE_ELECTRIC)},
+        {"FuelType::FUEL_TYPE_HYDROGEN", static_cast<int32_t>(FuelType::FUEL_TYPE_HYDROGEN)},
+        {"FuelType::FUEL_TYPE_OTHER", static_cast<int32_t>(FuelType::FUEL_TYPE_OTHER)},
+        {"GsrComplianceRequirementType::GSR_COMPLIANCE_NOT_REQUIRED", static_cast<int32_t>(GsrComplianceRequirementType::GSR_COMPLIANCE_NOT_REQUIRED)},
+        {"GsrComplianceRequirementType::GSR_COMPLIANCE_REQUIRED_V1", static_cast<int32_t>(GsrComplianceRequirementType::GSR_COMPLIANCE_REQUIRED_V1)},
+        {"HandsOnDetectionDriverState::OTHER", static_cast<int32_t>(HandsOnDetectionDriverState::OTHER)},
+        {"HandsOnDetectionDriverState::HANDS_ON", static_cast<int32_t>(HandsOnDetectionDriverState::HANDS_ON)},
+        {"HandsOnDetectionDriverState::HANDS_OFF", static_cast<int32_t>(HandsOnDetectionDriverState::HANDS_OFF)},
+        {"HandsOnDetectionWarning::OTHER", static_cast<int32_t>(HandsOnDetectionWarning::OTHER)},
+        {"HandsOnDetectionWarning::NO_WARNING", static_cast<int32_t>(HandsOnDetectionWarning::NO_WARNING)},
+        {"HandsOnDetectionWarning::WARNING", static_cast<int32_t>(HandsOnDetectionWarning::WARNING)},
+        {"InitialUserInfoRequestType::UNKNOWN", static_cast<int32_t>(InitialUserInfoRequestType::UNKNOWN)},
+        {"InitialUserInfoRequestType::FIRST_BOOT", static_cast<int32_t>(InitialUserInfoRequestType::FIRST_BOOT)},
+        {"InitialUserInfoRequestType::FIRST_BOOT_AFTER_OTA", static_cast<int32_t>(InitialUserInfoRequestType::FIRST_BOOT_AFTER_OTA)},
+        {"InitialUserInfoRequestType::COLD_BOOT", static_cast<int32_t>(InitialUserInfoRequestType::COLD_BOOT)},
+        {"InitialUserInfoRequestType::RESUME", static_cast<int32_t>(InitialUserInfoRequestType::RESUME)},
+        {"InitialUserInfoResponseAction::DEFAULT", static_cast<int32_t>(InitialUserInfoResponseAction::DEFAULT)},
+        {"InitialUserInfoResponseAction::SWITCH", static_cast<int32_t>(InitialUserInfoResponseAction::SWITCH)},
+        {"InitialUserInfoResponseAction::CREATE", static_cast<int32_t>(InitialUserInfoResponseAction::CREATE)},
+        {"LaneCenteringAssistCommand::ACTIVATE", static_cast<int32_t>(LaneCenteringAssistCommand::ACTIVATE)},
+        {"LaneCenteringAssistCommand::DEACTIVATE", static_cast<int32_t>(LaneCenteringAssistCommand::DEACTIVATE)},
+        {"LaneCenteringAssistState::OTHER", static_cast<int32_t>(LaneCenteringAssistState::OTHER)},
+        {"LaneCenteringAssistState::ENABLED", static_cast<int32_t>(LaneCenteringAssistState::ENABLED)},
+        {"LaneCenteringAssistState::ACTIVATION_REQUESTED", static_cast<int32_t>(LaneCenteringAssistState::ACTIVATION_REQUESTED)},
+        {"LaneCenteringAssistState::ACTIVATED", static_cast<int32_t>(LaneCenteringAssistState::ACTIVATED)},
+        {"LaneCenteringAssistState::USER_OVERRIDE", static_cast<int32_t>(LaneCenteringAssistState::USER_OVERRIDE)},
+        {"LaneCenteringAssistState::FORCED_DEACTIVATION_WARNING", static_cast<int32_t>(LaneCenteringAssistState::FORCED_DEACTIVATION_WARNING)},
+        {"LaneDepartureWarningState::OTHER", static_cast<int32_t>(LaneDepartureWarningState::OTHER)},
+        {"LaneDepartureWarningState::NO_WARNING", static_cast<int32_t>(LaneDepartureWarningState::NO_WARNING)},
+        {"LaneDepartureWarningState::WARNING_LEFT", static_cast<int32_t>(LaneDepartureWarningState::WARNING_LEFT)},
+        {"LaneDepartureWarningState::WARNING_RIGHT", static_cast<int32_t>(LaneDepartureWarningState::WARNING_RIGHT)},
+        {"LaneKeepAssistState::OTHER", static_cast<int32_t>(LaneKeepAssistState::OTHER)},
+        {"LaneKeepAssistState::ENABLED", static_cast<int32_t>(LaneKeepAssistState::ENABLED)},
+        {"LaneKeepAssistState::ACTIVATED_STEER_LEFT", static_cast<int32_t>(LaneKeepAssistState::ACTIVATED_STEER_LEFT)},
+        {"LaneKeepAssistState::ACTIVATED_STEER_RIGHT", static_cast<int32_t>(LaneKeepAssistState::ACTIVATED_STEER_RIGHT)},
+        {"LaneKeepAssistState::USER_OVERRIDE", static_cast<int32_t>(LaneKeepAssistState::USER_OVERRIDE)},
+        {"LocationCharacterization::PRIOR_LOCATIONS", static_cast<int32_t>(LocationCharacterization::PRIOR_LOCATIONS)},
+        {"LocationCharacterization::GYROSCOPE_FUSION", static_cast<int32_t>(LocationCharacterization::GYROSCOPE_FUSION)},
+        {"LocationCharacterization::ACCELEROMETER_FUSION", static_cast<int32_t>(LocationCharacterization::ACCELEROMETER_FUSION)},
+        {"LocationCharacterization::COMPASS_FUSION", static_cast<int32_t>(LocationCharacterization::COMPASS_FUSION)},
+        {"LocationCharacterization::WHEEL_SPEED_FUSION", static_cast<int32_t>(LocationCharacterization::WHEEL_SPEED_FUSION)},
+        {"LocationCharacterization::STEERING_ANGLE_FUSION", static_cast<int32_t>(LocationCharacterization::STEERING_ANGLE_FUSION)},
+        {"LocationCharacterization::CAR_SPEED_FUSION", static_cast<int32_t>(LocationCharacterization::CAR_SPEED_FUSION)},
+        {"LocationCharacterization::DEAD_RECKONED", static_cast<int32_t>(LocationCharacterization::DEAD_RECKONED)},
+        {"LocationCharacterization::RAW_GNSS_ONLY", static_cast<int32_t>(LocationCharacterization::RAW_GNSS_ONLY)},
+        {"Obd2CommonIgnitionMonitors::COMPONENTS_AVAILABLE", static_cast<int32_t>(Obd2CommonIgnitionMonitors::COMPONENTS_AVAILABLE)},
+        {"Obd2CommonIgnitionMonitors::COMPONENTS_INCOMPLETE", static_cast<int32_t>(Obd2CommonIgnitionMonitors::COMPONENTS_INCOMPLETE)},
+        {"Obd2CommonIgnitionMonitors::FUEL_SYSTEM_AVAILABLE", static_cast<int32_t>(Obd2CommonIgnitionMonitors::FUEL_SYSTEM_AVAILABLE)},
+        {"Obd2CommonIgnitionMonitors::FUEL_SYSTEM_INCOMPLETE", static_cast<int32_t>(Obd2CommonIgnitionMonitors::FUEL_SYSTEM_INCOMPLETE)},
+        {"Obd2CommonIgnitionMonitors::MISFIRE_AVAILABLE", static_cast<int32_t>(Obd2CommonIgnitionMonitors::MISFIRE_AVAILABLE)},
+        {"Obd2CommonIgnitionMonitors::MISFIRE_INCOMPLETE", static_cast<int32_t>(Obd2CommonIgnitionMonitors::MISFIRE_INCOMPLETE)},
+        {"Obd2CompressionIgnitionMonitors::COMPONENTS_AVAILABLE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::COMPONENTS_AVAILABLE)},
+        {"Obd2CompressionIgnitionMonitors::COMPONENTS_INCOMPLETE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::COMPONENTS_INCOMPLETE)},
+        {"Obd2CompressionIgnitionMonitors::FUEL_SYSTEM_AVAILABLE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::FUEL_SYSTEM_AVAILABLE)},
+        {"Obd2CompressionIgnitionMonitors::FUEL_SYSTEM_INCOMPLETE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::FUEL_SYSTEM_INCOMPLETE)},
+        {"Obd2CompressionIgnitionMonitors::MISFIRE_AVAILABLE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::MISFIRE_AVAILABLE)},
+        {"Obd2CompressionIgnitionMonitors::MISFIRE_INCOMPLETE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::MISFIRE_INCOMPLETE)},
+        {"Obd2CompressionIgnitionMonitors::EGR_OR_VVT_AVAILABLE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::EGR_OR_VVT_AVAILABLE)},
+        {"Obd2CompressionIgnitionMonitors::EGR_OR_VVT_INCOMPLETE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::EGR_OR_VVT_INCOMPLETE)},
+        {"Obd2CompressionIgnitionMonitors::PM_FILTER_AVAILABLE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::PM_FILTER_AVAILABLE)},
+        {"Obd2CompressionIgnitionMonitors::PM_FILTER_INCOMPLETE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::PM_FILTER_INCOMPLETE)},
+        {"Obd2CompressionIgnitionMonitors::EXHAUST_GAS_SENSOR_AVAILABLE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::EXHAUST_GAS_SENSOR_AVAILABLE)},
+        {"Obd2CompressionIgnitionMonitors::EXHAUST_GAS_SENSOR_INCOMPLETE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::EXHAUST_GAS_SENSOR_INCOMPLETE)},
+        {"Obd2CompressionIgnitionMonitors::BOOST_PRESSURE_AVAILABLE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::BOOST_PRESSURE_AVAILABLE)},
+        {"Obd2CompressionIgnitionMonitors::BOOST_PRESSURE_INCOMPLETE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::BOOST_PRESSURE_INCOMPLETE)},
+        {"Obd2CompressionIgnitionMonitors::NMHC_CATALYST_AVAILABLE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::NMHC_CATALYST_AVAILABLE)},
+        {"Obd2CompressionIgnitionMonitors::NMHC_CATALYST_INCOMPLETE", static_cast<int32_t>(Obd2CompressionIgnitionMonitors::NMHC_CATALYST_INCOMPLETE)},
+        {"Obd2FuelSystemStatus::OPEN_INSUFFICIENT_ENGINE_TEMPERATURE", static_cast<int32_t>(Obd2FuelSystemStatus::OPEN_INSUFFICIENT_ENGINE_TEMPERATURE)},
+        {"Obd2FuelSystemStatus::CLOSED_LOOP", static_cast<int32_t>(Obd2FuelSystemStatus::CLOSED_LOOP)},
+        {"Obd2FuelSystemStatus::OPEN_ENGINE_LOAD_OR_DECELERATION", static_cast<int32_t>(Obd2FuelSystemStatus::OPEN_ENGINE_LOAD_OR_DECELERATION)},
+        {"Obd2FuelSystemStatus::OPEN_SYSTEM_FAILURE", static_cast<int32_t>(Obd2FuelSystemStatus::OPEN_SYSTEM_FAILURE)},
+        {"Obd2FuelSystemStatus::CLOSED_LOOP_BUT_FEEDBACK_FAULT", static_cast<int32_t>(Obd2FuelSystemStatus::CLOSED_LOOP_BUT_FEEDBACK_FAULT)},
+        {"Obd2FuelType::NOT_AVAILABLE", static_cast<int32_t>(Obd2FuelType::NOT_AVAILABLE)},
+        {"Obd2FuelType::GASOLINE", static_cast<int32_t>(Obd2FuelType::GASOLINE)},
+        {"Obd2FuelType::METHANOL", static_cast<int32_t>(Obd2FuelType::METHANOL)},
+        {"Obd2FuelType::ETHANOL", static_cast<int32_t>(Obd2FuelType::ETHANOL)},
+        {"Obd2FuelType::DIESEL", static_cast<int32_t>(Obd2FuelType::DIESEL)},
+        {"Obd2FuelType::LPG", static_cast<int32_t>(Obd2FuelType::LPG)},
+        {"Obd2FuelType::CNG", static_cast<int32_t>(Obd2FuelType::CNG)},
+        {"Obd2FuelType::PROPANE", static_cast<int32_t>(Obd2FuelType::PROPANE)},
+        {"Obd2FuelType::ELECTRIC", static_cast<int32_t>(Obd2FuelType::ELECTRIC)},
+        {"Obd2FuelType::BIFUEL_RUNNING_GASOLINE", static_cast<int32_t>(Obd2FuelType::BIFUEL_RUNNING_GASOLINE)},
+        {"Obd2FuelType::BIFUEL_RUNNING_METHANOL", static_cast<int32_t>(Obd2FuelType::BIFUEL_RUNNING_METHANOL)},
+        {"Obd2FuelType::BIFUEL_RUNNING_ETHANOL", static_cast<int32_t>(Obd2FuelType::BIFUEL_RUNNING_ETHANOL)},
+        {"Obd2FuelType::BIFUEL_RUNNING_LPG", static_cast<int32_t>(Obd2FuelType::BIFUEL_RUNNING_LPG)},
+        {"Obd2FuelType::BIFUEL_RUNNING_CNG", static_cast<int32_t>(Obd2FuelType::BIFUEL_RUNNING_CNG)},
+        {"Obd2FuelType::BIFUEL_RUNNING_PROPANE", static_cast<int32_t>(Obd2FuelType::BIFUEL_RUNNING_PROPANE)},
+        {"Obd2FuelType::BIFUEL_RUNNING_ELECTRIC", static_cast<int32_t>(Obd2FuelType::BIFUEL_RUNNING_ELECTRIC)},
+        {"Obd2FuelType::BIFUEL_RUNNING_ELECTRIC_AND_COMBUSTION", static_cast<int32_t>(Obd2FuelType::BIFUEL_RUNNING_ELECTRIC_AND_COMBUSTION)},
+        {"Obd2FuelType::HYBRID_GASOLINE", static_cast<int32_t>(Obd2FuelType::HYBRID_GASOLINE)},
+        {"Obd2FuelType::HYBRID_ETHANOL", static_cast<int32_t>(Obd2FuelType::HYBRID_ETHANOL)},
+        {"Obd2FuelType::HYBRID_DIESEL", static_cast<int32_t>(Obd2FuelType::HYBRID_DIESEL)},
+        {"Obd2FuelType::HYBRID_ELECTRIC", static_cast<int32_t>(Obd2FuelType::HYBRID_ELECTRIC)},
+        {"Obd2FuelType::HYBRID_RUNNING_ELECTRIC_AND_COMBUSTION", static_cast<int32_t>(Obd2FuelType::HYBRID_RUNNING_ELECTRIC_AND_COMBUSTION)},
+        {"Obd2FuelType::HYBRID_REGENERATIVE", static_cast<int32_t>(Obd2FuelType::HYBRID_REGENERATIVE)},
+        {"Obd2FuelType::BIFUEL_RUNNING_DIESEL", static_cast<int32_t>(Obd2FuelType::BIFUEL_RUNNING_DIESEL)},
+        {"Obd2IgnitionMonitorKind::SPARK", static_cast<int32_t>(Obd2IgnitionMonitorKind::SPARK)},
+        {"Obd2IgnitionMonitorKind::COMPRESSION", static_cast<int32_t>(Obd2IgnitionMonitorKind::COMPRESSION)},
+        {"Obd2SecondaryAirStatus::UPSTREAM", static_cast<int32_t>(Obd2SecondaryAirStatus::UPSTREAM)},
+        {"Obd2SecondaryAirStatus::DOWNSTREAM_OF_CATALYCIC_CONVERTER", static_cast<int32_t>(Obd2SecondaryAirStatus::DOWNSTREAM_OF_CATALYCIC_CONVERTER)},
+        {"Obd2SecondaryAirStatus::FROM_OUTSIDE_OR_OFF", static_cast<int32_t>(Obd2SecondaryAirStatus::FROM_OUTSIDE_OR_OFF)},
+        {"Obd2SecondaryAirStatus::PUMP_ON_FOR_DIAGNOSTICS", static_cast<int32_t>(Obd2SecondaryAirStatus::PUMP_ON_FOR_DIAGNOSTICS)},
+        {"Obd2SparkIgnitionMonitors::COMPONENTS_AVAILABLE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::COMPONENTS_AVAILABLE)},
+        {"Obd2SparkIgnitionMonitors::COMPONENTS_INCOMPLETE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::COMPONENTS_INCOMPLETE)},
+        {"Obd2SparkIgnitionMonitors::FUEL_SYSTEM_AVAILABLE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::FUEL_SYSTEM_AVAILABLE)},
+        {"Obd2SparkIgnitionMonitors::FUEL_SYSTEM_INCOMPLETE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::FUEL_SYSTEM_INCOMPLETE)},
+        {"Obd2SparkIgnitionMonitors::MISFIRE_AVAILABLE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::MISFIRE_AVAILABLE)},
+        {"Obd2SparkIgnitionMonitors::MISFIRE_INCOMPLETE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::MISFIRE_INCOMPLETE)},
+        {"Obd2SparkIgnitionMonitors::EGR_AVAILABLE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::EGR_AVAILABLE)},
+        {"Obd2SparkIgnitionMonitors::EGR_INCOMPLETE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::EGR_INCOMPLETE)},
+        {"Obd2SparkIgnitionMonitors::OXYGEN_SENSOR_HEATER_AVAILABLE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::OXYGEN_SENSOR_HEATER_AVAILABLE)},
+        {"Obd2SparkIgnitionMonitors::OXYGEN_SENSOR_HEATER_INCOMPLETE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::OXYGEN_SENSOR_HEATER_INCOMPLETE)},
+        {"Obd2SparkIgnitionMonitors::OXYGEN_SENSOR_AVAILABLE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::OXYGEN_SENSOR_AVAILABLE)},
+        {"Obd2SparkIgnitionMonitors::OXYGEN_SENSOR_INCOMPLETE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::OXYGEN_SENSOR_INCOMPLETE)},
+        {"Obd2SparkIgnitionMonitors::AC_REFRIGERANT_AVAILABLE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::AC_REFRIGERANT_AVAILABLE)},
+        {"Obd2SparkIgnitionMonitors::AC_REFRIGERANT_INCOMPLETE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::AC_REFRIGERANT_INCOMPLETE)},
+        {"Obd2SparkIgnitionMonitors::SECONDARY_AIR_SYSTEM_AVAILABLE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::SECONDARY_AIR_SYSTEM_AVAILABLE)},
+        {"Obd2SparkIgnitionMonitors::SECONDARY_AIR_SYSTEM_INCOMPLETE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::SECONDARY_AIR_SYSTEM_INCOMPLETE)},
+        {"Obd2SparkIgnitionMonitors::EVAPORATIVE_SYSTEM_AVAILABLE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::EVAPORATIVE_SYSTEM_AVAILABLE)},
+        {"Obd2SparkIgnitionMonitors::EVAPORATIVE_SYSTEM_INCOMPLETE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::EVAPORATIVE_SYSTEM_INCOMPLETE)},
+        {"Obd2SparkIgnitionMonitors::HEATED_CATALYST_AVAILABLE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::HEATED_CATALYST_AVAILABLE)},
+        {"Obd2SparkIgnitionMonitors::HEATED_CATALYST_INCOMPLETE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::HEATED_CATALYST_INCOMPLETE)},
+        {"Obd2SparkIgnitionMonitors::CATALYST_AVAILABLE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::CATALYST_AVAILABLE)},
+        {"Obd2SparkIgnitionMonitors::CATALYST_INCOMPLETE", static_cast<int32_t>(Obd2SparkIgnitionMonitors::CATALYST_INCOMPLETE)},
+        {"PortLocationType::UNKNOWN", static_cast<int32_t>(PortLocationType::UNKNOWN)},
+        {"PortLocationType::FRONT_LEFT", static_cast<int32_t>(PortLocationType::FRONT_LEFT)},
+        {"PortLocationType::FRONT_RIGHT", static_cast<int32_t>(PortLocationType::FRONT_RIGHT)},
+        {"PortLocationType::REAR_RIGHT", static_cast<int32_t>(PortLocationType::REAR_RIGHT)},
+        {"PortLocationType::REAR_LEFT", static_cast<int32_t>(PortLocationType::REAR_LEFT)},
+        {"PortLocationType::FRONT", static_cast<int32_t>(PortLocationType::FRONT)},
+        {"PortLocationType::REAR", static_cast<int32_t>(PortLocationType::REAR)},
+        {"ProcessTerminationReason::NOT_RESPONDING", static_cast<int32_t>(ProcessTerminationReason::NOT_RESPONDING)},
+        {"ProcessTerminationReason::IO_OVERUSE", static_cast<int32_t>(ProcessTerminationReason::IO_OVERUSE)},
+        {"ProcessTerminationReason::MEMORY_OVERUSE", static_cast<int32_t>(ProcessTerminationReason::MEMORY_OVERUSE)},
+        {"RotaryInputType::ROTARY_INPUT_TYPE_SYSTEM_NAVIGATION", static_cast<int32_t>(RotaryInputType::ROTARY_INPUT_TYPE_SYSTEM_NAVIGATION)},
+        {"RotaryInputType::ROTARY_INPUT_TYPE_AUDIO_VOLUME", static_cast<int32_t>(RotaryInputType::ROTARY_INPUT_TYPE_AUDIO_VOLUME)},
+        {"SwitchUserMessageType::UNKNOWN", static_cast<int32_t>(SwitchUserMessageType::UNKNOWN)},
+        {"SwitchUserMessageType::LEGACY_ANDROID_SWITCH", static_cast<int32_t>(SwitchUserMessageType::LEGACY_ANDROID_SWITCH)},
+        {"SwitchUserMessageType::ANDROID_SWITCH", static_cast<int32_t>(SwitchUserMessageType::ANDROID_SWITCH)},
+        {"SwitchUserMessageType::VEHICLE_RESPONSE", static_cast<int32_t>(SwitchUserMessageType::VEHICLE_RESPONSE)},
+        {"SwitchUserMessageType::VEHICLE_REQUEST", static_cast<int32_t>(SwitchUserMessageType::VEHICLE_REQUEST)},
+        {"SwitchUserMessageType::ANDROID_POST_SWITCH", static_cast<int32_t>(SwitchUserMessageType::ANDROID_POST_SWITCH)},
+        {"SwitchUserStatus::SUCCESS", static_cast<int32_t>(SwitchUserStatus::SUCCESS)},
+        {"SwitchUserStatus::FAILURE", static_cast<int32_t>(SwitchUserStatus::FAILURE)},
+        {"TrailerState::UNKNOWN", static_cast<int32_t>(TrailerState::UNKNOWN)},
+        {"TrailerState::NOT_PRESENT", static_cast<int32_t>(TrailerState::NOT_PRESENT)},
+        {"TrailerState::PRESENT", static_cast<int32_t>(TrailerState::PRESENT)},
+        {"TrailerState::ERROR", static_cast<int32_t>(TrailerState::ERROR)},
+        {"UserIdentificationAssociationSetValue::INVALID", static_cast<int32_t>(UserIdentificationAssociationSetValue::INVALID)},
+        {"UserIdentificationAssociationSetValue::ASSOCIATE_CURRENT_USER", static_cast<int32_t>(UserIdentificationAssociationSetValue::ASSOCIATE_CURRENT_USER)},
+        {"UserIdentificationAssociationSetValue::DISASSOCIATE_CURRENT_USER", static_cast<int32_t>(UserIdentificationAssociationSetValue::DISASSOCIATE_CURRENT_USER)},
+        {"UserIdentificationAssociationSetValue::DISASSOCIATE_ALL_USERS", static_cast<int32_t>(UserIdentificationAssociationSetValue::DISASSOCIATE_ALL_USERS)},
+        {"UserIdentificationAssociationType::INVALID", static_cast<int32_t>(UserIdentificationAssociationType::INVALID)},
+        {"UserIdentificationAssociationType::KEY_FOB", static_cast<int32_t>(UserIdentificationAssociationType::KEY_FOB)},
+        {"UserIdentificationAssociationType::CUSTOM_1", static_cast<int32_t>(UserIdentificationAssociationType::CUSTOM_1)},
+        {"UserIdentificationAssociationType::CUSTOM_2", static_cast<int32_t>(UserIdentificationAssociationType::CUSTOM_2)},
+        {"UserIdentificationAssociationType::CUSTOM_3", static_cast<int32_t>(UserIdentificationAssociationType::CUSTOM_3)},
+        {"UserIdentificationAssociationType::CUSTOM_4", static_cast<int32_t>(UserIdentificationAssociationType::CUSTOM_4)},
+        {"UserIdentificationAssociationValue::UNKNOWN", static_cast<int32_t>(UserIdentificationAssociationValue::UNKNOWN)},
+        {"UserIdentificationAssociationValue::ASSOCIATED_CURRENT_USER", static_cast<int32_t>(UserIdentificationAssociationValue::ASSOCIATED_CURRENT_USER)},
+        {"UserIdentificationAssociationValue::ASSOCIATED_ANOTHER_USER", static_cast<int32_t>(UserIdentificationAssociationValue::ASSOCIATED_ANOTHER_USER)},
+        {"UserIdentificationAssociationValue::NOT_ASSOCIATED_ANY_USER", static_cast<int32_t>(UserIdentificationAssociationValue::NOT_ASSOCIATED_ANY_USER)},
+        {"VehicleApPowerBootupReason::USER_POWER_ON", static_cast<int32_t>(VehicleApPowerBootupReason::USER_POWER_ON)},
+        {"VehicleApPowerBootupReason::SYSTEM_USER_DETECTION", static_cast<int32_t>(VehicleApPowerBootupReason::SYSTEM_USER_DETECTION)},
+        {"VehicleApPowerBootupReason::SYSTEM_REMOTE_ACCESS", static_cast<int32_t>(VehicleApPowerBootupReason::SYSTEM_REMOTE_ACCESS)},
+        {"VehicleApPowerStateConfigFlag::ENABLE_DEEP_SLEEP_FLAG", static_cast<int32_t>(VehicleApPowerStateConfigFlag::ENABLE_DEEP_SLEEP_FLAG)},
+        {"VehicleApPowerStateConfigFlag::CONFIG_SUPPORT_TIMER_POWER_ON_FLAG", static_cast<int32_t>(VehicleApPowerStateConfigFlag::CONFIG_SUPPORT_TIMER_POWER_ON_FLAG)},
+        {"VehicleApPowerStateConfigFlag::ENABLE_HIBERNATION_FLAG", static_cast<int32_t>(VehicleApPowerStateConfigFlag::ENABLE_HIBERNATION_FLAG)},
+        {"VehicleApPowerStateReport::WAIT_FOR_VHAL", static_cast<int32_t>(VehicleApPowerStateReport::WAIT_FOR_VHAL)},
+        {"VehicleApPowerStateReport::DEEP_SLEEP_ENTRY", static_cast<int32_t>(VehicleApPowerStateReport::DEEP_SLEEP_ENTRY)},
+        {"VehicleApPowerStateReport::DEEP_SLEEP_EXIT", static_cast<int32_t>(VehicleApPowerStateReport::DEEP_SLEEP_EXIT)},
+        {"VehicleApPowerStateReport::SHUTDOWN_POSTPONE", static_cast<int32_t>(VehicleApPowerStateReport::SHUTDOWN_POSTPONE)},
+        {"VehicleApPowerStateReport::SHUTDOWN_START", static_cast<int32_t>(VehicleApPowerStateReport::SHUTDOWN_START)},
+        {"VehicleApPowerStateReport::ON", static_cast<int32_t>(VehicleApPowerStateReport::ON)},
+        {"VehicleApPowerStateReport::SHUTDOWN_PREPARE", static_cast<int32_t>(VehicleApPowerStateReport::SHUTDOWN_PREPARE)},
+        {"VehicleApPowerStateReport::SHUTDOWN_CANCELLED", static_cast<int32_t>(VehicleApPowerStateReport::SHUTDOWN_CANCELLED)},
+        {"VehicleApPowerStateReport::HIBERNATION_ENTRY", static_cast<int32_t>(VehicleApPowerStateReport::HIBERNATION_ENTRY)},
+        {"VehicleApPowerStateReport::HIBERNATION_EXIT", static_cast<int32_t>(VehicleApPowerStateReport::HIBERNATION_EXIT)},
+        {"VehicleApPowerStateReq::ON", static_cast<int32_t>(VehicleApPowerStateReq::ON)},
+        {"VehicleApPowerStateReq::SHUTDOWN_PREPARE", static_cast<int32_t>(VehicleApPowerStateReq::SHUTDOWN_PREPARE)},
+        {"VehicleApPowerStateReq::CANCEL_SHUTDOWN", static_cast<int32_t>(VehicleApPowerStateReq::CANCEL_SHUTDOWN)},
+        {"VehicleApPowerStateReq::FINISHED", static_cast<int32_t>(VehicleApPowerStateReq::FINISHED)},
+        {"VehicleApPowerStateReqIndex::STATE", static_cast<int32_t>(VehicleApPowerStateReqIndex::STATE)},
+        {"VehicleApPowerStateReqIndex::ADDITIONAL", static_cast<int32_t>(VehicleApPowerStateReqIndex::ADDITIONAL)},
+        {"VehicleApPowerStateShutdownParam::SHUTDOWN_IMMEDIATELY", static_cast<int32_t>(VehicleApPowerStateShutdownParam::SHUTDOWN_IMMEDIATELY)},
+        {"VehicleApPowerStateShutdownParam::CAN_SLEEP", static_cast<int32_t>(VehicleApPowerStateShutdownParam::CAN_SLEEP)},
+        {"VehicleApPowerStateShutdownParam::SHUTDOWN_ONLY", static_cast<int32_t>(VehicleApPowerStateShutdownParam::SHUTDOWN_ONLY)},
+        {"VehicleApPowerStateShutdownParam::SLEEP_IMMEDIATELY", static_cast<int32_t>(VehicleApPowerStateShutdownParam::SLEEP_IMMEDIATELY)},
+        {"VehicleApPowerStateShutdownParam::HIBERNATE_IMMEDIATELY", static_cast<int32_t>(VehicleApPowerStateShutdownParam::HIBERNATE_IMMEDIATELY)},
+        {"VehicleApPowerStateShutdownParam::CAN_HIBERNATE", static_cast<int32_t>(VehicleApPowerStateShutdownParam::CAN_HIBERNATE)},
+        {"VehicleArea::GLOBAL", static_cast<int32_t>(VehicleArea::GLOBAL)},
+        {"VehicleArea::WINDOW", static_cast<int32_t>(VehicleArea::WINDOW)},
+        {"VehicleArea::MIRROR", static_cast<int32_t>(VehicleArea::MIRROR)},
+        {"VehicleArea::SEAT", static_cast<int32_t>(VehicleArea::SEAT)},
+        {"VehicleArea::DOOR", static_cast<int32_t>(VehicleArea::DOOR)},
+        {"VehicleArea::WHEEL", static_cast<int32_t>(VehicleArea::WHEEL)},
+        {"VehicleArea::MASK", static_cast<int32_t>(VehicleArea::MASK)},
+        {"VehicleAreaDoor::ROW_1_LEFT", static_cast<int32_t>(VehicleAreaDoor::ROW_1_LEFT)},
+        {"VehicleAreaDoor::ROW_1_RIGHT", static_cast<int32_t>(VehicleAreaDoor::ROW_1_RIGHT)},
+        {"VehicleAreaDoor::ROW_2_LEFT", static_cast<int32_t>(VehicleAreaDoor::ROW_2_LEFT)},
+        {"VehicleAreaDoor::ROW_2_RIGHT", static_cast<int32_t>(VehicleAreaDoor::ROW_2_RIGHT)},
+        {"VehicleAreaDoor::ROW_3_LEFT", static_cast<int32_t>(VehicleAreaDoor::ROW_3_LEFT)},
+        {"VehicleAreaDoor::ROW_3_RIGHT", static_cast<int32_t>(VehicleAreaDoor::ROW_3_RIGHT)},
+        {"VehicleAreaDoor::HOOD", static_cast<int32_t>(VehicleAreaDoor::HOOD)},
+        {"VehicleAreaDoor::REAR", static_cast<int32_t>(VehicleAreaDoor::REAR)},
+        {"VehicleAreaMirror::DRIVER_LEFT", static_cast<int32_t>(VehicleAreaMirror::DRIVER_LEFT)},
+        {"VehicleAreaMirror::DRIVER_RIGHT", static_cast<int32_t>(VehicleAreaMirror::DRIVER_RIGHT)},
+        {"VehicleAreaMirror::DRIVER_CENTER", static_cast<int32_t>(VehicleAreaMirror::DRIVER_CENTER)},
+        {"VehicleAreaSeat::ROW_1_LEFT", static_cast<int32_t>(VehicleAreaSeat::ROW_1_LEFT)},
+        {"VehicleAreaSeat::ROW_1_CENTER", static_cast<int32_t>(VehicleAreaSeat::ROW_1_CENTER)},
+        {"VehicleAreaSeat::ROW_1_RIGHT", static_cast<int32_t>(VehicleAreaSeat::ROW_1_RIGHT)},
+        {"VehicleAreaSeat::ROW_2_LEFT", static_cast<int32_t>(VehicleAreaSeat::ROW_2_LEFT)},
+        {"VehicleAreaSeat::ROW_2_CENTER", static_cast<int32_t>(VehicleAreaSeat::ROW_2_CENTER)},
+        {"VehicleAreaSeat::ROW_2_RIGHT", static_cast<int32_t>(VehicleAreaSeat::ROW_2_RIGHT)},
+        {"VehicleAreaSeat::ROW_3_LEFT", static_cast<int32_t>(VehicleAreaSeat::ROW_3_LEFT)},
+        {"VehicleAreaSeat::ROW_3_CENTER", static_cast<int32_t>(VehicleAreaSeat::ROW_3_CENTER)},
+        {"VehicleAreaSeat::ROW_3_RIGHT", static_cast<int32_t>(VehicleAreaSeat::ROW_3_RIGHT)},
+        {"VehicleAreaWheel::UNKNOWN", static_cast<int32_t>(VehicleAreaWheel::UNKNOWN)},
+        {"VehicleAreaWheel::LEFT_FRONT", static_cast<int32_t>(VehicleAreaWheel::LEFT_FRONT)},
+        {"VehicleAreaWheel::RIGHT_FRONT", static_cast<int32_t>(VehicleAreaWheel::RIGHT_FRONT)},
+        {"VehicleAreaWheel::LEFT_REAR", static_cast<int32_t>(VehicleAreaWheel::LEFT_REAR)},
+        {"VehicleAreaWheel::RIGHT_REAR", static_cast<int32_t>(VehicleAreaWheel::RIGHT_REAR)},
+        {"VehicleAreaWindow::FRONT_WINDSHIELD", static_cast<int32_t>(VehicleAreaWindow::FRONT_WINDSHIELD)},
+        {"VehicleAreaWindow::REAR_WINDSHIELD", static_cast<int32_t>(VehicleAreaWindow::REAR_WINDSHIELD)},
+        {"VehicleAreaWindow::ROW_1_LEFT", static_cast<int32_t>(VehicleAreaWindow::ROW_1_LEFT)},
+        {"VehicleAreaWindow::ROW_1_RIGHT", static_cast<int32_t>(VehicleAreaWindow::ROW_1_RIGHT)},
+        {"VehicleAreaWindow::ROW_2_LEFT", static_cast<int32_t>(VehicleAreaWindow::ROW_2_LEFT)},
+        {"VehicleAreaWindow::ROW_2_RIGHT", static_cast<int32_t>(VehicleAreaWindow::ROW_2_RIGHT)},
+        {"VehicleAreaWindow::ROW_3_LEFT", static_cast<int32_t>(VehicleAreaWindow::ROW_3_LEFT)},
+        {"VehicleAreaWindow::ROW_3_RIGHT", static_cast<int32_t>(VehicleAreaWindow::ROW_3_RIGHT)},
+        {"VehicleAreaWindow::ROOF_TOP_1", static_cast<int32_t>(VehicleAreaWindow::ROOF_TOP_1)},
+        {"VehicleAreaWindow::ROOF_TOP_2", static_cast<int32_t>(VehicleAreaWindow::ROOF_TOP_2)},
+        {"VehicleDisplay::MAIN", static_cast<int32_t>(VehicleDisplay::MAIN)},
+        {"VehicleDisplay::INSTRUMENT_CLUSTER", static_cast<int32_t>(VehicleDisplay::INSTRUMENT_CLUSTER)},
+        {"VehicleDisplay::HUD", static_cast<int32_t>(VehicleDisplay::HUD)},
+        {"VehicleDisplay::INPUT", static_cast<int32_t>(VehicleDisplay::INPUT)},
+        {"VehicleDisplay::AUXILIARY", static_cast<int32_t>(VehicleDisplay::AUXILIARY)},
+        {"VehicleGear::GEAR_UNKNOWN", static_cast<int32_t>(VehicleGear::GEAR_UNKNOWN)},
+        {"VehicleGear::GEAR_NEUTRAL", static_cast<int32_t>(VehicleGear::GEAR_NEUTRAL)},
+        {"VehicleGear::GEAR_REVERSE", static_cast<int32_t>(VehicleGear::GEAR_REVERSE)},
+        {"VehicleGear::GEAR_PARK", static_cast<int32_t>(VehicleGear::GEAR_PARK)},
+        {"VehicleGear::GEAR_DRIVE", static_cast<int32_t>(VehicleGear::GEAR_DRIVE)},
+        {"VehicleGear::GEAR_1", static_cast<int32_t>(VehicleGear::GEAR_1)},
+        {"VehicleGear::GEAR_2", static_cast<int32_t>(VehicleGear::GEAR_2)},
+        {"VehicleGear::GEAR_3", static_cast<int32_t>(VehicleGear::GEAR_3)},
+        {"VehicleGear::GEAR_4", static_cast<int32_t>(VehicleGear::GEAR_4)},
+        {"VehicleGear::GEAR_5", static_cast<int32_t>(VehicleGear::GEAR_5)},
+        {"VehicleGear::GEAR_6", static_cast<int32_t>(VehicleGear::GEAR_6)},
+        {"VehicleGear::GEAR_7", static_cast<int32_t>(VehicleGear::GEAR_7)},
+        {"VehicleGear::GEAR_8", static_cast<int32_t>(VehicleGear::GEAR_8)},
+        {"VehicleGear::GEAR_9", static_cast<int32_t>(VehicleGear::GEAR_9)},
+        {"VehicleHvacFanDirection::UNKNOWN", static_cast<int32_t>(VehicleHvacFanDirection::UNKNOWN)},
+        {"VehicleHvacFanDirection::FACE", static_cast<int32_t>(VehicleHvacFanDirection::FACE)},
+        {"VehicleHvacFanDirection::FLOOR", static_cast<int32_t>(VehicleHvacFanDirection::FLOOR)},
+        {"VehicleHvacFanDirection::FACE_AND_FLOOR", static_cast<int32_t>(VehicleHvacFanDirection::FACE_AND_FLOOR)},
+        {"VehicleHvacFanDirection::DEFROST", static_cast<int32_t>(VehicleHvacFanDirection::DEFROST)},
+        {"VehicleHvacFanDirection::DEFROST_AND_FLOOR", static_cast<int32_t>(VehicleHvacFanDirection::DEFROST_AND_FLOOR)},
+        {"VehicleHwKeyInputAction::ACTION_DOWN", static_cast<int32_t>(VehicleHwKeyInputAction::ACTION_DOWN)},
+        {"VehicleHwKeyInputAction::ACTION_UP", static_cast<int32_t>(VehicleHwKeyInputAction::ACTION_UP)},
+        {"VehicleHwMotionButtonStateFlag::BUTTON_PRIMARY", static_cast<int32_t>(VehicleHwMotionButtonStateFlag::BUTTON_PRIMARY)},
+        {"VehicleHwMotionButtonStateFlag::BUTTON_SECONDARY", static_cast<int32_t>(VehicleHwMotionButtonStateFlag::BUTTON_SECONDARY)},
+        {"VehicleHwMotionButtonStateFlag::BUTTON_TERTIARY", static_cast<int32_t>(VehicleHwMotionButtonStateFlag::BUTTON_TERTIARY)},
+        {"VehicleHwMotionButtonStateFlag::BUTTON_BACK", static_cast<int32_t>(VehicleHwMotionButtonStateFlag::BUTTON_BACK)},
+        {"VehicleHwMotionButtonStateFlag::BUTTON_FORWARD", static_cast<int32_t>(VehicleHwMotionButtonStateFlag::BUTTON_FORWARD)},
+        {"VehicleHwMotionButtonStateFlag::BUTTON_STYLUS_PRIMARY", static_cast<int32_t>(VehicleHwMotionButtonStateFlag::BUTTON_STYLUS_PRIMARY)},
+        {"VehicleHwMotionButtonStateFlag::BUTTON_STYLUS_SECONDARY", static_cast<int32_t>(VehicleHwMotionButtonStateFlag::BUTTON_STYLUS_SECONDARY)},
+        {"VehicleHwMotionInputAction::ACTION_DOWN", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_DOWN)},
+        {"VehicleHwMotionInputAction::ACTION_UP", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_UP)},
+        {"VehicleHwMotionInputAction::ACTION_MOVE", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_MOVE)},
+        {"VehicleHwMotionInputAction::ACTION_CANCEL", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_CANCEL)},
+        {"VehicleHwMotionInputAction::ACTION_OUTSIDE", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_OUTSIDE)},
+        {"VehicleHwMotionInputAction::ACTION_POINTER_DOWN", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_POINTER_DOWN)},
+        {"VehicleHwMotionInputAction::ACTION_POINTER_UP", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_POINTER_UP)},
+        {"VehicleHwMotionInputAction::ACTION_HOVER_MOVE", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_HOVER_MOVE)},
+        {"VehicleHwMotionInputAction::ACTION_SCROLL", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_SCROLL)},
+        {"VehicleHwMotionInputAction::ACTION_HOVER_ENTER", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_HOVER_ENTER)},
+        {"VehicleHwMotionInputAction::ACTION_HOVER_EXIT", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_HOVER_EXIT)},
+        {"VehicleHwMotionInputAction::ACTION_BUTTON_PRESS", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_BUTTON_PRESS)},
+        {"VehicleHwMotionInputAction::ACTION_BUTTON_RELEASE", static_cast<int32_t>(VehicleHwMotionInputAction::ACTION_BUTTON_RELEASE)},
+        {"VehicleHwMotionInputSource::SOURCE_UNKNOWN", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_UNKNOWN)},
+        {"VehicleHwMotionInputSource::SOURCE_KEYBOARD", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_KEYBOARD)},
+        {"VehicleHwMotionInputSource::SOURCE_DPAD", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_DPAD)},
+        {"VehicleHwMotionInputSource::SOURCE_GAMEPAD", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_GAMEPAD)},
+        {"VehicleHwMotionInputSource::SOURCE_TOUCHSCREEN", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_TOUCHSCREEN)},
+        {"VehicleHwMotionInputSource::SOURCE_MOUSE", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_MOUSE)},
+        {"VehicleHwMotionInputSource::SOURCE_STYLUS", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_STYLUS)},
+        {"VehicleHwMotionInputSource::SOURCE_BLUETOOTH_STYLUS", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_BLUETOOTH_STYLUS)},
+        {"VehicleHwMotionInputSource::SOURCE_TRACKBALL", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_TRACKBALL)},
+        {"VehicleHwMotionInputSource::SOURCE_MOUSE_RELATIVE", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_MOUSE_RELATIVE)},
+        {"VehicleHwMotionInputSource::SOURCE_TOUCHPAD", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_TOUCHPAD)},
+        {"VehicleHwMotionInputSource::SOURCE_TOUCH_NAVIGATION", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_TOUCH_NAVIGATION)},
+        {"VehicleHwMotionInputSource::SOURCE_ROTARY_ENCODER", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_ROTARY_ENCODER)},
+        {"VehicleHwMotionInputSource::SOURCE_JOYSTICK", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_JOYSTICK)},
+        {"VehicleHwMotionInputSource::SOURCE_HDMI", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_HDMI)},
+        {"VehicleHwMotionInputSource::SOURCE_SENSOR", static_cast<int32_t>(VehicleHwMotionInputSource::SOURCE_SENSOR)},
+        {"VehicleHwMotionToolType::TOOL_TYPE_UNKNOWN", static_cast<int32_t>(VehicleHwMotionToolType::TOOL_TYPE_UNKNOWN)},
+        {"VehicleHwMotionToolType::TOOL_TYPE_FINGER", static_cast<int32_t>(VehicleHwMotionToolType::TOOL_TYPE_FINGER)},
+        {"VehicleHwMotionToolType::TOOL_TYPE_STYLUS", static_cast<int32_t>(VehicleHwMotionToolType::TOOL_TYPE_STYLUS)},
+        {"VehicleHwMotionToolType::TOOL_TYPE_MOUSE", static_cast<int32_t>(VehicleHwMotionToolType::TOOL_TYPE_MOUSE)},
+        {"VehicleHwMotionToolType::TOOL_TYPE_ERASER", static_cast<int32_t>(VehicleHwMotionToolType::TOOL_TYPE_ERASER)},
+        {"VehicleIgnitionState::UNDEFINED", static_cast<int32_t>(VehicleIgnitionState::UNDEFINED)},
+        {"VehicleIgnitionState::LOCK", static_cast<int32_t>(VehicleIgnitionState::LOCK)},
+        {"VehicleIgnitionState::OFF", static_cast<int32_t>(VehicleIgnitionState::OFF)},
+        {"VehicleIgnitionState::ACC", static_cast<int32_t>(VehicleIgnitionState::ACC)},
+        {"VehicleIgnitionState::ON", static_cast<int32_t>(VehicleIgnitionState::ON)},
+        {"VehicleIgnitionState::START", static_cast<int32_t>(VehicleIgnitionState::START)},
+        {"VehicleLightState::OFF", static_cast<int32_t>(VehicleLightState::OFF)},
+        {"VehicleLightState::ON", static_cast<int32_t>(VehicleLightState::ON)},
+        {"VehicleLightState::DAYTIME_RUNNING", static_cast<int32_t>(VehicleLightState::DAYTIME_RUNNING)},
+        {"VehicleLightSwitch::OFF", static_cast<int32_t>(VehicleLightSwitch::OFF)},
+        {"VehicleLightSwitch::ON", static_cast<int32_t>(VehicleLightSwitch::ON)},
+        {"VehicleLightSwitch::DAYTIME_RUNNING", static_cast<int32_t>(VehicleLightSwitch::DAYTIME_RUNNING)},
+        {"VehicleLightSwitch::AUTOMATIC", static_cast<int32_t>(VehicleLightSwitch::AUTOMATIC)},
+        {"VehicleOilLevel::CRITICALLY_LOW", static_cast<int32_t>(VehicleOilLevel::CRITICALLY_LOW)},
+        {"VehicleOilLevel::LOW", static_cast<int32_t>(VehicleOilLevel::LOW)},
+        {"VehicleOilLevel::NORMAL", static_cast<int32_t>(VehicleOilLevel::NORMAL)},
+        {"VehicleOilLevel::HIGH", static_cast<int32_t>(VehicleOilLevel::HIGH)},
+        {"VehicleOilLevel::ERROR", static_cast<int32_t>(VehicleOilLevel::ERROR)},
+        {"VehicleProperty::INVALID", static_cast<int32_t>(VehicleProperty::INVALID)},
+        {"VehicleProperty::INFO_VIN", static_cast<int32_t>(VehicleProperty::INFO_VIN)},
+        {"VehicleProperty::INFO_MAKE", static_cast<int32_t>(VehicleProperty::INFO_MAKE)},
+        {"VehicleProperty::INFO_MODEL", static_cast<int32_t>(VehicleProperty::INFO_MODEL)},
+        {"VehicleProperty::INFO_MODEL_YEAR", static_cast<int32_t>(VehicleProperty::INFO_MODEL_YEAR)},
+        {"VehicleProperty::INFO_FUEL_CAPACITY", static_cast<int32_t>(VehicleProperty::INFO_FUEL_CAPACITY)},
+        {"VehicleProperty::INFO_FUEL_TYPE", static_cast<int32_t>(VehicleProperty::INFO_FUEL_TYPE)},
+        {"VehicleProperty::INFO_EV_BATTERY_CAPACITY", static_cast<int32_t>(VehicleProperty::INFO_EV_BATTERY_CAPACITY)},
+        {"VehicleProperty::INFO_EV_CONNECTOR_TYPE", static_cast<int32_t>(VehicleProperty::INFO_EV_CONNECTOR_TYPE)},
+        {"VehicleProperty::INFO_FUEL_DOOR_LOCATION", static_cast<int32_t>(VehicleProperty::INFO_FUEL_DOOR_LOCATION)},
+        {"VehicleProperty::INFO_EV_PORT_LOCATION", static_cast<int32_t>(VehicleProperty::INFO_EV_PORT_LOCATION)},
+        {"VehicleProperty::INFO_DRIVER_SEAT", static_cast<int32_t>(VehicleProperty::INFO_DRIVER_SEAT)},
+        {"VehicleProperty::INFO_EXTERIOR_DIMENSIONS", static_cast<int32_t>(VehicleProperty::INFO_EXTERIOR_DIMENSIONS)},
+        {"VehicleProperty::INFO_MULTI_EV_PORT_LOCATIONS", static_cast<int32_t>(VehicleProperty::INFO_MULTI_EV_PORT_LOCATIONS)},
+        {"VehicleProperty::PERF_ODOMETER", static_cast<int32_t>(VehicleProperty::PERF_ODOMETER)},
+        {"VehicleProperty::PERF_VEHICLE_SPEED", static_cast<int32_t>(VehicleProperty::PERF_VEHICLE_SPEED)},
+        {"VehicleProperty::PERF_VEHICLE_SPEED_DISPLAY", static_cast<int32_t>(VehicleProperty::PERF_VEHICLE_SPEED_DISPLAY)},
+        {"VehicleProperty::PERF_STEERING_ANGLE", static_cast<int32_t>(VehicleProperty::PERF_STEERING_ANGLE)},
+        {"VehicleProperty::PERF_REAR_STEERING_ANGLE", static_cast<int32_t>(VehicleProperty::PERF_REAR_STEERING_ANGLE)},
+        {"VehicleProperty::ENGINE_COOLANT_TEMP", static_cast<int32_t>(VehicleProperty::ENGINE_COOLANT_TEMP)},
+        {"VehicleProperty::ENGINE_OIL_LEVEL", static_cast<int32_t>(VehicleProperty::ENGINE_OIL_LEVEL)},
+        {"VehicleProperty::ENGINE_OIL_TEMP", static_cast<int32_t>(VehicleProperty::ENGINE_OIL_TEMP)},
+        {"VehicleProperty::ENGINE_RPM", static_cast<int32_t>(VehicleProperty::ENGINE_RPM)},
+        {"VehicleProperty::WHEEL_TICK", static_cast<int32_t>(VehicleProperty::WHEEL_TICK)},
+        {"VehicleProperty::FUEL_LEVEL", static_cast<int32_t>(VehicleProperty::FUEL_LEVEL)},
+        {"VehicleProperty::FUEL_DOOR_OPEN", static_cast<int32_t>(VehicleProperty::FUEL_DOOR_OPEN)},
+        {"VehicleProperty::EV_BATTERY_LEVEL", static_cast<int32_t>(VehicleProperty::EV_BATTERY_LEVEL)},
+        {"VehicleProperty::EV_CURRENT_BATTERY_CAPACITY", static_cast<int32_t>(VehicleProperty::EV_CURRENT_BATTERY_CAPACITY)},
+        {"VehicleProperty::EV_CHARGE_PORT_OPEN", static_cast<int32_t>(VehicleProperty::EV_CHARGE_PORT_OPEN)},
+        {"VehicleProperty::EV_CHARGE_PORT_CONNECTED", static_cast<int32_t>(VehicleProperty::EV_CHARGE_PORT_CONNECTED)},
+        {"VehicleProperty::EV_BATTERY_INSTANTANEOUS_CHARGE_RATE", static_cast<int32_t>(VehicleProperty::EV_BATTERY_INSTANTANEOUS_CHARGE_RATE)},
+        {"VehicleProperty::RANGE_REMAINING", static_cast<int32_t>(VehicleProperty::RANGE_REMAINING)},
+        {"VehicleProperty::TIRE_PRESSURE", static_cast<int32_t>(VehicleProperty::TIRE_PRESSURE)},
+        {"VehicleProperty::CRITICALLY_LOW_TIRE_PRESSURE", static_cast<int32_t>(VehicleProperty::CRITICALLY_LOW_TIRE_PRESSURE)},
+        {"VehicleProperty::ENGINE_IDLE_AUTO_STOP_ENABLED", static_cast<int32_t>(VehicleProperty::ENGINE_IDLE_AUTO_STOP_ENABLED)},
+        {"VehicleProperty::GEAR_SELECTION", static_cast<int32_t>(VehicleProperty::GEAR_SELECTION)},
+        {"VehicleProperty::CURRENT_GEAR", static_cast<int32_t>(VehicleProperty::CURRENT_GEAR)},
+        {"VehicleProperty::PARKING_BRAKE_ON", static_cast<int32_t>(VehicleProperty::PARKING_BRAKE_ON)},
+        {"VehicleProperty::PARKING_BRAKE_AUTO_APPLY", static_cast<int32_t>(VehicleProperty::PARKING_BRAKE_AUTO_APPLY)},
+        {"VehicleProperty::EV_BRAKE_REGENERATION_LEVEL", static_cast<int32_t>(VehicleProperty::EV_BRAKE_REGENERATION_LEVEL)},
+        {"VehicleProperty::FUEL_LEVEL_LOW", static_cast<int32_t>(VehicleProperty::FUEL_LEVEL_LOW)},
+        {"VehicleProperty::NIGHT_MODE", static_cast<int32_t>(VehicleProperty::NIGHT_MODE)},
+        {"VehicleProperty::TURN_SIGNAL_STATE", static_cast<int32_t>(VehicleProperty::TURN_SIGNAL_STATE)},
+        {"VehicleProperty::IGNITION_STATE", static_cast<int32_t>(VehicleProperty::IGNITION_STATE)},
+        {"VehicleProperty::ABS_ACTIVE", static_cast<int32_t>(VehicleProperty::ABS_ACTIVE)},
+        {"VehicleProperty::TRACTION_CONTROL_ACTIVE", static_cast<int32_t>(VehicleProperty::TRACTION_CONTROL_ACTIVE)},
+        {"VehicleProperty::EV_STOPPING_MODE", static_cast<int32_t>(VehicleProperty::EV_STOPPING_MODE)},
+        {"VehicleProperty::HVAC_FAN_SPEED", static_cast<int32_t>(VehicleProperty::HVAC_FAN_SPEED)},
+        {"VehicleProperty::HVAC_FAN_DIRECTION", static_cast<int32_t>(VehicleProperty::HVAC_FAN_DIRECTION)},
+        {"VehicleProperty::HVAC_TEMPERATURE_CURRENT", static_cast<int32_t>(VehicleProperty::HVAC_TEMPERATURE_CURRENT)},
+        {"VehicleProperty::HVAC_TEMPERATURE_SET", static_cast<int32_t>(VehicleProperty::HVAC_TEMPERATURE_SET)},
+        {"VehicleProperty::HVAC_DEFROSTER", static_cast<int32_t>(VehicleProperty::HVAC_DEFROSTER)},
+        {"VehicleProperty::HVAC_AC_ON", static_cast<int32_t>(VehicleProperty::HVAC_AC_ON)},
+        {"VehicleProperty::HVAC_MAX_AC_ON", static_cast<int32_t>(VehicleProperty::HVAC_MAX_AC_ON)},
+        {"VehicleProperty::HVAC_MAX_DEFROST_ON", static_cast<int32_t>(VehicleProperty::HVAC_MAX_DEFROST_ON)},
+        {"VehicleProperty::HVAC_RECIRC_ON", static_cast<int32_t>(VehicleProperty::HVAC_RECIRC_ON)},
+        {"VehicleProperty::HVAC_DUAL_ON", static_cast<int32_t>(VehicleProperty::HVAC_DUAL_ON)},
+        {"VehicleProperty::HVAC_AUTO_ON", static_cast<int32_t>(VehicleProperty::HVAC_AUTO_ON)},
+        {"VehicleProperty::HVAC_SEAT_TEMPERATURE", static_cast<int32_t>(VehicleProperty::HVAC_SEAT_TEMPERATURE)},
+        {"VehicleProperty::HVAC_SIDE_MIRROR_HEAT", static_cast<int32_t>(VehicleProperty::HVAC_SIDE_MIRROR_HEAT)},
+        {"VehicleProperty::HVAC_STEERING_WHEEL_HEAT", static_cast<int32_t>(VehicleProperty::HVAC_STEERING_WHEEL_HEAT)},
+        {"VehicleProperty::HVAC_TEMPERATURE_DISPLAY_UNITS", static_cast<int32_t>(VehicleProperty::HVAC_TEMPERATURE_DISPLAY_UNITS)},
+        {"VehicleProperty::HVAC_ACTUAL_FAN_SPEED_RPM", static_cast<int32_t>(VehicleProperty::HVAC_ACTUAL_FAN_SPEED_RPM)},
+        {"VehicleProperty::HVAC_POWER_ON", static_cast<int32_t>(VehicleProperty::HVAC_POWER_ON)},
+        {"VehicleProperty::HVAC_FAN_DIRECTION_AVAILABLE", static_cast<int32_t>(VehicleProperty::HVAC_FAN_DIRECTION_AVAILABLE)},
+        {"VehicleProperty::HVAC_AUTO_RECIRC_ON", static_cast<int32_t>(VehicleProperty::HVAC_AUTO_RECIRC_ON)},
+        {"VehicleProperty::HVAC_SEAT_VENTILATION", static_cast<int32_t>(VehicleProperty::HVAC_SEAT_VENTILATION)},
+        {"VehicleProperty::HVAC_ELECTRIC_DEFROSTER_ON", static_cast<int32_t>(VehicleProperty::HVAC_ELECTRIC_DEFROSTER_ON)},
+        {"VehicleProperty::HVAC_TEMPERATURE_VALUE_SUGGESTION", static_cast<int32_t>(VehicleProperty::HVAC_TEMPERATURE_VALUE_SUGGESTION)},
+        {"VehicleProperty::DISTANCE_DISPLAY_UNITS", static_cast<int32_t>(VehicleProperty::DISTANCE_DISPLAY_UNITS)},
+        {"VehicleProperty::FUEL_VOLUME_DISPLAY_UNITS", static_cast<int32_t>(VehicleProperty::FUEL_VOLUME_DISPLAY_UNITS)},
+        {"VehicleProperty::TIRE_PRESSURE_DISPLAY_UNITS", static_cast<int32_t>(VehicleProperty::TIRE_PRESSURE_DISPLAY_UNITS)},
+        {"VehicleProperty::EV_BATTERY_DISPLAY_UNITS", static_cast<int32_t>(VehicleProperty::EV_BATTERY_DISPLAY_UNITS)},
+        {"VehicleProperty::FUEL_CONSUMPTION_UNITS_DISTANCE_OVER_VOLUME", static_cast<int32_t>(VehicleProperty::FUEL_CONSUMPTION_UNITS_DISTANCE_OVER_VOLUME)},
+        {"VehicleProperty::VEHICLE_SPEED_DISPLAY_UNITS", static_cast<int32_t>(VehicleProperty::VEHICLE_SPEED_DISPLAY_UNITS)},
+        {"VehicleProperty::EXTERNAL_CAR_TIME", static_cast<int32_t>(VehicleProperty::EXTERNAL_CAR_TIME)},
+        {"VehicleProperty::ANDROID_EPOCH_TIME", static_cast<int32_t>(VehicleProperty::ANDROID_EPOCH_TIME)},
+        {"VehicleProperty::STORAGE_ENCRYPTION_BINDING_SEED", static_cast<int32_t>(VehicleProperty::STORAGE_ENCRYPTION_BINDING_SEED)},
+        {"VehicleProperty::ENV_OUTSIDE_TEMPERATURE", static_cast<int32_t>(VehicleProperty::ENV_OUTSIDE_TEMPERATURE)},
+        {"VehicleProperty::AP_POWER_STATE_REQ", static_cast<int32_t>(VehicleProperty::AP_POWER_STATE_REQ)},
+        {"VehicleProperty::AP_POWER_STATE_REPORT", static_cast<int32_t>(VehicleProperty::AP_POWER_STATE_REPORT)},
+        {"VehicleProperty::AP_POWER_BOOTUP_REASON", static_cast<int32_t>(VehicleProperty::AP_POWER_BOOTUP_REASON)},
+        {"VehicleProperty::DISPLAY_BRIGHTNESS", static_cast<int32_t>(VehicleProperty::DISPLAY_BRIGHTNESS)},
+        {"VehicleProperty::PER_DISPLAY_BRIGHTNESS", static_cast<int32_t>(VehicleProperty::PER_DISPLAY_BRIGHTNESS)},
+        {"VehicleProperty::HW_KEY_INPUT", static_cast<int32_t>(VehicleProperty::HW_KEY_INPUT)},
+        {"VehicleProperty::HW_KEY_INPUT_V2", static_cast<int32_t>(VehicleProperty::HW_KEY_INPUT_V2)},
+        {"VehicleProperty::HW_MOTION_INPUT", static_cast<int32_t>(VehicleProperty::HW_MOTION_INPUT)},
+        {"VehicleProperty::HW_ROTARY_INPUT", static_cast<int32_t>(VehicleProperty::HW_ROTARY_INPUT)},
+        {"VehicleProperty::HW_CUSTOM_INPUT", static_cast<int32_t>(VehicleProperty::HW_CUSTOM_INPUT)},
+        {"VehicleProperty::DOOR_POS", static_cast<int32_t>(VehicleProperty::DOOR_POS)},
+        {"VehicleProperty::DOOR_MOVE", static_cast<int32_t>(VehicleProperty::DOOR_MOVE)},
+        {"VehicleProperty::DOOR_LOCK", static_cast<int32_t>(VehicleProperty::DOOR_LOCK)},
+        {"VehicleProperty::DOOR_CHILD_LOCK_ENABLED", static_cast<int32_t>(VehicleProperty::DOOR_CHILD_LOCK_ENABLED)},
+        {"VehicleProperty::MIRROR_Z_POS", static_cast<int32_t>(VehicleProperty::MIRROR_Z_POS)},
+        {"VehicleProperty::MIRROR_Z_MOVE", static_cast<int32_t>(VehicleProperty::MIRROR_Z_MOVE)},
+        {"VehicleProperty::MIRROR_Y_POS", static_cast<int32_t>(VehicleProperty::MIRROR_Y_POS)},
+        {"VehicleProperty::MIRROR_Y_MOVE", static_cast<int32_t>(VehicleProperty::MIRROR_Y_MOVE)},
+        {"VehicleProperty::MIRROR_LOCK", static_cast<int32_t>(VehicleProperty::MIRROR_LOCK)},
+        {"VehicleProperty::MIRROR_FOLD", static_cast<int32_t>(VehicleProperty::MIRROR_FOLD)},
+        {"VehicleProperty::MIRROR_AUTO_FOLD_ENABLED", static_cast<int32_t>(VehicleProperty::MIRROR_AUTO_FOLD_ENABLED)},
+        {"VehicleProperty::MIRROR_AUTO_TILT_ENABLED", static_cast<int32_t>(VehicleProperty::MIRROR_AUTO_TILT_ENABLED)},
+        {"VehicleProperty::SEAT_MEMORY_SELECT", static_cast<int32_t>(VehicleProperty::SEAT_MEMORY_SELECT)},
+        {"VehicleProperty::SEAT_MEMORY_SET", static_cast<int32_t>(VehicleProperty::SEAT_MEMORY_SET)},
+        {"VehicleProperty::SEAT_BELT_BUCKLED", static_cast<int32_t>(VehicleProperty::SEAT_BELT_BUCKLED)},
+        {"VehicleProperty::SEAT_BELT_HEIGHT_POS", static_cast<int32_t>(VehicleProperty::SEAT_BELT_HEIGHT_POS)},
+        {"VehicleProperty::SEAT_BELT_HEIGHT_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_BELT_HEIGHT_MOVE)},
+        {"VehicleProperty::SEAT_FORE_AFT_POS", static_cast<int32_t>(VehicleProperty::SEAT_FORE_AFT_POS)},
+        {"VehicleProperty::SEAT_FORE_AFT_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_FORE_AFT_MOVE)},
+        {"VehicleProperty::SEAT_BACKREST_ANGLE_1_POS", static_cast<int32_t>(VehicleProperty::SEAT_BACKREST_ANGLE_1_POS)},
+        {"VehicleProperty::SEAT_BACKREST_ANGLE_1_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_BACKREST_ANGLE_1_MOVE)},
+        {"VehicleProperty::SEAT_BACKREST_ANGLE_2_POS", static_cast<int32_t>(VehicleProperty::SEAT_BACKREST_ANGLE_2_POS)},
+        {"VehicleProperty::SEAT_BACKREST_ANGLE_2_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_BACKREST_ANGLE_2_MOVE)},
+        {"VehicleProperty::SEAT_HEIGHT_POS", static_cast<int32_t>(VehicleProperty::SEAT_HEIGHT_POS)},
+        {"VehicleProperty::SEAT_HEIGHT_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_HEIGHT_MOVE)},
+        {"VehicleProperty::SEAT_DEPTH_POS", static_cast<int32_t>(VehicleProperty::SEAT_DEPTH_POS)},
+        {"VehicleProperty::SEAT_DEPTH_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_DEPTH_MOVE)},
+        {"VehicleProperty::SEAT_TILT_POS", static_cast<int32_t>(VehicleProperty::SEAT_TILT_POS)},
+        {"VehicleProperty::SEAT_TILT_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_TILT_MOVE)},
+        {"VehicleProperty::SEAT_LUMBAR_FORE_AFT_POS", static_cast<int32_t>(VehicleProperty::SEAT_LUMBAR_FORE_AFT_POS)},
+        {"VehicleProperty::SEAT_LUMBAR_FORE_AFT_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_LUMBAR_FORE_AFT_MOVE)},
+        {"VehicleProperty::SEAT_LUMBAR_SIDE_SUPPORT_POS", static_cast<int32_t>(VehicleProperty::SEAT_LUMBAR_SIDE_SUPPORT_POS)},
+        {"VehicleProperty::SEAT_LUMBAR_SIDE_SUPPORT_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_LUMBAR_SIDE_SUPPORT_MOVE)},
+        {"VehicleProperty::SEAT_HEADREST_HEIGHT_POS", static_cast<int32_t>(VehicleProperty::SEAT_HEADREST_HEIGHT_POS)},
+        {"VehicleProperty::SEAT_HEADREST_HEIGHT_POS_V2", static_cast<int32_t>(VehicleProperty::SEAT_HEADREST_HEIGHT_POS_V2)},
+        {"VehicleProperty::SEAT_HEADREST_HEIGHT_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_HEADREST_HEIGHT_MOVE)},
+        {"VehicleProperty::SEAT_HEADREST_ANGLE_POS", static_cast<int32_t>(VehicleProperty::SEAT_HEADREST_ANGLE_POS)},
+        {"VehicleProperty::SEAT_HEADREST_ANGLE_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_HEADREST_ANGLE_MOVE)},
+        {"VehicleProperty::SEAT_HEADREST_FORE_AFT_POS", static_cast<int32_t>(VehicleProperty::SEAT_HEADREST_FORE_AFT_POS)},
+        {"VehicleProperty::SEAT_HEADREST_FORE_AFT_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_HEADREST_FORE_AFT_MOVE)},
+        {"VehicleProperty::SEAT_FOOTWELL_LIGHTS_STATE", static_cast<int32_t>(VehicleProperty::SEAT_FOOTWELL_LIGHTS_STATE)},
+        {"VehicleProperty::SEAT_FOOTWELL_LIGHTS_SWITCH", static_cast<int32_t>(VehicleProperty::SEAT_FOOTWELL_LIGHTS_SWITCH)},
+        {"VehicleProperty::SEAT_EASY_ACCESS_ENABLED", static_cast<int32_t>(VehicleProperty::SEAT_EASY_ACCESS_ENABLED)},
+        {"VehicleProperty::SEAT_AIRBAG_ENABLED", static_cast<int32_t>(VehicleProperty::SEAT_AIRBAG_ENABLED)},
+        {"VehicleProperty::SEAT_CUSHION_SIDE_SUPPORT_POS", static_cast<int32_t>(VehicleProperty::SEAT_CUSHION_SIDE_SUPPORT_POS)},
+        {"VehicleProperty::SEAT_CUSHION_SIDE_SUPPORT_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_CUSHION_SIDE_SUPPORT_MOVE)},
+        {"VehicleProperty::SEAT_LUMBAR_VERTICAL_POS", static_cast<int32_t>(VehicleProperty::SEAT_LUMBAR_VERTICAL_POS)},
+        {"VehicleProperty::SEAT_LUMBAR_VERTICAL_MOVE", static_cast<int32_t>(VehicleProperty::SEAT_LUMBAR_VERTICAL_MOVE)},
+        {"VehicleProperty::SEAT_WALK_IN_POS", static_cast<int32_t>(VehicleProperty::SEAT_WALK_IN_POS)},
+        {"VehicleProperty::SEAT_OCCUPANCY", static_cast<int32_t>(VehicleProperty::SEAT_OCCUPANCY)},
+        {"VehicleProperty::WINDOW_POS", static_cast<int32_t>(VehicleProperty::WINDOW_POS)},
+        {"VehicleProperty::WINDOW_MOVE", static_cast<int32_t>(VehicleProperty::WINDOW_MOVE)},
+        {"VehicleProperty::WINDOW_LOCK", static_cast<int32_t>(VehicleProperty::WINDOW_LOCK)},
+        {"VehicleProperty::WINDSHIELD_WIPERS_PERIOD", static_cast<int32_t>(VehicleProperty::WINDSHIELD_WIPERS_PERIOD)},
+        {"VehicleProperty::WINDSHIELD_WIPERS_STATE", static_cast<int32_t>(VehicleProperty::WINDSHIELD_WIPERS_STATE)},
+        {"VehicleProperty::WINDSHIELD_WIPERS_SWITCH", static_cast<int32_t>(VehicleProperty::WINDSHIELD_WIPERS_SWITCH)},
+        {"VehicleProperty::STEERING_WHEEL_DEPTH_POS", static_cast<int32_t>(VehicleProperty::STEERING_WHEEL_DEPTH_POS)},
+        {"VehicleProperty::STEERING_WHEEL_DEPTH_MOVE", static_cast<int32_t>(VehicleProperty::STEERING_WHEEL_DEPTH_MOVE)},
+        {"VehicleProperty::STEERING_WHEEL_HEIGHT_POS", static_cast<int32_t>(VehicleProperty::STEERING_WHEEL_HEIGHT_POS)},
+        {"VehicleProperty::STEERING_WHEEL_HEIGHT_MOVE", static_cast<int32_t>(VehicleProperty::STEERING_WHEEL_HEIGHT_MOVE)},
+        {"VehicleProperty::STEERING_WHEEL_THEFT_LOCK_ENABLED", static_cast<int32_t>(VehicleProperty::STEERING_WHEEL_THEFT_LOCK_ENABLED)},
+        {"VehicleProperty::STEERING_WHEEL_LOCKED", static_cast<int32_t>(VehicleProperty::STEERING_WHEEL_LOCKED)},
+        {"VehicleProperty::STEERING_WHEEL_EASY_ACCESS_ENABLED", static_cast<int32_t>(VehicleProperty::STEERING_WHEEL_EASY_ACCESS_ENABLED)},
+        {"VehicleProperty::GLOVE_BOX_DOOR_POS", static_cast<int32_t>(VehicleProperty::GLOVE_BOX_DOOR_POS)},
+        {"VehicleProperty::GLOVE_BOX_LOCKED", static_cast<int32_t>(VehicleProperty::GLOVE_BOX_LOCKED)},
+        {"VehicleProperty::VEHICLE_MAP_SERVICE", static_cast<int32_t>(VehicleProperty::VEHICLE_MAP_SERVICE)},
+        {"VehicleProperty::LOCATION_CHARACTERIZATION", static_cast<int32_t>(VehicleProperty::LOCATION_CHARACTERIZATION)},
+        {"VehicleProperty::OBD2_LIVE_FRAME", static_cast<int32_t>(VehicleProperty::OBD2_LIVE_FRAME)},
+        {"VehicleProperty::OBD2_FREEZE_FRAME", static_cast<int32_t>(VehicleProperty::OBD2_FREEZE_FRAME)},
+        {"VehicleProperty::OBD2_FREEZE_FRAME_INFO", static_cast<int32_t>(VehicleProperty::OBD2_FREEZE_FRAME_INFO)},
+        {"VehicleProperty::OBD2_FREEZE_FRAME_CLEAR", static_cast<int32_t>(VehicleProperty::OBD2_FREEZE_FRAME_CLEAR)},
+        {"VehicleProperty::HEADLIGHTS_STATE", static_cast<int32_t>(VehicleProperty::HEADLIGHTS_STATE)},
+        {"VehicleProperty::HIGH_BEAM_LIGHTS_STATE", static_cast<int32_t>(VehicleProperty::HIGH_BEAM_LIGHTS_STATE)},
+        {"VehicleProperty::FOG_LIGHTS_STATE", static_cast<int32_t>(VehicleProperty::FOG_LIGHTS_STATE)},
+        {"VehicleProperty::HAZARD_LIGHTS_STATE", static_cast<int32_t>(VehicleProperty::HAZARD_LIGHTS_STATE)},
+        {"VehicleProperty::HEADLIGHTS_SWITCH", static_cast<int32_t>(VehicleProperty::HEADLIGHTS_SWITCH)},
+        {"VehicleProperty::HIGH_BEAM_LIGHTS_SWITCH", static_cast<int32_t>(VehicleProperty::HIGH_BEAM_LIGHTS_SWITCH)},
+        {"VehicleProperty::FOG_LIGHTS_SWITCH", static_cast<int32_t>(VehicleProperty::FOG_LIGHTS_SWITCH)},
+        {"VehicleProperty::HAZARD_LIGHTS_SWITCH", static_cast<int32_t>(VehicleProperty::HAZARD_LIGHTS_SWITCH)},
+        {"VehicleProperty::CABIN_LIGHTS_STATE", static_cast<int32_t>(VehicleProperty::CABIN_LIGHTS_STATE)},
+        {"VehicleProperty::CABIN_LIGHTS_SWITCH", static_cast<int32_t>(VehicleProperty::CABIN_LIGHTS_SWITCH)},
+        {"VehicleProperty::READING_LIGHTS_STATE", static_cast<int32_t>(VehicleProperty::READING_LIGHTS_STATE)},
+        {"VehicleProperty::READING_LIGHTS_SWITCH", static_cast<int32_t>(VehicleProperty::READING_LIGHTS_SWITCH)},
+        {"VehicleProperty::STEERING_WHEEL_LIGHTS_STATE", static_cast<int32_t>(VehicleProperty::STEERING_WHEEL_LIGHTS_STATE)},
+        {"VehicleProperty::STEERING_WHEEL_LIGHTS_SWITCH", static_cast<int32_t>(VehicleProperty::STEERING_WHEEL_LIGHTS_SWITCH)},
+        {"VehicleProperty::SUPPORT_CUSTOMIZE_VENDOR_PERMISSION", static_cast<int32_t>(VehicleProperty::SUPPORT_CUSTOMIZE_VENDOR_PERMISSION)},
+        {"VehicleProperty::DISABLED_OPTIONAL_FEATURES", static_cast<int32_t>(VehicleProperty::DISABLED_OPTIONAL_FEATURES)},
+        {"VehicleProperty::INITIAL_USER_INFO", static_cast<int32_t>(VehicleProperty::INITIAL_USER_INFO)},
+        {"VehicleProperty::SWITCH_USER", static_cast<int32_t>(VehicleProperty::SWITCH_USER)},
+        {"VehicleProperty::CREATE_USER", static_cast<int32_t>(VehicleProperty::CREATE_USER)},
+        {"VehicleProperty::REMOVE_USER", static_cast<int32_t>(VehicleProperty::REMOVE_USER)},
+        {"VehicleProperty::USER_IDENTIFICATION_ASSOCIATION", static_cast<int32_t>(VehicleProperty::USER_IDENTIFICATION_ASSOCIATION)},
+        {"VehicleProperty::EVS_SERVICE_REQUEST", static_cast<int32_t>(VehicleProperty::EVS_SERVICE_REQUEST)},
+        {"VehicleProperty::POWER_POLICY_REQ", static_cast<int32_t>(VehicleProperty::POWER_POLICY_REQ)},
+        {"VehicleProperty::POWER_POLICY_GROUP_REQ", static_cast<int32_t>(VehicleProperty::POWER_POLICY_GROUP_REQ)},
+        {"VehicleProperty::CURRENT_POWER_POLICY", static_cast<int32_t>(VehicleProperty::CURRENT_POWER_POLICY)},
+        {"VehicleProperty::WATCHDOG_ALIVE", static_cast<int32_t>(VehicleProperty::WATCHDOG_ALIVE)},
+        {"VehicleProperty::WATCHDOG_TERMINATED_PROCESS", static_cast<int32_t>(VehicleProperty::WATCHDOG_TERMINATED_PROCESS)},
+        {"VehicleProperty::VHAL_HEARTBEAT", static_cast<int32_t>(VehicleProperty::VHAL_HEARTBEAT)},
+        {"VehicleProperty::CLUSTER_SWITCH_UI", static_cast<int32_t>(VehicleProperty::CLUSTER_SWITCH_UI)},
+        {"VehicleProperty::CLUSTER_DISPLAY_STATE", static_cast<int32_t>(VehicleProperty::CLUSTER_DISPLAY_STATE)},
+        {"VehicleProperty::CLUSTER_REPORT_STATE", static_cast<int32_t>(VehicleProperty::CLUSTER_REPORT_STATE)},
+        {"VehicleProperty::CLUSTER_REQUEST_DISPLAY", static_cast<int32_t>(VehicleProperty::CLUSTER_REQUEST_DISPLAY)},
+        {"VehicleProperty::CLUSTER_NAVIGATION_STATE", static_cast<int32_t>(VehicleProperty::CLUSTER_NAVIGATION_STATE)},
+        {"VehicleProperty::ELECTRONIC_TOLL_COLLECTION_CARD_TYPE", static_cast<int32_t>(VehicleProperty::ELECTRONIC_TOLL_COLLECTION_CARD_TYPE)},
+        {"VehicleProperty::ELECTRONIC_TOLL_COLLECTION_CARD_STATUS", static_cast<int32_t>(VehicleProperty::ELECTRONIC_TOLL_COLLECTION_CARD_STATUS)},
+        {"VehicleProperty::FRONT_FOG_LIGHTS_STATE", static_cast<int32_t>(VehicleProperty::FRONT_FOG_LIGHTS_STATE)},
+        {"VehicleProperty::FRONT_FOG_LIGHTS_SWITCH", static_cast<int32_t>(VehicleProperty::FRONT_FOG_LIGHTS_SWITCH)},
+        {"VehicleProperty::REAR_FOG_LIGHTS_STATE", static_cast<int32_t>(VehicleProperty::REAR_FOG_LIGHTS_STATE)},
+        {"VehicleProperty::REAR_FOG_LIGHTS_SWITCH", static_cast<int32_t>(VehicleProperty::REAR_FOG_LIGHTS_SWITCH)},
+        {"VehicleProperty::EV_CHARGE_CURRENT_DRAW_LIMIT", static_cast<int32_t>(VehicleProperty::EV_CHARGE_CURRENT_DRAW_LIMIT)},
+        {"VehicleProperty::EV_CHARGE_PERCENT_LIMIT", static_cast<int32_t>(VehicleProperty::EV_CHARGE_PERCENT_LIMIT)},
+        {"VehicleProperty::EV_CHARGE_STATE", static_cast<int32_t>(VehicleProperty::EV_CHARGE_STATE)},
+        {"VehicleProperty::EV_CHARGE_SWITCH", static_cast<int32_t>(VehicleProperty::EV_CHARGE_SWITCH)},
+        {"VehicleProperty::EV_CHARGE_TIME_REMAINING", static_cast<int32_t>(VehicleProperty::EV_CHARGE_TIME_REMAINING)},
+        {"VehicleProperty::EV_REGENERATIVE_BRAKING_STATE", static_cast<int32_t>(VehicleProperty::EV_REGENERATIVE_BRAKING_STATE)},
+        {"VehicleProperty::TRAILER_PRESENT", static_cast<int32_t>(VehicleProperty::TRAILER_PRESENT)},
+        {"VehicleProperty::VEHICLE_CURB_WEIGHT", static_cast<int32_t>(VehicleProperty::VEHICLE_CURB_WEIGHT)},
+        {"VehicleProperty::GENERAL_SAFETY_REGULATION_COMPLIANCE_REQUIREMENT", static_cast<int32_t>(VehicleProperty::GENERAL_SAFETY_REGULATION_COMPLIANCE_REQUIREMENT)},
+        {"VehicleProperty::SUPPORTED_PROPERTY_IDS", static_cast<int32_t>(VehicleProperty::SUPPORTED_PROPERTY_IDS)},
+        {"VehicleProperty::SHUTDOWN_REQUEST", static_cast<int32_t>(VehicleProperty::SHUTDOWN_REQUEST)},
+        {"VehicleProperty::VEHICLE_IN_USE", static_cast<int32_t>(VehicleProperty::VEHICLE_IN_USE)},
+        {"VehicleProperty::AUTOMATIC_EMERGENCY_BRAKING_ENABLED", static_cast<int32_t>(VehicleProperty::AUTOMATIC_EMERGENCY_BRAKING_ENABLED)},
+        {"VehicleProperty::AUTOMATIC_EMERGENCY_BRAKING_STATE", static_cast<int32_t>(VehicleProperty::AUTOMATIC_EMERGENCY_BRAKING_STATE)},
+        {"VehicleProperty::FORWARD_COLLISION_WARNING_ENABLED", static_cast<int32_t>(VehicleProperty::FORWARD_COLLISION_WARNING_ENABLED)},
+        {"VehicleProperty::FORWARD_COLLISION_WARNING_STATE", static_cast<int32_t>(VehicleProperty::FORWARD_COLLISION_WARNING_STATE)},
+        {"VehicleProperty::BLIND_SPOT_WARNING_ENABLED", static_cast<int32_t>(VehicleProperty::BLIND_SPOT_WARNING_ENABLED)},
+        {"VehicleProperty::BLIND_SPOT_WARNING_STATE", static_cast<int32_t>(VehicleProperty::BLIND_SPOT_WARNING_STATE)},
+        {"VehicleProperty::LANE_DEPARTURE_WARNING_ENABLED", static_cast<int32_t>(VehicleProperty::LANE_DEPARTURE_WARNING_ENABLED)},
+        {"VehicleProperty::LANE_DEPARTURE_WARNING_STATE", static_cast<int32_t>(VehicleProperty::LANE_DEPARTURE_WARNING_STATE)},
+        {"VehicleProperty::LANE_KEEP_ASSIST_ENABLED", static_cast<int32_t>(VehicleProperty::LANE_KEEP_ASSIST_ENABLED)},
+        {"VehicleProperty::LANE_KEEP_ASSIST_STATE", static_cast<int32_t>(VehicleProperty::LANE_KEEP_ASSIST_STATE)},
+        {"VehicleProperty::LANE_CENTERING_ASSIST_ENABLED", static_cast<int32_t>(VehicleProperty::LANE_CENTERING_ASSIST_ENABLED)},
+        {"VehicleProperty::LANE_CENTERING_ASSIST_COMMAND", static_cast<int32_t>(VehicleProperty::LANE_CENTERING_ASSIST_COMMAND)},
+        {"VehicleProperty::LANE_CENTERING_ASSIST_STATE", static_cast<int32_t>(VehicleProperty::LANE_CENTERING_ASSIST_STATE)},
+        {"VehicleProperty::EMERGENCY_LANE_KEEP_ASSIST_ENABLED", static_cast<int32_t>(VehicleProperty::EMERGENCY_LANE_KEEP_ASSIST_ENABLED)},
+        {"VehicleProperty::EMERGENCY_LANE_KEEP_ASSIST_STATE", static_cast<int32_t>(VehicleProperty::EMERGENCY_LANE_KEEP_ASSIST_STATE)},
+        {"VehicleProperty::CRUISE_CONTROL_ENABLED", static_cast<int32_t>(VehicleProperty::CRUISE_CONTROL_ENABLED)},
+        {"VehicleProperty::CRUISE_CONTROL_TYPE", static_cast<int32_t>(VehicleProperty::CRUISE_CONTROL_TYPE)},
+        {"VehicleProperty::CRUISE_CONTROL_STATE", static_cast<int32_t>(VehicleProperty::CRUISE_CONTROL_STATE)},
+        {"VehicleProperty::CRUISE_CONTROL_COMMAND", static_cast<int32_t>(VehicleProperty::CRUISE_CONTROL_COMMAND)},
+        {"VehicleProperty::CRUISE_CONTROL_TARGET_SPEED", static_cast<int32_t>(VehicleProperty::CRUISE_CONTROL_TARGET_SPEED)},
+        {"VehicleProperty::ADAPTIVE_CRUISE_CONTROL_TARGET_TIME_GAP", static_cast<int32_t>(VehicleProperty::ADAPTIVE_CRUISE_CONTROL_TARGET_TIME_GAP)},
+        {"VehicleProperty::ADAPTIVE_CRUISE_CONTROL_LEAD_VEHICLE_MEASURED_DISTANCE", static_cast<int32_t>(VehicleProperty::ADAPTIVE_CRUISE_CONTROL_LEAD_VEHICLE_MEASURED_DISTANCE)},
+        {"VehicleProperty::HANDS_ON_DETECTION_ENABLED", static_cast<int32_t>(VehicleProperty::HANDS_ON_DETECTION_ENABLED)},
+        {"VehicleProperty::HANDS_ON_DETECTION_DRIVER_STATE", static_cast<int32_t>(VehicleProperty::HANDS_ON_DETECTION_DRIVER_STATE)},
+        {"VehicleProperty::HANDS_ON_DETECTION_WARNING", static_cast<int32_t>(VehicleProperty::HANDS_ON_DETECTION_WARNING)},
+        {"VehiclePropertyAccess::NONE", static_cast<int32_t>(VehiclePropertyAccess::NONE)},
+        {"VehiclePropertyAccess::READ", static_cast<int32_t>(VehiclePropertyAccess::READ)},
+        {"VehiclePropertyAccess::WRITE", static_cast<int32_t>(VehiclePropertyAccess::WRITE)},
+        {"VehiclePropertyAccess::READ_WRITE", static_cast<int32_t>(VehiclePropertyAccess::READ_WRITE)},
+        {"VehiclePropertyChangeMode::STATIC", static_cast<int32_t>(VehiclePropertyChangeMode::STATIC)},
+        {"VehiclePropertyChangeMode::ON_CHANGE", static_cast<int32_t>(VehiclePropertyChangeMode::ON_CHANGE)},
+        {"VehiclePropertyChangeMode::CONTINUOUS", static_cast<int32_t>(VehiclePropertyChangeMode::CONTINUOUS)},
+        {"VehiclePropertyGroup::SYSTEM", static_cast<int32_t>(VehiclePropertyGroup::SYSTEM)},
+        {"VehiclePropertyGroup::VENDOR", static_cast<int32_t>(VehiclePropertyGroup::VENDOR)},
+        {"VehiclePropertyGroup::MASK", static_cast<int32_t>(VehiclePropertyGroup::MASK)},
+        {"VehiclePropertyType::STRING", static_cast<int32_t>(VehiclePropertyType::STRING)},
+        {"VehiclePropertyType::BOOLEAN", static_cast<int32_t>(VehiclePropertyType::BOOLEAN)},
+        {"VehiclePropertyType::INT32", static_cast<int32_t>(VehiclePropertyType::INT32)},
+        {"VehiclePropertyType::INT32_VEC", static_cast<int32_t>(VehiclePropertyType::INT32_VEC)},
+        {"VehiclePropertyType::INT64", static_cast<int32_t>(VehiclePropertyType::INT64)},
+        {"VehiclePropertyType::INT64_VEC", static_cast<int32_t>(VehiclePropertyType::INT64_VEC)},
+        {"VehiclePropertyType::FLOAT", static_cast<int32_t>(VehiclePropertyType::FLOAT)},
+        {"VehiclePropertyType::FLOAT_VEC", static_cast<int32_t>(VehiclePropertyType::FLOAT_VEC)},
+        {"VehiclePropertyType::BYTES", static_cast<int32_t>(VehiclePropertyType::BYTES)},
+        {"VehiclePropertyType::MIXED", static_cast<int32_t>(VehiclePropertyType::MIXED)},
+        {"VehiclePropertyType::MASK", static_cast<int32_t>(VehiclePropertyType::MASK)},
+        {"VehicleSeatOccupancyState::UNKNOWN", static_cast<int32_t>(VehicleSeatOccupancyState::UNKNOWN)},
+        {"VehicleSeatOccupancyState::VACANT", static_cast<int32_t>(VehicleSeatOccupancyState::VACANT)},
+        {"VehicleSeatOccupancyState::OCCUPIED", static_cast<int32_t>(VehicleSeatOccupancyState::OCCUPIED)},
+        {"VehicleTurnSignal::NONE", static_cast<int32_t>(VehicleTurnSignal::NONE)},
+        {"VehicleTurnSignal::RIGHT", static_cast<int32_t>(VehicleTurnSignal::RIGHT)},
+        {"VehicleTurnSignal::LEFT", static_cast<int32_t>(VehicleTurnSignal::LEFT)},
+        {"VehicleUnit::SHOULD_NOT_USE", static_cast<int32_t>(VehicleUnit::SHOULD_NOT_USE)},
+        {"VehicleUnit::METER_PER_SEC", static_cast<int32_t>(VehicleUnit::METER_PER_SEC)},
+        {"VehicleUnit::RPM", static_cast<int32_t>(VehicleUnit::RPM)},
+        {"VehicleUnit::HERTZ", static_cast<int32_t>(VehicleUnit::HERTZ)},
+        {"VehicleUnit::PERCENTILE", static_cast<int32_t>(VehicleUnit::PERCENTILE)},
+        {"VehicleUnit::MILLIMETER", static_cast<int32_t>(VehicleUnit::MILLIMETER)},
+        {"VehicleUnit::METER", static_cast<int32_t>(VehicleUnit::METER)},
+        {"VehicleUnit::KILOMETER", static_cast<int32_t>(VehicleUnit::KILOMETER)},
+        {"VehicleUnit::MILE", static_cast<int32_t>(VehicleUnit::MILE)},
+        {"VehicleUnit::CELSIUS", static_cast<int32_t>(VehicleUnit::CELSIUS)},
+        {"VehicleUnit::FAHRENHEIT", static_cast<int32_t>(VehicleUnit::FAHRENHEIT)},
+        {"VehicleUnit::KELVIN", static_cast<int32_t>(VehicleUnit::KELVIN)},
+        {"VehicleUnit::MILLILITER", static_cast<int32_t>(VehicleUnit::MILLILITER)},
+        {"VehicleUnit::LITER", static_cast<int32_t>(VehicleUnit::LITER)},
+        {"VehicleUnit::GALLON", static_cast<int32_t>(VehicleUnit::GALLON)},
+        {"VehicleUnit::US_GALLON", static_cast<int32_t>(VehicleUnit::US_GALLON)},
+        {"VehicleUnit::IMPERIAL_GALLON", static_cast<int32_t>(VehicleUnit::IMPERIAL_GALLON)},
+        {"VehicleUnit::NANO_SECS", static_cast<int32_t>(VehicleUnit::NANO_SECS)},
+        {"VehicleUnit::MILLI_SECS", static_cast<int32_t>(VehicleUnit::MILLI_SECS)},
+        {"VehicleUnit::SECS", static_cast<int32_t>(VehicleUnit::SECS)},
+        {"VehicleUnit::YEAR", static_cast<int32_t>(VehicleUnit::YEAR)},
+        {"VehicleUnit::WATT_HOUR", static_cast<int32_t>(VehicleUnit::WATT_HOUR)},
+        {"VehicleUnit::MILLIAMPERE", static_cast<int32_t>(VehicleUnit::MILLIAMPERE)},
+        {"VehicleUnit::MILLIVOLT", static_cast<int32_t>(VehicleUnit::MILLIVOLT)},
+        {"VehicleUnit::MILLIWATTS", static_cast<int32_t>(VehicleUnit::MILLIWATTS)},
+        {"VehicleUnit::AMPERE_HOURS", static_cast<int32_t>(VehicleUnit::AMPERE_HOURS)},
+        {"VehicleUnit::KILOWATT_HOUR", static_cast<int32_t>(VehicleUnit::KILOWATT_HOUR)},
+        {"VehicleUnit::AMPERE", static_cast<int32_t>(VehicleUnit::AMPERE)},
+        {"VehicleUnit::KILOPASCAL", static_cast<int32_t>(VehicleUnit::KILOPASCAL)},
+        {"VehicleUnit::PSI", static_cast<int32_t>(VehicleUnit::PSI)},
+        {"VehicleUnit::BAR", static_cast<int32_t>(VehicleUnit::BAR)},
+        {"VehicleUnit::DEGREES", static_cast<int32_t>(VehicleUnit::DEGREES)},
+        {"VehicleUnit::MILES_PER_HOUR", static_cast<int32_t>(VehicleUnit::MILES_PER_HOUR)},
+        {"VehicleUnit::KILOMETERS_PER_HOUR", static_cast<int32_t>(VehicleUnit::KILOMETERS_PER_HOUR)},
+        {"VehicleVendorPermission::PERMISSION_DEFAULT", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_DEFAULT)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_WINDOW", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_WINDOW)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_WINDOW", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_WINDOW)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_DOOR", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_DOOR)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_DOOR", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_DOOR)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_SEAT", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_SEAT)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_SEAT", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_SEAT)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_MIRROR", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_MIRROR)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_MIRROR", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_MIRROR)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_INFO", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_INFO)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_INFO", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_INFO)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_ENGINE", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_ENGINE)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_ENGINE", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_ENGINE)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_HVAC", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_HVAC)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_HVAC", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_HVAC)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_LIGHT", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_LIGHT)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_LIGHT", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_LIGHT)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_1", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_1)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_1", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_1)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_2", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_2)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_2", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_2)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_3", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_3)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_3", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_3)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_4", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_4)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_4", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_4)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_5", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_5)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_5", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_5)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_6", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_6)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_6", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_6)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_7", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_7)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_7", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_7)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_8", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_8)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_8", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_8)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_9", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_9)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_9", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_9)},
+        {"VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_10", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_SET_VENDOR_CATEGORY_10)},
+        {"VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_10", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_GET_VENDOR_CATEGORY_10)},
+        {"VehicleVendorPermission::PERMISSION_NOT_ACCESSIBLE", static_cast<int32_t>(VehicleVendorPermission::PERMISSION_NOT_ACCESSIBLE)},
+        {"VmsAvailabilityStateIntegerValuesIndex::MESSAGE_TYPE", static_cast<int32_t>(VmsAvailabilityStateIntegerValuesIndex::MESSAGE_TYPE)},
+        {"VmsAvailabilityStateIntegerValuesIndex::SEQUENCE_NUMBER", static_cast<int32_t>(VmsAvailabilityStateIntegerValuesIndex::SEQUENCE_NUMBER)},
+        {"VmsAvailabilityStateIntegerValuesIndex::NUMBER_OF_ASSOCIATED_LAYERS", static_cast<int32_t>(VmsAvailabilityStateIntegerValuesIndex::NUMBER_OF_ASSOCIATED_LAYERS)},
+        {"VmsAvailabilityStateIntegerValuesIndex::LAYERS_START", static_cast<int32_t>(VmsAvailabilityStateIntegerValuesIndex::LAYERS_START)},
+        {"VmsBaseMessageIntegerValuesIndex::MESSAGE_TYPE", static_cast<int32_t>(VmsBaseMessageIntegerValuesIndex::MESSAGE_TYPE)},
+        {"VmsMessageType::SUBSCRIBE", static_cast<int32_t>(VmsMessageType::SUBSCRIBE)},
+        {"VmsMessageType::SUBSCRIBE_TO_PUBLISHER", static_cast<int32_t>(VmsMessageType::SUBSCRIBE_TO_PUBLISHER)},
+        {"VmsMessageType::UNSUBSCRIBE", static_cast<int32_t>(VmsMessageType::UNSUBSCRIBE)},
+        {"VmsMessageType::UNSUBSCRIBE_TO_PUBLISHER", static_cast<int32_t>(VmsMessageType::UNSUBSCRIBE_TO_PUBLISHER)},
+        {"VmsMessageType::OFFERING", static_cast<int32_t>(VmsMessageType::OFFERING)},
+        {"VmsMessageType::AVAILABILITY_REQUEST", static_cast<int32_t>(VmsMessageType::AVAILABILITY_REQUEST)},
+        {"VmsMessageType::SUBSCRIPTIONS_REQUEST", static_cast<int32_t>(VmsMessageType::SUBSCRIPTIONS_REQUEST)},
+        {"VmsMessageType::AVAILABILITY_RESPONSE", static_cast<int32_t>(VmsMessageType::AVAILABILITY_RESPONSE)},
+        {"VmsMessageType::AVAILABILITY_CHANGE", static_cast<int32_t>(VmsMessageType::AVAILABILITY_CHANGE)},
+        {"VmsMessageType::SUBSCRIPTIONS_RESPONSE", static_cast<int32_t>(VmsMessageType::SUBSCRIPTIONS_RESPONSE)},
+        {"VmsMessageType::SUBSCRIPTIONS_CHANGE", static_cast<int32_t>(VmsMessageType::SUBSCRIPTIONS_CHANGE)},
+        {"VmsMessageType::DATA", static_cast<int32_t>(VmsMessageType::DATA)},
+        {"VmsMessageType::PUBLISHER_ID_REQUEST", static_cast<int32_t>(VmsMessageType::PUBLISHER_ID_REQUEST)},
+        {"VmsMessageType::PUBLISHER_ID_RESPONSE", static_cast<int32_t>(VmsMessageType::PUBLISHER_ID_RESPONSE)},
+        {"VmsMessageType::PUBLISHER_INFORMATION_REQUEST", static_cast<int32_t>(VmsMessageType::PUBLISHER_INFORMATION_REQUEST)},
+        {"VmsMessageType::PUBLISHER_INFORMATION_RESPONSE", static_cast<int32_t>(VmsMessageType::PUBLISHER_INFORMATION_RESPONSE)},
+        {"VmsMessageType::START_SESSION", static_cast<int32_t>(VmsMessageType::START_SESSION)},
+        {"VmsMessageWithLayerAndPublisherIdIntegerValuesIndex::MESSAGE_TYPE", static_cast<int32_t>(VmsMessageWithLayerAndPublisherIdIntegerValuesIndex::MESSAGE_TYPE)},
+        {"VmsMessageWithLayerAndPublisherIdIntegerValuesIndex::LAYER_TYPE", static_cast<int32_t>(VmsMessageWithLayerAndPublisherIdIntegerValuesIndex::LAYER_TYPE)},
+        {"VmsMessageWithLayerAndPublisherIdIntegerValuesIndex::LAYER_SUBTYPE", static_cast<int32_t>(VmsMessageWithLayerAndPublisherIdIntegerValuesIndex::LAYER_SUBTYPE)},
+        {"VmsMessageWithLayerAndPublisherIdIntegerValuesIndex::LAYER_VERSION", static_cast<int32_t>(VmsMessageWithLayerAndPublisherIdIntegerValuesIndex::LAYER_VERSION)},
+        {"VmsMessageWithLayerAndPublisherIdIntegerValuesIndex::PUBLISHER_ID", static_cast<int32_t>(VmsMessageWithLayerAndPublisherIdIntegerValuesIndex::PUBLISHER_ID)},
+        {"VmsMessageWithLayerIntegerValuesIndex::MESSAGE_TYPE", static_cast<int32_t>(VmsMessageWithLayerIntegerValuesIndex::MESSAGE_TYPE)},
+        {"VmsMessageWithLayerIntegerValuesIndex::LAYER_TYPE", static_cast<int32_t>(VmsMessageWithLayerIntegerValuesIndex::LAYER_TYPE)},
+        {"VmsMessageWithLayerIntegerValuesIndex::LAYER_SUBTYPE", static_cast<int32_t>(VmsMessageWithLayerIntegerValuesIndex::LAYER_SUBTYPE)},
+        {"VmsMessageWithLayerIntegerValuesIndex::LAYER_VERSION", static_cast<int32_t>(VmsMessageWithLayerIntegerValuesIndex::LAYER_VERSION)},
+        {"VmsOfferingMessageIntegerValuesIndex::MESSAGE_TYPE", static_cast<int32_t>(VmsOfferingMessageIntegerValuesIndex::MESSAGE_TYPE)},
+        {"VmsOfferingMessageIntegerValuesIndex::PUBLISHER_ID", static_cast<int32_t>(VmsOfferingMessageIntegerValuesIndex::PUBLISHER_ID)},
+        {"VmsOfferingMessageIntegerValuesIndex::NUMBER_OF_OFFERS", static_cast<int32_t>(VmsOfferingMessageIntegerValuesIndex::NUMBER_OF_OFFERS)},
+        {"VmsOfferingMessageIntegerValuesIndex::OFFERING_START", static_cast<int32_t>(VmsOfferingMessageIntegerValuesIndex::OFFERING_START)},
+        {"VmsPublisherInformationIntegerValuesIndex::MESSAGE_TYPE", static_cast<int32_t>(VmsPublisherInformationIntegerValuesIndex::MESSAGE_TYPE)},
+        {"VmsPublisherInformationIntegerValuesIndex::PUBLISHER_ID", static_cast<int32_t>(VmsPublisherInformationIntegerValuesIndex::PUBLISHER_ID)},
+        {"VmsStartSessionMessageIntegerValuesIndex::MESSAGE_TYPE", static_cast<int32_t>(VmsStartSessionMessageIntegerValuesIndex::MESSAGE_TYPE)},
+        {"VmsStartSessionMessageIntegerValuesIndex::SERVICE_ID", static_cast<int32_t>(VmsStartSessionMessageIntegerValuesIndex::SERVICE_ID)},
+        {"VmsStartSessionMessageIntegerValuesIndex::CLIENT_ID", static_cast<int32_t>(VmsStartSessionMessageIntegerValuesIndex::CLIENT_ID)},
+        {"VmsSubscriptionsStateIntegerValuesIndex::MESSAGE_TYPE", static_cast<int32_t>(VmsSubscriptionsStateIntegerValuesIndex::MESSAGE_TYPE)},
+        {"VmsSubscriptionsStateIntegerValuesIndex::SEQUENCE_NUMBER", static_cast<int32_t>(VmsSubscriptionsStateIntegerValuesIndex::SEQUENCE_NUMBER)},
+        {"VmsSubscriptionsStateIntegerValuesIndex::NUMBER_OF_LAYERS", static_cast<int32_t>(VmsSubscriptionsStateIntegerValuesIndex::NUMBER_OF_LAYERS)},
+        {"VmsSubscriptionsStateIntegerValuesIndex::NUMBER_OF_ASSOCIATED_LAYERS", static_cast<int32_t>(VmsSubscriptionsStateIntegerValuesIndex::NUMBER_OF_ASSOCIATED_LAYERS)},
+        {"VmsSubscriptionsStateIntegerValuesIndex::SUBSCRIPTIONS_START", static_cast<int32_t>(VmsSubscriptionsStateIntegerValuesIndex::SUBSCRIPTIONS_START)},
+        {"WindshieldWipersState::OTHER", static_cast<int32_t>(WindshieldWipersState::OTHER)},
+        {"WindshieldWipersState::OFF", static_cast<int32_t>(WindshieldWipersState::OFF)},
+        {"WindshieldWipersState::ON", static_cast<int32_t>(WindshieldWipersState::ON)},
+        {"WindshieldWipersState::SERVICE", static_cast<int32_t>(WindshieldWipersState::SERVICE)},
+        {"WindshieldWipersSwitch::OTHER", static_cast<int32_t>(WindshieldWipersSwitch::OTHER)},
+        {"WindshieldWipersSwitch::OFF", static_cast<int32_t>(WindshieldWipersSwitch::OFF)},
+        {"WindshieldWipersSwitch::MIST", static_cast<int32_t>(WindshieldWipersSwitch::MIST)},
+        {"WindshieldWipersSwitch::INTERMITTENT_LEVEL_1", static_cast<int32_t>(WindshieldWipersSwitch::INTERMITTENT_LEVEL_1)},
+        {"WindshieldWipersSwitch::INTERMITTENT_LEVEL_2", static_cast<int32_t>(WindshieldWipersSwitch::INTERMITTENT_LEVEL_2)},
+        {"WindshieldWipersSwitch::INTERMITTENT_LEVEL_3", static_cast<int32_t>(WindshieldWipersSwitch::INTERMITTENT_LEVEL_3)},
+        {"WindshieldWipersSwitch::INTERMITTENT_LEVEL_4", static_cast<int32_t>(WindshieldWipersSwitch::INTERMITTENT_LEVEL_4)},
+        {"WindshieldWipersSwitch::INTERMITTENT_LEVEL_5", static_cast<int32_t>(WindshieldWipersSwitch::INTERMITTENT_LEVEL_5)},
+        {"WindshieldWipersSwitch::CONTINUOUS_LEVEL_1", static_cast<int32_t>(WindshieldWipersSwitch::CONTINUOUS_LEVEL_1)},
+        {"WindshieldWipersSwitch::CONTINUOUS_LEVEL_2", static_cast<int32_t>(WindshieldWipersSwitch::CONTINUOUS_LEVEL_2)},
+        {"WindshieldWipersSwitch::CONTINUOUS_LEVEL_3", static_cast<int32_t>(WindshieldWipersSwitch::CONTINUOUS_LEVEL_3)},
+        {"WindshieldWipersSwitch::CONTINUOUS_LEVEL_4", static_cast<int32_t>(WindshieldWipersSwitch::CONTINUOUS_LEVEL_4)},
+        {"WindshieldWipersSwitch::CONTINUOUS_LEVEL_5", static_cast<int32_t>(WindshieldWipersSwitch::CONTINUOUS_LEVEL_5)},
+        {"WindshieldWipersSwitch::AUTO", static_cast<int32_t>(WindshieldWipersSwitch::AUTO)},
+        {"WindshieldWipersSwitch::SERVICE", static_cast<int32_t>(WindshieldWipersSwitch::SERVICE)},
+};
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
+}  // aidl
+
+#endif  // android_hardware_automotive_vehicle_aidl_generated_lib_EnumConstantsForVehicleProperty_H_
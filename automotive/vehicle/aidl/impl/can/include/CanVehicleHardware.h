@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef android_hardware_automotive_vehicle_aidl_impl_can_include_CanVehicleHardware_H_
+#define android_hardware_automotive_vehicle_aidl_impl_can_include_CanVehicleHardware_H_
+
+#include <IVehicleHardware.h>
+#include <VehicleHalTypes.h>
+#include <android-base/thread_annotations.h>
+#include <android/hardware/automotive/can/1.0/ICanBus.h>
+#include <libprotocan/MessageSpec.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+namespace canbridge {
+
+// Maps a decoded CAN signal to a VHAL property.
+struct CanSignalMapping {
+    // Message carrying the signal, typically from tables generated by dbc2protocan.
+    const protocan::MessageSpec* message;
+    // Index of the signal within the message.
+    size_t signalIndex;
+
+    int32_t propId;
+    int32_t areaId = 0;
+
+    // Applied on top of the signal physical value (as defined by DBC factor and offset):
+    // property value = physical value * scale + offset.
+    float scale = 1.0f;
+    float offset = 0.0f;
+
+    // Minimum change of the property value to report a property change event. Unchanged values
+    // are never reported.
+    float changeThreshold = 0.0f;
+};
+
+// IVehicleHardware backend feeding VHAL properties from signals received on a CAN bus.
+//
+// The mapping is declarative: every CanSignalMapping makes one property (area) follow one CAN
+// signal. Only CAN messages carrying mapped signals are subscribed to, so the CAN HAL can filter
+// out all the other traffic in the kernel. Property change events for all signals of a single
+// CAN message are delivered in one batch.
+//
+// Properties are read-only. Supported property types are INT32, INT64, FLOAT and BOOLEAN.
+class CanVehicleHardware final : public IVehicleHardware {
+  public:
+    CanVehicleHardware(sp<::android::hardware::automotive::can::V1_0::ICanBus> bus,
+                       std::vector<aidl::android::hardware::automotive::vehicle::VehiclePropConfig>
+                               configs,
+                       std::vector<CanSignalMapping> mappings);
+
+    ~CanVehicleHardware();
+
+    std::vector<aidl::android::hardware::automotive::vehicle::VehiclePropConfig>
+    getAllPropertyConfigs() const override;
+
+    // All properties are read-only, set requests always fail with ACCESS_DENIED.
+    aidl::android::hardware::automotive::vehicle::StatusCode setValues(
+            std::shared_ptr<const SetValuesCallback> callback,
+            const std::vector<aidl::android::hardware::automotive::vehicle::SetValueRequest>&
+                    requests) override;
+
+    // Returns the last value received from CAN bus, or NOT_AVAILABLE if none was received yet.
+    aidl::android::hardware::automotive::vehicle::StatusCode getValues(
+            std::shared_ptr<const GetValuesCallback> callback,
+            const std::vector<aidl::android::hardware::automotive::vehicle::GetValueRequest>&
+                    requests) const override;
+
+    DumpResult dump(const std::vector<std::string>& options) override;
+
+    // Returns OK as long as the CAN bus subscription is active.
+    aidl::android::hardware::automotive::vehicle::StatusCode checkHealth() override;
+
+    void registerOnPropertyChangeEvent(
+            std::unique_ptr<const PropertyChangeCallback> callback) override;
+
+    void registerOnPropertySetErrorEvent(
+            std::unique_ptr<const PropertySetErrorCallback> callback) override;
+
+  private:
+    class MessageListener;
+
+    struct PropertyState {
+        CanSignalMapping mapping;
+        aidl::android::hardware::automotive::vehicle::VehiclePropertyType type;
+        aidl::android::hardware::automotive::vehicle::VehiclePropValue value;
+        // Last reported value, before converting to the property type.
+        double reportedValue = 0.0;
+        bool hasValue = false;
+    };
+
+    // Mapped signals of a CAN message, as indices to mProperties.
+    struct MessageMapping {
+        const protocan::MessageSpec* message;
+        std::vector<size_t> properties;
+    };
+
+    static uint64_t messageKey(uint32_t canId, bool isExtendedId);
+    static int64_t propertyKey(int32_t propId, int32_t areaId);
+
+    void subscribe();
+
+    // Decode a CAN message and report changed properties. Called for every received message.
+    void onReceive(const ::android::hardware::automotive::can::V1_0::CanMessage& message);
+
+    const sp<::android::hardware::automotive::can::V1_0::ICanBus> mBus;
+    const std::vector<aidl::android::hardware::automotive::vehicle::VehiclePropConfig> mConfigs;
+
+    // Built once in the constructor, read-only afterwards.
+    std::unordered_map<uint64_t, MessageMapping> mMessages;
+    std::unordered_map<int64_t, size_t> mPropertyIndex;
+
+    mutable std::mutex mLock;
+    std::vector<PropertyState> mProperties GUARDED_BY(mLock);
+    // Scratch buffer for decoded signal values.
+    std::vector<protocan::Signal::value> mDecoded GUARDED_BY(mLock);
+
+    std::shared_mutex mCallbackLock;
+    // Guarded by mCallbackLock.
+    std::unique_ptr<const PropertyChangeCallback> mOnPropertyChangeCallback;
+
+    sp<MessageListener> mListener;
+    sp<::android::hardware::automotive::can::V1_0::ICloseHandle> mCloseHandle;
+
+    std::atomic<uint64_t> mReceivedFrames = 0;
+    std::atomic<uint64_t> mDroppedFrames = 0;
+    std::atomic<uint64_t> mReportedEvents = 0;
+    std::atomic<uint64_t> mSuppressedEvents = 0;
+};
+
+}  // namespace canbridge
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
+
+#endif  // android_hardware_automotive_vehicle_aidl_impl_can_include_CanVehicleHardware_H_
@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define LOG_TAG "CanVehicleHardware"
+
+#include "CanVehicleHardware.h"
+
+#include <VehicleUtils.h>
+#include <android-base/stringprintf.h>
+#include <libprotocan/MessageLayout.h>
+#include <utils/Log.h>
+
+#include <inttypes.h>
+#include <cmath>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+namespace canbridge {
+
+namespace {
+
+namespace canhal = ::android::hardware::automotive::can::V1_0;
+
+using ::aidl::android::hardware::automotive::vehicle::GetValueRequest;
+using ::aidl::android::hardware::automotive::vehicle::GetValueResult;
+using ::aidl::android::hardware::automotive::vehicle::SetValueRequest;
+using ::aidl::android::hardware::automotive::vehicle::SetValueResult;
+using ::aidl::android::hardware::automotive::vehicle::StatusCode;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropConfig;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropertyStatus;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropertyType;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropValue;
+
+using ::android::base::StringPrintf;
+using ::android::hardware::hidl_vec;
+using ::android::hardware::Return;
+
+// Mask matching the whole message ID, for both standard and extended IDs (CAN_EFF_MASK).
+constexpr uint32_t kExactIdMask = 0x1FFFFFFF;
+
+bool isSupportedType(VehiclePropertyType type) {
+    switch (type) {
+        case VehiclePropertyType::INT32:
+        case VehiclePropertyType::INT64:
+        case VehiclePropertyType::FLOAT:
+        case VehiclePropertyType::BOOLEAN:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Round the value the way it's going to be reported, so changes that are invisible in the
+// property type are not reported.
+double normalizeValue(VehiclePropertyType type, double value) {
+    switch (type) {
+        case VehiclePropertyType::INT32:
+        case VehiclePropertyType::INT64:
+            return std::round(value);
+        case VehiclePropertyType::BOOLEAN:
+            return value != 0 ? 1 : 0;
+        default:
+            return value;
+    }
+}
+
+void setPropertyValue(VehiclePropValue* propValue, VehiclePropertyType type, double value) {
+    switch (type) {
+        case VehiclePropertyType::INT32:
+        case VehiclePropertyType::BOOLEAN:
+            propValue->value.int32Values = {static_cast<int32_t>(value)};
+            break;
+        case VehiclePropertyType::INT64:
+            propValue->value.int64Values = {static_cast<int64_t>(value)};
+            break;
+        case VehiclePropertyType::FLOAT:
+            propValue->value.floatValues = {static_cast<float>(value)};
+            break;
+        default:
+            break;
+    }
+}
+
+}  // namespace
+
+// Forwards messages to CanVehicleHardware until it's detached. The listener is reference counted
+// by the CAN HAL, so it may outlive CanVehicleHardware.
+class CanVehicleHardware::MessageListener final : public canhal::ICanMessageListener {
+  public:
+    explicit MessageListener(CanVehicleHardware* hardware) : mHardware(hardware) {}
+
+    Return<void> onReceive(const canhal::CanMessage& message) override {
+        std::lock_guard<std::mutex> lockGuard(mLock);
+        if (mHardware != nullptr) {
+            mHardware->onReceive(message);
+        }
+        return {};
+    }
+
+    // Stop forwarding messages, waiting for the one being processed (if any).
+    void detach() {
+        std::lock_guard<std::mutex> lockGuard(mLock);
+        mHardware = nullptr;
+    }
+
+  private:
+    std::mutex mLock;
+    CanVehicleHardware* mHardware GUARDED_BY(mLock);
+};
+
+CanVehicleHardware::CanVehicleHardware(sp<canhal::ICanBus> bus,
+                                       std::vector<VehiclePropConfig> configs,
+                                       std::vector<CanSignalMapping> mappings)
+    : mBus(bus), mConfigs(std::move(configs)) {
+    for (const auto& mapping : mappings) {
+        if (mapping.message == nullptr || mapping.signalIndex >= mapping.message->signalCount) {
+            ALOGE("invalid CAN signal mapping for property ID: %d", mapping.propId);
+            continue;
+        }
+        VehiclePropertyType type = getPropType(mapping.propId);
+        if (!isSupportedType(type)) {
+            ALOGE("property ID: %d has a type not supported for CAN signals", mapping.propId);
+            continue;
+        }
+        int64_t key = propertyKey(mapping.propId, mapping.areaId);
+        if (mPropertyIndex.find(key) != mPropertyIndex.end()) {
+            ALOGE("duplicate CAN signal mapping for property ID: %d, area ID: %d", mapping.propId,
+                  mapping.areaId);
+            continue;
+        }
+        auto& messageMapping =
+                mMessages[messageKey(mapping.message->id, mapping.message->isExtendedId)];
+        if (messageMapping.message != nullptr && messageMapping.message != mapping.message) {
+            ALOGE("conflicting definitions of CAN message: %s, ignoring property ID: %d",
+                  mapping.message->name, mapping.propId);
+            continue;
+        }
+
+        PropertyState state = {
+                .mapping = mapping,
+                .type = type,
+        };
+        state.value.prop = mapping.propId;
+        state.value.areaId = mapping.areaId;
+        state.value.status = VehiclePropertyStatus::AVAILABLE;
+
+        size_t index = mProperties.size();
+        mProperties.push_back(std::move(state));
+        mPropertyIndex[key] = index;
+        messageMapping.message = mapping.message;
+        messageMapping.properties.push_back(index);
+    }
+
+    subscribe();
+}
+
+CanVehicleHardware::~CanVehicleHardware() {
+    if (mCloseHandle != nullptr) {
+        mCloseHandle->close();
+    }
+    if (mListener != nullptr) {
+        mListener->detach();
+    }
+}
+
+uint64_t CanVehicleHardware::messageKey(uint32_t canId, bool isExtendedId) {
+    return (static_cast<uint64_t>(canId) << 1) | (isExtendedId ? 1 : 0);
+}
+
+int64_t CanVehicleHardware::propertyKey(int32_t propId, int32_t areaId) {
+    return (static_cast<int64_t>(propId) << 32) | static_cast<uint32_t>(areaId);
+}
+
+void CanVehicleHardware::subscribe() {
+    if (mMessages.empty()) {
+        // An empty filter list would subscribe to everything.
+        ALOGW("no CAN signals mapped, not subscribing to CAN bus");
+        return;
+    }
+
+    // One exact-match filter per message lets the CAN HAL drop all the other traffic in kernel.
+    std::vector<canhal::CanMessageFilter> filters;
+    for (const auto& [_, messageMapping] : mMessages) {
+        const auto* message = messageMapping.message;
+        filters.push_back({
+                .id = message->id,
+                .mask = kExactIdMask,
+                .rtr = canhal::FilterFlag::NOT_SET,
+                .extendedFormat = message->isExtendedId ? canhal::FilterFlag::SET
+                                                        : canhal::FilterFlag::NOT_SET,
+                .exclude = false,
+        });
+    }
+
+    mListener = new MessageListener(this);
+    canhal::Result result = canhal::Result::UNKNOWN_ERROR;
+    auto ret = mBus->listen(filters, mListener,
+                            [this, &result](canhal::Result r, const sp<canhal::ICloseHandle>& h) {
+                                result = r;
+                                mCloseHandle = h;
+                            });
+    if (!ret.isOk() || result != canhal::Result::OK) {
+        ALOGE("failed to listen on CAN bus, result: %s", canhal::toString(result).c_str());
+        mCloseHandle = nullptr;
+    }
+}
+
+void CanVehicleHardware::onReceive(const canhal::CanMessage& message) {
+    mReceivedFrames++;
+
+    auto it = mMessages.find(messageKey(message.id, message.isExtendedId));
+    if (it == mMessages.end() || message.remoteTransmissionRequest ||
+        message.payload.size() < it->second.message->length) {
+        mDroppedFrames++;
+        return;
+    }
+    const auto* spec = it->second.message;
+
+    std::vector<VehiclePropValue> events;
+    {
+        std::scoped_lock<std::mutex> lockGuard(mLock);
+
+        mDecoded.resize(spec->signalCount);
+        protocan::MessageLayout::decode(spec->fields, spec->signalCount, message,
+                                        mDecoded.data());
+
+        for (size_t index : it->second.properties) {
+            PropertyState& state = mProperties[index];
+            const CanSignalMapping& mapping = state.mapping;
+            double physical =
+                    spec->signals[mapping.signalIndex].toPhysical(mDecoded[mapping.signalIndex]);
+            double value = normalizeValue(state.type, physical * mapping.scale + mapping.offset);
+
+            if (state.hasValue &&
+                (value == state.reportedValue ||
+                 std::abs(value - state.reportedValue) < mapping.changeThreshold)) {
+                mSuppressedEvents++;
+                continue;
+            }
+
+            state.hasValue = true;
+            state.reportedValue = value;
+            setPropertyValue(&state.value, state.type, value);
+            state.value.timestamp = message.timestamp;
+            events.push_back(state.value);
+        }
+    }
+
+    if (events.empty()) {
+        return;
+    }
+    mReportedEvents += events.size();
+
+    std::shared_lock<std::shared_mutex> lockGuard(mCallbackLock);
+    if (mOnPropertyChangeCallback != nullptr) {
+        // All changes from a single CAN message are reported in one batch.
+        (*mOnPropertyChangeCallback)(std::move(events));
+    }
+}
+
+std::vector<VehiclePropConfig> CanVehicleHardware::getAllPropertyConfigs() const {
+    return mConfigs;
+}
+
+StatusCode CanVehicleHardware::setValues(std::shared_ptr<const SetValuesCallback> callback,
+                                         const std::vector<SetValueRequest>& requests) {
+    std::vector<SetValueResult> results;
+    for (const auto& request : requests) {
+        results.push_back({
+                .requestId = request.requestId,
+                .status = StatusCode::ACCESS_DENIED,
+        });
+    }
+    (*callback)(std::move(results));
+    return StatusCode::OK;
+}
+
+StatusCode CanVehicleHardware::getValues(std::shared_ptr<const GetValuesCallback> callback,
+                                         const std::vector<GetValueRequest>& requests) const {
+    std::vector<GetValueResult> results;
+    {
+        std::scoped_lock<std::mutex> lockGuard(mLock);
+        for (const auto& request : requests) {
+            GetValueResult result;
+            result.requestId = request.requestId;
+
+            auto it = mPropertyIndex.find(propertyKey(request.prop.prop, request.prop.areaId));
+            if (it == mPropertyIndex.end()) {
+                result.status = StatusCode::INVALID_ARG;
+            } else if (!mProperties[it->second].hasValue) {
+                result.status = StatusCode::NOT_AVAILABLE;
+            } else {
+                result.status = StatusCode::OK;
+                result.prop = mProperties[it->second].value;
+            }
+            results.push_back(std::move(result));
+        }
+    }
+    (*callback)(std::move(results));
+    return StatusCode::OK;
+}
+
+DumpResult CanVehicleHardware::dump(const std::vector<std::string>&) {
+    DumpResult result;
+    result.callerShouldDumpState = true;
+    result.buffer = StringPrintf(
+            "CAN bus subscription: %s\n"
+            "Mapped CAN messages: %zu, properties: %zu\n"
+            "Received frames: %" PRIu64 ", dropped frames: %" PRIu64 "\n"
+            "Reported events: %" PRIu64 ", suppressed events: %" PRIu64 "\n",
+            mCloseHandle != nullptr ? "active" : "inactive", mMessages.size(),
+            mPropertyIndex.size(), mReceivedFrames.load(), mDroppedFrames.load(),
+            mReportedEvents.load(), mSuppressedEvents.load());
+    return result;
+}
+
+StatusCode CanVehicleHardware::checkHealth() {
+    return mCloseHandle != nullptr ? StatusCode::OK : StatusCode::INTERNAL_ERROR;
+}
+
+void CanVehicleHardware::registerOnPropertyChangeEvent(
+        std::unique_ptr<const PropertyChangeCallback> callback) {
+    std::unique_lock<std::shared_mutex> lockGuard(mCallbackLock);
+    mOnPropertyChangeCallback = std::move(callback);
+}
+
+void CanVehicleHardware::registerOnPropertySetErrorEvent(
+        std::unique_ptr<const PropertySetErrorCallback>) {
+    // Properties are read-only, so there are never any set errors to report.
+}
+
+}  // namespace canbridge
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
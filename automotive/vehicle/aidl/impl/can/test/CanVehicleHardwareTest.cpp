@@ -0,0 +1,285 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CanVehicleHardware.h"
+
+#include <CanVehicleHardwareTestDbc.h>
+#include <VehicleUtils.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+namespace canbridge {
+
+namespace {
+
+namespace canhal = ::android::hardware::automotive::can::V1_0;
+
+using ::aidl::android::hardware::automotive::vehicle::GetValueRequest;
+using ::aidl::android::hardware::automotive::vehicle::GetValueResult;
+using ::aidl::android::hardware::automotive::vehicle::SetValueRequest;
+using ::aidl::android::hardware::automotive::vehicle::SetValueResult;
+using ::aidl::android::hardware::automotive::vehicle::StatusCode;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropConfig;
+using ::aidl::android::hardware::automotive::vehicle::VehicleProperty;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropValue;
+
+using ::android::hardware::hidl_vec;
+using ::android::hardware::Return;
+using ::android::hardware::Void;
+
+using ::testing::ElementsAre;
+using ::testing::FloatEq;
+using ::testing::SizeIs;
+
+constexpr int32_t kSpeedProp = toInt(VehicleProperty::PERF_VEHICLE_SPEED);
+constexpr int32_t kGearProp = toInt(VehicleProperty::GEAR_SELECTION);
+constexpr int32_t kParkingBrakeProp = toInt(VehicleProperty::PARKING_BRAKE_ON);
+constexpr int32_t kCabinTempProp = toInt(VehicleProperty::HVAC_TEMPERATURE_CURRENT);
+constexpr int32_t kRow1LeftArea = 1;
+
+class FakeCloseHandle : public canhal::ICloseHandle {
+  public:
+    Return<void> close() override {
+        mClosed = true;
+        return Void();
+    }
+
+    bool mClosed = false;
+};
+
+// Stands in for the CAN HAL, messages are delivered straight to the registered listener.
+class FakeCanBus : public canhal::ICanBus {
+  public:
+    Return<canhal::Result> send(const canhal::CanMessage&) override {
+        return canhal::Result::OK;
+    }
+
+    Return<void> listen(const hidl_vec<canhal::CanMessageFilter>& filter,
+                        const sp<canhal::ICanMessageListener>& listener,
+                        listen_cb hidlCb) override {
+        mFilters = filter;
+        mListener = listener;
+        mCloseHandle = new FakeCloseHandle();
+        hidlCb(canhal::Result::OK, mCloseHandle);
+        return Void();
+    }
+
+    Return<sp<canhal::ICloseHandle>> listenForErrors(
+            const sp<canhal::ICanErrorListener>&) override {
+        return nullptr;
+    }
+
+    void receive(canhal::CanMessageId id, bool isExtendedId, std::vector<uint8_t> payload) {
+        canhal::CanMessage message = {};
+        message.id = id;
+        message.isExtendedId = isExtendedId;
+        message.payload = payload;
+        message.timestamp = ++mTimestamp;
+        mListener->onReceive(message);
+    }
+
+    hidl_vec<canhal::CanMessageFilter> mFilters;
+    sp<canhal::ICanMessageListener> mListener;
+    sp<FakeCloseHandle> mCloseHandle;
+
+  private:
+    uint64_t mTimestamp = 0;
+};
+
+}  // namespace
+
+class CanVehicleHardwareTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        mBus = new FakeCanBus();
+
+        std::vector<VehiclePropConfig> configs = {
+                {.prop = kSpeedProp},
+                {.prop = kGearProp},
+                {.prop = kParkingBrakeProp},
+                {.prop = kCabinTempProp},
+        };
+        std::vector<CanSignalMapping> mappings = {
+                {
+                        .message = &test_dbc::kMessages[0],
+                        .signalIndex = test_dbc::Powertrain::kVehicleSpeed,
+                        .propId = kSpeedProp,
+                        // km/h to m/s
+                        .scale = 1 / 3.6f,
+                        .changeThreshold = 0.1f,
+                },
+                {
+                        .message = &test_dbc::kMessages[0],
+                        .signalIndex = test_dbc::Powertrain::kGear,
+                        .propId = kGearProp,
+                },
+                {
+                        .message = &test_dbc::kMessages[0],
+                        .signalIndex = test_dbc::Powertrain::kParkingBrake,
+                        .propId = kParkingBrakeProp,
+                },
+                {
+                        .message = &test_dbc::kMessages[1],
+                        .signalIndex = test_dbc::Climate::kCabinTemp,
+                        .propId = kCabinTempProp,
+                        .areaId = kRow1LeftArea,
+                },
+        };
+
+        mHardware = std::make_unique<CanVehicleHardware>(mBus, configs, mappings);
+        mHardware->registerOnPropertyChangeEvent(std::make_unique<
+                                                 IVehicleHardware::PropertyChangeCallback>(
+                [this](std::vector<VehiclePropValue> values) { mEvents.push_back(values); }));
+    }
+
+    std::vector<GetValueResult> getValues(const std::vector<GetValueRequest>& requests) {
+        std::vector<GetValueResult> results;
+        auto callback = std::make_shared<const IVehicleHardware::GetValuesCallback>(
+                [&results](std::vector<GetValueResult> r) { results = std::move(r); });
+        EXPECT_EQ(StatusCode::OK, mHardware->getValues(callback, requests));
+        return results;
+    }
+
+    sp<FakeCanBus> mBus;
+    std::unique_ptr<CanVehicleHardware> mHardware;
+    std::vector<std::vector<VehiclePropValue>> mEvents;
+};
+
+TEST_F(CanVehicleHardwareTest, testSubscribesToMappedMessagesOnly) {
+    ASSERT_EQ(StatusCode::OK, mHardware->checkHealth());
+    ASSERT_THAT(mBus->mFilters, SizeIs(2));
+
+    for (const auto& filter : mBus->mFilters) {
+        EXPECT_EQ(0x1FFFFFFFu, filter.mask);
+        EXPECT_FALSE(filter.exclude);
+        if (filter.id == 0x123) {
+            EXPECT_EQ(canhal::FilterFlag::NOT_SET, filter.extendedFormat);
+        } else {
+            EXPECT_EQ(0x18FEF000u, filter.id);
+            EXPECT_EQ(canhal::FilterFlag::SET, filter.extendedFormat);
+        }
+    }
+}
+
+TEST_F(CanVehicleHardwareTest, testReportsMessageSignalsInOneBatch) {
+    // 36.00 km/h, gear 4, parking brake on.
+    mBus->receive(0x123, false, {0x10, 0x0E, 0x14, 0, 0, 0, 0, 0});
+
+    ASSERT_THAT(mEvents, SizeIs(1));
+    const auto& events = mEvents[0];
+    ASSERT_THAT(events, SizeIs(3));
+    EXPECT_EQ(kSpeedProp, events[0].prop);
+    EXPECT_THAT(events[0].value.floatValues, ElementsAre(FloatEq(10.0f)));
+    EXPECT_EQ(kGearProp, events[1].prop);
+    EXPECT_THAT(events[1].value.int32Values, ElementsAre(4));
+    EXPECT_EQ(kParkingBrakeProp, events[2].prop);
+    EXPECT_THAT(events[2].value.int32Values, ElementsAre(1));
+    EXPECT_EQ(1, events[0].timestamp);
+}
+
+TEST_F(CanVehicleHardwareTest, testSuppressesUnchangedValues) {
+    mBus->receive(0x123, false, {0x10, 0x0E, 0x14, 0, 0, 0, 0, 0});
+    // Same values.
+    mBus->receive(0x123, false, {0x10, 0x0E, 0x14, 0, 0, 0, 0, 0});
+    // Speed changes by 0.01 km/h, which is below the threshold.
+    mBus->receive(0x123, false, {0x11, 0x0E, 0x14, 0, 0, 0, 0, 0});
+    ASSERT_THAT(mEvents, SizeIs(1));
+
+    // Speed changes by 1 km/h and parking brake is released.
+    mBus->receive(0x123, false, {0x74, 0x0E, 0x04, 0, 0, 0, 0, 0});
+    ASSERT_THAT(mEvents, SizeIs(2));
+    ASSERT_THAT(mEvents[1], SizeIs(2));
+    EXPECT_EQ(kSpeedProp, mEvents[1][0].prop);
+    EXPECT_EQ(kParkingBrakeProp, mEvents[1][1].prop);
+    EXPECT_THAT(mEvents[1][1].value.int32Values, ElementsAre(0));
+}
+
+TEST_F(CanVehicleHardwareTest, testCanFdMessage) {
+    std::vector<uint8_t> payload(64);
+    // -12.3 degC, as 12 bit two's complement.
+    payload[0] = 0x85;
+    payload[1] = 0x0F;
+    mBus->receive(0x18FEF000, true, payload);
+
+    ASSERT_THAT(mEvents, SizeIs(1));
+    ASSERT_THAT(mEvents[0], SizeIs(1));
+    EXPECT_EQ(kCabinTempProp, mEvents[0][0].prop);
+    EXPECT_EQ(kRow1LeftArea, mEvents[0][0].areaId);
+    EXPECT_THAT(mEvents[0][0].value.floatValues, ElementsAre(FloatEq(-12.3f)));
+}
+
+TEST_F(CanVehicleHardwareTest, testDropsUnknownAndShortMessages) {
+    // Known ID, but not an extended one.
+    mBus->receive(0x18FEF000, false, std::vector<uint8_t>(64));
+    // Too short.
+    mBus->receive(0x123, false, {0x10, 0x0E});
+
+    EXPECT_THAT(mEvents, SizeIs(0));
+    EXPECT_EQ(StatusCode::NOT_AVAILABLE, getValues({{.prop = {.prop = kGearProp}}})[0].status);
+}
+
+TEST_F(CanVehicleHardwareTest, testGetValues) {
+    mBus->receive(0x123, false, {0x10, 0x0E, 0x14, 0, 0, 0, 0, 0});
+
+    auto results = getValues({
+            {.requestId = 1, .prop = {.prop = kGearProp}},
+            {.requestId = 2, .prop = {.areaId = kRow1LeftArea, .prop = kCabinTempProp}},
+            {.requestId = 3, .prop = {.prop = kCabinTempProp}},
+    });
+
+    ASSERT_THAT(results, SizeIs(3));
+    EXPECT_EQ(1, results[0].requestId);
+    ASSERT_EQ(StatusCode::OK, results[0].status);
+    EXPECT_THAT(results[0].prop->value.int32Values, ElementsAre(4));
+    EXPECT_EQ(StatusCode::NOT_AVAILABLE, results[1].status);
+    EXPECT_EQ(StatusCode::INVALID_ARG, results[2].status);
+}
+
+TEST_F(CanVehicleHardwareTest, testSetValuesIsDenied) {
+    std::vector<SetValueResult> results;
+    auto callback = std::make_shared<const IVehicleHardware::SetValuesCallback>(
+            [&results](std::vector<SetValueResult> r) { results = std::move(r); });
+
+    ASSERT_EQ(StatusCode::OK,
+              mHardware->setValues(callback, {{.requestId = 1, .value = {.prop = kGearProp}}}));
+
+    ASSERT_THAT(results, SizeIs(1));
+    EXPECT_EQ(StatusCode::ACCESS_DENIED, results[0].status);
+}
+
+TEST_F(CanVehicleHardwareTest, testClosesSubscription) {
+    auto closeHandle = mBus->mCloseHandle;
+    mHardware.reset();
+
+    EXPECT_TRUE(closeHandle->mClosed);
+    // Late messages must not reach the destroyed hardware.
+    mBus->receive(0x123, false, {0x10, 0x0E, 0x14, 0, 0, 0, 0, 0});
+    EXPECT_THAT(mEvents, SizeIs(0));
+}
+
+}  // namespace canbridge
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ConstantValueTable.h>
+#include <EnumConstantsForVehicleProperty.h>
+#include <JsonConfigLoader.h>
+
+#include <android-base/file.h>
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+namespace {
+
+using ::aidl::android::hardware::automotive::vehicle::EnumConstantsForVehicleProperty;
+using ::android::hardware::automotive::vehicle::jsonconfigloader_impl::ConstantValueTable;
+
+constexpr char DEFAULT_PROPERTIES_CONFIG[] = "DefaultProperties.json";
+
+constexpr auto ENUM_CONSTANT_TABLE = [] {
+    ConstantValueTable<std::size(EnumConstantsForVehicleProperty)> table;
+    for (const auto& [name, value] : EnumConstantsForVehicleProperty) {
+        table.insert(name, value);
+    }
+    return table;
+}();
+
+std::string getTestFilePath(const char* filename) {
+    return android::base::GetExecutableDirectory() + "/" + filename;
+}
+
+void BM_LoadDefaultProperties(benchmark::State& state) {
+    std::string content;
+    if (!android::base::ReadFileToString(getTestFilePath(DEFAULT_PROPERTIES_CONFIG), &content)) {
+        state.SkipWithError("failed to read DefaultProperties.json");
+        return;
+    }
+    JsonConfigLoader loader;
+    size_t configCount = 0;
+    for (auto _ : state) {
+        std::istringstream is(content);
+        auto result = loader.loadPropConfig(is);
+        if (!result.ok()) {
+            state.SkipWithError(result.error().message().c_str());
+            return;
+        }
+        configCount = result.value().size();
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["configs"] = configCount;
+    state.SetBytesProcessed(state.iterations() * content.size());
+}
+BENCHMARK(BM_LoadDefaultProperties);
+
+// Baseline: resolves every enum constant through a runtime hash map keyed by std::string, which is
+// how constants used to be resolved.
+void BM_ResolveConstants_UnorderedMap(benchmark::State& state) {
+    std::unordered_map<std::string, int32_t> valueByName;
+    std::vector<std::string> names;
+    for (const auto& [name, value] : EnumConstantsForVehicleProperty) {
+        valueByName[std::string(name)] = value;
+        names.emplace_back(name);
+    }
+    for (auto _ : state) {
+        for (const std::string& name : names) {
+            auto it = valueByName.find(name);
+            benchmark::DoNotOptimize(it);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_ResolveConstants_UnorderedMap);
+
+void BM_ResolveConstants_ConstantValueTable(benchmark::State& state) {
+    std::vector<std::string> names;
+    for (const auto& entry : EnumConstantsForVehicleProperty) {
+        names.emplace_back(entry.first);
+    }
+    for (auto _ : state) {
+        for (const std::string& name : names) {
+            auto value = ENUM_CONSTANT_TABLE.find(name);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_ResolveConstants_ConstantValueTable);
+
+}  // namespace
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
+
+BENCHMARK_MAIN();
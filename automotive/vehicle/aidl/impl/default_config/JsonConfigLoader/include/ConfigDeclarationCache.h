@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef android_hardware_automotive_vehicle_aidl_impl_default_config_JsonConfigLoader_include_ConfigDeclarationCache_H_
+#define android_hardware_automotive_vehicle_aidl_impl_default_config_JsonConfigLoader_include_ConfigDeclarationCache_H_
+
+#include <ConfigDeclaration.h>
+
+#include <android-base/result.h>
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+// A binary cache for the ConfigDeclarations parsed from one JSON config file.
+//
+// The cache file stores the hash of the JSON content it was generated from. Reading the cache
+// maps the file into memory and fails if the file is corrupted or if the stored hash does not
+// match the expected one, in which case the caller should fall back to parsing the JSON file.
+class ConfigDeclarationCache final {
+  public:
+    // Returns the hash of a JSON config file content. The hash also covers the cache format
+    // version, the parser variant and the vendor build fingerprint, so a cache is never reused
+    // across incompatible loaders or after an OTA.
+    static uint64_t hashContent(std::string_view content);
+
+    // Writes the configs to the cache file. The file is replaced atomically.
+    static android::base::Result<void> write(
+            const std::string& cachePath, uint64_t sourceHash,
+            const std::unordered_map<int32_t, ConfigDeclaration>& configsByPropId);
+
+    // Reads the configs from the cache file if it is valid and was generated from content with
+    // {@code sourceHash}.
+    static android::base::Result<std::unordered_map<int32_t, ConfigDeclaration>> read(
+            const std::string& cachePath, uint64_t sourceHash);
+};
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
+
+#endif  // android_hardware_automotive_vehicle_aidl_impl_default_config_JsonConfigLoader_include_ConfigDeclarationCache_H_
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef android_hardware_automotive_vehicle_aidl_impl_default_config_JsonConfigLoader_include_ConstantValueTable_H_
+#define android_hardware_automotive_vehicle_aidl_impl_default_config_JsonConfigLoader_include_ConstantValueTable_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+// private namespace
+namespace jsonconfigloader_impl {
+
+// A fixed-size hash table from constant names to constant values that can be built at compile
+// time. The table uses open addressing with Robin Hood linear probing and is at most half full, so
+// a lookup hashes the name once and compares against a few slots without any allocation.
+template <size_t N>
+class ConstantValueTable final {
+  public:
+    constexpr ConstantValueTable() = default;
+
+    // Inserts a constant. If the name already exists, the first inserted value is kept.
+    constexpr void insert(std::string_view name, int32_t value) {
+        Slot entry = {
+                .name = name,
+                .hash = hashName(name),
+                .value = value,
+                .distance = 0,
+                .occupied = true,
+        };
+        size_t index = entry.hash & (CAPACITY - 1);
+        while (mSlots[index].occupied) {
+            Slot& slot = mSlots[index];
+            if (slot.hash == entry.hash && slot.name == entry.name) {
+                return;
+            }
+            // Robin Hood: the entry that is further away from its home slot takes this slot, which
+            // keeps the longest probe sequence short.
+            if (slot.distance < entry.distance) {
+                std::swap(slot, entry);
+                updateMaxProbes(slot.distance);
+            }
+            index = (index + 1) & (CAPACITY - 1);
+            entry.distance++;
+        }
+        mSlots[index] = entry;
+        updateMaxProbes(entry.distance);
+        mSize++;
+    }
+
+    // Returns the value for the constant name, or std::nullopt if it is not defined.
+    constexpr std::optional<int32_t> find(std::string_view name) const {
+        uint64_t hash = hashName(name);
+        size_t index = hash & (CAPACITY - 1);
+        for (size_t distance = 0; distance < mMaxProbes; distance++) {
+            const Slot& slot = mSlots[index];
+            if (!slot.occupied || slot.distance < distance) {
+                return std::nullopt;
+            }
+            if (slot.hash == hash && slot.name == name) {
+                return slot.value;
+            }
+            index = (index + 1) & (CAPACITY - 1);
+        }
+        return std::nullopt;
+    }
+
+    constexpr size_t size() const { return mSize; }
+
+    // The maximum number of slots a lookup needs to check.
+    constexpr size_t maxProbes() const { return mMaxProbes; }
+
+  private:
+    constexpr void updateMaxProbes(size_t distance) {
+        if (distance + 1 > mMaxProbes) {
+            mMaxProbes = distance + 1;
+        }
+    }
+
+    static constexpr size_t roundUpToPowerOfTwo(size_t n) {
+        size_t result = 1;
+        while (result < n) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    // Hashes the name 8 bytes at a time. In constant evaluation the words are assembled byte by
+    // byte, at runtime full words are loaded directly. Both give the same result on little-endian
+    // targets.
+    static constexpr uint64_t hashName(std::string_view name) {
+        constexpr uint64_t kMultiplier = 0x9e3779b97f4a7c15;
+        uint64_t hash = name.size() * kMultiplier;
+        size_t i = 0;
+        while (i < name.size()) {
+            size_t length = std::min<size_t>(name.size() - i, sizeof(uint64_t));
+            uint64_t word = 0;
+            if (!std::is_constant_evaluated() && length == sizeof(uint64_t)) {
+                std::memcpy(&word, name.data() + i, sizeof(uint64_t));
+            } else {
+                for (size_t j = 0; j < length; j++) {
+                    word |= static_cast<uint64_t>(static_cast<uint8_t>(name[i + j])) << (j * 8);
+                }
+            }
+            i += length;
+            hash = (hash ^ word) * kMultiplier;
+            hash ^= hash >> 29;
+        }
+        // Finalizer from MurmurHash3 so that the low bits used for the slot index are well mixed.
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccd;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    static constexpr size_t CAPACITY = roundUpToPowerOfTwo(N * 2);
+
+    struct Slot {
+        std::string_view name;
+        uint64_t hash = 0;
+        int32_t value = 0;
+        // The distance from the slot the hash maps to.
+        uint32_t distance = 0;
+        bool occupied = false;
+    };
+
+    std::array<Slot, CAPACITY> mSlots = {};
+    size_t mSize = 0;
+    size_t mMaxProbes = 0;
+};
+
+}  // namespace jsonconfigloader_impl
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
+
+#endif  // android_hardware_automotive_vehicle_aidl_impl_default_config_JsonConfigLoader_include_ConstantValueTable_H_
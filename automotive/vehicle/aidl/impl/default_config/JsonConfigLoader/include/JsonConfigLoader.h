@@ -22,6 +22,7 @@
 
 #include <android-base/result.h>
 #include <json/json.h>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -34,22 +35,12 @@ namespace vehicle {
 // private namespace
 namespace jsonconfigloader_impl {
 
-// An abstract interface that represents a ValueParser for any constant value types.
-class ConstantParserInterface {
-  public:
-    // Parses a constant variable name to its actual value.
-    virtual android::base::Result<int> parseValue(const std::string& name) const = 0;
-    virtual ~ConstantParserInterface() = default;
-};
-
 // A class to parse a value field in JSON config file.
 // If the field is a string and the field is in the format of "XX::XX", the value will be parsed
 // as a constant value in the format of "TYPE::NAME". Otherwise, the field will be return as is
 // converted to the expected type.
 class JsonValueParser final {
   public:
-    JsonValueParser();
-
     android::base::Result<std::string> parseStringValue(const std::string& fieldName,
                                                         const Json::Value& value) const;
 
@@ -66,24 +57,12 @@ class JsonValueParser final {
     static android::base::Result<T> convertValueToType(const std::string& fieldName,
                                                        const Json::Value& value);
 
-    std::optional<std::pair<std::string, std::string>> maybeGetTypeAndValueName(
-            const std::string& jsonFieldValue) const;
-
-    android::base::Result<int> parseConstantValue(
-            const std::pair<std::string, std::string>& typeValueName) const;
-
-    const ConstantParserInterface* getParser(const std::string& type) const {
-        auto it = mConstantParsersByType.find(type);
-        if (it == mConstantParsersByType.end()) {
-            return nullptr;
-        }
-        return it->second.get();
-    }
+    // Parses a constant in the format of "TYPE::NAME" to its value. The lookup uses a table that
+    // is generated at compile time from the AIDL enums and does not allocate.
+    static android::base::Result<int> parseConstantValue(std::string_view typeValueName);
 
   private:
-    inline static const std::string DELIMITER = "::";
-    std::unordered_map<std::string, std::unique_ptr<ConstantParserInterface>>
-            mConstantParsersByType;
+    static constexpr std::string_view DELIMITER = "::";
 };
 
 // The main class to parse a VHAL config file in JSON format.
@@ -164,6 +143,12 @@ class JsonConfigLoader final {
     android::base::Result<std::unordered_map<int32_t, ConfigDeclaration>> loadPropConfig(
             const std::string& configPath);
 
+    // Loads a JSON config file using the binary cache at cachePath. If the cache is missing or was
+    // generated from a different version of the config file, the config file is parsed and the
+    // cache is regenerated. Failing to write the cache is not an error.
+    android::base::Result<std::unordered_map<int32_t, ConfigDeclaration>> loadPropConfig(
+            const std::string& configPath, const std::string& cachePath);
+
   private:
     std::unique_ptr<jsonconfigloader_impl::JsonConfigParser> mParser;
 };
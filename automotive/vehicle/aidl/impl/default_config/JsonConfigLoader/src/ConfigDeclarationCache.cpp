@@ -0,0 +1,390 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ConfigDeclarationCache.h>
+
+#include <VehicleUtils.h>
+#include <android-base/file.h>
+#include <android-base/properties.h>
+#include <android-base/unique_fd.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+#include <type_traits>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+namespace {
+
+using ::aidl::android::hardware::automotive::vehicle::RawPropValues;
+using ::aidl::android::hardware::automotive::vehicle::VehicleAreaConfig;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropConfig;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropertyAccess;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropertyChangeMode;
+
+using ::android::base::Error;
+using ::android::base::ErrnoError;
+using ::android::base::Result;
+using ::android::base::unique_fd;
+
+// "VHCC" in little endian.
+constexpr uint32_t CACHE_MAGIC = 0x43434856;
+// Must be increased whenever the layout of the cache or of ConfigDeclaration changes.
+constexpr uint32_t CACHE_VERSION = 1;
+// The parsed configs also depend on the constant tables and the parser compiled into the vendor
+// image, so a cache is never reused across vendor builds.
+constexpr char BUILD_FINGERPRINT_PROPERTY[] = "ro.vendor.build.fingerprint";
+
+#ifdef ENABLE_VEHICLE_HAL_TEST_PROPERTIES
+constexpr uint64_t PARSER_VARIANT = 1;
+#else
+constexpr uint64_t PARSER_VARIANT = 0;
+#endif  // ENABLE_VEHICLE_HAL_TEST_PROPERTIES
+
+struct CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t sourceHash;
+    uint64_t payloadSize;
+    uint32_t configCount;
+    uint32_t reserved;
+};
+
+// Appends values to a byte buffer in host byte order. The cache is only ever read on the device
+// that wrote it.
+class CacheWriter final {
+  public:
+    template <class T>
+    void write(T value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const char* p = reinterpret_cast<const char*>(&value);
+        mBuffer.append(p, sizeof(T));
+    }
+
+    template <class T>
+    void writeVector(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        write<uint32_t>(values.size());
+        mBuffer.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    void writeString(const std::string& value) {
+        write<uint32_t>(value.size());
+        mBuffer.append(value);
+    }
+
+    void writeRawPropValues(const RawPropValues& values) {
+        writeVector(values.int32Values);
+        writeVector(values.floatValues);
+        writeVector(values.int64Values);
+        writeVector(values.byteValues);
+        writeString(values.stringValue);
+    }
+
+    void writeAreaConfig(const VehicleAreaConfig& areaConfig) {
+        write(areaConfig.areaId);
+        write(areaConfig.minInt32Value);
+        write(areaConfig.maxInt32Value);
+        write(areaConfig.minInt64Value);
+        write(areaConfig.maxInt64Value);
+        write(areaConfig.minFloatValue);
+        write(areaConfig.maxFloatValue);
+        write<uint8_t>(areaConfig.supportedEnumValues.has_value());
+        if (areaConfig.supportedEnumValues.has_value()) {
+            writeVector(*areaConfig.supportedEnumValues);
+        }
+    }
+
+    void writeConfigDeclaration(const ConfigDeclaration& configDeclaration) {
+        const VehiclePropConfig& config = configDeclaration.config;
+        write(config.prop);
+        write(toInt(config.access));
+        write(toInt(config.changeMode));
+        write<uint32_t>(config.areaConfigs.size());
+        for (const auto& areaConfig : config.areaConfigs) {
+            writeAreaConfig(areaConfig);
+        }
+        writeVector(config.configArray);
+        writeString(config.configString);
+        write(config.minSampleRate);
+        write(config.maxSampleRate);
+        writeRawPropValues(configDeclaration.initialValue);
+        write<uint32_t>(configDeclaration.initialAreaValues.size());
+        for (const auto& [areaId, values] : configDeclaration.initialAreaValues) {
+            write(areaId);
+            writeRawPropValues(values);
+        }
+    }
+
+    const std::string& buffer() const { return mBuffer; }
+
+  private:
+    std::string mBuffer;
+};
+
+// Reads values from a memory region with bounds checking. Once a read fails, all the following
+// reads fail.
+class CacheReader final {
+  public:
+    CacheReader(const uint8_t* data, size_t size) : mCur(data), mEnd(data + size) {}
+
+    template <class T>
+    bool read(T* out) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (!ensureAvailable(sizeof(T))) {
+            return false;
+        }
+        memcpy(out, mCur, sizeof(T));
+        mCur += sizeof(T);
+        return true;
+    }
+
+    template <class T>
+    bool readVector(std::vector<T>* out) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        uint32_t size;
+        if (!read(&size) || !ensureAvailable(static_cast<size_t>(size) * sizeof(T))) {
+            return false;
+        }
+        out->resize(size);
+        memcpy(out->data(), mCur, size * sizeof(T));
+        mCur += size * sizeof(T);
+        return true;
+    }
+
+    bool readString(std::string* out) {
+        uint32_t size;
+        if (!read(&size) || !ensureAvailable(size)) {
+            return false;
+        }
+        out->assign(reinterpret_cast<const char*>(mCur), size);
+        mCur += size;
+        return true;
+    }
+
+    bool readRawPropValues(RawPropValues* out) {
+        return readVector(&out->int32Values) && readVector(&out->floatValues) &&
+               readVector(&out->int64Values) && readVector(&out->byteValues) &&
+               readString(&out->stringValue);
+    }
+
+    bool readAreaConfig(VehicleAreaConfig* out) {
+        uint8_t hasSupportedEnumValues;
+        if (!read(&out->areaId) || !read(&out->minInt32Value) || !read(&out->maxInt32Value) ||
+            !read(&out->minInt64Value) || !read(&out->maxInt64Value) ||
+            !read(&out->minFloatValue) || !read(&out->maxFloatValue) ||
+            !read(&hasSupportedEnumValues)) {
+            return false;
+        }
+        if (hasSupportedEnumValues) {
+            out->supportedEnumValues = std::vector<int64_t>();
+            return readVector(&*out->supportedEnumValues);
+        }
+        return true;
+    }
+
+    bool readConfigDeclaration(ConfigDeclaration* out) {
+        VehiclePropConfig& config = out->config;
+        int32_t access;
+        int32_t changeMode;
+        uint32_t areaConfigCount;
+        if (!read(&config.prop) || !read(&access) || !read(&changeMode) ||
+            !read(&areaConfigCount)) {
+            return false;
+        }
+        config.access = static_cast<VehiclePropertyAccess>(access);
+        config.changeMode = static_cast<VehiclePropertyChangeMode>(changeMode);
+        for (uint32_t i = 0; i < areaConfigCount; i++) {
+            VehicleAreaConfig areaConfig;
+            if (!readAreaConfig(&areaConfig)) {
+                return false;
+            }
+            config.areaConfigs.push_back(std::move(areaConfig));
+        }
+        uint32_t initialAreaValueCount;
+        if (!readVector(&config.configArray) || !readString(&config.configString) ||
+            !read(&config.minSampleRate) || !read(&config.maxSampleRate) ||
+            !readRawPropValues(&out->initialValue) || !read(&initialAreaValueCount)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < initialAreaValueCount; i++) {
+            int32_t areaId;
+            RawPropValues values;
+            if (!read(&areaId) || !readRawPropValues(&values)) {
+                return false;
+            }
+            out->initialAreaValues[areaId] = std::move(values);
+        }
+        return true;
+    }
+
+    bool atEnd() const { return mCur == mEnd; }
+
+  private:
+    const uint8_t* mCur;
+    const uint8_t* mEnd;
+
+    bool ensureAvailable(size_t size) {
+        if (mCur == nullptr || static_cast<size_t>(mEnd - mCur) < size) {
+            mCur = nullptr;
+            mEnd = nullptr;
+            return false;
+        }
+        return true;
+    }
+};
+
+// Unmaps the memory region on destruction.
+class ScopedMmap final {
+  public:
+    ScopedMmap(void* addr, size_t size) : mAddr(addr), mSize(size) {}
+    ~ScopedMmap() {
+        if (mAddr != MAP_FAILED) {
+            munmap(mAddr, mSize);
+        }
+    }
+
+  private:
+    void* mAddr;
+    size_t mSize;
+};
+
+}  // namespace
+
+uint64_t ConfigDeclarationCache::hashContent(std::string_view content) {
+    // 64-bit FNV-1a.
+    uint64_t hash = 0xcbf29ce484222325;
+    auto mix = [&hash](uint8_t byte) {
+        hash ^= byte;
+        hash *= 0x100000001b3;
+    };
+    for (char c : content) {
+        mix(static_cast<uint8_t>(c));
+    }
+    // Include the terminator so that the content and the fingerprint can't be confused.
+    mix(0);
+    for (char c : android::base::GetProperty(BUILD_FINGERPRINT_PROPERTY, "")) {
+        mix(static_cast<uint8_t>(c));
+    }
+    for (uint64_t salt : {static_cast<uint64_t>(CACHE_VERSION), PARSER_VARIANT}) {
+        for (size_t i = 0; i < sizeof(salt); i++) {
+            mix(static_cast<uint8_t>(salt >> (i * 8)));
+        }
+    }
+    return hash;
+}
+
+Result<void> ConfigDeclarationCache::write(
+        const std::string& cachePath, uint64_t sourceHash,
+        const std::unordered_map<int32_t, ConfigDeclaration>& configsByPropId) {
+    CacheWriter writer;
+    for (const auto& [_, configDeclaration] : configsByPropId) {
+        writer.writeConfigDeclaration(configDeclaration);
+    }
+    CacheHeader header = {
+            .magic = CACHE_MAGIC,
+            .version = CACHE_VERSION,
+            .sourceHash = sourceHash,
+            .payloadSize = writer.buffer().size(),
+            .configCount = static_cast<uint32_t>(configsByPropId.size()),
+            .reserved = 0,
+    };
+
+    // Write to a temporary file first so that a reader never sees a partially written cache.
+    std::string tmpPath = cachePath + ".tmp";
+    unique_fd fd(TEMP_FAILURE_RETRY(
+            open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600)));
+    if (fd.get() < 0) {
+        return ErrnoError() << "failed to create cache file: " << tmpPath;
+    }
+    if (!android::base::WriteFully(fd.get(), &header, sizeof(header)) ||
+        !android::base::WriteFully(fd.get(), writer.buffer().data(), writer.buffer().size()) ||
+        fsync(fd.get()) != 0) {
+        auto error = ErrnoError() << "failed to write cache file: " << tmpPath;
+        unlink(tmpPath.c_str());
+        return error;
+    }
+    fd.reset();
+    if (rename(tmpPath.c_str(), cachePath.c_str()) != 0) {
+        auto error = ErrnoError() << "failed to rename cache file to: " << cachePath;
+        unlink(tmpPath.c_str());
+        return error;
+    }
+    return {};
+}
+
+Result<std::unordered_map<int32_t, ConfigDeclaration>> ConfigDeclarationCache::read(
+        const std::string& cachePath, uint64_t sourceHash) {
+    unique_fd fd(TEMP_FAILURE_RETRY(open(cachePath.c_str(), O_RDONLY | O_CLOEXEC)));
+    if (fd.get() < 0) {
+        return ErrnoError() << "failed to open cache file: " << cachePath;
+    }
+    struct stat st;
+    if (fstat(fd.get(), &st) != 0) {
+        return ErrnoError() << "failed to stat cache file: " << cachePath;
+    }
+    size_t fileSize = static_cast<size_t>(st.st_size);
+    if (fileSize < sizeof(CacheHeader)) {
+        return Error() << "cache file: " << cachePath << " is too small";
+    }
+    void* addr = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd.get(), 0);
+    if (addr == MAP_FAILED) {
+        return ErrnoError() << "failed to mmap cache file: " << cachePath;
+    }
+    ScopedMmap scopedMmap(addr, fileSize);
+
+    const uint8_t* data = static_cast<const uint8_t*>(addr);
+    CacheHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != CACHE_MAGIC || header.version != CACHE_VERSION) {
+        return Error() << "cache file: " << cachePath << " has an unsupported format";
+    }
+    if (header.sourceHash != sourceHash) {
+        return Error() << "cache file: " << cachePath << " is stale";
+    }
+    if (header.payloadSize != fileSize - sizeof(CacheHeader)) {
+        return Error() << "cache file: " << cachePath << " is truncated";
+    }
+
+    CacheReader reader(data + sizeof(CacheHeader), header.payloadSize);
+    std::unordered_map<int32_t, ConfigDeclaration> configsByPropId;
+    configsByPropId.reserve(header.configCount);
+    for (uint32_t i = 0; i < header.configCount; i++) {
+        ConfigDeclaration configDeclaration;
+        if (!reader.readConfigDeclaration(&configDeclaration)) {
+            return Error() << "cache file: " << cachePath << " is corrupted";
+        }
+        int32_t propId = configDeclaration.config.prop;
+        configsByPropId[propId] = std::move(configDeclaration);
+    }
+    if (!reader.atEnd()) {
+        return Error() << "cache file: " << cachePath << " has trailing data";
+    }
+    return configsByPropId;
+}
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
@@ -14,18 +14,27 @@
  * limitations under the License.
  */
 
+#define LOG_TAG "JsonConfigLoader"
+
 #include <JsonConfigLoader.h>
 
 #include <AccessForVehicleProperty.h>
 #include <ChangeModeForVehicleProperty.h>
+#include <ConfigDeclarationCache.h>
+#include <ConstantValueTable.h>
+#include <EnumConstantsForVehicleProperty.h>
 #include <PropertyUtils.h>
 
 #ifdef ENABLE_VEHICLE_HAL_TEST_PROPERTIES
 #include <TestPropertyUtils.h>
 #endif  // ENABLE_VEHICLE_HAL_TEST_PROPERTIES
 
+#include <android-base/file.h>
 #include <android-base/strings.h>
+#include <utils/Log.h>
+
 #include <fstream>
+#include <sstream>
 
 namespace android {
 namespace hardware {
@@ -35,232 +44,101 @@ namespace vehicle {
 namespace jsonconfigloader_impl {
 
 using ::aidl::android::hardware::automotive::vehicle::AccessForVehicleProperty;
-using ::aidl::android::hardware::automotive::vehicle::AutomaticEmergencyBrakingState;
-using ::aidl::android::hardware::automotive::vehicle::BlindSpotWarningState;
 using ::aidl::android::hardware::automotive::vehicle::ChangeModeForVehicleProperty;
-using ::aidl::android::hardware::automotive::vehicle::CruiseControlCommand;
-using ::aidl::android::hardware::automotive::vehicle::CruiseControlState;
-using ::aidl::android::hardware::automotive::vehicle::CruiseControlType;
-using ::aidl::android::hardware::automotive::vehicle::EmergencyLaneKeepAssistState;
-using ::aidl::android::hardware::automotive::vehicle::ErrorState;
-using ::aidl::android::hardware::automotive::vehicle::EvConnectorType;
-using ::aidl::android::hardware::automotive::vehicle::EvsServiceState;
-using ::aidl::android::hardware::automotive::vehicle::EvsServiceType;
-using ::aidl::android::hardware::automotive::vehicle::ForwardCollisionWarningState;
-using ::aidl::android::hardware::automotive::vehicle::FuelType;
-using ::aidl::android::hardware::automotive::vehicle::GsrComplianceRequirementType;
-using ::aidl::android::hardware::automotive::vehicle::HandsOnDetectionDriverState;
-using ::aidl::android::hardware::automotive::vehicle::HandsOnDetectionWarning;
-using ::aidl::android::hardware::automotive::vehicle::LaneCenteringAssistCommand;
-using ::aidl::android::hardware::automotive::vehicle::LaneCenteringAssistState;
-using ::aidl::android::hardware::automotive::vehicle::LaneDepartureWarningState;
-using ::aidl::android::hardware::automotive::vehicle::LaneKeepAssistState;
-using ::aidl::android::hardware::automotive::vehicle::LocationCharacterization;
+using ::aidl::android::hardware::automotive::vehicle::EnumConstantsForVehicleProperty;
 using ::aidl::android::hardware::automotive::vehicle::RawPropValues;
-using ::aidl::android::hardware::automotive::vehicle::VehicleApPowerStateReport;
-using ::aidl::android::hardware::automotive::vehicle::VehicleApPowerStateReq;
 using ::aidl::android::hardware::automotive::vehicle::VehicleAreaConfig;
 using ::aidl::android::hardware::automotive::vehicle::VehicleAreaMirror;
-using ::aidl::android::hardware::automotive::vehicle::VehicleAreaWindow;
-using ::aidl::android::hardware::automotive::vehicle::VehicleGear;
 using ::aidl::android::hardware::automotive::vehicle::VehicleHvacFanDirection;
-using ::aidl::android::hardware::automotive::vehicle::VehicleIgnitionState;
-using ::aidl::android::hardware::automotive::vehicle::VehicleOilLevel;
-using ::aidl::android::hardware::automotive::vehicle::VehiclePropConfig;
 using ::aidl::android::hardware::automotive::vehicle::VehicleProperty;
-using ::aidl::android::hardware::automotive::vehicle::VehiclePropertyAccess;
-using ::aidl::android::hardware::automotive::vehicle::VehiclePropertyChangeMode;
-using ::aidl::android::hardware::automotive::vehicle::VehicleSeatOccupancyState;
-using ::aidl::android::hardware::automotive::vehicle::VehicleTurnSignal;
-using ::aidl::android::hardware::automotive::vehicle::VehicleUnit;
-using ::aidl::android::hardware::automotive::vehicle::VehicleVendorPermission;
-using ::aidl::android::hardware::automotive::vehicle::WindshieldWipersState;
-using ::aidl::android::hardware::automotive::vehicle::WindshieldWipersSwitch;
 
 using ::android::base::Error;
 using ::android::base::Result;
 
-// Defines a map from constant names to constant values, the values defined here corresponds to
+// Defines a list of constant names to constant values, the values defined here corresponds to
 // the "Constants::XXXX" used in JSON config file.
-const std::unordered_map<std::string, int> CONSTANTS_BY_NAME = {
-        {"DOOR_1_RIGHT", DOOR_1_RIGHT},
-        {"DOOR_1_LEFT", DOOR_1_LEFT},
-        {"DOOR_2_RIGHT", DOOR_2_RIGHT},
-        {"DOOR_2_LEFT", DOOR_2_LEFT},
-        {"DOOR_REAR", DOOR_REAR},
-        {"HVAC_ALL", HVAC_ALL},
-        {"HVAC_LEFT", HVAC_LEFT},
-        {"HVAC_RIGHT", HVAC_RIGHT},
-        {"VENDOR_EXTENSION_INT_PROPERTY", VENDOR_EXTENSION_INT_PROPERTY},
-        {"VENDOR_EXTENSION_BOOLEAN_PROPERTY", VENDOR_EXTENSION_BOOLEAN_PROPERTY},
-        {"VENDOR_EXTENSION_STRING_PROPERTY", VENDOR_EXTENSION_STRING_PROPERTY},
-        {"VENDOR_EXTENSION_FLOAT_PROPERTY", VENDOR_EXTENSION_FLOAT_PROPERTY},
-        {"WINDOW_1_LEFT", WINDOW_1_LEFT},
-        {"WINDOW_1_RIGHT", WINDOW_1_RIGHT},
-        {"WINDOW_2_LEFT", WINDOW_2_LEFT},
-        {"WINDOW_2_RIGHT", WINDOW_2_RIGHT},
-        {"WINDOW_ROOF_TOP_1", WINDOW_ROOF_TOP_1},
-        {"WINDOW_1_RIGHT_2_LEFT_2_RIGHT", WINDOW_1_RIGHT | WINDOW_2_LEFT | WINDOW_2_RIGHT},
-        {"SEAT_1_LEFT", SEAT_1_LEFT},
-        {"SEAT_1_RIGHT", SEAT_1_RIGHT},
-        {"SEAT_2_LEFT", SEAT_2_LEFT},
-        {"SEAT_2_RIGHT", SEAT_2_RIGHT},
-        {"SEAT_2_CENTER", SEAT_2_CENTER},
-        {"SEAT_2_LEFT_2_RIGHT_2_CENTER", SEAT_2_LEFT | SEAT_2_RIGHT | SEAT_2_CENTER},
-        {"WHEEL_REAR_RIGHT", WHEEL_REAR_RIGHT},
-        {"WHEEL_REAR_LEFT", WHEEL_REAR_LEFT},
-        {"WHEEL_FRONT_RIGHT", WHEEL_FRONT_RIGHT},
-        {"WHEEL_FRONT_LEFT", WHEEL_FRONT_LEFT},
-        {"CHARGE_PORT_FRONT_LEFT", CHARGE_PORT_FRONT_LEFT},
-        {"CHARGE_PORT_REAR_LEFT", CHARGE_PORT_REAR_LEFT},
-        {"FAN_DIRECTION_UNKNOWN", toInt(VehicleHvacFanDirection::UNKNOWN)},
-        {"FAN_DIRECTION_FLOOR", FAN_DIRECTION_FLOOR},
-        {"FAN_DIRECTION_FACE", FAN_DIRECTION_FACE},
-        {"FAN_DIRECTION_DEFROST", FAN_DIRECTION_DEFROST},
-        {"FAN_DIRECTION_FACE_FLOOR", FAN_DIRECTION_FACE | FAN_DIRECTION_FLOOR},
-        {"FAN_DIRECTION_FACE_DEFROST", FAN_DIRECTION_FACE | FAN_DIRECTION_DEFROST},
-        {"FAN_DIRECTION_FLOOR_DEFROST", FAN_DIRECTION_FLOOR | FAN_DIRECTION_DEFROST},
-        {"FAN_DIRECTION_FLOOR_DEFROST_FACE",
+constexpr std::pair<std::string_view, int32_t> CONSTANTS_BY_NAME[] = {
+        {"Constants::DOOR_1_RIGHT", DOOR_1_RIGHT},
+        {"Constants::DOOR_1_LEFT", DOOR_1_LEFT},
+        {"Constants::DOOR_2_RIGHT", DOOR_2_RIGHT},
+        {"Constants::DOOR_2_LEFT", DOOR_2_LEFT},
+        {"Constants::DOOR_REAR", DOOR_REAR},
+        {"Constants::HVAC_ALL", HVAC_ALL},
+        {"Constants::HVAC_LEFT", HVAC_LEFT},
+        {"Constants::HVAC_RIGHT", HVAC_RIGHT},
+        {"Constants::VENDOR_EXTENSION_INT_PROPERTY", VENDOR_EXTENSION_INT_PROPERTY},
+        {"Constants::VENDOR_EXTENSION_BOOLEAN_PROPERTY", VENDOR_EXTENSION_BOOLEAN_PROPERTY},
+        {"Constants::VENDOR_EXTENSION_STRING_PROPERTY", VENDOR_EXTENSION_STRING_PROPERTY},
+        {"Constants::VENDOR_EXTENSION_FLOAT_PROPERTY", VENDOR_EXTENSION_FLOAT_PROPERTY},
+        {"Constants::WINDOW_1_LEFT", WINDOW_1_LEFT},
+        {"Constants::WINDOW_1_RIGHT", WINDOW_1_RIGHT},
+        {"Constants::WINDOW_2_LEFT", WINDOW_2_LEFT},
+        {"Constants::WINDOW_2_RIGHT", WINDOW_2_RIGHT},
+        {"Constants::WINDOW_ROOF_TOP_1", WINDOW_ROOF_TOP_1},
+        {"Constants::WINDOW_1_RIGHT_2_LEFT_2_RIGHT",
+         WINDOW_1_RIGHT | WINDOW_2_LEFT | WINDOW_2_RIGHT},
+        {"Constants::SEAT_1_LEFT", SEAT_1_LEFT},
+        {"Constants::SEAT_1_RIGHT", SEAT_1_RIGHT},
+        {"Constants::SEAT_2_LEFT", SEAT_2_LEFT},
+        {"Constants::SEAT_2_RIGHT", SEAT_2_RIGHT},
+        {"Constants::SEAT_2_CENTER", SEAT_2_CENTER},
+        {"Constants::SEAT_2_LEFT_2_RIGHT_2_CENTER", SEAT_2_LEFT | SEAT_2_RIGHT | SEAT_2_CENTER},
+        {"Constants::WHEEL_REAR_RIGHT", WHEEL_REAR_RIGHT},
+        {"Constants::WHEEL_REAR_LEFT", WHEEL_REAR_LEFT},
+        {"Constants::WHEEL_FRONT_RIGHT", WHEEL_FRONT_RIGHT},
+        {"Constants::WHEEL_FRONT_LEFT", WHEEL_FRONT_LEFT},
+        {"Constants::CHARGE_PORT_FRONT_LEFT", CHARGE_PORT_FRONT_LEFT},
+        {"Constants::CHARGE_PORT_REAR_LEFT", CHARGE_PORT_REAR_LEFT},
+        {"Constants::FAN_DIRECTION_UNKNOWN", toInt(VehicleHvacFanDirection::UNKNOWN)},
+        {"Constants::FAN_DIRECTION_FLOOR", FAN_DIRECTION_FLOOR},
+        {"Constants::FAN_DIRECTION_FACE", FAN_DIRECTION_FACE},
+        {"Constants::FAN_DIRECTION_DEFROST", FAN_DIRECTION_DEFROST},
+        {"Constants::FAN_DIRECTION_FACE_FLOOR", FAN_DIRECTION_FACE | FAN_DIRECTION_FLOOR},
+        {"Constants::FAN_DIRECTION_FACE_DEFROST", FAN_DIRECTION_FACE | FAN_DIRECTION_DEFROST},
+        {"Constants::FAN_DIRECTION_FLOOR_DEFROST", FAN_DIRECTION_FLOOR | FAN_DIRECTION_DEFROST},
+        {"Constants::FAN_DIRECTION_FLOOR_DEFROST_FACE",
          FAN_DIRECTION_FLOOR | FAN_DIRECTION_DEFROST | FAN_DIRECTION_FACE},
-        {"FUEL_DOOR_REAR_LEFT", FUEL_DOOR_REAR_LEFT},
-        {"LIGHT_STATE_ON", LIGHT_STATE_ON},
-        {"LIGHT_STATE_OFF", LIGHT_STATE_OFF},
-        {"LIGHT_SWITCH_OFF", LIGHT_SWITCH_OFF},
-        {"LIGHT_SWITCH_ON", LIGHT_SWITCH_ON},
-        {"LIGHT_SWITCH_AUTO", LIGHT_SWITCH_AUTO},
-        {"EV_STOPPING_MODE_CREEP", EV_STOPPING_MODE_CREEP},
-        {"EV_STOPPING_MODE_ROLL", EV_STOPPING_MODE_ROLL},
-        {"EV_STOPPING_MODE_HOLD", EV_STOPPING_MODE_HOLD},
-        {"MIRROR_DRIVER_LEFT_RIGHT",
+        {"Constants::FUEL_DOOR_REAR_LEFT", FUEL_DOOR_REAR_LEFT},
+        {"Constants::LIGHT_STATE_ON", LIGHT_STATE_ON},
+        {"Constants::LIGHT_STATE_OFF", LIGHT_STATE_OFF},
+        {"Constants::LIGHT_SWITCH_OFF", LIGHT_SWITCH_OFF},
+        {"Constants::LIGHT_SWITCH_ON", LIGHT_SWITCH_ON},
+        {"Constants::LIGHT_SWITCH_AUTO", LIGHT_SWITCH_AUTO},
+        {"Constants::EV_STOPPING_MODE_CREEP", EV_STOPPING_MODE_CREEP},
+        {"Constants::EV_STOPPING_MODE_ROLL", EV_STOPPING_MODE_ROLL},
+        {"Constants::EV_STOPPING_MODE_HOLD", EV_STOPPING_MODE_HOLD},
+        {"Constants::MIRROR_DRIVER_LEFT_RIGHT",
          toInt(VehicleAreaMirror::DRIVER_LEFT) | toInt(VehicleAreaMirror::DRIVER_RIGHT)},
 #ifdef ENABLE_VEHICLE_HAL_TEST_PROPERTIES
         // Following are test properties:
-        {"ECHO_REVERSE_BYTES", ECHO_REVERSE_BYTES},
-        {"VENDOR_PROPERTY_ID", VENDOR_PROPERTY_ID},
-        {"kMixedTypePropertyForTest", kMixedTypePropertyForTest},
-        {"VENDOR_CLUSTER_NAVIGATION_STATE", VENDOR_CLUSTER_NAVIGATION_STATE},
-        {"VENDOR_CLUSTER_REQUEST_DISPLAY", VENDOR_CLUSTER_REQUEST_DISPLAY},
-        {"VENDOR_CLUSTER_SWITCH_UI", VENDOR_CLUSTER_SWITCH_UI},
-        {"VENDOR_CLUSTER_DISPLAY_STATE", VENDOR_CLUSTER_DISPLAY_STATE},
-        {"VENDOR_CLUSTER_REPORT_STATE", VENDOR_CLUSTER_REPORT_STATE},
-        {"PLACEHOLDER_PROPERTY_INT", PLACEHOLDER_PROPERTY_INT},
-        {"PLACEHOLDER_PROPERTY_FLOAT", PLACEHOLDER_PROPERTY_FLOAT},
-        {"PLACEHOLDER_PROPERTY_BOOLEAN", PLACEHOLDER_PROPERTY_BOOLEAN},
-        {"PLACEHOLDER_PROPERTY_STRING", PLACEHOLDER_PROPERTY_STRING}
+        {"Constants::ECHO_REVERSE_BYTES", ECHO_REVERSE_BYTES},
+        {"Constants::VENDOR_PROPERTY_ID", VENDOR_PROPERTY_ID},
+        {"Constants::kMixedTypePropertyForTest", kMixedTypePropertyForTest},
+        {"Constants::VENDOR_CLUSTER_NAVIGATION_STATE", VENDOR_CLUSTER_NAVIGATION_STATE},
+        {"Constants::VENDOR_CLUSTER_REQUEST_DISPLAY", VENDOR_CLUSTER_REQUEST_DISPLAY},
+        {"Constants::VENDOR_CLUSTER_SWITCH_UI", VENDOR_CLUSTER_SWITCH_UI},
+        {"Constants::VENDOR_CLUSTER_DISPLAY_STATE", VENDOR_CLUSTER_DISPLAY_STATE},
+        {"Constants::VENDOR_CLUSTER_REPORT_STATE", VENDOR_CLUSTER_REPORT_STATE},
+        {"Constants::PLACEHOLDER_PROPERTY_INT", PLACEHOLDER_PROPERTY_INT},
+        {"Constants::PLACEHOLDER_PROPERTY_FLOAT", PLACEHOLDER_PROPERTY_FLOAT},
+        {"Constants::PLACEHOLDER_PROPERTY_BOOLEAN", PLACEHOLDER_PROPERTY_BOOLEAN},
+        {"Constants::PLACEHOLDER_PROPERTY_STRING", PLACEHOLDER_PROPERTY_STRING}
 #endif  // ENABLE_VEHICLE_HAL_TEST_PROPERTIES
 };
 
-// A class to parse constant values for type T.
-template <class T>
-class ConstantParser final : public ConstantParserInterface {
-  public:
-    ConstantParser() {
-        for (const T& v : ndk::enum_range<T>()) {
-            std::string name = aidl::android::hardware::automotive::vehicle::toString(v);
-            // We use the same constant for both VehicleUnit::GALLON and VehicleUnit::US_GALLON,
-            // which caused toString() not work properly for US_GALLON. So we explicitly add the
-            // map here.
-            if (name == "GALLON") {
-                mValueByName["US_GALLON"] = toInt(v);
-            }
-            mValueByName[name] = toInt(v);
-        }
+// All the constants that could be used in JSON config file in the format of "TYPE::NAME". The
+// table is built at compile time.
+constexpr auto CONSTANT_VALUE_TABLE = [] {
+    ConstantValueTable<std::size(EnumConstantsForVehicleProperty) + std::size(CONSTANTS_BY_NAME)>
+            table;
+    for (const auto& [name, value] : EnumConstantsForVehicleProperty) {
+        table.insert(name, value);
     }
-
-    ~ConstantParser() = default;
-
-    Result<int> parseValue(const std::string& name) const override {
-        auto it = mValueByName.find(name);
-        if (it == mValueByName.end()) {
-            return Error() << "Constant name: " << name << " is not defined";
-        }
-        return it->second;
+    for (const auto& [name, value] : CONSTANTS_BY_NAME) {
+        table.insert(name, value);
     }
-
-  private:
-    std::unordered_map<std::string, int> mValueByName;
-};
-
-// A class to parse constant values defined in CONSTANTS_BY_NAME map.
-class LocalVariableParser final : public ConstantParserInterface {
-  public:
-    ~LocalVariableParser() = default;
-
-    Result<int> parseValue(const std::string& name) const override {
-        auto constantsIt = CONSTANTS_BY_NAME.find(name);
-        if (constantsIt == CONSTANTS_BY_NAME.end()) {
-            return Error() << "Constant variable name: " << name << " is not defined";
-        }
-        return constantsIt->second;
-    }
-};
-
-JsonValueParser::JsonValueParser() {
-    mConstantParsersByType["VehiclePropertyAccess"] =
-            std::make_unique<ConstantParser<VehiclePropertyAccess>>();
-    mConstantParsersByType["VehiclePropertyChangeMode"] =
-            std::make_unique<ConstantParser<VehiclePropertyChangeMode>>();
-    mConstantParsersByType["LocationCharacterization"] =
-            std::make_unique<ConstantParser<LocationCharacterization>>();
-    mConstantParsersByType["VehicleGear"] = std::make_unique<ConstantParser<VehicleGear>>();
-    mConstantParsersByType["VehicleAreaWindow"] =
-            std::make_unique<ConstantParser<VehicleAreaWindow>>();
-    mConstantParsersByType["VehicleAreaMirror"] =
-            std::make_unique<ConstantParser<VehicleAreaMirror>>();
-    mConstantParsersByType["VehicleOilLevel"] = std::make_unique<ConstantParser<VehicleOilLevel>>();
-    mConstantParsersByType["VehicleUnit"] = std::make_unique<ConstantParser<VehicleUnit>>();
-    mConstantParsersByType["VehicleSeatOccupancyState"] =
-            std::make_unique<ConstantParser<VehicleSeatOccupancyState>>();
-    mConstantParsersByType["VehicleHvacFanDirection"] =
-            std::make_unique<ConstantParser<VehicleHvacFanDirection>>();
-    mConstantParsersByType["VehicleApPowerStateReport"] =
-            std::make_unique<ConstantParser<VehicleApPowerStateReport>>();
-    mConstantParsersByType["VehicleTurnSignal"] =
-            std::make_unique<ConstantParser<VehicleTurnSignal>>();
-    mConstantParsersByType["VehicleVendorPermission"] =
-            std::make_unique<ConstantParser<VehicleVendorPermission>>();
-    mConstantParsersByType["EvsServiceType"] = std::make_unique<ConstantParser<EvsServiceType>>();
-    mConstantParsersByType["EvsServiceState"] = std::make_unique<ConstantParser<EvsServiceState>>();
-    mConstantParsersByType["EvConnectorType"] = std::make_unique<ConstantParser<EvConnectorType>>();
-    mConstantParsersByType["VehicleProperty"] = std::make_unique<ConstantParser<VehicleProperty>>();
-    mConstantParsersByType["GsrComplianceRequirementType"] =
-            std::make_unique<ConstantParser<GsrComplianceRequirementType>>();
-    mConstantParsersByType["VehicleIgnitionState"] =
-            std::make_unique<ConstantParser<VehicleIgnitionState>>();
-    mConstantParsersByType["FuelType"] = std::make_unique<ConstantParser<FuelType>>();
-    mConstantParsersByType["WindshieldWipersState"] =
-            std::make_unique<ConstantParser<WindshieldWipersState>>();
-    mConstantParsersByType["WindshieldWipersSwitch"] =
-            std::make_unique<ConstantParser<WindshieldWipersSwitch>>();
-    mConstantParsersByType["EmergencyLaneKeepAssistState"] =
-            std::make_unique<ConstantParser<EmergencyLaneKeepAssistState>>();
-    mConstantParsersByType["CruiseControlType"] =
-            std::make_unique<ConstantParser<CruiseControlType>>();
-    mConstantParsersByType["CruiseControlState"] =
-            std::make_unique<ConstantParser<CruiseControlState>>();
-    mConstantParsersByType["CruiseControlCommand"] =
-            std::make_unique<ConstantParser<CruiseControlCommand>>();
-    mConstantParsersByType["HandsOnDetectionDriverState"] =
-            std::make_unique<ConstantParser<HandsOnDetectionDriverState>>();
-    mConstantParsersByType["HandsOnDetectionWarning"] =
-            std::make_unique<ConstantParser<HandsOnDetectionWarning>>();
-    mConstantParsersByType["ErrorState"] = std::make_unique<ConstantParser<ErrorState>>();
-    mConstantParsersByType["AutomaticEmergencyBrakingState"] =
-            std::make_unique<ConstantParser<AutomaticEmergencyBrakingState>>();
-    mConstantParsersByType["ForwardCollisionWarningState"] =
-            std::make_unique<ConstantParser<ForwardCollisionWarningState>>();
-    mConstantParsersByType["BlindSpotWarningState"] =
-            std::make_unique<ConstantParser<BlindSpotWarningState>>();
-    mConstantParsersByType["LaneDepartureWarningState"] =
-            std::make_unique<ConstantParser<LaneDepartureWarningState>>();
-    mConstantParsersByType["LaneKeepAssistState"] =
-            std::make_unique<ConstantParser<LaneKeepAssistState>>();
-    mConstantParsersByType["LaneCenteringAssistCommand"] =
-            std::make_unique<ConstantParser<LaneCenteringAssistCommand>>();
-    mConstantParsersByType["LaneCenteringAssistState"] =
-            std::make_unique<ConstantParser<LaneCenteringAssistState>>();
-    mConstantParsersByType["Constants"] = std::make_unique<LocalVariableParser>();
-}
+    return table;
+}();
 
 template <>
 Result<int32_t> JsonValueParser::convertValueToType<int32_t>(const std::string& fieldName,
@@ -314,11 +192,15 @@ Result<T> JsonValueParser::parseValue(const std::string& fieldName,
     if (!value.isString()) {
         return convertValueToType<T>(fieldName, value);
     }
-    auto maybeTypeAndValue = maybeGetTypeAndValueName(value.asString());
-    if (!maybeTypeAndValue.has_value()) {
+    // Look up the constant in the string owned by the JSON value, without copying it.
+    const char* begin;
+    const char* end;
+    value.getString(&begin, &end);
+    std::string_view typeValueName(begin, end - begin);
+    if (typeValueName.find(DELIMITER) == std::string_view::npos) {
         return Error() << "Invalid constant value: " << value << " for field: " << fieldName;
     }
-    auto constantParseResult = parseConstantValue(maybeTypeAndValue.value());
+    auto constantParseResult = parseConstantValue(typeValueName);
     if (!constantParseResult.ok()) {
         return constantParseResult.error();
     }
@@ -350,33 +232,12 @@ Result<std::vector<T>> JsonValueParser::parseArray(const std::string& fieldName,
     return std::move(parsedValues);
 }
 
-std::optional<std::pair<std::string, std::string>> JsonValueParser::maybeGetTypeAndValueName(
-        const std::string& jsonFieldValue) const {
-    size_t pos = jsonFieldValue.find(DELIMITER);
-    if (pos == std::string::npos) {
-        return {};
-    }
-    std::string type = jsonFieldValue.substr(0, pos);
-    std::string valueName = jsonFieldValue.substr(pos + DELIMITER.length(), std::string::npos);
-    if (type != "Constants" && mConstantParsersByType.find(type) == mConstantParsersByType.end()) {
-        return {};
-    }
-    return std::make_pair(type, valueName);
-}
-
-Result<int> JsonValueParser::parseConstantValue(
-        const std::pair<std::string, std::string>& typeValueName) const {
-    const std::string& type = typeValueName.first;
-    const std::string& valueName = typeValueName.second;
-    auto it = mConstantParsersByType.find(type);
-    if (it == mConstantParsersByType.end()) {
-        return Error() << "Unrecognized type: " << type;
-    }
-    auto result = it->second->parseValue(valueName);
-    if (!result.ok()) {
-        return Error() << type << "::" << valueName << " undefined";
+Result<int> JsonValueParser::parseConstantValue(std::string_view typeValueName) {
+    std::optional<int32_t> constantValue = CONSTANT_VALUE_TABLE.find(typeValueName);
+    if (!constantValue.has_value()) {
+        return Error() << typeValueName << " undefined";
     }
-    return result;
+    return *constantValue;
 }
 
 template <class T>
@@ -625,6 +486,34 @@ JsonConfigLoader::loadPropConfig(const std::string& configPath) {
     return loadPropConfig(ifs);
 }
 
+android::base::Result<std::unordered_map<int32_t, ConfigDeclaration>>
+JsonConfigLoader::loadPropConfig(const std::string& configPath, const std::string& cachePath) {
+    std::string content;
+    if (!android::base::ReadFileToString(configPath, &content)) {
+        return android::base::Error() << "couldn't open " << configPath << " for parsing.";
+    }
+    uint64_t sourceHash = ConfigDeclarationCache::hashContent(content);
+    auto cacheResult = ConfigDeclarationCache::read(cachePath, sourceHash);
+    if (cacheResult.ok()) {
+        ALOGI("loaded %zu property configs for %s from cache", cacheResult.value().size(),
+              configPath.c_str());
+        return cacheResult;
+    }
+    ALOGI("cache for %s is not usable, parsing JSON, reason: %s", configPath.c_str(),
+          cacheResult.error().message().c_str());
+
+    std::istringstream iss(content);
+    auto result = loadPropConfig(iss);
+    if (!result.ok()) {
+        return result;
+    }
+    if (auto writeResult = ConfigDeclarationCache::write(cachePath, sourceHash, result.value());
+        !writeResult.ok()) {
+        ALOGW("failed to write config cache: %s", writeResult.error().message().c_str());
+    }
+    return result;
+}
+
 }  // namespace vehicle
 }  // namespace automotive
 }  // namespace hardware
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ConfigDeclarationCache.h>
+#include <JsonConfigLoader.h>
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+using ::aidl::android::hardware::automotive::vehicle::RawPropValues;
+using ::aidl::android::hardware::automotive::vehicle::VehicleAreaConfig;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropConfig;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropertyAccess;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropertyChangeMode;
+
+using ::android::base::ReadFileToString;
+using ::android::base::WriteStringToFile;
+
+constexpr char JSON_CONFIG[] = R"(
+{
+    "properties": [{
+        "property": 291504388,
+        "access": "VehiclePropertyAccess::READ",
+        "changeMode": "VehiclePropertyChangeMode::CONTINUOUS",
+        "configArray": [1, 2, 3],
+        "configString": "abcd",
+        "minSampleRate": 1.0,
+        "maxSampleRate": 10.0,
+        "defaultValue": {
+            "floatValues": [1.5]
+        },
+        "areas": [{
+            "areaId": 1,
+            "minFloatValue": 0.0,
+            "maxFloatValue": 100.0,
+            "defaultValue": {
+                "floatValues": [2.5]
+            }
+        }]
+    }]
+}
+)";
+
+class ConfigDeclarationCacheUnitTest : public ::testing::Test {
+  protected:
+    std::string getCachePath() const { return std::string(mTempDir.path) + "/cache"; }
+
+    std::string getConfigPath() const { return std::string(mTempDir.path) + "/config.json"; }
+
+    JsonConfigLoader mLoader;
+
+  private:
+    android::base::TemporaryDir mTempDir;
+};
+
+std::unordered_map<int32_t, ConfigDeclaration> getTestConfigs() {
+    ConfigDeclaration configDeclaration = {
+            .config =
+                    {
+                            .prop = 1,
+                            .access = VehiclePropertyAccess::READ_WRITE,
+                            .changeMode = VehiclePropertyChangeMode::ON_CHANGE,
+                            .areaConfigs = {VehicleAreaConfig{
+                                                    .areaId = 2,
+                                                    .minInt32Value = -1,
+                                                    .maxInt32Value = 1,
+                                                    .supportedEnumValues = {{1, 2}},
+                                            },
+                                            VehicleAreaConfig{
+                                                    .areaId = 4,
+                                                    .minInt64Value = -2,
+                                                    .maxInt64Value = 2,
+                                            }},
+                            .configArray = {1, 2},
+                            .configString = "config",
+                            .minSampleRate = 1.0f,
+                            .maxSampleRate = 2.0f,
+                    },
+            .initialValue =
+                    {
+                            .int32Values = {1},
+                            .floatValues = {1.0f},
+                            .int64Values = {2},
+                            .byteValues = {0x01, 0x02},
+                            .stringValue = "value",
+                    },
+            .initialAreaValues = {{2, RawPropValues{.int32Values = {3}}}},
+    };
+    return {{1, configDeclaration}, {2, ConfigDeclaration{.config = {.prop = 2}}}};
+}
+
+TEST_F(ConfigDeclarationCacheUnitTest, testWriteRead) {
+    auto configs = getTestConfigs();
+
+    ASSERT_TRUE(ConfigDeclarationCache::write(getCachePath(), /*sourceHash=*/1234, configs).ok());
+
+    auto result = ConfigDeclarationCache::read(getCachePath(), /*sourceHash=*/1234);
+
+    ASSERT_TRUE(result.ok()) << result.error().message();
+    ASSERT_EQ(result.value(), configs);
+}
+
+TEST_F(ConfigDeclarationCacheUnitTest, testReadStaleCache) {
+    ASSERT_TRUE(
+            ConfigDeclarationCache::write(getCachePath(), /*sourceHash=*/1234, getTestConfigs())
+                    .ok());
+
+    ASSERT_FALSE(ConfigDeclarationCache::read(getCachePath(), /*sourceHash=*/5678).ok())
+            << "cache generated from a different source must not be used";
+}
+
+TEST_F(ConfigDeclarationCacheUnitTest, testReadNonExistingCache) {
+    ASSERT_FALSE(ConfigDeclarationCache::read(getCachePath(), /*sourceHash=*/1234).ok());
+}
+
+TEST_F(ConfigDeclarationCacheUnitTest, testReadTruncatedCache) {
+    ASSERT_TRUE(
+            ConfigDeclarationCache::write(getCachePath(), /*sourceHash=*/1234, getTestConfigs())
+                    .ok());
+    std::string content;
+    ASSERT_TRUE(ReadFileToString(getCachePath(), &content));
+    ASSERT_TRUE(WriteStringToFile(content.substr(0, content.size() - 1), getCachePath()));
+
+    ASSERT_FALSE(ConfigDeclarationCache::read(getCachePath(), /*sourceHash=*/1234).ok());
+}
+
+TEST_F(ConfigDeclarationCacheUnitTest, testHashContent) {
+    ASSERT_EQ(ConfigDeclarationCache::hashContent("abcd"),
+              ConfigDeclarationCache::hashContent("abcd"));
+    ASSERT_NE(ConfigDeclarationCache::hashContent("abcd"),
+              ConfigDeclarationCache::hashContent("abce"));
+}
+
+TEST_F(ConfigDeclarationCacheUnitTest, testLoadPropConfigWithCache) {
+    ASSERT_TRUE(WriteStringToFile(JSON_CONFIG, getConfigPath()));
+
+    auto result = mLoader.loadPropConfig(getConfigPath(), getCachePath());
+
+    ASSERT_TRUE(result.ok()) << result.error().message();
+    auto cacheResult = ConfigDeclarationCache::read(
+            getCachePath(), ConfigDeclarationCache::hashContent(JSON_CONFIG));
+    ASSERT_TRUE(cacheResult.ok()) << "cache must be generated after parsing JSON: "
+                                  << cacheResult.error().message();
+    ASSERT_EQ(cacheResult.value(), result.value());
+
+    auto cachedResult = mLoader.loadPropConfig(getConfigPath(), getCachePath());
+
+    ASSERT_TRUE(cachedResult.ok()) << cachedResult.error().message();
+    ASSERT_EQ(cachedResult.value(), result.value());
+}
+
+TEST_F(ConfigDeclarationCacheUnitTest, testLoadPropConfigWithStaleCache) {
+    ASSERT_TRUE(ConfigDeclarationCache::write(getCachePath(),
+                                              ConfigDeclarationCache::hashContent("stale"),
+                                              getTestConfigs())
+                        .ok());
+    ASSERT_TRUE(WriteStringToFile(JSON_CONFIG, getConfigPath()));
+
+    auto result = mLoader.loadPropConfig(getConfigPath(), getCachePath());
+
+    ASSERT_TRUE(result.ok()) << result.error().message();
+    ASSERT_EQ(result.value().size(), 1u);
+    ASSERT_EQ(result.value().begin()->second.config.prop, 291504388);
+}
+
+TEST_F(ConfigDeclarationCacheUnitTest, testLoadPropConfigUnwritableCache) {
+    ASSERT_TRUE(WriteStringToFile(JSON_CONFIG, getConfigPath()));
+
+    auto result = mLoader.loadPropConfig(getConfigPath(), "/non_existing_dir/cache");
+
+    ASSERT_TRUE(result.ok()) << "failing to write cache must not fail loading: "
+                             << result.error().message();
+    ASSERT_EQ(result.value().size(), 1u);
+}
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
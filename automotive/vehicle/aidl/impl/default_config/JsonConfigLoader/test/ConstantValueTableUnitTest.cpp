@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ConstantValueTable.h>
+#include <EnumConstantsForVehicleProperty.h>
+
+#include <gtest/gtest.h>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+using ::aidl::android::hardware::automotive::vehicle::EnumConstantsForVehicleProperty;
+using ::aidl::android::hardware::automotive::vehicle::VehicleGear;
+using ::aidl::android::hardware::automotive::vehicle::VehicleUnit;
+using ::android::hardware::automotive::vehicle::jsonconfigloader_impl::ConstantValueTable;
+
+namespace {
+
+constexpr auto ENUM_CONSTANT_TABLE = [] {
+    ConstantValueTable<std::size(EnumConstantsForVehicleProperty)> table;
+    for (const auto& [name, value] : EnumConstantsForVehicleProperty) {
+        table.insert(name, value);
+    }
+    return table;
+}();
+
+// The lookup must be usable in a constant expression.
+static_assert(ENUM_CONSTANT_TABLE.find("VehicleGear::GEAR_PARK") ==
+              static_cast<int32_t>(VehicleGear::GEAR_PARK));
+static_assert(!ENUM_CONSTANT_TABLE.find("VehicleGear::NOT_A_GEAR").has_value());
+
+}  // namespace
+
+TEST(ConstantValueTableUnitTest, testFind) {
+    ConstantValueTable<2> table;
+    table.insert("Constants::A", 1);
+    table.insert("Constants::B", 2);
+
+    ASSERT_EQ(table.size(), 2u);
+    EXPECT_EQ(table.find("Constants::A"), 1);
+    EXPECT_EQ(table.find("Constants::B"), 2);
+    EXPECT_FALSE(table.find("Constants::C").has_value());
+    EXPECT_FALSE(table.find("").has_value());
+}
+
+TEST(ConstantValueTableUnitTest, testDuplicateNameKeepsFirstValue) {
+    ConstantValueTable<2> table;
+    table.insert("Constants::A", 1);
+    table.insert("Constants::A", 2);
+
+    ASSERT_EQ(table.size(), 1u);
+    EXPECT_EQ(table.find("Constants::A"), 1);
+}
+
+TEST(ConstantValueTableUnitTest, testAllEnumConstantsFound) {
+    for (const auto& [name, value] : EnumConstantsForVehicleProperty) {
+        auto result = ENUM_CONSTANT_TABLE.find(name);
+
+        ASSERT_TRUE(result.has_value()) << name << " not found";
+        EXPECT_EQ(*result, value) << "wrong value for " << name;
+    }
+}
+
+TEST(ConstantValueTableUnitTest, testEnumAliases) {
+    EXPECT_EQ(ENUM_CONSTANT_TABLE.find("VehicleUnit::GALLON"),
+              static_cast<int32_t>(VehicleUnit::GALLON));
+    EXPECT_EQ(ENUM_CONSTANT_TABLE.find("VehicleUnit::US_GALLON"),
+              static_cast<int32_t>(VehicleUnit::US_GALLON));
+}
+
+TEST(ConstantValueTableUnitTest, testBoundedProbes) {
+    // The table is at most half full, so the longest probe sequence must stay short.
+    EXPECT_LE(ENUM_CONSTANT_TABLE.maxProbes(), 16u);
+}
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
@@ -24,12 +24,15 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <iostream>
 #include <mutex>
 #include <optional>
-#include <queue>
+#include <string>
 #include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace android {
 namespace hardware {
@@ -37,50 +40,111 @@ namespace automotive {
 namespace vehicle {
 namespace fake {
 
-// This is the scheduler for all VHAL event generators. It manages all generators and uses priority
-// queue to maintain generated events ordered by timestamp. The scheduler uses a single thread to
-// keep querying and updating the event queue to make sure events from all generators are produced
-// in order.
+// This is the scheduler for all VHAL event generators. It manages all generators and uses a hashed
+// timer wheel to keep generated events ordered by timestamp. Each slot of the wheel covers one
+// tick, and events that are due in the same tick are delivered together in one batch. The
+// scheduler uses a single thread to keep draining the wheel, and releases the lock while
+// delivering events so that registration never waits for the callback.
 class GeneratorHub {
   public:
     using OnHalEvent = std::function<void(
             const aidl::android::hardware::automotive::vehicle::VehiclePropValue& event)>;
+    using OnHalEvents = std::function<void(
+            const std::vector<aidl::android::hardware::automotive::vehicle::VehiclePropValue>&
+                    events)>;
 
+    // Statistics for one registered generator.
+    struct GeneratorStats {
+        int64_t eventCount = 0;
+        // The event rate implied by the timestamps the generator produced.
+        float requestedRateHz = 0;
+        // The event rate at which the events were actually delivered.
+        float achievedRateHz = 0;
+        // The maximum delay between an event's timestamp and its delivery.
+        int64_t maxDispatchDelayNs = 0;
+    };
+
+    // Creates a hub that delivers events one by one.
     explicit GeneratorHub(OnHalEvent&& onHalEvent);
+    // Creates a hub that delivers all the events due in the same tick in one call, ordered by
+    // timestamp.
+    explicit GeneratorHub(OnHalEvents&& onHalEvents);
     ~GeneratorHub();
 
     // Register a new generator. The generator will be discarded if it could not produce next event.
     // The existing generator will be overridden if it has the same generatorId.
     void registerGenerator(int32_t generatorId, std::unique_ptr<FakeValueGenerator> generator);
 
+    // Register multiple generators at once. This is equivalent to calling registerGenerator for
+    // each generator, but only takes the lock and wakes up the scheduler thread once.
+    void registerGenerators(
+            std::vector<std::pair<int32_t, std::unique_ptr<FakeValueGenerator>>>&& generators);
+
     // Unregister a generator with the generatorId. If no registered generator is found, this
     // function does nothing. Returns true if the generator is unregistered.
     bool unregisterGenerator(int32_t generatorId);
 
+    // Returns the statistics for all the currently registered generators.
+    std::unordered_map<int32_t, GeneratorStats> getGeneratorStats() const;
+
+    // Returns a human readable summary of requested vs achieved event rates.
+    std::string dumpStats() const;
+
   private:
     struct VhalEvent {
         int32_t generatorId;
+        // The generation of the generator that produced this event, used to skip events from
+        // generators that have been unregistered or replaced.
+        uint64_t generation;
+        int64_t tick;
         aidl::android::hardware::automotive::vehicle::VehiclePropValue val;
     };
 
-    // Comparator used by priority queue to keep track of soonest event.
-    struct GreaterByTime {
-        bool operator()(const VhalEvent& lhs, const VhalEvent& rhs) const {
-            return lhs.val.timestamp > rhs.val.timestamp;
-        }
+    struct GeneratorState {
+        std::unique_ptr<FakeValueGenerator> generator;
+        uint64_t generation;
+        int64_t eventCount = 0;
+        int64_t firstEventTimestamp = 0;
+        int64_t lastEventTimestamp = 0;
+        int64_t firstDispatchTime = 0;
+        int64_t lastDispatchTime = 0;
+        int64_t maxDispatchDelayNs = 0;
     };
 
-    std::priority_queue<VhalEvent, std::vector<VhalEvent>, GreaterByTime> mEventQueue;
-    std::mutex mGeneratorsLock;
-    std::unordered_map<int32_t, std::unique_ptr<FakeValueGenerator>> mGenerators
-            GUARDED_BY(mGeneratorsLock);
-    OnHalEvent mOnHalEvent;
+    mutable std::mutex mGeneratorsLock;
+    std::unordered_map<int32_t, GeneratorState> mGenerators GUARDED_BY(mGeneratorsLock);
+    std::vector<std::vector<VhalEvent>> mWheel GUARDED_BY(mGeneratorsLock);
+    // One bit per slot of the wheel, set if the slot is not empty.
+    std::vector<uint64_t> mOccupiedSlots GUARDED_BY(mGeneratorsLock);
+    // The next tick that has not been processed yet.
+    int64_t mCursorTick GUARDED_BY(mGeneratorsLock);
+    // The soonest tick that has a pending event, INT64_MAX if there is none.
+    int64_t mNextTick GUARDED_BY(mGeneratorsLock) = INT64_MAX;
+    // The tick the scheduler thread is currently waiting for, INT64_MAX if waiting for a new
+    // generator, INT64_MIN if it is dispatching events and will re-evaluate the wheel afterwards.
+    int64_t mWakeUpTick GUARDED_BY(mGeneratorsLock) = INT64_MAX;
+    // Set when an event sooner than mWakeUpTick is scheduled while the scheduler thread waits.
+    bool mWakeUpRequested GUARDED_BY(mGeneratorsLock) = false;
+    uint64_t mNextGeneration GUARDED_BY(mGeneratorsLock) = 0;
+    OnHalEvents mOnHalEvents;
     std::condition_variable mCond;
     std::thread mThread;
     std::atomic<bool> mShuttingDownFlag{false};
 
     // Main loop of the single thread to producing event and updating event queue.
     void run();
+
+    // Registers a generator and schedules its first event, returns whether the scheduler thread
+    // needs to be woken up.
+    bool registerGeneratorLocked(int32_t generatorId, std::unique_ptr<FakeValueGenerator> generator)
+            REQUIRES(mGeneratorsLock);
+    void scheduleEventLocked(VhalEvent&& event) REQUIRES(mGeneratorsLock);
+    // Removes all the events due at or before {@code nowTick} from the wheel and returns them
+    // ordered by timestamp.
+    std::vector<VhalEvent> takeDueEventsLocked(int64_t nowTick) REQUIRES(mGeneratorsLock);
+    // Returns the first tick that has a pending event, or INT64_MAX if there is none. Only visits
+    // the occupied slots of the wheel.
+    int64_t findNextTickLocked() const REQUIRES(mGeneratorsLock);
 };
 
 }  // namespace fake
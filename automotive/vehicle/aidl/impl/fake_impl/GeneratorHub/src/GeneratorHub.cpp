@@ -18,6 +18,10 @@
 
 #include "GeneratorHub.h"
 
+#include <inttypes.h>
+#include <algorithm>
+
+#include <android-base/stringprintf.h>
 #include <utils/Log.h>
 #include <utils/SystemClock.h>
 
@@ -27,9 +31,54 @@ namespace automotive {
 namespace vehicle {
 namespace fake {
 
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropValue;
 using ::android::base::ScopedLockAssertion;
+using ::android::base::StringAppendF;
+
+namespace {
+
+// The time covered by one slot of the timer wheel.
+constexpr int64_t TICK_NANOS = 1'000'000;
+// The number of slots in the timer wheel, must be a power of 2.
+constexpr size_t WHEEL_SIZE = 1024;
+constexpr size_t SLOTS_PER_WORD = 64;
+
+// The tick that contains {@code timestamp}.
+int64_t toTick(int64_t timestamp) {
+    return timestamp / TICK_NANOS;
+}
+
+// The first tick that starts at or after {@code timestamp}, so that an event is never delivered
+// before its timestamp.
+int64_t toDueTick(int64_t timestamp) {
+    return (timestamp + TICK_NANOS - 1) / TICK_NANOS;
+}
 
-GeneratorHub::GeneratorHub(OnHalEvent&& onHalEvent) : mOnHalEvent(onHalEvent) {
+float toRateHz(int64_t count, int64_t durationNs) {
+    if (count < 2 || durationNs <= 0) {
+        return 0;
+    }
+    return static_cast<float>(count - 1) * 1'000'000'000.0f / static_cast<float>(durationNs);
+}
+
+}  // namespace
+
+GeneratorHub::GeneratorHub(OnHalEvent&& onHalEvent)
+    : GeneratorHub(OnHalEvents([onHalEvent = std::move(onHalEvent)](
+                                       const std::vector<VehiclePropValue>& events) {
+          for (const auto& event : events) {
+              onHalEvent(event);
+          }
+      })) {}
+
+GeneratorHub::GeneratorHub(OnHalEvents&& onHalEvents)
+    : mWheel(WHEEL_SIZE),
+      mOccupiedSlots(WHEEL_SIZE / SLOTS_PER_WORD),
+      mOnHalEvents(std::move(onHalEvents)) {
+    {
+        std::scoped_lock<std::mutex> lockGuard(mGeneratorsLock);
+        mCursorTick = toTick(elapsedRealtimeNano());
+    }
     mThread = std::thread(&GeneratorHub::run, this);
 }
 
@@ -48,80 +97,257 @@ GeneratorHub::~GeneratorHub() {
 }
 
 void GeneratorHub::registerGenerator(int32_t id, std::unique_ptr<FakeValueGenerator> generator) {
+    bool needWakeUp;
     {
         std::scoped_lock<std::mutex> lockGuard(mGeneratorsLock);
-        auto maybeNextEvent = generator->nextEvent();
-        // Register only if the generator can produce at least one event.
-        if (maybeNextEvent.has_value()) {
-            // Push the next event if it is a new generator
-            if (mGenerators.find(id) == mGenerators.end()) {
-                ALOGI("%s: Registering new generator, id: %d", __func__, id);
-                mEventQueue.push({id, maybeNextEvent.value()});
-            }
-            mGenerators[id] = std::move(generator);
-            ALOGI("%s: Registered generator, id: %d", __func__, id);
+        needWakeUp = registerGeneratorLocked(id, std::move(generator));
+    }
+    if (needWakeUp) {
+        mCond.notify_one();
+    }
+}
+
+void GeneratorHub::registerGenerators(
+        std::vector<std::pair<int32_t, std::unique_ptr<FakeValueGenerator>>>&& generators) {
+    bool needWakeUp = false;
+    {
+        std::scoped_lock<std::mutex> lockGuard(mGeneratorsLock);
+        for (auto& [id, generator] : generators) {
+            needWakeUp |= registerGeneratorLocked(id, std::move(generator));
         }
     }
-    mCond.notify_one();
+    ALOGI("%s: Registered %zu generators", __func__, generators.size());
+    if (needWakeUp) {
+        mCond.notify_one();
+    }
+}
+
+bool GeneratorHub::registerGeneratorLocked(int32_t id,
+                                           std::unique_ptr<FakeValueGenerator> generator) {
+    auto maybeNextEvent = generator->nextEvent();
+    // Register only if the generator can produce at least one event.
+    if (!maybeNextEvent.has_value()) {
+        return false;
+    }
+    uint64_t generation = mNextGeneration++;
+    // Overriding an existing generator invalidates the events it already scheduled.
+    mGenerators[id] = GeneratorState{
+            .generator = std::move(generator),
+            .generation = generation,
+    };
+    int64_t tick = toDueTick(maybeNextEvent->timestamp);
+    scheduleEventLocked({
+            .generatorId = id,
+            .generation = generation,
+            .tick = tick,
+            .val = std::move(maybeNextEvent.value()),
+    });
+    // Only wake up the scheduler thread if the new event is sooner than what it is waiting for.
+    if (tick < mWakeUpTick) {
+        mWakeUpRequested = true;
+    }
+    return mWakeUpRequested;
 }
 
 bool GeneratorHub::unregisterGenerator(int32_t id) {
     bool removed;
     {
         std::scoped_lock<std::mutex> lockGuard(mGeneratorsLock);
+        // The scheduled events for this generator stay in the wheel and are skipped when they
+        // become due, so there is no need to wake up the scheduler thread.
         removed = mGenerators.erase(id);
     }
-    mCond.notify_one();
     ALOGI("%s: Unregistered generator, id: %d", __func__, id);
     return removed;
 }
 
-void GeneratorHub::run() {
-    while (!mShuttingDownFlag.load()) {
-        std::unique_lock<std::mutex> lock(mGeneratorsLock);
-        ScopedLockAssertion lock_assertion(mGeneratorsLock);
-        // Pop events whose generator does not exist (may be already unregistered)
-        while (!mEventQueue.empty() &&
-               mGenerators.find(mEventQueue.top().generatorId) == mGenerators.end()) {
-            mEventQueue.pop();
+std::unordered_map<int32_t, GeneratorHub::GeneratorStats> GeneratorHub::getGeneratorStats() const {
+    std::unordered_map<int32_t, GeneratorStats> statsById;
+    std::scoped_lock<std::mutex> lockGuard(mGeneratorsLock);
+    for (const auto& [id, state] : mGenerators) {
+        statsById[id] = GeneratorStats{
+                .eventCount = state.eventCount,
+                .requestedRateHz = toRateHz(state.eventCount, state.lastEventTimestamp -
+                                                                      state.firstEventTimestamp),
+                .achievedRateHz = toRateHz(state.eventCount,
+                                           state.lastDispatchTime - state.firstDispatchTime),
+                .maxDispatchDelayNs = state.maxDispatchDelayNs,
+        };
+    }
+    return statsById;
+}
+
+std::string GeneratorHub::dumpStats() const {
+    auto statsById = getGeneratorStats();
+    std::string result;
+    int64_t totalEvents = 0;
+    float totalRequestedRateHz = 0;
+    float totalAchievedRateHz = 0;
+    for (const auto& [id, stats] : statsById) {
+        StringAppendF(&result,
+                      "Generator %d: events: %" PRId64 ", requested rate: %.2fHz, "
+                      "achieved rate: %.2fHz, max delay: %" PRId64 "us\n",
+                      id, stats.eventCount, stats.requestedRateHz, stats.achievedRateHz,
+                      stats.maxDispatchDelayNs / 1000);
+        totalEvents += stats.eventCount;
+        totalRequestedRateHz += stats.requestedRateHz;
+        totalAchievedRateHz += stats.achievedRateHz;
+    }
+    StringAppendF(&result,
+                  "Total: %zu generators, events: %" PRId64 ", requested rate: %.2fHz, "
+                  "achieved rate: %.2fHz\n",
+                  statsById.size(), totalEvents, totalRequestedRateHz, totalAchievedRateHz);
+    return result;
+}
+
+void GeneratorHub::scheduleEventLocked(VhalEvent&& event) {
+    // Events that are already overdue are handled in the next unprocessed tick.
+    if (event.tick < mCursorTick) {
+        event.tick = mCursorTick;
+    }
+    size_t slot = event.tick & (WHEEL_SIZE - 1);
+    mNextTick = std::min(mNextTick, event.tick);
+    mOccupiedSlots[slot / SLOTS_PER_WORD] |= uint64_t{1} << (slot % SLOTS_PER_WORD);
+    mWheel[slot].push_back(std::move(event));
+}
+
+std::vector<GeneratorHub::VhalEvent> GeneratorHub::takeDueEventsLocked(int64_t nowTick) {
+    std::vector<VhalEvent> dueEvents;
+    // Each slot only needs to be visited once even if we are more than one revolution behind.
+    int64_t lastTick = std::min(nowTick, mCursorTick + static_cast<int64_t>(WHEEL_SIZE) - 1);
+    for (int64_t tick = mCursorTick; tick <= lastTick; tick++) {
+        size_t slotIndex = tick & (WHEEL_SIZE - 1);
+        auto& slot = mWheel[slotIndex];
+        auto it = std::partition(slot.begin(), slot.end(),
+                                 [nowTick](const VhalEvent& event) { return event.tick > nowTick; });
+        for (auto dueIt = it; dueIt != slot.end(); dueIt++) {
+            auto generatorIt = mGenerators.find(dueIt->generatorId);
+            // Skip events whose generator does not exist (may be already unregistered) or has been
+            // replaced.
+            if (generatorIt == mGenerators.end() ||
+                generatorIt->second.generation != dueIt->generation) {
+                continue;
+            }
+            dueEvents.push_back(std::move(*dueIt));
         }
-        // Wait until event queue is not empty or shutting down flag is set.
-        // This would unlock mGeneratorsLock and reacquire later.
-        mCond.wait(lock, [this] { return !mEventQueue.empty() || mShuttingDownFlag.load(); });
-        if (mShuttingDownFlag.load()) {
+        slot.erase(it, slot.end());
+        if (slot.empty()) {
+            mOccupiedSlots[slotIndex / SLOTS_PER_WORD] &=
+                    ~(uint64_t{1} << (slotIndex % SLOTS_PER_WORD));
+        }
+    }
+    mCursorTick = nowTick + 1;
+    if (mNextTick <= nowTick) {
+        // The soonest event was just taken, look for the next one once per dispatch.
+        mNextTick = INT64_MAX;
+        mNextTick = findNextTickLocked();
+    }
+    std::stable_sort(dueEvents.begin(), dueEvents.end(),
+                     [](const VhalEvent& lhs, const VhalEvent& rhs) {
+                         return lhs.val.timestamp < rhs.val.timestamp;
+                     });
+    return dueEvents;
+}
+
+int64_t GeneratorHub::findNextTickLocked() const {
+    // Events are scheduled no later than one revolution ahead in their own slot, so the first
+    // slot that contains an event for the current revolution is the next tick.
+    int64_t nextTick = INT64_MAX;
+    size_t offset = 0;
+    while (offset < WHEEL_SIZE) {
+        size_t slot = (mCursorTick + static_cast<int64_t>(offset)) & (WHEEL_SIZE - 1);
+        uint64_t occupied = mOccupiedSlots[slot / SLOTS_PER_WORD] >> (slot % SLOTS_PER_WORD);
+        if (occupied == 0) {
+            // Skip the rest of this word.
+            offset += SLOTS_PER_WORD - slot % SLOTS_PER_WORD;
+            continue;
+        }
+        offset += __builtin_ctzll(occupied);
+        if (offset >= WHEEL_SIZE) {
             break;
         }
+        int64_t tick = mCursorTick + static_cast<int64_t>(offset);
+        for (const auto& event : mWheel[tick & (WHEEL_SIZE - 1)]) {
+            if (event.tick == tick) {
+                return tick;
+            }
+            nextTick = std::min(nextTick, event.tick);
+        }
+        offset++;
+    }
+    return nextTick;
+}
 
-        const VhalEvent& curEvent = mEventQueue.top();
-        long currentTime = elapsedRealtimeNano();
-        long waitTime =
-                curEvent.val.timestamp > currentTime ? curEvent.val.timestamp - currentTime : 0;
-        if (waitTime != 0) {
-            // Wait until the soonest event happen
-            if (mCond.wait_for(lock, std::chrono::nanoseconds(waitTime)) !=
-                std::cv_status::timeout) {
-                // It is possible that a new generator is registered and produced a sooner event, or
-                // current generator is unregistered, in this case the thread will re-evaluate the
-                // soonest event
-                ALOGI("Something happened while waiting");
-                continue;
+void GeneratorHub::run() {
+    std::vector<VehiclePropValue> batch;
+    std::unique_lock<std::mutex> lock(mGeneratorsLock);
+    ScopedLockAssertion lock_assertion(mGeneratorsLock);
+    // The shutting down flag is checked under the lock, so that the notification from the
+    // destructor cannot be missed between the check and the wait.
+    auto shouldWakeUp = [this]() REQUIRES(mGeneratorsLock) {
+        return mShuttingDownFlag.load() || mWakeUpRequested;
+    };
+    while (!mShuttingDownFlag.load()) {
+        int64_t nowTick = toTick(elapsedRealtimeNano());
+        // Events left behind by unregistered generators do not need a wake up.
+        mWakeUpTick = mGenerators.empty() ? INT64_MAX : mNextTick;
+        if (mWakeUpTick > nowTick) {
+            // Wait until the soonest event is due, a sooner event is registered or shutting down
+            // flag is set. This would unlock mGeneratorsLock and reacquire later.
+            mWakeUpRequested = false;
+            if (mWakeUpTick == INT64_MAX) {
+                mCond.wait(lock, shouldWakeUp);
+            } else {
+                mCond.wait_for(lock,
+                               std::chrono::nanoseconds(mWakeUpTick * TICK_NANOS -
+                                                        elapsedRealtimeNano()),
+                               shouldWakeUp);
             }
+            // Re-evaluate the soonest event since the wheel might have changed while waiting.
+            continue;
         }
-        // Now it's time to handle current event.
-        mOnHalEvent(curEvent.val);
-        // Update queue by popping current event and producing next event from the same generator
-        int32_t id = curEvent.generatorId;
-        mEventQueue.pop();
-        if (mGenerators.find(id) != mGenerators.end()) {
-            auto maybeNextEvent = mGenerators[id]->nextEvent();
+        mWakeUpTick = INT64_MIN;
+
+        std::vector<VhalEvent> dueEvents = takeDueEventsLocked(nowTick);
+        int64_t dispatchTime = elapsedRealtimeNano();
+        batch.clear();
+        batch.reserve(dueEvents.size());
+        for (auto& event : dueEvents) {
+            int32_t id = event.generatorId;
+            GeneratorState& state = mGenerators[id];
+            if (state.eventCount == 0) {
+                state.firstEventTimestamp = event.val.timestamp;
+                state.firstDispatchTime = dispatchTime;
+            }
+            state.eventCount++;
+            state.lastEventTimestamp = event.val.timestamp;
+            state.lastDispatchTime = dispatchTime;
+            state.maxDispatchDelayNs =
+                    std::max(state.maxDispatchDelayNs, dispatchTime - event.val.timestamp);
+            batch.push_back(std::move(event.val));
+
+            // Produce next event from the same generator.
+            auto maybeNextEvent = state.generator->nextEvent();
             if (maybeNextEvent.has_value()) {
-                mEventQueue.push({id, maybeNextEvent.value()});
+                int64_t tick = toDueTick(maybeNextEvent->timestamp);
+                scheduleEventLocked({
+                        .generatorId = id,
+                        .generation = event.generation,
+                        .tick = tick,
+                        .val = std::move(maybeNextEvent.value()),
+                });
                 continue;
             }
+            ALOGI("%s: Generator ended, unregister it, id: %d", __func__, id);
+            mGenerators.erase(id);
         }
 
-        ALOGI("%s: Generator ended, unregister it, id: %d", __func__, id);
-        mGenerators.erase(id);
+        // Now it's time to handle current events, do not hold the lock while invoking the callback.
+        lock.unlock();
+        if (!batch.empty()) {
+            mOnHalEvents(batch);
+        }
+        lock.lock();
     }
 }
 
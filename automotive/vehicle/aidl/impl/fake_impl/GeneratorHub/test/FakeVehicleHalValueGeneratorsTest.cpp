@@ -169,6 +169,143 @@ TEST_F(FakeVehicleHalValueGeneratorsTest, testUnregisterGeneratorStopGeneration)
             << "Must stop generating event after generator is unregistered";
 }
 
+TEST_F(FakeVehicleHalValueGeneratorsTest, testRegisterGenerators) {
+    size_t generatorCount = 1000;
+    size_t eventCount = 5;
+    int64_t timestamp = elapsedRealtimeNano();
+    std::vector<std::pair<int32_t, std::unique_ptr<FakeValueGenerator>>> generators;
+    for (size_t i = 0; i < generatorCount; i++) {
+        auto generator = std::make_unique<TestFakeValueGenerator>();
+        std::vector<VehiclePropValue> events;
+        for (size_t j = 0; j < eventCount; j++) {
+            events.push_back(VehiclePropValue{
+                    .prop = static_cast<int32_t>(i),
+                    // Generate 1 event every 1ms.
+                    .timestamp = timestamp + static_cast<int64_t>(1000000 * j),
+            });
+        }
+        generator->setEvents(events);
+        generators.push_back({static_cast<int32_t>(i), std::move(generator)});
+    }
+
+    getHub()->registerGenerators(std::move(generators));
+
+    waitForEvents(generatorCount * eventCount);
+
+    auto events = getEvents();
+    ASSERT_EQ(events.size(), generatorCount * eventCount);
+    int64_t lastEventTime = 0;
+    for (const auto& event : events) {
+        EXPECT_GE(event.timestamp, lastEventTime) << "events must be delivered in order";
+        lastEventTime = event.timestamp;
+    }
+}
+
+TEST_F(FakeVehicleHalValueGeneratorsTest, testEventsInSameTickAreBatched) {
+    std::mutex lock;
+    std::condition_variable cv;
+    std::vector<std::vector<VehiclePropValue>> batches;
+    auto hub = std::make_unique<GeneratorHub>(
+            [&lock, &cv, &batches](const std::vector<VehiclePropValue>& events) {
+                {
+                    std::scoped_lock<std::mutex> lockGuard(lock);
+                    batches.push_back(events);
+                }
+                cv.notify_all();
+            });
+
+    // All the events happen at the same time in the future.
+    int64_t timestamp = elapsedRealtimeNano() + 100'000'000;
+    std::vector<std::pair<int32_t, std::unique_ptr<FakeValueGenerator>>> generators;
+    for (int32_t i = 0; i < 10; i++) {
+        auto generator = std::make_unique<TestFakeValueGenerator>();
+        generator->setEvents({VehiclePropValue{
+                .prop = i,
+                .timestamp = timestamp,
+        }});
+        generators.push_back({i, std::move(generator)});
+    }
+    hub->registerGenerators(std::move(generators));
+
+    std::unique_lock<std::mutex> uniqueLock(lock);
+    ASSERT_TRUE(cv.wait_for(uniqueLock, 10s, [&batches] { return !batches.empty(); }))
+            << "didn't receive any events";
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(batches[0].size(), 10u);
+    uniqueLock.unlock();
+
+    hub.reset();
+}
+
+TEST_F(FakeVehicleHalValueGeneratorsTest, testEventsNotDeliveredBeforeTimestamp) {
+    std::mutex lock;
+    std::condition_variable cv;
+    std::vector<int64_t> deliveryTimes;
+    auto hub = std::make_unique<GeneratorHub>(
+            [&lock, &cv, &deliveryTimes](const VehiclePropValue&) {
+                int64_t now = elapsedRealtimeNano();
+                {
+                    std::scoped_lock<std::mutex> lockGuard(lock);
+                    deliveryTimes.push_back(now);
+                }
+                cv.notify_all();
+            });
+
+    auto generator = std::make_unique<TestFakeValueGenerator>();
+    std::vector<VehiclePropValue> events;
+    int64_t timestamp = elapsedRealtimeNano();
+    for (size_t i = 0; i < 10; i++) {
+        events.push_back(VehiclePropValue{
+                .prop = static_cast<int32_t>(i),
+                // Not aligned with the 1ms ticks of the hub.
+                .timestamp = timestamp + static_cast<int64_t>(1'700'000 * (i + 1)),
+        });
+    }
+    generator->setEvents(events);
+    hub->registerGenerator(0, std::move(generator));
+
+    std::unique_lock<std::mutex> uniqueLock(lock);
+    ASSERT_TRUE(cv.wait_for(uniqueLock, 10s, [&deliveryTimes, &events] {
+        return deliveryTimes.size() == events.size();
+    })) << "didn't receive enough events";
+    for (size_t i = 0; i < events.size(); i++) {
+        EXPECT_GE(deliveryTimes[i], events[i].timestamp) << "event " << i << " delivered early";
+    }
+    uniqueLock.unlock();
+
+    hub.reset();
+}
+
+TEST_F(FakeVehicleHalValueGeneratorsTest, testDestroyWithoutPendingEvents) {
+    // The scheduler thread waits without a deadline when there is no event, destroying the hub
+    // right after creating it must still wake it up.
+    for (int i = 0; i < 1000; i++) {
+        GeneratorHub hub([](const VehiclePropValue&) {});
+    }
+}
+
+TEST_F(FakeVehicleHalValueGeneratorsTest, testGetGeneratorStats) {
+    std::unique_ptr<LinearFakeValueGenerator> generator =
+            std::make_unique<LinearFakeValueGenerator>(toInt(VehicleProperty::PERF_VEHICLE_SPEED),
+                                                       /*middleValue=*/50.0,
+                                                       /*initValue=*/30.0,
+                                                       /*dispersion=*/50.0,
+                                                       /*increment=*/20.0,
+                                                       // 100Hz.
+                                                       /*interval=*/10000000);
+    getHub()->registerGenerator(0, std::move(generator));
+
+    waitForEvents(10);
+
+    auto statsById = getHub()->getGeneratorStats();
+    ASSERT_EQ(statsById.count(0), 1u);
+    const auto& stats = statsById[0];
+    EXPECT_GE(stats.eventCount, 10);
+    EXPECT_FLOAT_EQ(stats.requestedRateHz, 100.0f);
+    EXPECT_GT(stats.achievedRateHz, 0.0f);
+    EXPECT_NE(getHub()->dumpStats().find("Generator 0"), std::string::npos);
+}
+
 TEST_F(FakeVehicleHalValueGeneratorsTest, testLinerFakeValueGeneratorFloat) {
     std::unique_ptr<LinearFakeValueGenerator> generator =
             std::make_unique<LinearFakeValueGenerator>(toInt(VehicleProperty::PERF_VEHICLE_SPEED),
@@ -53,6 +53,13 @@ class FakeVehicleHardware : public IVehicleHardware {
     FakeVehicleHardware(std::string defaultConfigDir, std::string overrideConfigDir,
                         bool forceOverride);
 
+    // If configCacheDir is not empty, the parsed config files are cached in binary format in that
+    // directory to speed up the following initializations. The directory must be created and
+    // labelled by the device, and be mounted when the VHAL starts for the cache to be used. The
+    // default constructor does not use a cache, as the default VHAL starts before /data is mounted.
+    FakeVehicleHardware(std::string defaultConfigDir, std::string overrideConfigDir,
+                        bool forceOverride, std::string configCacheDir);
+
     ~FakeVehicleHardware();
 
     // Get all the property configs.
@@ -158,6 +165,7 @@ class FakeVehicleHardware : public IVehicleHardware {
 
     const std::string mDefaultConfigDir;
     const std::string mOverrideConfigDir;
+    const std::string mConfigCacheDir;
     const bool mForceOverride;
     bool mAddExtraTestVendorConfigs;
 
@@ -174,6 +182,8 @@ class FakeVehicleHardware : public IVehicleHardware {
     // into a map from property ID to ConfigDeclarations.
     void loadPropConfigsFromDir(const std::string& dirPath,
                                 std::unordered_map<int32_t, ConfigDeclaration>* configs);
+    // Returns the path of the binary cache for a config file.
+    std::string getConfigCachePath(const std::string& configPath) const;
     // Function to be called when a value change event comes from vehicle bus. In our fake
     // implementation, this function is only called during "--inject-event" dump command.
     void eventFromVehicleBus(
@@ -39,6 +39,8 @@
 #include <dirent.h>
 #include <inttypes.h>
 #include <sys/types.h>
+#include <unistd.h>
+#include <algorithm>
 #include <fstream>
 #include <regex>
 #include <unordered_set>
@@ -238,17 +240,27 @@ FakeVehicleHardware::FakeVehicleHardware()
 
 FakeVehicleHardware::FakeVehicleHardware(std::string defaultConfigDir,
                                          std::string overrideConfigDir, bool forceOverride)
+    : FakeVehicleHardware(defaultConfigDir, overrideConfigDir, forceOverride,
+                          /*configCacheDir=*/"") {}
+
+FakeVehicleHardware::FakeVehicleHardware(std::string defaultConfigDir,
+                                         std::string overrideConfigDir, bool forceOverride,
+                                         std::string configCacheDir)
     : mValuePool(std::make_unique<VehiclePropValuePool>()),
       mServerSidePropStore(new VehiclePropertyStore(mValuePool)),
       mFakeObd2Frame(new obd2frame::FakeObd2Frame(mServerSidePropStore)),
       mFakeUserHal(new FakeUserHal(mValuePool)),
       mRecurrentTimer(new RecurrentTimer()),
-      mGeneratorHub(new GeneratorHub(
-              [this](const VehiclePropValue& value) { eventFromVehicleBus(value); })),
+      mGeneratorHub(new GeneratorHub([this](const std::vector<VehiclePropValue>& values) {
+          for (const auto& value : values) {
+              eventFromVehicleBus(value);
+          }
+      })),
       mPendingGetValueRequests(this),
       mPendingSetValueRequests(this),
       mDefaultConfigDir(defaultConfigDir),
       mOverrideConfigDir(overrideConfigDir),
+      mConfigCacheDir(configCacheDir),
       mForceOverride(forceOverride) {
     init();
 }
@@ -270,18 +282,20 @@ std::unordered_map<int32_t, ConfigDeclaration> FakeVehicleHardware::loadConfigDe
 }
 
 void FakeVehicleHardware::init() {
-    for (auto& [_, configDeclaration] : loadConfigDeclarations()) {
+    int64_t loadStartTime = elapsedRealtimeNano();
+    auto configsByPropId = loadConfigDeclarations();
+    ALOGI("loaded %zu property configs in %" PRId64 "us", configsByPropId.size(),
+          (elapsedRealtimeNano() - loadStartTime) / 1000);
+
+    for (auto& [_, configDeclaration] : configsByPropId) {
         VehiclePropConfig cfg = configDeclaration.config;
-        VehiclePropertyStore::TokenFunction tokenFunction = nullptr;
 
         if (cfg.prop == toInt(VehicleProperty::AP_POWER_STATE_REQ)) {
             int config = GetIntProperty(POWER_STATE_REQ_CONFIG_PROPERTY, /*default_value=*/0);
             cfg.configArray[0] = config;
-        } else if (cfg.prop == OBD2_FREEZE_FRAME) {
-            tokenFunction = [](const VehiclePropValue& propValue) { return propValue.timestamp; };
         }
 
-        mServerSidePropStore->registerProperty(cfg, tokenFunction);
+        mServerSidePropStore->registerProperty(cfg);
         if (obd2frame::FakeObd2Frame::isDiagnosticProperty(cfg)) {
             // Ignore storing default value for diagnostic property. They have special get/set
             // logic.
@@ -620,6 +634,9 @@ FakeVehicleHardware::ValueResultType FakeVehicleHardware::maybeGetSpecialValue(
     }
 
     switch (propId) {
+        case OBD2_LIVE_FRAME:
+            *isSpecialValue = true;
+            return mFakeObd2Frame->getObd2LiveFrame();
         case OBD2_FREEZE_FRAME:
             *isSpecialValue = true;
             result = mFakeObd2Frame->getObd2FreezeFrame(value);
@@ -1035,6 +1052,8 @@ provided, it would iterate indefinitely.
 
 --genfakedata --stopjson [generatorID(string)]: Stop a JSON generator.
 
+--genfakedata --stats: Show the requested and achieved event rates for all running generators.
+
 --genfakedata --keypress [keyCode(int32)] [display[int32]]: Generate key press.
 
 --genfakedata --keyinputv2 [area(int32)] [display(int32)] [keyCode[int32]] [action[int32]]
@@ -1174,6 +1193,12 @@ std::string FakeVehicleHardware::genFakeDataCommand(const std::vector<std::strin
         } else {
             return StringPrintf("No JSON event generator found for ID: %s", options[2].c_str());
         }
+    } else if (command == "--stats") {
+        // --genfakedata --stats
+        if (options.size() != 2) {
+            return "incorrect argument count, need 2 arguments for --genfakedata --stats\n";
+        }
+        return mGeneratorHub->dumpStats();
     } else if (command == "--keypress") {
         int32_t keyCode;
         int32_t display;
@@ -1393,6 +1418,24 @@ VehiclePropValue FakeVehicleHardware::createHwMotionInputProp(
 }
 
 void FakeVehicleHardware::eventFromVehicleBus(const VehiclePropValue& value) {
+    if (value.prop == OBD2_FREEZE_FRAME) {
+        // Freeze frames are kept in a bounded storage in FakeObd2Frame instead of the property
+        // store.
+        mFakeObd2Frame->addObd2FreezeFrame(value);
+        onValueChangeCallback(value);
+        return;
+    }
+    if (value.prop == OBD2_LIVE_FRAME) {
+        // The live frame is read from the sensor store in FakeObd2Frame, not the property store.
+        if (auto result = mFakeObd2Frame->setObd2LiveFrame(value); !result.ok()) {
+            ALOGE("failed to update OBD2 live frame: %s", getErrorMsg(result).c_str());
+            return;
+        }
+        if (auto liveFrame = mFakeObd2Frame->getObd2LiveFrame(); liveFrame.ok()) {
+            onValueChangeCallback(*liveFrame.value());
+        }
+        return;
+    }
     mServerSidePropStore->writeValue(mValuePool->obtain(value));
 }
 
@@ -1871,6 +1914,13 @@ void FakeVehicleHardware::loadPropConfigsFromDir(
         const std::string& dirPath,
         std::unordered_map<int32_t, ConfigDeclaration>* configsByPropId) {
     ALOGI("loading properties from %s", dirPath.c_str());
+    // The cache directory may not be mounted yet, e.g. when it is under /data and the VHAL starts
+    // in early boot. Parse the config files in that case instead of failing to write the caches.
+    bool useCache = !mConfigCacheDir.empty() && access(mConfigCacheDir.c_str(), W_OK) == 0;
+    if (!mConfigCacheDir.empty() && !useCache) {
+        ALOGI("config cache dir %s is not available, not using the config cache",
+              mConfigCacheDir.c_str());
+    }
     if (auto dir = opendir(dirPath.c_str()); dir != NULL) {
         std::regex regJson(".*[.]json", std::regex::icase);
         while (auto f = readdir(dir)) {
@@ -1879,7 +1929,8 @@ void FakeVehicleHardware::loadPropConfigsFromDir(
             }
             std::string filePath = dirPath + "/" + std::string(f->d_name);
             ALOGI("loading properties from %s", filePath.c_str());
-            auto result = mLoader.loadPropConfig(filePath);
+            auto result = useCache ? mLoader.loadPropConfig(filePath, getConfigCachePath(filePath))
+                                   : mLoader.loadPropConfig(filePath);
             if (!result.ok()) {
                 ALOGE("failed to load config file: %s, error: %s", filePath.c_str(),
                       result.error().message().c_str());
@@ -1893,6 +1944,14 @@ void FakeVehicleHardware::loadPropConfigsFromDir(
     }
 }
 
+std::string FakeVehicleHardware::getConfigCachePath(const std::string& configPath) const {
+    // Flatten the config file path so that config files with the same name in different
+    // directories do not share a cache.
+    std::string cacheName = configPath;
+    std::replace(cacheName.begin(), cacheName.end(), '/', '_');
+    return mConfigCacheDir + "/" + cacheName + ".cache";
+}
+
 Result<float> FakeVehicleHardware::safelyParseFloat(int index, const std::string& s) {
     float out;
     if (!ParseFloat(s, &out)) {
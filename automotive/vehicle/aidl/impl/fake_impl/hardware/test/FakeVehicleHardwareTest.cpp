@@ -31,6 +31,8 @@
 #include <utils/SystemClock.h>
 
 #include <inttypes.h>
+#include <unistd.h>
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <unordered_map>
@@ -751,6 +753,46 @@ TEST_F(FakeVehicleHardwareTest, testVendorOverridePropertiesMultipleAreas) {
     ASSERT_EQ(30.0f, result.value().value.floatValues[0]);
 }
 
+TEST_F(FakeVehicleHardwareTest, testConfigCache) {
+    std::string currentDir = android::base::GetExecutableDirectory();
+    std::string overrideDir = currentDir + "/override/";
+    android::base::TemporaryDir cacheDir;
+
+    // The first initialization parses the JSON files and generates the caches, the second one
+    // loads the configs from the caches.
+    FakeVehicleHardware hardwareWithoutCache(currentDir, overrideDir, /*forceOverride=*/true,
+                                             cacheDir.path);
+    FakeVehicleHardware hardwareWithCache(currentDir, overrideDir, /*forceOverride=*/true,
+                                          cacheDir.path);
+
+    auto expectedConfigs = getHardware()->getAllPropertyConfigs();
+    auto configsWithoutCache = hardwareWithoutCache.getAllPropertyConfigs();
+    auto configsWithCache = hardwareWithCache.getAllPropertyConfigs();
+    auto byPropId = [](const VehiclePropConfig& lhs, const VehiclePropConfig& rhs) {
+        return lhs.prop < rhs.prop;
+    };
+    std::sort(configsWithoutCache.begin(), configsWithoutCache.end(), byPropId);
+    std::sort(configsWithCache.begin(), configsWithCache.end(), byPropId);
+
+    ASSERT_EQ(configsWithoutCache, configsWithCache);
+    ASSERT_GE(configsWithCache.size(), expectedConfigs.size());
+}
+
+TEST_F(FakeVehicleHardwareTest, testConfigCacheDirNotAvailable) {
+    std::string currentDir = android::base::GetExecutableDirectory();
+    std::string overrideDir = currentDir + "/override/";
+    android::base::TemporaryDir cacheDir;
+    std::string missingCacheDir = std::string(cacheDir.path) + "/not_mounted";
+
+    FakeVehicleHardware hardwareWithoutCacheDir(currentDir, overrideDir, /*forceOverride=*/true,
+                                                missingCacheDir);
+    FakeVehicleHardware hardwareWithoutCache(currentDir, overrideDir, /*forceOverride=*/true);
+
+    ASSERT_EQ(hardwareWithoutCacheDir.getAllPropertyConfigs().size(),
+              hardwareWithoutCache.getAllPropertyConfigs().size());
+    ASSERT_NE(access(missingCacheDir.c_str(), F_OK), 0) << "cache dir must not be created";
+}
+
 TEST_F(FakeVehicleHardwareTest, testVendorOverridePropertiesDirDoesNotExist) {
     std::string currentDir = android::base::GetExecutableDirectory();
     std::string overrideDir = currentDir + "/override/";
@@ -2530,6 +2572,9 @@ std::vector<OptionsTestCase> GenInvalidOptions() {
             {"genfakedata_stopjson_no_args",
              {"--genfakedata", "--stopjson"},
              "incorrect argument count"},
+            {"genfakedata_stats_extra_args",
+             {"--genfakedata", "--stats", "1"},
+             "incorrect argument count"},
             {"genfakedata_keypress_no_args",
              {"--genfakedata", "--keypress"},
              "incorrect argument count"},
@@ -2639,6 +2684,12 @@ TEST_F(FakeVehicleHardwareTest, testDebugGenFakeDataLinear) {
         value = (value + 20) % 100;
     }
 
+    result = getHardware()->dump({"--genfakedata", "--stats"});
+
+    ASSERT_FALSE(result.callerShouldDumpState);
+    ASSERT_THAT(result.buffer, HasSubstr(StringPrintf("Generator %s", propIdString.c_str())));
+    ASSERT_THAT(result.buffer, HasSubstr("requested rate: 10.00Hz"));
+
     // Stop the linear generator.
     options = {"--genfakedata", "--stoplinear", propIdString};
 
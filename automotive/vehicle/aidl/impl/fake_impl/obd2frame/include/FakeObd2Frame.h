@@ -16,6 +16,7 @@
 #ifndef android_hardware_automotive_vehicle_aidl_impl_fake_impl_obd2frame_include_FakeObd2Frame_H_
 #define android_hardware_automotive_vehicle_aidl_impl_fake_impl_obd2frame_include_FakeObd2Frame_H_
 
+#include <Obd2FreezeFrameRing.h>
 #include <Obd2SensorStore.h>
 #include <VehicleHalTypes.h>
 #include <VehiclePropertyStore.h>
@@ -31,24 +32,42 @@ namespace obd2frame {
 
 class FakeObd2Frame final {
   public:
+    // The maximum number of freeze frames kept. Once reached, the oldest freeze frame is dropped.
+    static constexpr size_t MAX_FREEZE_FRAMES = 64;
+
     explicit FakeObd2Frame(std::shared_ptr<VehiclePropertyStore> propStore)
-        : mPropStore(propStore) {}
+        : mPropStore(propStore),
+          mFreezeFrames(propStore->getValuePool(), MAX_FREEZE_FRAMES) {}
 
     void initObd2LiveFrame(
             const aidl::android::hardware::automotive::vehicle::VehiclePropConfig& propConfig);
     void initObd2FreezeFrame(
             const aidl::android::hardware::automotive::vehicle::VehiclePropConfig& propConfig);
+    // Returns the live frame, built from the latest published sensor frame.
+    VhalResult<VehiclePropValuePool::RecyclableType> getObd2LiveFrame() const;
+    // Updates the live frame sensors from an injected live frame. Only the sensors set in the
+    // bitmask of the injected frame are updated, or all of them if it has no bitmask.
+    VhalResult<void> setObd2LiveFrame(
+            const aidl::android::hardware::automotive::vehicle::VehiclePropValue& liveFrame);
     VhalResult<VehiclePropValuePool::RecyclableType> getObd2FreezeFrame(
             const aidl::android::hardware::automotive::vehicle::VehiclePropValue&
                     requestedPropValue) const;
     VhalResult<VehiclePropValuePool::RecyclableType> getObd2DtcInfo() const;
     VhalResult<void> clearObd2FreezeFrames(
             const aidl::android::hardware::automotive::vehicle::VehiclePropValue& propValue);
+    // Stores a new freeze frame, e.g. one injected from a fake data generator.
+    void addObd2FreezeFrame(
+            const aidl::android::hardware::automotive::vehicle::VehiclePropValue& freezeFrame);
     static bool isDiagnosticProperty(
             const aidl::android::hardware::automotive::vehicle::VehiclePropConfig& propConfig);
 
   private:
     std::shared_ptr<VehiclePropertyStore> mPropStore;
+    // The sensors of the live frame. Set once by initObd2LiveFrame, readers then share the
+    // published sensor frames instead of copying them through mPropStore.
+    std::unique_ptr<Obd2SensorStore> mLiveFrameSensors;
+    // Freeze frames are kept here instead of in mPropStore so that the storage stays bounded.
+    Obd2FreezeFrameRing mFreezeFrames;
 
     std::unique_ptr<Obd2SensorStore> fillDefaultObd2Frame(size_t numVendorIntegerSensors,
                                                           size_t numVendorFloatSensors);
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef android_hardware_automotive_vehicle_aidl_impl_fake_impl_obd2frame_include_Obd2FreezeFrameRing_H_
+#define android_hardware_automotive_vehicle_aidl_impl_fake_impl_obd2frame_include_Obd2FreezeFrameRing_H_
+
+#include <VehicleHalTypes.h>
+#include <VehicleObjectPool.h>
+
+#include <android-base/thread_annotations.h>
+
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+namespace fake {
+namespace obd2frame {
+
+// A bounded storage for OBD2 freeze frames, indexed by the frame timestamp.
+//
+// Frames are stored in a fixed number of slots. Adding a frame uses a free slot if there is one,
+// including the slots of removed frames, and only evicts the oldest frame once all the slots are
+// used. Adding a frame with the timestamp of a stored frame replaces the stored frame.
+//
+// This class is thread-safe.
+class Obd2FreezeFrameRing final {
+  public:
+    Obd2FreezeFrameRing(std::shared_ptr<VehiclePropValuePool> valuePool, size_t capacity);
+
+    // Stores a freeze frame. Returns the timestamp of the evicted frame if the ring was full.
+    std::optional<int64_t> add(
+            const aidl::android::hardware::automotive::vehicle::VehiclePropValue& freezeFrame);
+
+    // Returns the freeze frame at the timestamp, or nullptr if there is none.
+    VehiclePropValuePool::RecyclableType get(int64_t timestamp) const;
+
+    // Returns the timestamps for all the stored frames, from the oldest to the newest.
+    std::vector<int64_t> getTimestamps() const;
+
+    // Removes the freeze frame at the timestamp. Returns false if there is none.
+    bool remove(int64_t timestamp);
+
+    // Removes all the freeze frames.
+    void clear();
+
+    size_t size() const;
+
+  private:
+    const std::shared_ptr<VehiclePropValuePool> mValuePool;
+    const size_t mCapacity;
+
+    struct Slot {
+        aidl::android::hardware::automotive::vehicle::VehiclePropValue freezeFrame;
+        // The order in which the frames were added, the oldest frame has the lowest sequence.
+        uint64_t sequence;
+    };
+
+    mutable std::mutex mLock;
+    std::vector<std::optional<Slot>> mSlots GUARDED_BY(mLock);
+    std::unordered_map<int64_t, size_t> mSlotIndexByTimestamp GUARDED_BY(mLock);
+    // The indexes of the empty slots, the next frame is written to the last one.
+    std::vector<size_t> mFreeSlotIndexes GUARDED_BY(mLock);
+    uint64_t mNextSequence GUARDED_BY(mLock) = 0;
+
+    void resetLocked() REQUIRES(mLock);
+    // Returns the index of the slot holding the oldest frame. Must only be called when all the
+    // slots are used.
+    size_t findOldestSlotIndexLocked() const REQUIRES(mLock);
+};
+
+}  // namespace obd2frame
+}  // namespace fake
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
+
+#endif  // android_hardware_automotive_vehicle_aidl_impl_fake_impl_obd2frame_include_Obd2FreezeFrameRing_H_
@@ -22,8 +22,12 @@
 #include <VehicleUtils.h>
 
 #include <android-base/result.h>
+#include <android-base/thread_annotations.h>
 
 #include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace android {
@@ -37,8 +41,25 @@ namespace obd2frame {
 // It allows storing sensor values, setting appropriate bitmasks as needed, and returning
 // appropriately laid out storage of sensor values suitable for being returned via a VehicleHal
 // implementation.
+//
+// Sensor values are kept in two buffers. Writers update the back buffer and record which ranges
+// changed. Readers get the front buffer as an immutable, versioned SensorFrame that they can share
+// without copying. When a reader asks for a frame after a write, the buffers are swapped and only
+// the changed ranges are copied into the new back buffer.
+//
+// This class is thread-safe.
 class Obd2SensorStore final {
   public:
+    // A snapshot of all the stored sensors. A published frame is never modified.
+    struct SensorFrame {
+        // Increases by one every time a new frame is published.
+        uint64_t version = 0;
+        std::vector<int32_t> integerSensors;
+        std::vector<float> floatSensors;
+        // A bitmask for all the stored sensors, integer sensors first, then float sensors.
+        std::vector<uint8_t> sensorsBitmask;
+    };
+
     // Creates a sensor storage with a given number of vendor-specific sensors.
     Obd2SensorStore(std::shared_ptr<VehiclePropValuePool> valuePool, size_t numVendorIntegerSensors,
                     size_t numVendorFloatSensors);
@@ -67,36 +88,55 @@ class Obd2SensorStore final {
     // Stores a float-valued sensor.
     aidl::android::hardware::automotive::vehicle::StatusCode setFloatSensor(size_t index,
                                                                             float value);
+    // Stores many sensors at once. Either all the sensors are stored, or none of them is stored if
+    // any index is out of bound.
+    aidl::android::hardware::automotive::vehicle::StatusCode setSensors(
+            const std::vector<std::pair<size_t, int32_t>>& integerSensors,
+            const std::vector<std::pair<size_t, float>>& floatSensors);
+
+    // Returns the number of integer sensors, including the vendor-specific ones.
+    size_t getIntegerSensorCount() const { return mNumIntegerSensors; }
+
+    // Returns the latest sensor frame. The same frame is returned until a sensor is changed.
+    std::shared_ptr<const SensorFrame> getSensorFrame() const;
 
     // Returns a sensor property value using the given DTC.
     VehiclePropValuePool::RecyclableType getSensorProperty(const std::string& dtc) const;
 
   private:
-    class BitmaskInVector final {
+    // A range of indexes [begin, end) that changed since the last published frame.
+    class DirtyRange final {
       public:
-        explicit BitmaskInVector(size_t numBits = 0);
-        void resize(size_t numBits);
-        android::base::Result<bool> get(size_t index) const;
-        android::base::Result<void> set(size_t index, bool value);
-
-        const std::vector<uint8_t>& getBitmask() const;
+        void mark(size_t index);
+        bool empty() const;
+        void clear();
+        // Copies the elements in the range from one vector to another.
+        template <class T>
+        void copy(const std::vector<T>& from, std::vector<T>* to) const;
 
       private:
-        std::vector<uint8_t> mStorage;
-        size_t mNumBits;
+        size_t mBegin = 0;
+        size_t mEnd = 0;
     };
 
-    std::vector<int32_t> mIntegerSensors;
-    std::vector<float> mFloatSensors;
-    BitmaskInVector mSensorsBitmask;
+    const size_t mNumIntegerSensors;
+    const size_t mNumFloatSensors;
     std::shared_ptr<VehiclePropValuePool> mValuePool;
 
-    // Returns a vector that contains all integer sensors stored.
-    const std::vector<int32_t>& getIntegerSensors() const;
-    // Returns a vector that contains all float sensors stored.
-    const std::vector<float>& getFloatSensors() const;
-    // Returns a vector that contains a bitmask for all stored sensors.
-    const std::vector<uint8_t>& getSensorsBitmask() const;
+    mutable std::mutex mLock;
+    // The buffer that writers update.
+    mutable std::shared_ptr<SensorFrame> mBackFrame GUARDED_BY(mLock);
+    // The buffer that was published last.
+    mutable std::shared_ptr<SensorFrame> mFrontFrame GUARDED_BY(mLock);
+    mutable DirtyRange mDirtyIntegerSensors GUARDED_BY(mLock);
+    mutable DirtyRange mDirtyFloatSensors GUARDED_BY(mLock);
+    mutable DirtyRange mDirtyBitmask GUARDED_BY(mLock);
+
+    void setIntegerSensorLocked(size_t index, int32_t value) REQUIRES(mLock);
+    void setFloatSensorLocked(size_t index, float value) REQUIRES(mLock);
+    void setBitLocked(size_t index) REQUIRES(mLock);
+    // Publishes the back buffer as the new front buffer if any sensor changed.
+    void publishLocked() const REQUIRES(mLock);
 };
 
 }  // namespace obd2frame
@@ -25,6 +25,8 @@
 #include <android-base/result.h>
 #include <utils/Log.h>
 
+#include <inttypes.h>
+
 namespace android {
 namespace hardware {
 namespace automotive {
@@ -104,12 +106,50 @@ std::unique_ptr<Obd2SensorStore> FakeObd2Frame::fillDefaultObd2Frame(size_t numV
 }
 
 void FakeObd2Frame::initObd2LiveFrame(const VehiclePropConfig& propConfig) {
-    auto sensorStore = fillDefaultObd2Frame(static_cast<size_t>(propConfig.configArray[0]),
-                                            static_cast<size_t>(propConfig.configArray[1]));
-    auto liveObd2Frame = sensorStore->getSensorProperty("");
+    mLiveFrameSensors = fillDefaultObd2Frame(static_cast<size_t>(propConfig.configArray[0]),
+                                             static_cast<size_t>(propConfig.configArray[1]));
+}
+
+VhalResult<VehiclePropValuePool::RecyclableType> FakeObd2Frame::getObd2LiveFrame() const {
+    if (mLiveFrameSensors == nullptr) {
+        return StatusError(StatusCode::NOT_AVAILABLE) << "OBD2_LIVE_FRAME is not configured";
+    }
+    auto liveObd2Frame = mLiveFrameSensors->getSensorProperty("");
     liveObd2Frame->prop = OBD2_LIVE_FRAME;
+    return liveObd2Frame;
+}
 
-    mPropStore->writeValue(std::move(liveObd2Frame), /*updateStatus=*/true);
+VhalResult<void> FakeObd2Frame::setObd2LiveFrame(const VehiclePropValue& liveFrame) {
+    if (mLiveFrameSensors == nullptr) {
+        return StatusError(StatusCode::NOT_AVAILABLE) << "OBD2_LIVE_FRAME is not configured";
+    }
+    const auto& integerValues = liveFrame.value.int32Values;
+    const auto& floatValues = liveFrame.value.floatValues;
+    const auto& bitmask = liveFrame.value.byteValues;
+    // The bitmask covers all the integer sensors of the frame first, then the float sensors, no
+    // matter how many integer values were given.
+    const size_t firstFloatBit = mLiveFrameSensors->getIntegerSensorCount();
+    auto isSet = [&bitmask](size_t bitIndex) {
+        return bitmask.empty() ||
+               (bitIndex / 8 < bitmask.size() && (bitmask[bitIndex / 8] & (1 << (bitIndex % 8))));
+    };
+    std::vector<std::pair<size_t, int32_t>> integerSensors;
+    for (size_t i = 0; i < integerValues.size(); i++) {
+        if (isSet(i)) {
+            integerSensors.push_back({i, integerValues[i]});
+        }
+    }
+    std::vector<std::pair<size_t, float>> floatSensors;
+    for (size_t i = 0; i < floatValues.size(); i++) {
+        if (isSet(firstFloatBit + i)) {
+            floatSensors.push_back({i, floatValues[i]});
+        }
+    }
+    if (auto status = mLiveFrameSensors->setSensors(integerSensors, floatSensors);
+        status != StatusCode::OK) {
+        return StatusError(status) << "invalid OBD2_LIVE_FRAME sensors";
+    }
+    return {};
 }
 
 void FakeObd2Frame::initObd2FreezeFrame(const VehiclePropConfig& propConfig) {
@@ -121,7 +161,14 @@ void FakeObd2Frame::initObd2FreezeFrame(const VehiclePropConfig& propConfig) {
         auto freezeFrame = sensorStore->getSensorProperty(dtc);
         freezeFrame->prop = OBD2_FREEZE_FRAME;
 
-        mPropStore->writeValue(std::move(freezeFrame), /*updateStatus=*/true);
+        addObd2FreezeFrame(*freezeFrame);
+    }
+}
+
+void FakeObd2Frame::addObd2FreezeFrame(const VehiclePropValue& freezeFrame) {
+    if (auto evictedTimestamp = mFreezeFrames.add(freezeFrame); evictedTimestamp.has_value()) {
+        ALOGW("too many OBD2 freeze frames, dropped the one at timestamp: %" PRId64,
+              *evictedTimestamp);
     }
 }
 
@@ -131,56 +178,39 @@ VhalResult<VehiclePropValuePool::RecyclableType> FakeObd2Frame::getObd2FreezeFra
         return StatusError(StatusCode::INVALID_ARG)
                << "asked for OBD2_FREEZE_FRAME without valid timestamp";
     }
-    auto readValuesResult = mPropStore->readValuesForProperty(OBD2_FREEZE_FRAME);
-    if (!readValuesResult.ok()) {
-        return StatusError(StatusCode::INTERNAL_ERROR)
-               << "failed to read OBD2_FREEZE_FRAME property: "
-               << readValuesResult.error().message();
-    }
-    if (readValuesResult.value().size() == 0) {
+    if (mFreezeFrames.size() == 0) {
         // Should no freeze frame be available at the given timestamp, a response of NOT_AVAILABLE
         // must be returned by the implementation
         return StatusError(StatusCode::NOT_AVAILABLE);
     }
     auto timestamp = requestedPropValue.value.int64Values[0];
-    auto readValueResult = mPropStore->readValue(OBD2_FREEZE_FRAME, /*area=*/0, timestamp);
-    if (!readValueResult.ok()) {
+    auto freezeFrame = mFreezeFrames.get(timestamp);
+    if (freezeFrame == nullptr) {
         return StatusError(StatusCode::INVALID_ARG)
                << "asked for OBD2_FREEZE_FRAME at invalid timestamp";
     }
-    return readValueResult;
+    return freezeFrame;
 }
 
 VhalResult<VehiclePropValuePool::RecyclableType> FakeObd2Frame::getObd2DtcInfo() const {
-    std::vector<int64_t> timestamps;
-    auto result = mPropStore->readValuesForProperty(OBD2_FREEZE_FRAME);
-    if (!result.ok()) {
-        return StatusError(StatusCode::INTERNAL_ERROR)
-               << "failed to read OBD2_FREEZE_FRAME property: " << result.error().message();
-    }
-    for (const auto& freezeFrame : result.value()) {
-        timestamps.push_back(freezeFrame->timestamp);
-    }
+    std::vector<int64_t> timestamps = mFreezeFrames.getTimestamps();
     auto outValue =
             mPropStore->getValuePool()->obtain(VehiclePropertyType::INT64_VEC, timestamps.size());
-    outValue->value.int64Values = timestamps;
+    outValue->value.int64Values = std::move(timestamps);
     outValue->prop = OBD2_FREEZE_FRAME_INFO;
     return outValue;
 }
 
 VhalResult<void> FakeObd2Frame::clearObd2FreezeFrames(const VehiclePropValue& propValue) {
     if (propValue.value.int64Values.size() == 0) {
-        mPropStore->removeValuesForProperty(OBD2_FREEZE_FRAME);
+        mFreezeFrames.clear();
         return {};
     }
     for (int64_t timestamp : propValue.value.int64Values) {
-        auto result = mPropStore->readValue(OBD2_FREEZE_FRAME, 0, timestamp);
-        if (!result.ok()) {
+        if (!mFreezeFrames.remove(timestamp)) {
             return StatusError(StatusCode::INVALID_ARG)
-                   << "asked for OBD2_FREEZE_FRAME at invalid timestamp, error: %s"
-                   << result.error().message();
+                   << "asked for OBD2_FREEZE_FRAME at invalid timestamp: " << timestamp;
         }
-        mPropStore->removeValue(*result.value());
     }
     return {};
 }
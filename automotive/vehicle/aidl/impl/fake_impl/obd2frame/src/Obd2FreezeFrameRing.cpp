@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Obd2FreezeFrameRing.h"
+
+#include <algorithm>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+namespace fake {
+namespace obd2frame {
+
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropValue;
+
+Obd2FreezeFrameRing::Obd2FreezeFrameRing(std::shared_ptr<VehiclePropValuePool> valuePool,
+                                         size_t capacity)
+    : mValuePool(valuePool), mCapacity(capacity) {
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    resetLocked();
+}
+
+std::optional<int64_t> Obd2FreezeFrameRing::add(const VehiclePropValue& freezeFrame) {
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    if (mCapacity == 0) {
+        return std::nullopt;
+    }
+    if (auto it = mSlotIndexByTimestamp.find(freezeFrame.timestamp);
+        it != mSlotIndexByTimestamp.end()) {
+        mSlots[it->second]->freezeFrame = freezeFrame;
+        return std::nullopt;
+    }
+
+    std::optional<int64_t> evictedTimestamp;
+    size_t slotIndex;
+    if (!mFreeSlotIndexes.empty()) {
+        slotIndex = mFreeSlotIndexes.back();
+        mFreeSlotIndexes.pop_back();
+    } else {
+        slotIndex = findOldestSlotIndexLocked();
+        evictedTimestamp = mSlots[slotIndex]->freezeFrame.timestamp;
+        mSlotIndexByTimestamp.erase(*evictedTimestamp);
+    }
+    mSlots[slotIndex] = Slot{
+            .freezeFrame = freezeFrame,
+            .sequence = mNextSequence++,
+    };
+    mSlotIndexByTimestamp[freezeFrame.timestamp] = slotIndex;
+    return evictedTimestamp;
+}
+
+VehiclePropValuePool::RecyclableType Obd2FreezeFrameRing::get(int64_t timestamp) const {
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    auto it = mSlotIndexByTimestamp.find(timestamp);
+    if (it == mSlotIndexByTimestamp.end()) {
+        return nullptr;
+    }
+    return mValuePool->obtain(mSlots[it->second]->freezeFrame);
+}
+
+std::vector<int64_t> Obd2FreezeFrameRing::getTimestamps() const {
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    std::vector<std::pair<uint64_t, int64_t>> timestampsBySequence;
+    timestampsBySequence.reserve(mSlotIndexByTimestamp.size());
+    for (const std::optional<Slot>& slot : mSlots) {
+        if (slot.has_value()) {
+            timestampsBySequence.push_back({slot->sequence, slot->freezeFrame.timestamp});
+        }
+    }
+    std::sort(timestampsBySequence.begin(), timestampsBySequence.end());
+    std::vector<int64_t> timestamps;
+    timestamps.reserve(timestampsBySequence.size());
+    for (const auto& [_, timestamp] : timestampsBySequence) {
+        timestamps.push_back(timestamp);
+    }
+    return timestamps;
+}
+
+bool Obd2FreezeFrameRing::remove(int64_t timestamp) {
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    auto it = mSlotIndexByTimestamp.find(timestamp);
+    if (it == mSlotIndexByTimestamp.end()) {
+        return false;
+    }
+    mSlots[it->second].reset();
+    mFreeSlotIndexes.push_back(it->second);
+    mSlotIndexByTimestamp.erase(it);
+    return true;
+}
+
+void Obd2FreezeFrameRing::clear() {
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    resetLocked();
+}
+
+void Obd2FreezeFrameRing::resetLocked() {
+    mSlots.assign(mCapacity, std::nullopt);
+    mSlotIndexByTimestamp.clear();
+    mFreeSlotIndexes.clear();
+    // Fill the slots in order, starting from the first one.
+    for (size_t i = mCapacity; i > 0; i--) {
+        mFreeSlotIndexes.push_back(i - 1);
+    }
+}
+
+size_t Obd2FreezeFrameRing::findOldestSlotIndexLocked() const {
+    size_t oldestSlotIndex = 0;
+    for (size_t i = 1; i < mCapacity; i++) {
+        if (mSlots[i]->sequence < mSlots[oldestSlotIndex]->sequence) {
+            oldestSlotIndex = i;
+        }
+    }
+    return oldestSlotIndex;
+}
+
+size_t Obd2FreezeFrameRing::size() const {
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    return mSlotIndexByTimestamp.size();
+}
+
+}  // namespace obd2frame
+}  // namespace fake
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
@@ -20,6 +20,9 @@
 
 #include <utils/SystemClock.h>
 
+#include <algorithm>
+#include <atomic>
+
 namespace android {
 namespace hardware {
 namespace automotive {
@@ -31,53 +34,45 @@ using ::aidl::android::hardware::automotive::vehicle::DiagnosticFloatSensorIndex
 using ::aidl::android::hardware::automotive::vehicle::DiagnosticIntegerSensorIndex;
 using ::aidl::android::hardware::automotive::vehicle::StatusCode;
 using ::aidl::android::hardware::automotive::vehicle::VehiclePropertyType;
-using ::android::base::Error;
-using ::android::base::Result;
 
-Obd2SensorStore::BitmaskInVector::BitmaskInVector(size_t numBits) {
-    mNumBits = numBits;
-    resize(numBits);
+void Obd2SensorStore::DirtyRange::mark(size_t index) {
+    if (empty()) {
+        mBegin = index;
+        mEnd = index + 1;
+        return;
+    }
+    mBegin = std::min(mBegin, index);
+    mEnd = std::max(mEnd, index + 1);
 }
 
-void Obd2SensorStore::BitmaskInVector::resize(size_t numBits) {
-    mNumBits = numBits;
-    mStorage = std::vector<uint8_t>((numBits + 7) / 8, 0);
+bool Obd2SensorStore::DirtyRange::empty() const {
+    return mBegin == mEnd;
 }
 
-Result<void> Obd2SensorStore::BitmaskInVector::set(size_t index, bool value) {
-    const size_t byteIndex = index / 8;
-    const size_t bitIndex = index % 8;
-    if (index >= mNumBits) {
-        return Error() << "out of bound";
-    }
-    const uint8_t byte = mStorage[byteIndex];
-    uint8_t newValue = value ? (byte | (1 << bitIndex)) : (byte & ~(1 << bitIndex));
-    mStorage[byteIndex] = newValue;
-    return {};
+void Obd2SensorStore::DirtyRange::clear() {
+    mBegin = 0;
+    mEnd = 0;
 }
 
-Result<bool> Obd2SensorStore::BitmaskInVector::get(size_t index) const {
-    const size_t byteIndex = index / 8;
-    const size_t bitIndex = index % 8;
-    if (index >= mNumBits) {
-        return Error() << "out of bound";
-    }
-    const uint8_t byte = mStorage[byteIndex];
-    return (byte & (1 << bitIndex)) != 0;
-}
-
-const std::vector<uint8_t>& Obd2SensorStore::BitmaskInVector::getBitmask() const {
-    return mStorage;
+template <class T>
+void Obd2SensorStore::DirtyRange::copy(const std::vector<T>& from, std::vector<T>* to) const {
+    std::copy(from.begin() + mBegin, from.begin() + mEnd, to->begin() + mBegin);
 }
 
 Obd2SensorStore::Obd2SensorStore(std::shared_ptr<VehiclePropValuePool> valuePool,
                                  size_t numVendorIntegerSensors, size_t numVendorFloatSensors)
-    : mValuePool(valuePool) {
-    const size_t numSystemIntegerSensors = getLastIndex<DiagnosticIntegerSensorIndex>() + 1;
-    const size_t numSystemFloatSensors = getLastIndex<DiagnosticFloatSensorIndex>() + 1;
-    mIntegerSensors = std::vector<int32_t>(numSystemIntegerSensors + numVendorIntegerSensors, 0);
-    mFloatSensors = std::vector<float>(numSystemFloatSensors + numVendorFloatSensors, 0);
-    mSensorsBitmask.resize(mIntegerSensors.size() + mFloatSensors.size());
+    : mNumIntegerSensors(getLastIndex<DiagnosticIntegerSensorIndex>() + 1 +
+                         numVendorIntegerSensors),
+      mNumFloatSensors(getLastIndex<DiagnosticFloatSensorIndex>() + 1 + numVendorFloatSensors),
+      mValuePool(valuePool) {
+    auto frame = std::make_shared<SensorFrame>();
+    frame->integerSensors = std::vector<int32_t>(mNumIntegerSensors, 0);
+    frame->floatSensors = std::vector<float>(mNumFloatSensors, 0);
+    frame->sensorsBitmask = std::vector<uint8_t>((mNumIntegerSensors + mNumFloatSensors + 7) / 8, 0);
+
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    mBackFrame = std::make_shared<SensorFrame>(*frame);
+    mFrontFrame = std::move(frame);
 }
 
 StatusCode Obd2SensorStore::setIntegerSensor(DiagnosticIntegerSensorIndex index, int32_t value) {
@@ -88,50 +83,106 @@ StatusCode Obd2SensorStore::setFloatSensor(DiagnosticFloatSensorIndex index, flo
 }
 
 StatusCode Obd2SensorStore::setIntegerSensor(size_t index, int32_t value) {
-    if (index >= mIntegerSensors.size()) {
+    if (index >= mNumIntegerSensors) {
         ALOGE("failed to set integer sensor: OOB");
         return StatusCode::INVALID_ARG;
     }
-    mIntegerSensors[index] = value;
-    if (auto result = mSensorsBitmask.set(index, true); !result.ok()) {
-        ALOGE("failed to set integer sensor: %s", result.error().message().c_str());
-        return StatusCode::INVALID_ARG;
-    }
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    setIntegerSensorLocked(index, value);
     return StatusCode::OK;
 }
 
 StatusCode Obd2SensorStore::setFloatSensor(size_t index, float value) {
-    if (index >= mFloatSensors.size()) {
-        ALOGE("failed to set integer sensor: OOB");
+    if (index >= mNumFloatSensors) {
+        ALOGE("failed to set float sensor: OOB");
         return StatusCode::INVALID_ARG;
     }
-    mFloatSensors[index] = value;
-    if (auto result = mSensorsBitmask.set(index + mIntegerSensors.size(), true); !result.ok()) {
-        ALOGE("failed to set float sensor: %s", result.error().message().c_str());
-        return StatusCode::INVALID_ARG;
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    setFloatSensorLocked(index, value);
+    return StatusCode::OK;
+}
+
+StatusCode Obd2SensorStore::setSensors(const std::vector<std::pair<size_t, int32_t>>& integerSensors,
+                                       const std::vector<std::pair<size_t, float>>& floatSensors) {
+    for (const auto& [index, _] : integerSensors) {
+        if (index >= mNumIntegerSensors) {
+            ALOGE("failed to set sensors: integer sensor index %zu OOB", index);
+            return StatusCode::INVALID_ARG;
+        }
+    }
+    for (const auto& [index, _] : floatSensors) {
+        if (index >= mNumFloatSensors) {
+            ALOGE("failed to set sensors: float sensor index %zu OOB", index);
+            return StatusCode::INVALID_ARG;
+        }
+    }
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    for (const auto& [index, value] : integerSensors) {
+        setIntegerSensorLocked(index, value);
+    }
+    for (const auto& [index, value] : floatSensors) {
+        setFloatSensorLocked(index, value);
     }
     return StatusCode::OK;
 }
 
-const std::vector<int32_t>& Obd2SensorStore::getIntegerSensors() const {
-    return mIntegerSensors;
+void Obd2SensorStore::setIntegerSensorLocked(size_t index, int32_t value) {
+    mBackFrame->integerSensors[index] = value;
+    mDirtyIntegerSensors.mark(index);
+    setBitLocked(index);
+}
+
+void Obd2SensorStore::setFloatSensorLocked(size_t index, float value) {
+    mBackFrame->floatSensors[index] = value;
+    mDirtyFloatSensors.mark(index);
+    setBitLocked(index + mNumIntegerSensors);
 }
 
-const std::vector<float>& Obd2SensorStore::getFloatSensors() const {
-    return mFloatSensors;
+void Obd2SensorStore::setBitLocked(size_t index) {
+    const size_t byteIndex = index / 8;
+    mBackFrame->sensorsBitmask[byteIndex] |= static_cast<uint8_t>(1 << (index % 8));
+    mDirtyBitmask.mark(byteIndex);
+}
+
+void Obd2SensorStore::publishLocked() const {
+    if (mDirtyIntegerSensors.empty() && mDirtyFloatSensors.empty() && mDirtyBitmask.empty()) {
+        return;
+    }
+    mBackFrame->version = mFrontFrame->version + 1;
+    std::shared_ptr<SensorFrame> oldFrontFrame = std::move(mFrontFrame);
+    mFrontFrame = std::move(mBackFrame);
+
+    if (oldFrontFrame.use_count() == 1) {
+        // No reader holds the old front buffer anymore. It only misses the changes that were just
+        // published, so copy those and reuse it as the back buffer.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        mDirtyIntegerSensors.copy(mFrontFrame->integerSensors, &oldFrontFrame->integerSensors);
+        mDirtyFloatSensors.copy(mFrontFrame->floatSensors, &oldFrontFrame->floatSensors);
+        mDirtyBitmask.copy(mFrontFrame->sensorsBitmask, &oldFrontFrame->sensorsBitmask);
+        mBackFrame = std::move(oldFrontFrame);
+    } else {
+        mBackFrame = std::make_shared<SensorFrame>(*mFrontFrame);
+    }
+
+    mDirtyIntegerSensors.clear();
+    mDirtyFloatSensors.clear();
+    mDirtyBitmask.clear();
 }
 
-const std::vector<uint8_t>& Obd2SensorStore::getSensorsBitmask() const {
-    return mSensorsBitmask.getBitmask();
+std::shared_ptr<const Obd2SensorStore::SensorFrame> Obd2SensorStore::getSensorFrame() const {
+    std::scoped_lock<std::mutex> lockGuard(mLock);
+    publishLocked();
+    return mFrontFrame;
 }
 
 VehiclePropValuePool::RecyclableType Obd2SensorStore::getSensorProperty(
         const std::string& dtc) const {
+    std::shared_ptr<const SensorFrame> frame = getSensorFrame();
     auto propValue = mValuePool->obtain(VehiclePropertyType::MIXED);
     propValue->timestamp = elapsedRealtimeNano();
-    propValue->value.int32Values = getIntegerSensors();
-    propValue->value.floatValues = getFloatSensors();
-    propValue->value.byteValues = getSensorsBitmask();
+    propValue->value.int32Values = frame->integerSensors;
+    propValue->value.floatValues = frame->floatSensors;
+    propValue->value.byteValues = frame->sensorsBitmask;
     propValue->value.stringValue = dtc;
     return propValue;
 }
@@ -104,24 +104,87 @@ TEST_F(FakeObd2FrameTest, testInitObd2LiveFrame) {
 
     getFakeObd2Frame()->initObd2LiveFrame(getObd2LiveFrameConfig());
 
-    auto result = getPropertyStore()->readValue(OBD2_LIVE_FRAME);
+    auto result = getFakeObd2Frame()->getObd2LiveFrame();
 
     ASSERT_TRUE(result.ok());
     auto& value = result.value();
 
+    EXPECT_EQ(value->prop, OBD2_LIVE_FRAME);
     EXPECT_GE(value->timestamp, timestamp);
     EXPECT_EQ(value->value.stringValue, "");
     EXPECT_EQ(value->value.int32Values.size(), static_cast<size_t>(33));
     EXPECT_EQ(value->value.floatValues.size(), static_cast<size_t>(72));
 }
 
+TEST_F(FakeObd2FrameTest, testGetObd2LiveFrameNotConfigured) {
+    ASSERT_FALSE(getFakeObd2Frame()->getObd2LiveFrame().ok());
+}
+
+TEST_F(FakeObd2FrameTest, testSetObd2LiveFrame) {
+    getFakeObd2Frame()->initObd2LiveFrame(getObd2LiveFrameConfig());
+    auto initialFrame = getFakeObd2Frame()->getObd2LiveFrame();
+    ASSERT_TRUE(initialFrame.ok());
+
+    // Only update the first integer sensor and the first float sensor. With 33 integer sensors,
+    // the float sensors start at bit 33.
+    VehiclePropValue liveFrame = {
+            .prop = OBD2_LIVE_FRAME,
+            .value.int32Values = {7, 8},
+            .value.floatValues = {1.5f, 2.5f},
+            .value.byteValues = {0b0001, 0, 0, 0, 0b0010},
+    };
+    ASSERT_TRUE(getFakeObd2Frame()->setObd2LiveFrame(liveFrame).ok());
+
+    auto result = getFakeObd2Frame()->getObd2LiveFrame();
+
+    ASSERT_TRUE(result.ok());
+    auto expectedIntegerSensors = initialFrame.value()->value.int32Values;
+    expectedIntegerSensors[0] = 7;
+    auto expectedFloatSensors = initialFrame.value()->value.floatValues;
+    expectedFloatSensors[0] = 1.5f;
+    EXPECT_EQ(result.value()->value.int32Values, expectedIntegerSensors);
+    EXPECT_EQ(result.value()->value.floatValues, expectedFloatSensors);
+    // The live frame is not kept in the property store.
+    EXPECT_FALSE(getPropertyStore()->readValue(OBD2_LIVE_FRAME).ok());
+}
+
+TEST_F(FakeObd2FrameTest, testSetObd2LiveFrameWithFewerIntegerValues) {
+    getFakeObd2Frame()->initObd2LiveFrame(getObd2LiveFrameConfig());
+    auto initialFrame = getFakeObd2Frame()->getObd2LiveFrame();
+    ASSERT_TRUE(initialFrame.ok());
+
+    // The float bits still start after all the 33 integer sensors, so only the second float
+    // sensor is updated. The set integer bits have no values and are ignored.
+    VehiclePropValue liveFrame = {
+            .prop = OBD2_LIVE_FRAME,
+            .value.int32Values = {7},
+            .value.floatValues = {1.5f, 2.5f},
+            .value.byteValues = {0b0110, 0, 0, 0, 0b0100},
+    };
+    ASSERT_TRUE(getFakeObd2Frame()->setObd2LiveFrame(liveFrame).ok());
+
+    auto result = getFakeObd2Frame()->getObd2LiveFrame();
+
+    ASSERT_TRUE(result.ok());
+    auto expectedFloatSensors = initialFrame.value()->value.floatValues;
+    expectedFloatSensors[1] = 2.5f;
+    EXPECT_EQ(result.value()->value.int32Values, initialFrame.value()->value.int32Values);
+    EXPECT_EQ(result.value()->value.floatValues, expectedFloatSensors);
+}
+
 TEST_F(FakeObd2FrameTest, testInitFreezeFrame) {
     getFakeObd2Frame()->initObd2FreezeFrame(getObd2FreezeFrameConfig());
 
-    auto result = getPropertyStore()->readValuesForProperty(OBD2_FREEZE_FRAME);
+    auto result = getFakeObd2Frame()->getObd2DtcInfo();
 
     ASSERT_TRUE(result.ok());
-    ASSERT_EQ(result.value().size(), static_cast<size_t>(3));
+    ASSERT_EQ(result.value()->value.int64Values.size(), static_cast<size_t>(3));
+
+    // Freeze frames are not kept in the property store.
+    auto readResult = getPropertyStore()->readValuesForProperty(OBD2_FREEZE_FRAME);
+
+    ASSERT_TRUE(readResult.ok());
+    ASSERT_EQ(readResult.value().size(), static_cast<size_t>(0));
 }
 
 TEST_F(FakeObd2FrameTest, testGetObd2DtcInfo) {
@@ -198,6 +261,32 @@ TEST_F(FakeObd2FrameTest, testClearObd2FreezeFrameByTimestamp) {
     EXPECT_EQ(result.value()->value.int64Values.size(), static_cast<size_t>(1));
 }
 
+TEST_F(FakeObd2FrameTest, testAddObd2FreezeFrameDropsOldest) {
+    for (size_t i = 0; i < FakeObd2Frame::MAX_FREEZE_FRAMES + 1; i++) {
+        getFakeObd2Frame()->addObd2FreezeFrame(VehiclePropValue{
+                .prop = OBD2_FREEZE_FRAME,
+                .timestamp = static_cast<int64_t>(i + 1),
+                .value.stringValue = "P0070",
+        });
+    }
+
+    auto result = getFakeObd2Frame()->getObd2DtcInfo();
+
+    ASSERT_TRUE(result.ok());
+    const auto& timestamps = result.value()->value.int64Values;
+    ASSERT_EQ(timestamps.size(), FakeObd2Frame::MAX_FREEZE_FRAMES);
+    EXPECT_EQ(timestamps.front(), 2);
+    EXPECT_EQ(timestamps.back(), static_cast<int64_t>(FakeObd2Frame::MAX_FREEZE_FRAMES + 1));
+
+    EXPECT_FALSE(getFakeObd2Frame()
+                         ->getObd2FreezeFrame(VehiclePropValue{.value.int64Values = {1}})
+                         .ok());
+    auto freezeFrameResult =
+            getFakeObd2Frame()->getObd2FreezeFrame(VehiclePropValue{.value.int64Values = {2}});
+    ASSERT_TRUE(freezeFrameResult.ok());
+    EXPECT_EQ(freezeFrameResult.value()->value.stringValue, "P0070");
+}
+
 }  // namespace obd2frame
 }  // namespace fake
 }  // namespace vehicle
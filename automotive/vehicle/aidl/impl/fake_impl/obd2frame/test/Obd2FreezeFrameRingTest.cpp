@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Obd2FreezeFrameRing.h"
+
+#include <PropertyUtils.h>
+
+#include <gtest/gtest.h>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+namespace fake {
+namespace obd2frame {
+
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropValue;
+
+class Obd2FreezeFrameRingTest : public ::testing::Test {
+  protected:
+    void SetUp() override { mValuePool = std::make_shared<VehiclePropValuePool>(); }
+
+    VehiclePropValue getFreezeFrame(int64_t timestamp, const std::string& dtc) {
+        return VehiclePropValue{
+                .prop = OBD2_FREEZE_FRAME,
+                .timestamp = timestamp,
+                .value.stringValue = dtc,
+        };
+    }
+
+    std::shared_ptr<VehiclePropValuePool> mValuePool;
+};
+
+TEST_F(Obd2FreezeFrameRingTest, testAddGet) {
+    Obd2FreezeFrameRing ring(mValuePool, 4);
+
+    ASSERT_FALSE(ring.add(getFreezeFrame(1, "P0070")).has_value());
+    ASSERT_FALSE(ring.add(getFreezeFrame(2, "P0102")).has_value());
+
+    auto freezeFrame = ring.get(2);
+
+    ASSERT_NE(freezeFrame, nullptr);
+    EXPECT_EQ(freezeFrame->value.stringValue, "P0102");
+    EXPECT_EQ(ring.get(3), nullptr);
+    EXPECT_EQ(ring.size(), 2u);
+    EXPECT_EQ(ring.getTimestamps(), std::vector<int64_t>({1, 2}));
+}
+
+TEST_F(Obd2FreezeFrameRingTest, testAddSameTimestampReplaces) {
+    Obd2FreezeFrameRing ring(mValuePool, 4);
+
+    ring.add(getFreezeFrame(1, "P0070"));
+    ring.add(getFreezeFrame(1, "P0102"));
+
+    ASSERT_EQ(ring.size(), 1u);
+    EXPECT_EQ(ring.get(1)->value.stringValue, "P0102");
+}
+
+TEST_F(Obd2FreezeFrameRingTest, testAddEvictsOldest) {
+    Obd2FreezeFrameRing ring(mValuePool, 2);
+
+    ring.add(getFreezeFrame(1, "P0070"));
+    ring.add(getFreezeFrame(2, "P0102"));
+    auto evictedTimestamp = ring.add(getFreezeFrame(3, "P0123"));
+
+    ASSERT_TRUE(evictedTimestamp.has_value());
+    EXPECT_EQ(*evictedTimestamp, 1);
+    EXPECT_EQ(ring.get(1), nullptr);
+    EXPECT_EQ(ring.getTimestamps(), std::vector<int64_t>({2, 3}));
+}
+
+TEST_F(Obd2FreezeFrameRingTest, testRemove) {
+    Obd2FreezeFrameRing ring(mValuePool, 2);
+
+    ring.add(getFreezeFrame(1, "P0070"));
+    ring.add(getFreezeFrame(2, "P0102"));
+
+    ASSERT_TRUE(ring.remove(1));
+    ASSERT_FALSE(ring.remove(1));
+
+    // The slot of the removed frame is reused without evicting anything.
+    ASSERT_FALSE(ring.add(getFreezeFrame(3, "P0123")).has_value());
+    EXPECT_EQ(ring.getTimestamps(), std::vector<int64_t>({2, 3}));
+}
+
+TEST_F(Obd2FreezeFrameRingTest, testRemoveThenAddReusesFreeSlot) {
+    Obd2FreezeFrameRing ring(mValuePool, 3);
+
+    ring.add(getFreezeFrame(1, "P0070"));
+    ring.add(getFreezeFrame(2, "P0102"));
+    ring.add(getFreezeFrame(3, "P0123"));
+    // Leave a hole in the middle of the ring.
+    ASSERT_TRUE(ring.remove(2));
+
+    // The hole is used before any frame is evicted.
+    ASSERT_FALSE(ring.add(getFreezeFrame(4, "P0200")).has_value());
+    EXPECT_EQ(ring.size(), 3u);
+    EXPECT_EQ(ring.getTimestamps(), std::vector<int64_t>({1, 3, 4}));
+
+    // Once full, the oldest frame is evicted, not the one in the reused slot.
+    auto evictedTimestamp = ring.add(getFreezeFrame(5, "P0300"));
+    ASSERT_TRUE(evictedTimestamp.has_value());
+    EXPECT_EQ(*evictedTimestamp, 1);
+    EXPECT_EQ(ring.getTimestamps(), std::vector<int64_t>({3, 4, 5}));
+    EXPECT_EQ(ring.get(4)->value.stringValue, "P0200");
+}
+
+TEST_F(Obd2FreezeFrameRingTest, testClear) {
+    Obd2FreezeFrameRing ring(mValuePool, 2);
+
+    ring.add(getFreezeFrame(1, "P0070"));
+    ring.add(getFreezeFrame(2, "P0102"));
+    ring.clear();
+
+    EXPECT_EQ(ring.size(), 0u);
+    EXPECT_EQ(ring.getTimestamps(), std::vector<int64_t>());
+    EXPECT_EQ(ring.get(1), nullptr);
+}
+
+}  // namespace obd2frame
+}  // namespace fake
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
@@ -78,6 +78,86 @@ TEST(Obd2SensorStoreTest, testIndexOOB) {
     EXPECT_EQ(sensorStore.setFloatSensor(static_cast<size_t>(-1), 1.0), StatusCode::INVALID_ARG);
 }
 
+TEST(Obd2SensorStoreTest, testSetSensors) {
+    std::shared_ptr<VehiclePropValuePool> valuePool = std::make_shared<VehiclePropValuePool>();
+    Obd2SensorStore sensorStore(valuePool, 1, 1);
+    size_t vendorIntSensorIndex = Obd2SensorStore::getLastIndex<DiagnosticIntegerSensorIndex>() + 1;
+    size_t vendorFloatSensorIndex = Obd2SensorStore::getLastIndex<DiagnosticFloatSensorIndex>() + 1;
+
+    ASSERT_EQ(sensorStore.setSensors(
+                      {{toInt(DiagnosticIntegerSensorIndex::FUEL_TYPE), 1},
+                       {vendorIntSensorIndex, 2}},
+                      {{toInt(DiagnosticFloatSensorIndex::ENGINE_RPM), 3.0},
+                       {vendorFloatSensorIndex, 4.0}}),
+              StatusCode::OK);
+
+    auto frame = sensorStore.getSensorFrame();
+
+    EXPECT_EQ(frame->integerSensors[toInt(DiagnosticIntegerSensorIndex::FUEL_TYPE)], 1);
+    EXPECT_EQ(frame->integerSensors[vendorIntSensorIndex], 2);
+    EXPECT_EQ(frame->floatSensors[toInt(DiagnosticFloatSensorIndex::ENGINE_RPM)], 3.0);
+    EXPECT_EQ(frame->floatSensors[vendorFloatSensorIndex], 4.0);
+}
+
+TEST(Obd2SensorStoreTest, testSetSensorsOOBStoresNothing) {
+    std::shared_ptr<VehiclePropValuePool> valuePool = std::make_shared<VehiclePropValuePool>();
+    Obd2SensorStore sensorStore(valuePool, 1, 1);
+    auto frame = sensorStore.getSensorFrame();
+
+    ASSERT_EQ(sensorStore.setSensors(
+                      {{toInt(DiagnosticIntegerSensorIndex::FUEL_TYPE), 1}},
+                      {{Obd2SensorStore::getLastIndex<DiagnosticFloatSensorIndex>() + 2, 1.0}}),
+              StatusCode::INVALID_ARG);
+
+    EXPECT_EQ(sensorStore.getSensorFrame(), frame) << "no sensor must be stored";
+}
+
+TEST(Obd2SensorStoreTest, testGetSensorFrameSharedUntilChanged) {
+    std::shared_ptr<VehiclePropValuePool> valuePool = std::make_shared<VehiclePropValuePool>();
+    Obd2SensorStore sensorStore(valuePool, 0, 0);
+
+    ASSERT_EQ(sensorStore.setIntegerSensor(DiagnosticIntegerSensorIndex::FUEL_TYPE, 1),
+              StatusCode::OK);
+    auto frame = sensorStore.getSensorFrame();
+
+    ASSERT_EQ(sensorStore.getSensorFrame(), frame);
+
+    ASSERT_EQ(sensorStore.setIntegerSensor(DiagnosticIntegerSensorIndex::FUEL_TYPE, 2),
+              StatusCode::OK);
+    auto newFrame = sensorStore.getSensorFrame();
+
+    ASSERT_NE(newFrame, frame);
+    EXPECT_EQ(newFrame->version, frame->version + 1);
+    EXPECT_EQ(newFrame->integerSensors[toInt(DiagnosticIntegerSensorIndex::FUEL_TYPE)], 2);
+    // A published frame must not change.
+    EXPECT_EQ(frame->integerSensors[toInt(DiagnosticIntegerSensorIndex::FUEL_TYPE)], 1);
+}
+
+TEST(Obd2SensorStoreTest, testSensorFrameBuffersStayInSync) {
+    std::shared_ptr<VehiclePropValuePool> valuePool = std::make_shared<VehiclePropValuePool>();
+    Obd2SensorStore sensorStore(valuePool, 0, 0);
+    size_t numIntSensors = Obd2SensorStore::getLastIndex<DiagnosticIntegerSensorIndex>() + 1;
+    size_t numFloatSensors = Obd2SensorStore::getLastIndex<DiagnosticFloatSensorIndex>() + 1;
+    std::vector<int32_t> expectedIntSensors(numIntSensors, 0);
+    std::vector<float> expectedFloatSensors(numFloatSensors, 0);
+
+    // Change different sensors between frames, so that each buffer misses changes made while
+    // the other buffer was being written.
+    for (int32_t i = 0; i < 100; i++) {
+        size_t intIndex = (i * 7) % numIntSensors;
+        size_t floatIndex = (i * 5) % numFloatSensors;
+        ASSERT_EQ(sensorStore.setIntegerSensor(intIndex, i), StatusCode::OK);
+        ASSERT_EQ(sensorStore.setFloatSensor(floatIndex, static_cast<float>(i)), StatusCode::OK);
+        expectedIntSensors[intIndex] = i;
+        expectedFloatSensors[floatIndex] = static_cast<float>(i);
+
+        auto frame = sensorStore.getSensorFrame();
+
+        ASSERT_EQ(frame->integerSensors, expectedIntSensors);
+        ASSERT_EQ(frame->floatSensors, expectedFloatSensors);
+    }
+}
+
 }  // namespace obd2frame
 }  // namespace fake
 }  // namespace vehicle
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ShardedClientMap.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+namespace {
+
+constexpr size_t NUM_CLIENTS = 64;
+
+struct Client {
+    int64_t id;
+};
+
+// Fake client IDs. Like binder objects, they are separate heap allocations. Only the addresses are
+// used as keys, they are never dereferenced.
+std::vector<std::unique_ptr<Client>> createClientObjects() {
+    std::vector<std::unique_ptr<Client>> clients;
+    for (size_t i = 0; i < NUM_CLIENTS; i++) {
+        clients.push_back(std::make_unique<Client>(Client{static_cast<int64_t>(i)}));
+    }
+    return clients;
+}
+
+const std::vector<std::unique_ptr<Client>>* gClientObjects =
+        new std::vector<std::unique_ptr<Client>>(createClientObjects());
+
+const AIBinder* getClientId(size_t index) {
+    return reinterpret_cast<const AIBinder*>((*gClientObjects)[index % NUM_CLIENTS].get());
+}
+
+// The registry DefaultVehicleHal used before: every lookup takes one global lock.
+class GlobalLockClientMap final {
+  public:
+    template <class CreateFunc>
+    std::shared_ptr<Client> getOrCreate(const AIBinder* clientId, CreateFunc&& create) {
+        std::scoped_lock<std::mutex> lockGuard(mLock);
+        auto it = mClients.find(clientId);
+        if (it == mClients.end()) {
+            it = mClients.emplace(clientId, create()).first;
+        }
+        return it->second;
+    }
+
+  private:
+    std::mutex mLock;
+    std::unordered_map<const AIBinder*, std::shared_ptr<Client>> mClients;
+};
+
+template <class ClientMap>
+void runGetOrCreate(benchmark::State& state, ClientMap* clients) {
+    size_t index = static_cast<size_t>(state.thread_index()) * 7;
+    for (auto _ : state) {
+        const AIBinder* clientId = getClientId(index++);
+        benchmark::DoNotOptimize(clients->getOrCreate(
+                clientId, [] { return std::make_shared<Client>(Client{0}); }));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+GlobalLockClientMap* gGlobalLockClients = new GlobalLockClientMap();
+ShardedClientMap<Client>* gShardedClients = new ShardedClientMap<Client>();
+
+// Known clients issuing getValues/setValues/subscribe concurrently, as with the previous global
+// lock.
+void BM_KnownClients_GlobalLock(benchmark::State& state) {
+    runGetOrCreate(state, gGlobalLockClients);
+}
+BENCHMARK(BM_KnownClients_GlobalLock)->ThreadRange(1, 16)->UseRealTime();
+
+// Known clients issuing getValues/setValues/subscribe concurrently through the sharded fast path.
+void BM_KnownClients_Sharded(benchmark::State& state) {
+    runGetOrCreate(state, gShardedClients);
+}
+BENCHMARK(BM_KnownClients_Sharded)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
+
+BENCHMARK_MAIN();
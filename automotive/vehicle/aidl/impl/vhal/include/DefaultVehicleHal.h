@@ -21,6 +21,7 @@
 #include <ParcelableUtils.h>
 #include <PendingRequestPool.h>
 #include <RecurrentTimer.h>
+#include <ShardedClientMap.h>
 #include <SubscriptionManager.h>
 
 #include <ConcurrentQueue.h>
@@ -90,39 +91,6 @@ class DefaultVehicleHal final : public aidl::android::hardware::automotive::vehi
             GetSetValuesClient<aidl::android::hardware::automotive::vehicle::SetValueResult,
                                aidl::android::hardware::automotive::vehicle::SetValueResults>;
 
-    // A thread safe class to maintain an increasing request ID for each subscribe client. This
-    // class is safe to pass to async callbacks.
-    class SubscribeIdByClient {
-      public:
-        int64_t getId(const CallbackType& callback);
-
-      private:
-        std::mutex mLock;
-        std::unordered_map<const AIBinder*, int64_t> mIds GUARDED_BY(mLock);
-    };
-
-    // A thread safe class to store all subscribe clients. This class is safe to pass to async
-    // callbacks.
-    class SubscriptionClients {
-      public:
-        SubscriptionClients(std::shared_ptr<PendingRequestPool> pool) : mPendingRequestPool(pool) {}
-
-        std::shared_ptr<SubscriptionClient> maybeAddClient(const CallbackType& callback);
-
-        std::shared_ptr<SubscriptionClient> getClient(const CallbackType& callback);
-
-        void removeClient(const AIBinder* clientId);
-
-        size_t countClients();
-
-      private:
-        std::mutex mLock;
-        std::unordered_map<const AIBinder*, std::shared_ptr<SubscriptionClient>> mClients
-                GUARDED_BY(mLock);
-        // PendingRequestPool is thread-safe.
-        std::shared_ptr<PendingRequestPool> mPendingRequestPool;
-    };
-
     // A wrapper for binder lifecycle operations to enable stubbing for test.
     class BinderLifecycleInterface {
       public:
@@ -178,15 +146,15 @@ class DefaultVehicleHal final : public aidl::android::hardware::automotive::vehi
     // SubscriptionManager is thread-safe.
     std::shared_ptr<SubscriptionManager> mSubscriptionManager;
 
+    // mLock is only required when a client contacts us for the first time and we have to link to
+    // its death, or when a client dies. Requests from known clients do not take it.
     std::mutex mLock;
     std::unordered_map<const AIBinder*, std::unique_ptr<OnBinderDiedContext>> mOnBinderDiedContexts
             GUARDED_BY(mLock);
-    std::unordered_map<const AIBinder*, std::shared_ptr<GetValuesClient>> mGetValuesClients
-            GUARDED_BY(mLock);
-    std::unordered_map<const AIBinder*, std::shared_ptr<SetValuesClient>> mSetValuesClients
-            GUARDED_BY(mLock);
-    // SubscriptionClients is thread-safe.
-    std::shared_ptr<SubscriptionClients> mSubscriptionClients;
+    // ShardedClientMap is thread-safe. A client is only added after we have linked to its death.
+    ShardedClientMap<GetValuesClient> mGetValuesClients;
+    ShardedClientMap<SetValuesClient> mSetValuesClients;
+    ShardedClientMap<SubscriptionClient> mSubscriptionClients;
     // mBinderLifecycleHandler is only going to be changed in test.
     std::unique_ptr<BinderLifecycleInterface> mBinderLifecycleHandler;
 
@@ -242,11 +210,11 @@ class DefaultVehicleHal final : public aidl::android::hardware::automotive::vehi
     // mBinderEvents.
     void onBinderDiedUnlinkedHandler();
 
-    // Gets or creates a {@code T} object for the client to or from {@code clients}.
+    // Gets or creates a {@code T} object for the client to or from {@code clients}. A known client
+    // is found without taking mLock. Returns nullptr if the client binder is dead.
     template <class T>
-    static std::shared_ptr<T> getOrCreateClient(
-            std::unordered_map<const AIBinder*, std::shared_ptr<T>>* clients,
-            const CallbackType& callback, std::shared_ptr<PendingRequestPool> pendingRequestPool);
+    std::shared_ptr<T> getOrCreateClient(ShardedClientMap<T>* clients,
+                                         const CallbackType& callback);
 
     static void onPropertyChangeEvent(
             const std::weak_ptr<SubscriptionManager>& subscriptionManager,
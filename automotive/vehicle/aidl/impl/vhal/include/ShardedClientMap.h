@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef android_hardware_automotive_vehicle_aidl_impl_vhal_include_ShardedClientMap_H_
+#define android_hardware_automotive_vehicle_aidl_impl_vhal_include_ShardedClientMap_H_
+
+#include <android/binder_auto_utils.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+// A thread-safe map from a client binder to a client-specific object.
+//
+// The map is split into shards by client ID, each guarded by its own reader-writer lock. Looking up
+// a known client only takes a shared lock on one shard, so concurrent calls from different clients,
+// or from the same client, do not block each other. Only adding or removing a client takes the
+// shard's exclusive lock.
+template <class T>
+class ShardedClientMap final {
+  public:
+    // Returns the object for the client, or nullptr if there is none.
+    std::shared_ptr<T> get(const AIBinder* clientId) const {
+        const Shard& shard = getShard(clientId);
+        std::shared_lock<std::shared_mutex> lockGuard(shard.lock);
+        auto it = shard.objects.find(clientId);
+        if (it == shard.objects.end()) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    // Returns the object for the client. If there is none, creates one with {@code create}.
+    template <class CreateFunc>
+    std::shared_ptr<T> getOrCreate(const AIBinder* clientId, CreateFunc&& create) {
+        if (std::shared_ptr<T> object = get(clientId); object != nullptr) {
+            return object;
+        }
+        Shard& shard = getShard(clientId);
+        std::unique_lock<std::shared_mutex> lockGuard(shard.lock);
+        std::shared_ptr<T>& object = shard.objects[clientId];
+        if (object == nullptr) {
+            object = create();
+        }
+        return object;
+    }
+
+    void remove(const AIBinder* clientId) {
+        Shard& shard = getShard(clientId);
+        std::unique_lock<std::shared_mutex> lockGuard(shard.lock);
+        shard.objects.erase(clientId);
+    }
+
+    size_t size() const {
+        size_t count = 0;
+        for (const Shard& shard : mShards) {
+            std::shared_lock<std::shared_mutex> lockGuard(shard.lock);
+            count += shard.objects.size();
+        }
+        return count;
+    }
+
+  private:
+    static constexpr size_t NUM_SHARDS = 16;
+
+    struct Shard {
+        mutable std::shared_mutex lock;
+        // Guarded by lock.
+        std::unordered_map<const AIBinder*, std::shared_ptr<T>> objects;
+    };
+
+    std::array<Shard, NUM_SHARDS> mShards;
+
+    static size_t getShardIndex(const AIBinder* clientId) {
+        // Binder objects are heap allocated, so the lowest bits carry little information.
+        uintptr_t address = reinterpret_cast<uintptr_t>(clientId);
+        return ((address >> 4) ^ (address >> 12)) % NUM_SHARDS;
+    }
+
+    Shard& getShard(const AIBinder* clientId) { return mShards[getShardIndex(clientId)]; }
+
+    const Shard& getShard(const AIBinder* clientId) const {
+        return mShards[getShardIndex(clientId)];
+    }
+};
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
+
+#endif  // android_hardware_automotive_vehicle_aidl_impl_vhal_include_ShardedClientMap_H_
@@ -92,39 +92,6 @@ float getDefaultSampleRateHz(float sampleRateHz, float minSampleRateHz, float ma
 
 }  // namespace
 
-std::shared_ptr<SubscriptionClient> DefaultVehicleHal::SubscriptionClients::maybeAddClient(
-        const CallbackType& callback) {
-    std::scoped_lock<std::mutex> lockGuard(mLock);
-    return getOrCreateClient(&mClients, callback, mPendingRequestPool);
-}
-
-std::shared_ptr<SubscriptionClient> DefaultVehicleHal::SubscriptionClients::getClient(
-        const CallbackType& callback) {
-    std::scoped_lock<std::mutex> lockGuard(mLock);
-    const AIBinder* clientId = callback->asBinder().get();
-    if (mClients.find(clientId) == mClients.end()) {
-        return nullptr;
-    }
-    return mClients[clientId];
-}
-
-int64_t DefaultVehicleHal::SubscribeIdByClient::getId(const CallbackType& callback) {
-    std::scoped_lock<std::mutex> lockGuard(mLock);
-    // This would be initialized to 0 if callback does not exist in the map.
-    int64_t subscribeId = (mIds[callback->asBinder().get()])++;
-    return subscribeId;
-}
-
-void DefaultVehicleHal::SubscriptionClients::removeClient(const AIBinder* clientId) {
-    std::scoped_lock<std::mutex> lockGuard(mLock);
-    mClients.erase(clientId);
-}
-
-size_t DefaultVehicleHal::SubscriptionClients::countClients() {
-    std::scoped_lock<std::mutex> lockGuard(mLock);
-    return mClients.size();
-}
-
 DefaultVehicleHal::DefaultVehicleHal(std::unique_ptr<IVehicleHardware> vehicleHardware)
     : mVehicleHardware(std::move(vehicleHardware)),
       mPendingRequestPool(std::make_shared<PendingRequestPool>(TIMEOUT_IN_NANO)) {
@@ -132,9 +99,6 @@ DefaultVehicleHal::DefaultVehicleHal(std::unique_ptr<IVehicleHardware> vehicleHa
         return;
     }
 
-    mSubscriptionClients = std::make_shared<SubscriptionClients>(mPendingRequestPool);
-
-    auto subscribeIdByClient = std::make_shared<SubscribeIdByClient>();
     IVehicleHardware* vehicleHardwarePtr = mVehicleHardware.get();
     mSubscriptionManager = std::make_shared<SubscriptionManager>(vehicleHardwarePtr);
 
@@ -214,14 +178,26 @@ void DefaultVehicleHal::onPropertySetErrorEvent(
 }
 
 template <class T>
-std::shared_ptr<T> DefaultVehicleHal::getOrCreateClient(
-        std::unordered_map<const AIBinder*, std::shared_ptr<T>>* clients,
-        const CallbackType& callback, std::shared_ptr<PendingRequestPool> pendingRequestPool) {
+std::shared_ptr<T> DefaultVehicleHal::getOrCreateClient(ShardedClientMap<T>* clients,
+                                                        const CallbackType& callback) {
     const AIBinder* clientId = callback->asBinder().get();
-    if (clients->find(clientId) == clients->end()) {
-        (*clients)[clientId] = std::make_shared<T>(pendingRequestPool, callback);
+    // A known client has already been linked to death, so we only need to check that it is still
+    // alive.
+    if (std::shared_ptr<T> client = clients->get(clientId); client != nullptr) {
+        if (!mBinderLifecycleHandler->isAlive(clientId)) {
+            return nullptr;
+        }
+        return client;
     }
-    return (*clients)[clientId];
+
+    // Lock to make sure onBinderDied would not be called concurrently.
+    std::scoped_lock lockGuard(mLock);
+    if (!monitorBinderLifeCycleLocked(clientId)) {
+        return nullptr;
+    }
+    return clients->getOrCreate(clientId, [this, &callback] {
+        return std::make_shared<T>(mPendingRequestPool, callback);
+    });
 }
 
 bool DefaultVehicleHal::monitorBinderLifeCycleLocked(const AIBinder* clientId) {
@@ -260,9 +236,9 @@ void DefaultVehicleHal::onBinderDied(void* cookie) {
 void DefaultVehicleHal::onBinderDiedWithContext(const AIBinder* clientId) {
     std::scoped_lock<std::mutex> lockGuard(mLock);
     ALOGD("binder died, client ID: %p", clientId);
-    mSetValuesClients.erase(clientId);
-    mGetValuesClients.erase(clientId);
-    mSubscriptionClients->removeClient(clientId);
+    mSetValuesClients.remove(clientId);
+    mGetValuesClients.remove(clientId);
+    mSubscriptionClients.remove(clientId);
     mSubscriptionManager->unsubscribe(clientId);
 }
 
@@ -293,19 +269,6 @@ void DefaultVehicleHal::onBinderDiedUnlinkedHandler() {
     }
 }
 
-template std::shared_ptr<DefaultVehicleHal::GetValuesClient>
-DefaultVehicleHal::getOrCreateClient<DefaultVehicleHal::GetValuesClient>(
-        std::unordered_map<const AIBinder*, std::shared_ptr<GetValuesClient>>* clients,
-        const CallbackType& callback, std::shared_ptr<PendingRequestPool> pendingRequestPool);
-template std::shared_ptr<DefaultVehicleHal::SetValuesClient>
-DefaultVehicleHal::getOrCreateClient<DefaultVehicleHal::SetValuesClient>(
-        std::unordered_map<const AIBinder*, std::shared_ptr<SetValuesClient>>* clients,
-        const CallbackType& callback, std::shared_ptr<PendingRequestPool> pendingRequestPool);
-template std::shared_ptr<SubscriptionClient>
-DefaultVehicleHal::getOrCreateClient<SubscriptionClient>(
-        std::unordered_map<const AIBinder*, std::shared_ptr<SubscriptionClient>>* clients,
-        const CallbackType& callback, std::shared_ptr<PendingRequestPool> pendingRequestPool);
-
 void DefaultVehicleHal::setTimeout(int64_t timeoutInNano) {
     mPendingRequestPool = std::make_unique<PendingRequestPool>(timeoutInNano);
 }
@@ -422,16 +385,9 @@ ScopedAStatus DefaultVehicleHal::getValues(const CallbackType& callback,
         hardwareRequestIds.insert(request.requestId);
     }
 
-    std::shared_ptr<GetValuesClient> client;
-    {
-        // Lock to make sure onBinderDied would not be called concurrently.
-        std::scoped_lock lockGuard(mLock);
-        if (!monitorBinderLifeCycleLocked(callback->asBinder().get())) {
-            return ScopedAStatus::fromExceptionCodeWithMessage(EX_TRANSACTION_FAILED,
-                                                               "client died");
-        }
-
-        client = getOrCreateClient(&mGetValuesClients, callback, mPendingRequestPool);
+    std::shared_ptr<GetValuesClient> client = getOrCreateClient(&mGetValuesClients, callback);
+    if (client == nullptr) {
+        return ScopedAStatus::fromExceptionCodeWithMessage(EX_TRANSACTION_FAILED, "client died");
     }
 
     // Register the pending hardware requests and also check for duplicate request Ids.
@@ -519,15 +475,9 @@ ScopedAStatus DefaultVehicleHal::setValues(const CallbackType& callback,
         hardwareRequestIds.insert(request.requestId);
     }
 
-    std::shared_ptr<SetValuesClient> client;
-    {
-        // Lock to make sure onBinderDied would not be called concurrently.
-        std::scoped_lock lockGuard(mLock);
-        if (!monitorBinderLifeCycleLocked(callback->asBinder().get())) {
-            return ScopedAStatus::fromExceptionCodeWithMessage(EX_TRANSACTION_FAILED,
-                                                               "client died");
-        }
-        client = getOrCreateClient(&mSetValuesClients, callback, mPendingRequestPool);
+    std::shared_ptr<SetValuesClient> client = getOrCreateClient(&mSetValuesClients, callback);
+    if (client == nullptr) {
+        return ScopedAStatus::fromExceptionCodeWithMessage(EX_TRANSACTION_FAILED, "client died");
     }
 
     // Register the pending hardware requests and also check for duplicate request Ids.
@@ -700,32 +650,34 @@ ScopedAStatus DefaultVehicleHal::subscribe(const CallbackType& callback,
         }
     }
 
-    {
-        // Lock to make sure onBinderDied would not be called concurrently.
-        std::scoped_lock lockGuard(mLock);
-        if (!monitorBinderLifeCycleLocked(callback->asBinder().get())) {
-            return ScopedAStatus::fromExceptionCodeWithMessage(EX_TRANSACTION_FAILED,
-                                                               "client died");
-        }
-
-        // Create a new SubscriptionClient if there isn't an existing one.
-        mSubscriptionClients->maybeAddClient(callback);
+    // Create a new SubscriptionClient if there isn't an existing one.
+    if (getOrCreateClient(&mSubscriptionClients, callback) == nullptr) {
+        return ScopedAStatus::fromExceptionCodeWithMessage(EX_TRANSACTION_FAILED, "client died");
+    }
 
-        if (!onChangeSubscriptions.empty()) {
-            auto result = mSubscriptionManager->subscribe(callback, onChangeSubscriptions,
-                                                          /*isContinuousProperty=*/false);
-            if (!result.ok()) {
-                return toScopedAStatus(result);
-            }
+    if (!onChangeSubscriptions.empty()) {
+        auto result = mSubscriptionManager->subscribe(callback, onChangeSubscriptions,
+                                                      /*isContinuousProperty=*/false);
+        if (!result.ok()) {
+            return toScopedAStatus(result);
         }
-        if (!continuousSubscriptions.empty()) {
-            auto result = mSubscriptionManager->subscribe(callback, continuousSubscriptions,
-                                                          /*isContinuousProperty=*/true);
-            if (!result.ok()) {
-                return toScopedAStatus(result);
-            }
+    }
+    if (!continuousSubscriptions.empty()) {
+        auto result = mSubscriptionManager->subscribe(callback, continuousSubscriptions,
+                                                      /*isContinuousProperty=*/true);
+        if (!result.ok()) {
+            return toScopedAStatus(result);
         }
     }
+
+    // We no longer hold mLock while subscribing, so the client might have died and been cleaned up
+    // in the meantime. isAlive turns false before onBinderDied is delivered, so if the cleanup has
+    // already run, we observe the death here and remove the subscriptions we just added.
+    const AIBinder* clientId = callback->asBinder().get();
+    if (!mBinderLifecycleHandler->isAlive(clientId)) {
+        mSubscriptionManager->unsubscribe(clientId);
+        return ScopedAStatus::fromExceptionCodeWithMessage(EX_TRANSACTION_FAILED, "client died");
+    }
     return ScopedAStatus::ok();
 }
 
@@ -837,14 +789,10 @@ binder_status_t DefaultVehicleHal::dump(int fd, const char** args, uint32_t numA
         return STATUS_OK;
     }
     dprintf(fd, "Vehicle HAL State: \n");
-    {
-        std::scoped_lock<std::mutex> lockGuard(mLock);
-        dprintf(fd, "Containing %zu property configs\n", mConfigsByPropId.size());
-        dprintf(fd, "Currently have %zu getValues clients\n", mGetValuesClients.size());
-        dprintf(fd, "Currently have %zu setValues clients\n", mSetValuesClients.size());
-        dprintf(fd, "Currently have %zu subscription clients\n",
-                mSubscriptionClients->countClients());
-    }
+    dprintf(fd, "Containing %zu property configs\n", mConfigsByPropId.size());
+    dprintf(fd, "Currently have %zu getValues clients\n", mGetValuesClients.size());
+    dprintf(fd, "Currently have %zu setValues clients\n", mSetValuesClients.size());
+    dprintf(fd, "Currently have %zu subscription clients\n", mSubscriptionClients.size());
     return STATUS_OK;
 }
 
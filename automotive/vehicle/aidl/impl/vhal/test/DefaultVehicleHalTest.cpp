@@ -31,6 +31,7 @@
 #include <utils/Log.h>
 #include <utils/SystemClock.h>
 
+#include <atomic>
 #include <chrono>
 #include <list>
 #include <memory>
@@ -348,9 +349,8 @@ class DefaultVehicleHalTest : public testing::Test {
     size_t countPendingRequests() { return mVhal->mPendingRequestPool->countPendingRequests(); }
 
     size_t countClients() {
-        std::scoped_lock<std::mutex> lockGuard(mVhal->mLock);
         return mVhal->mGetValuesClients.size() + mVhal->mSetValuesClients.size() +
-               mVhal->mSubscriptionClients->countClients();
+               mVhal->mSubscriptionClients.size();
     }
 
     std::shared_ptr<PendingRequestPool> getPool() { return mVhal->mPendingRequestPool; }
@@ -460,7 +460,8 @@ class DefaultVehicleHalTest : public testing::Test {
         void setAlive(bool isAlive) { mIsAlive = isAlive; }
 
       private:
-        bool mIsAlive = true;
+        // Known clients are checked without DefaultVehicleHal's lock, so this must be atomic.
+        std::atomic<bool> mIsAlive = true;
     };
 
     std::shared_ptr<DefaultVehicleHal> mVhal;
@@ -852,6 +853,69 @@ TEST_F(DefaultVehicleHalTest, testGetValuesExistingClientDied) {
     EXPECT_EQ(countClients(), static_cast<size_t>(1));
 }
 
+TEST_F(DefaultVehicleHalTest, testGetValuesConcurrentClients) {
+    constexpr size_t numClients = 8;
+    constexpr size_t numRequestsPerClient = 100;
+
+    getHardware()->setGetValueResponder(
+            [](std::shared_ptr<const IVehicleHardware::GetValuesCallback> callback,
+               const std::vector<GetValueRequest>& requests) {
+                std::vector<GetValueResult> results;
+                for (auto& request : requests) {
+                    results.push_back({
+                            .requestId = request.requestId,
+                            .status = StatusCode::OK,
+                            .prop = request.prop,
+                    });
+                }
+                (*callback)(results);
+                return StatusCode::OK;
+            });
+
+    std::vector<std::shared_ptr<MockVehicleCallback>> callbacks;
+    std::vector<SpAIBinder> binders;
+    std::vector<std::shared_ptr<IVehicleCallback>> callbackClients;
+    for (size_t i = 0; i < numClients; i++) {
+        callbacks.push_back(ndk::SharedRefBase::make<MockVehicleCallback>());
+        // Keep the local binder alive.
+        binders.push_back(callbacks.back()->asBinder());
+        callbackClients.push_back(IVehicleCallback::fromBinder(binders.back()));
+    }
+
+    std::atomic<size_t> failedCount = 0;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numClients; i++) {
+        threads.emplace_back([this, &callbackClients, &failedCount, i] {
+            for (size_t j = 0; j < numRequestsPerClient; j++) {
+                GetValueRequests requests = {
+                        .payloads = {{
+                                .requestId = static_cast<int64_t>(j),
+                                .prop = {.prop = testInt32VecProp(j % 10)},
+                        }},
+                };
+                if (!getClient()->getValues(callbackClients[i], requests).isOk()) {
+                    failedCount++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(failedCount.load(), 0u) << "getValues must not fail for concurrent live clients";
+    EXPECT_EQ(countClients(), numClients);
+    EXPECT_EQ(countOnBinderDiedContexts(), numClients)
+            << "each client must be linked to death exactly once";
+    for (const auto& callback : callbacks) {
+        size_t resultCount = 0;
+        while (callback->nextGetValueResults().has_value()) {
+            resultCount++;
+        }
+        EXPECT_EQ(resultCount, numRequestsPerClient);
+    }
+}
+
 TEST_F(DefaultVehicleHalTest, testSetValuesSmall) {
     SetValueRequests requests;
     std::vector<SetValueResult> expectedResults;
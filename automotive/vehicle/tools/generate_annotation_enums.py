@@ -17,8 +17,9 @@
 """A script to generate Java files and CPP header files based on annotations in VehicleProperty.aidl
 
    Need ANDROID_BUILD_TOP environmental variable to be set. This script will update
-   ChangeModeForVehicleProperty.h and AccessForVehicleProperty.h under generated_lib/cpp and
-   ChangeModeForVehicleProperty.java and AccessForVehicleProperty.java under generated_lib/java.
+   ChangeModeForVehicleProperty.h, AccessForVehicleProperty.h and EnumConstantsForVehicleProperty.h
+   under generated_lib/cpp and ChangeModeForVehicleProperty.java and AccessForVehicleProperty.java
+   under generated_lib/java.
 
    Usage:
    $ python generate_annotation_enums.py
@@ -27,14 +28,22 @@ import os
 import re
 import sys
 
-PROP_AIDL_FILE_PATH = ("hardware/interfaces/automotive/vehicle/aidl_property/android/hardware/" +
-    "automotive/vehicle/VehicleProperty.aidl")
+PROP_AIDL_DIR_PATH = ("hardware/interfaces/automotive/vehicle/aidl_property/android/hardware/" +
+    "automotive/vehicle")
+PROP_AIDL_FILE_PATH = os.path.join(PROP_AIDL_DIR_PATH, "VehicleProperty.aidl")
+# Enums defined in the VHAL interface package that may also be used in the JSON config.
+INTERFACE_ENUM_AIDL_FILE_PATHS = [
+    os.path.join("hardware/interfaces/automotive/vehicle/aidl/android/hardware/automotive/vehicle",
+                 file_name)
+    for file_name in ["VehiclePropertyAccess.aidl", "VehiclePropertyChangeMode.aidl"]]
 CHANGE_MODE_CPP_FILE_PATH = ("hardware/interfaces/automotive/vehicle/aidl/generated_lib/cpp/" +
     "ChangeModeForVehicleProperty.h")
 ACCESS_CPP_FILE_PATH = ("hardware/interfaces/automotive/vehicle/aidl/generated_lib/cpp/" +
     "AccessForVehicleProperty.h")
 CHANGE_MODE_JAVA_FILE_PATH = ("hardware/interfaces/automotive/vehicle/aidl/generated_lib/java/" +
     "ChangeModeForVehicleProperty.java")
+ENUM_CONSTANTS_CPP_FILE_PATH = ("hardware/interfaces/automotive/vehicle/aidl/generated_lib/cpp/" +
+    "EnumConstantsForVehicleProperty.h")
 ACCESS_JAVA_FILE_PATH = ("hardware/interfaces/automotive/vehicle/aidl/generated_lib/java/" +
     "AccessForVehicleProperty.java")
 
@@ -46,6 +55,8 @@ RE_COMMENT_END = re.compile("\s*\*\/")
 RE_CHANGE_MODE = re.compile("\s*\* @change_mode (\S+)\s*")
 RE_ACCESS = re.compile("\s*\* @access (\S+)\s*")
 RE_VALUE = re.compile("\s*(\w+)\s*=(.*)")
+RE_ANY_ENUM_START = re.compile("\s*enum (\w+) \{")
+RE_ENUM_MEMBER = re.compile("\s*([A-Z][A-Z0-9_]*)\s*(=|,|$)")
 
 LICENSE = """/*
  * Copyright (C) 2022 The Android Open Source Project
@@ -131,6 +142,38 @@ ACCESS_CPP_FOOTER = """
 #endif  // android_hardware_automotive_vehicle_aidl_generated_lib_AccessForVehicleProperty_H_
 """
 
+ENUM_CONSTANTS_CPP_HEADER = """#ifndef android_hardware_automotive_vehicle_aidl_generated_lib_EnumConstantsForVehicleProperty_H_
+#define android_hardware_automotive_vehicle_aidl_generated_lib_EnumConstantsForVehicleProperty_H_
+
+"""
+
+ENUM_CONSTANTS_CPP_BODY = """
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+// All the enum constants defined for vehicle properties, in the format of "EnumType::NAME".
+constexpr std::pair<std::string_view, int32_t> EnumConstantsForVehicleProperty[] = {
+"""
+
+ENUM_CONSTANTS_CPP_FOOTER = """
+};
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
+}  // aidl
+
+#endif  // android_hardware_automotive_vehicle_aidl_generated_lib_EnumConstantsForVehicleProperty_H_
+"""
+
 CHANGE_MODE_JAVA_HEADER = """package android.hardware.automotive.vehicle;
 
 import java.util.Map;
@@ -221,6 +264,52 @@ class Converter:
             f.write(content)
 
 
+class EnumConstantsConverter:
+
+    def convert(self, input_files, output):
+        includes = ""
+        content = ""
+        for file_path in sorted(input_files, key=os.path.basename):
+            with open(file_path, 'r') as f:
+                lines = f.readlines()
+            enum_name = None
+            members = []
+            in_comment = False
+            for line in lines:
+                if enum_name is None:
+                    match = RE_ANY_ENUM_START.match(line)
+                    if match:
+                        enum_name = match.group(1)
+                    continue
+                if RE_ENUM_END.match(line) or line.strip() == "}":
+                    break
+                if RE_COMMENT_BEGIN.match(line):
+                    in_comment = True
+                if in_comment:
+                    if RE_COMMENT_END.match(line) or "*/" in line:
+                        in_comment = False
+                    continue
+                line = line.split("//")[0]
+                match = RE_ENUM_MEMBER.match(line)
+                if match:
+                    members.append(match.group(1))
+            if enum_name is None:
+                continue
+            includes += ("#include <aidl/android/hardware/automotive/vehicle/" + enum_name +
+                         ".h>\n")
+            for member in members:
+                if content:
+                    content += "\n"
+                content += (TAB + TAB + "{\"" + enum_name + "::" + member +
+                            "\", static_cast<int32_t>(" + enum_name + "::" + member + ")},")
+
+        content = (LICENSE + ENUM_CONSTANTS_CPP_HEADER + includes + ENUM_CONSTANTS_CPP_BODY +
+                   content + ENUM_CONSTANTS_CPP_FOOTER)
+
+        with open(output, 'w') as f:
+            f.write(content)
+
+
 def main():
     android_top = os.environ['ANDROID_BUILD_TOP']
     if not android_top:
@@ -232,6 +321,8 @@ def main():
     access_cpp_output = os.path.join(android_top, ACCESS_CPP_FILE_PATH);
     change_mode_java_output = os.path.join(android_top, CHANGE_MODE_JAVA_FILE_PATH);
     access_java_output = os.path.join(android_top, ACCESS_JAVA_FILE_PATH);
+    aidl_dir = os.path.join(android_top, PROP_AIDL_DIR_PATH)
+    enum_constants_cpp_output = os.path.join(android_top, ENUM_CONSTANTS_CPP_FILE_PATH)
 
     c = Converter("change_mode", RE_CHANGE_MODE);
     c.convert(aidl_file, change_mode_cpp_output, CHANGE_MODE_CPP_HEADER, CHANGE_MODE_CPP_FOOTER, True)
@@ -239,6 +330,11 @@ def main():
     c = Converter("access", RE_ACCESS)
     c.convert(aidl_file, access_cpp_output, ACCESS_CPP_HEADER, ACCESS_CPP_FOOTER, True)
     c.convert(aidl_file, access_java_output, ACCESS_JAVA_HEADER, ACCESS_JAVA_FOOTER, False)
+    enum_aidl_files = [os.path.join(aidl_dir, file_name) for file_name in os.listdir(aidl_dir)
+                       if file_name.endswith(".aidl")]
+    enum_aidl_files += [os.path.join(android_top, file_path)
+                        for file_path in INTERFACE_ENUM_AIDL_FILE_PATHS]
+    EnumConstantsConverter().convert(enum_aidl_files, enum_constants_cpp_output)
 
 
 if __name__ == "__main__":
@@ -2144,12 +2144,6 @@ Status ExternalCameraDeviceSession::OutputThread::allocateIntermediateBuffers(
         const Size& v4lSize, const Size& thumbSize, const std::vector<Stream>& streams,
         uint32_t blobBufferSize) {
     std::lock_guard<std::mutex> lk(mBufferLock);
-    if (!mScaledYu12Frames.empty()) {
-        ALOGE("%s: intermediate buffer pool has %zu inflight buffers! (expect 0)", __FUNCTION__,
-              mScaledYu12Frames.size());
-        return Status::INTERNAL_ERROR;
-    }
-
     // Allocating intermediate YU12 frame
     if (mYu12Frame == nullptr || mYu12Frame->mWidth != v4lSize.width ||
         mYu12Frame->mHeight != v4lSize.height) {
@@ -2391,19 +2385,13 @@ int ExternalCameraDeviceSession::OutputThread::cropAndScaleLocked(
         return 0;
     }
 
-    auto it = mScaledYu12Frames.find(outSz);
-    std::shared_ptr<AllocatedFrame> scaledYu12Buf;
-    if (it != mScaledYu12Frames.end()) {
-        scaledYu12Buf = it->second;
-    } else {
-        it = mIntermediateBuffers.find(outSz);
-        if (it == mIntermediateBuffers.end()) {
-            ALOGE("%s: failed to find intermediate buffer size %dx%d", __FUNCTION__, outSz.width,
-                  outSz.height);
-            return -1;
-        }
-        scaledYu12Buf = it->second;
+    auto it = mIntermediateBuffers.find(outSz);
+    if (it == mIntermediateBuffers.end()) {
+        ALOGE("%s: failed to find intermediate buffer size %dx%d", __FUNCTION__, outSz.width,
+              outSz.height);
+        return -1;
     }
+    std::shared_ptr<AllocatedFrame> scaledYu12Buf = it->second;
     // Scale
     YCbCrLayout outLayout;
     ret = scaledYu12Buf->getLayout(&outLayout);
@@ -2429,7 +2417,6 @@ int ExternalCameraDeviceSession::OutputThread::cropAndScaleLocked(
     }
 
     *out = outLayout;
-    mScaledYu12Frames.insert({outSz, scaledYu12Buf});
     return 0;
 }
 
@@ -2557,7 +2544,8 @@ int ExternalCameraDeviceSession::OutputThread::cropAndScaleThumbLocked(
 }
 
 int ExternalCameraDeviceSession::OutputThread::createJpegLocked(
-        HalStreamBuffer& halBuf, const common::V1_0::helper::CameraMetadata& setting) {
+        HalStreamBuffer& halBuf, const common::V1_0::helper::CameraMetadata& setting,
+        const YCbCrLayout& yu12Main) {
     ATRACE_CALL();
     int ret;
     auto lfail = [&](auto... args) {
@@ -2605,8 +2593,6 @@ int ExternalCameraDeviceSession::OutputThread::createJpegLocked(
         return lfail("%s: ANDROID_JPEG_THUMBNAIL_SIZE not set", __FUNCTION__);
     }
 
-    /* Cropped and scaled YU12 buffer for main and thumbnail */
-    YCbCrLayout yu12Main;
     Size jpegSize{halBuf.width, halBuf.height};
 
     /* Compute temporary buffer sizes accounting for the following:
@@ -2637,13 +2623,6 @@ int ExternalCameraDeviceSession::OutputThread::createJpegLocked(
         }
     }
 
-    /* Scale and crop main jpeg */
-    ret = cropAndScaleLocked(mYu12Frame, jpegSize, &yu12Main);
-
-    if (ret != 0) {
-        return lfail("%s: crop and scale main failed!", __FUNCTION__);
-    }
-
     /* Encode the thumbnail image */
     if (outputThumbnail) {
         ret = encodeJpegYU12(thumbSize, yu12Thumb, thumbQuality, 0, 0, &thumbCode[0],
@@ -2679,8 +2658,7 @@ int ExternalCameraDeviceSession::OutputThread::createJpegLocked(
     const uint8_t* exifData = utils->getApp1Buffer();
 
     /* Lock the HAL jpeg code buffer */
-    void* bufPtr = sHandleImporter.lock(*(halBuf.bufPtr), static_cast<uint64_t>(halBuf.usage),
-                                        maxJpegCodeSize);
+    void* bufPtr = lockBuffer(halBuf, maxJpegCodeSize);
 
     if (!bufPtr) {
         return lfail("%s: could not lock %zu bytes", __FUNCTION__, maxJpegCodeSize);
@@ -2698,7 +2676,7 @@ int ExternalCameraDeviceSession::OutputThread::createJpegLocked(
     memcpy(blobDst, &blob, sizeof(CameraBlob));
 
     /* Unlock the HAL jpeg code buffer */
-    int relFence = sHandleImporter.unlock(*(halBuf.bufPtr));
+    int relFence = unlockBuffer(halBuf);
     if (relFence >= 0) {
         halBuf.acquireFence = relFence;
     }
@@ -2714,6 +2692,143 @@ int ExternalCameraDeviceSession::OutputThread::createJpegLocked(
     return 0;
 }
 
+int ExternalCameraDeviceSession::OutputThread::processOutputBuffersLocked(
+        std::vector<HalStreamBuffer>& buffers, const common::V1_0::helper::CameraMetadata& settings,
+        uint8_t* inData, size_t inDataSize) {
+    const int kSyncWaitTimeoutMs = 500;
+    for (auto& halBuf : buffers) {
+        if (*(halBuf.bufPtr) == nullptr) {
+            ALOGW("%s: buffer for stream %d missing", __FUNCTION__, halBuf.streamId);
+            halBuf.fenceTimeout = true;
+        } else if (halBuf.acquireFence >= 0) {
+            int ret = sync_wait(halBuf.acquireFence, kSyncWaitTimeoutMs);
+            if (ret) {
+                halBuf.fenceTimeout = true;
+            } else {
+                ::close(halBuf.acquireFence);
+                halBuf.acquireFence = -1;
+            }
+        }
+    }
+
+    // Crop and scale once per output size, as buffers of the same size would scale into the same
+    // intermediate buffer.
+    std::unordered_map<Size, YCbCrLayout, SizeHasher> cropAndScaled;
+    for (const auto& halBuf : buffers) {
+        if (halBuf.fenceTimeout) {
+            continue;
+        }
+        switch (halBuf.format) {
+            case PixelFormat::BLOB:
+            case PixelFormat::YCBCR_420_888:
+            case PixelFormat::YV12:
+                cropAndScaled.emplace(Size{halBuf.width, halBuf.height}, YCbCrLayout{});
+                break;
+            case PixelFormat::Y16:
+                break;
+            default:
+                ALOGE("%s: unknown output format %x", __FUNCTION__, halBuf.format);
+                return -1;
+        }
+    }
+
+    std::vector<std::function<int()>> tasks;
+    for (auto& entry : cropAndScaled) {
+        tasks.push_back([this, &entry]() {
+            ATRACE_NAME("cropAndScaleLocked");
+            return cropAndScaleLocked(mYu12Frame, entry.first, &entry.second);
+        });
+    }
+    int ret = mWorkerPool.run(tasks);
+    if (ret != 0) {
+        ALOGE("%s: crop and scale failed!", __FUNCTION__);
+        return ret;
+    }
+
+    tasks.clear();
+    for (auto& halBuf : buffers) {
+        if (halBuf.fenceTimeout) {
+            continue;
+        }
+        auto it = cropAndScaled.find(Size{halBuf.width, halBuf.height});
+        YCbCrLayout layout = it != cropAndScaled.end() ? it->second : YCbCrLayout{};
+        tasks.push_back([this, &halBuf, &settings, layout, inData, inDataSize]() {
+            return processOutputBufferLocked(halBuf, settings, layout, inData, inDataSize);
+        });
+    }
+    return mWorkerPool.run(tasks);
+}
+
+int ExternalCameraDeviceSession::OutputThread::processOutputBufferLocked(
+        HalStreamBuffer& halBuf, const common::V1_0::helper::CameraMetadata& settings,
+        const YCbCrLayout& cropAndScaled, uint8_t* inData, size_t inDataSize) {
+    // Gralloc lockYCbCr the buffer
+    switch (halBuf.format) {
+        case PixelFormat::BLOB: {
+            int ret = createJpegLocked(halBuf, settings, cropAndScaled);
+            if (ret != 0) {
+                ALOGE("%s: createJpegLocked failed with %d", __FUNCTION__, ret);
+                return ret;
+            }
+        } break;
+        case PixelFormat::Y16: {
+            void* outLayout = lockBuffer(halBuf, inDataSize);
+
+            std::memcpy(outLayout, inData, inDataSize);
+
+            int relFence = unlockBuffer(halBuf);
+            if (relFence >= 0) {
+                halBuf.acquireFence = relFence;
+            }
+        } break;
+        case PixelFormat::YCBCR_420_888:
+        case PixelFormat::YV12: {
+            YCbCrLayout outLayout = lockBufferYCbCr(halBuf);
+            ALOGV("%s: outLayout y %p cb %p cr %p y_str %d c_str %d c_step %d", __FUNCTION__,
+                  outLayout.y, outLayout.cb, outLayout.cr, outLayout.yStride, outLayout.cStride,
+                  outLayout.chromaStep);
+
+            // Convert to output buffer size/format
+            uint32_t outputFourcc = getFourCcFromLayout(outLayout);
+            ALOGV("%s: converting to format %c%c%c%c", __FUNCTION__, outputFourcc & 0xFF,
+                  (outputFourcc >> 8) & 0xFF, (outputFourcc >> 16) & 0xFF,
+                  (outputFourcc >> 24) & 0xFF);
+
+            Size sz{halBuf.width, halBuf.height};
+            ATRACE_BEGIN("formatConvert");
+            int ret = formatConvert(cropAndScaled, outLayout, sz, outputFourcc);
+            ATRACE_END();
+            if (ret != 0) {
+                ALOGE("%s: format conversion failed!", __FUNCTION__);
+                return ret;
+            }
+            int relFence = unlockBuffer(halBuf);
+            if (relFence >= 0) {
+                halBuf.acquireFence = relFence;
+            }
+        } break;
+        default:
+            ALOGE("%s: unknown output format %x", __FUNCTION__, halBuf.format);
+            return -1;
+    }
+    return 0;
+}
+
+void* ExternalCameraDeviceSession::OutputThread::lockBuffer(HalStreamBuffer& halBuf, size_t size) {
+    return sHandleImporter.lock(*(halBuf.bufPtr), static_cast<uint64_t>(halBuf.usage), size);
+}
+
+YCbCrLayout ExternalCameraDeviceSession::OutputThread::lockBufferYCbCr(HalStreamBuffer& halBuf) {
+    IMapper::Rect outRect{0, 0, static_cast<int32_t>(halBuf.width),
+                          static_cast<int32_t>(halBuf.height)};
+    return sHandleImporter.lockYCbCr(*(halBuf.bufPtr), static_cast<uint64_t>(halBuf.usage),
+                                     outRect);
+}
+
+int ExternalCameraDeviceSession::OutputThread::unlockBuffer(HalStreamBuffer& halBuf) {
+    return sHandleImporter.unlock(*(halBuf.bufPtr));
+}
+
 void ExternalCameraDeviceSession::OutputThread::clearIntermediateBuffers() {
     std::lock_guard<std::mutex> lk(mBufferLock);
     mYu12Frame.reset();
@@ -2840,91 +2955,11 @@ bool ExternalCameraDeviceSession::OutputThread::threadLoop() {
     }
 
     ALOGV("%s processing new request", __FUNCTION__);
-    const int kSyncWaitTimeoutMs = 500;
-    for (auto& halBuf : req->buffers) {
-        if (*(halBuf.bufPtr) == nullptr) {
-            ALOGW("%s: buffer for stream %d missing", __FUNCTION__, halBuf.streamId);
-            halBuf.fenceTimeout = true;
-        } else if (halBuf.acquireFence >= 0) {
-            int ret = sync_wait(halBuf.acquireFence, kSyncWaitTimeoutMs);
-            if (ret) {
-                halBuf.fenceTimeout = true;
-            } else {
-                ::close(halBuf.acquireFence);
-                halBuf.acquireFence = -1;
-            }
-        }
-
-        if (halBuf.fenceTimeout) {
-            continue;
-        }
-
-        // Gralloc lockYCbCr the buffer
-        switch (halBuf.format) {
-            case PixelFormat::BLOB: {
-                int ret = createJpegLocked(halBuf, req->setting);
-
-                if (ret != 0) {
-                    lk.unlock();
-                    return onDeviceError("%s: createJpegLocked failed with %d", __FUNCTION__, ret);
-                }
-            } break;
-            case PixelFormat::Y16: {
-                void* outLayout = sHandleImporter.lock(
-                        *(halBuf.bufPtr), static_cast<uint64_t>(halBuf.usage), inDataSize);
-
-                std::memcpy(outLayout, inData, inDataSize);
-
-                int relFence = sHandleImporter.unlock(*(halBuf.bufPtr));
-                if (relFence >= 0) {
-                    halBuf.acquireFence = relFence;
-                }
-            } break;
-            case PixelFormat::YCBCR_420_888:
-            case PixelFormat::YV12: {
-                IMapper::Rect outRect{0, 0, static_cast<int32_t>(halBuf.width),
-                                      static_cast<int32_t>(halBuf.height)};
-                YCbCrLayout outLayout = sHandleImporter.lockYCbCr(
-                        *(halBuf.bufPtr), static_cast<uint64_t>(halBuf.usage), outRect);
-                ALOGV("%s: outLayout y %p cb %p cr %p y_str %d c_str %d c_step %d", __FUNCTION__,
-                      outLayout.y, outLayout.cb, outLayout.cr, outLayout.yStride, outLayout.cStride,
-                      outLayout.chromaStep);
-
-                // Convert to output buffer size/format
-                uint32_t outputFourcc = getFourCcFromLayout(outLayout);
-                ALOGV("%s: converting to format %c%c%c%c", __FUNCTION__, outputFourcc & 0xFF,
-                      (outputFourcc >> 8) & 0xFF, (outputFourcc >> 16) & 0xFF,
-                      (outputFourcc >> 24) & 0xFF);
-
-                YCbCrLayout cropAndScaled;
-                ATRACE_BEGIN("cropAndScaleLocked");
-                int ret = cropAndScaleLocked(mYu12Frame, Size{halBuf.width, halBuf.height},
-                                             &cropAndScaled);
-                ATRACE_END();
-                if (ret != 0) {
-                    lk.unlock();
-                    return onDeviceError("%s: crop and scale failed!", __FUNCTION__);
-                }
-
-                Size sz{halBuf.width, halBuf.height};
-                ATRACE_BEGIN("formatConvert");
-                ret = formatConvert(cropAndScaled, outLayout, sz, outputFourcc);
-                ATRACE_END();
-                if (ret != 0) {
-                    lk.unlock();
-                    return onDeviceError("%s: format conversion failed!", __FUNCTION__);
-                }
-                int relFence = sHandleImporter.unlock(*(halBuf.bufPtr));
-                if (relFence >= 0) {
-                    halBuf.acquireFence = relFence;
-                }
-            } break;
-            default:
-                lk.unlock();
-                return onDeviceError("%s: unknown output format %x", __FUNCTION__, halBuf.format);
-        }
-    }  // for each buffer
-    mScaledYu12Frames.clear();
+    res = processOutputBuffersLocked(req->buffers, req->setting, inData, inDataSize);
+    if (res != 0) {
+        lk.unlock();
+        return onDeviceError("%s: failed to process output buffers! res %d", __FUNCTION__, res);
+    }
 
     // Don't hold the lock while calling back to parent
     lk.unlock();
@@ -196,8 +196,29 @@ class ExternalCameraDeviceSession : public BnCameraDeviceSession, public OutputT
         int cropAndScaleThumbLocked(std::shared_ptr<AllocatedFrame>& in, const Size& outSize,
                                     YCbCrLayout* out);
 
+        // yu12Main is mYu12Frame cropped and scaled to the size of halBuf.
         int createJpegLocked(HalStreamBuffer& halBuf,
-                             const common::V1_0::helper::CameraMetadata& settings);
+                             const common::V1_0::helper::CameraMetadata& settings,
+                             const YCbCrLayout& yu12Main);
+
+        // Fill the output buffers of a request from mYu12Frame, or from the input data for Y16
+        // buffers. mYu12Frame is first cropped and scaled once for each output size, then each
+        // buffer is converted or encoded. Both steps are spread over mWorkerPool, whose threads
+        // only read mYu12Frame and write to distinct intermediate and output buffers. There is at
+        // most one BLOB buffer per request, so mYu12ThumbFrame is only used by one of them.
+        int processOutputBuffersLocked(std::vector<HalStreamBuffer>& buffers,
+                                       const common::V1_0::helper::CameraMetadata& settings,
+                                       uint8_t* inData, size_t inDataSize);
+
+        int processOutputBufferLocked(HalStreamBuffer& halBuf,
+                                      const common::V1_0::helper::CameraMetadata& settings,
+                                      const YCbCrLayout& cropAndScaled, uint8_t* inData,
+                                      size_t inDataSize);
+
+        // Map/unmap the gralloc output buffers. Tests override these to fill CPU buffers instead.
+        virtual void* lockBuffer(HalStreamBuffer& halBuf, size_t size);
+        virtual YCbCrLayout lockBufferYCbCr(HalStreamBuffer& halBuf);
+        virtual int unlockBuffer(HalStreamBuffer& halBuf);  // returns release fence
 
         void clearIntermediateBuffers();
 
@@ -215,13 +236,12 @@ class ExternalCameraDeviceSession : public BnCameraDeviceSession, public OutputT
 
         // V4L2 frameIn
         // (MJPG decode)-> mYu12Frame
-        // (Scale)-> mScaledYu12Frames
+        // (Scale)-> mIntermediateBuffers
         // (Format convert) -> output gralloc frames
         mutable std::mutex mBufferLock;  // Protect access to intermediate buffers
         std::shared_ptr<AllocatedFrame> mYu12Frame;
         std::shared_ptr<AllocatedFrame> mYu12ThumbFrame;
         std::unordered_map<Size, std::shared_ptr<AllocatedFrame>, SizeHasher> mIntermediateBuffers;
-        std::unordered_map<Size, std::shared_ptr<AllocatedFrame>, SizeHasher> mScaledYu12Frames;
         YCbCrLayout mYu12FrameLayout;
         YCbCrLayout mYu12ThumbFrameLayout;
         std::vector<uint8_t> mMuteTestPatternFrame;
@@ -233,6 +253,9 @@ class ExternalCameraDeviceSession : public BnCameraDeviceSession, public OutputT
         std::string mExifModel;
 
         const std::shared_ptr<BufferRequestThread> mBufferRequestThread;
+
+        // A request has at most one buffer per stream, the OutputThread processes one of them
+        WorkerPool mWorkerPool{kMaxProcessedStream + kMaxStallStream - 1};
     };
 
   private:
@@ -853,6 +853,60 @@ int AllocatedV4L2Frame::getData(uint8_t** outData, size_t* dataSize) {
     return 0;
 }
 
+WorkerPool::WorkerPool(size_t numThreads) {
+    for (size_t i = 0; i < numThreads; i++) {
+        mThreads.emplace_back(&WorkerPool::threadLoop, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    std::unique_lock<std::mutex> lk(mLock);
+    mExit = true;
+    lk.unlock();
+    mWorkCond.notify_all();
+    for (auto& thread : mThreads) {
+        thread.join();
+    }
+}
+
+int WorkerPool::run(const std::vector<std::function<int()>>& tasks) {
+    std::unique_lock<std::mutex> lk(mLock);
+    mTasks = &tasks;
+    mNextTask = 0;
+    mPendingTasks = tasks.size();
+    mResult = 0;
+    mWorkCond.notify_all();
+
+    // Work on the calling thread too instead of only waiting for the pool
+    runTasksLocked(lk);
+    mDoneCond.wait(lk, [this] { return mPendingTasks == 0; });
+    mTasks = nullptr;
+    return mResult;
+}
+
+void WorkerPool::threadLoop() {
+    std::unique_lock<std::mutex> lk(mLock);
+    while (!mExit) {
+        runTasksLocked(lk);
+        mWorkCond.wait(lk);
+    }
+}
+
+void WorkerPool::runTasksLocked(std::unique_lock<std::mutex>& lk) {
+    while (mTasks != nullptr && mNextTask < mTasks->size()) {
+        const std::function<int()>& task = (*mTasks)[mNextTask++];
+        lk.unlock();
+        int ret = task();
+        lk.lock();
+        if (ret != 0 && mResult == 0) {
+            mResult = ret;
+        }
+        if (--mPendingTasks == 0) {
+            mDoneCond.notify_all();
+        }
+    }
+}
+
 }  // namespace implementation
 }  // namespace device
 }  // namespace camera
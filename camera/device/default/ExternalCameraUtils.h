@@ -26,6 +26,10 @@
 #include <aidl/android/hardware/graphics/common/BufferUsage.h>
 #include <aidl/android/hardware/graphics/common/PixelFormat.h>
 #include <tinyxml2.h>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -291,6 +295,32 @@ class AllocatedV4L2Frame : public Frame {
     std::vector<uint8_t> mData;
 };
 
+// A fixed pool of threads running the per-buffer work of a capture request in parallel.
+// run() must not be called concurrently.
+class WorkerPool {
+  public:
+    explicit WorkerPool(size_t numThreads);
+    ~WorkerPool();
+
+    // Runs all the tasks, on the pool threads and on the calling thread, and returns once they
+    // are all done. Returns 0 if every task returned 0, otherwise the error of a failed task.
+    int run(const std::vector<std::function<int()>>& tasks);
+
+  private:
+    void threadLoop();
+    void runTasksLocked(std::unique_lock<std::mutex>& lk);
+
+    std::mutex mLock;
+    std::condition_variable mWorkCond;  // signaled when new tasks are available or on exit
+    std::condition_variable mDoneCond;  // signaled when all the tasks are done
+    const std::vector<std::function<int()>>* mTasks = nullptr;
+    size_t mNextTask = 0;
+    size_t mPendingTasks = 0;
+    int mResult = 0;
+    bool mExit = false;
+    std::vector<std::thread> mThreads;
+};
+
 }  // namespace implementation
 }  // namespace device
 }  // namespace camera
@@ -0,0 +1,373 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define LOG_TAG "ExtCamOutputTest"
+
+#include <ExternalCameraDeviceSession.h>
+#include <ExternalCameraUtils.h>
+#include <aidl/android/hardware/camera/device/CameraBlob.h>
+#include <aidl/android/hardware/camera/device/CameraBlobId.h>
+#include <cutils/native_handle.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+
+#include <libyuv.h>
+
+using ::aidl::android::hardware::camera::device::CameraBlob;
+using ::aidl::android::hardware::camera::device::CameraBlobId;
+using ::aidl::android::hardware::camera::device::Stream;
+using ::android::hardware::camera::device::implementation::AllocatedFrame;
+using ::android::hardware::camera::device::implementation::CroppingType;
+using ::android::hardware::camera::device::implementation::encodeJpegYU12;
+using ::android::hardware::camera::device::implementation::ExternalCameraDeviceSession;
+using ::android::hardware::camera::device::implementation::HalRequest;
+using ::android::hardware::camera::device::implementation::HalStreamBuffer;
+using ::android::hardware::camera::device::implementation::OutputThreadInterface;
+using ::android::hardware::camera::device::implementation::WorkerPool;
+using ::android::hardware::camera::external::common::Size;
+using RequestSettings = ::android::hardware::camera::common::V1_0::helper::CameraMetadata;
+
+namespace {
+
+// Same number of threads as the OutputThread: one per stream, minus the calling thread.
+constexpr size_t kNumWorkers = 2;
+
+constexpr Size kInputSize{640, 480};
+constexpr Size kThumbSize{160, 120};
+constexpr uint8_t kJpegQuality = 90;
+constexpr size_t kMaxJpegSize = 1024 * 1024;
+
+// A gradient, so that the scaled and encoded outputs depend on every part of the frame.
+void fillTestPattern(const YCbCrLayout& layout, const Size& size) {
+    for (int32_t row = 0; row < size.height; row++) {
+        uint8_t* y = static_cast<uint8_t*>(layout.y) + row * layout.yStride;
+        for (int32_t col = 0; col < size.width; col++) {
+            y[col] = static_cast<uint8_t>(row + col);
+        }
+    }
+    for (int32_t row = 0; row < size.height / 2; row++) {
+        uint8_t* cb = static_cast<uint8_t*>(layout.cb) + row * layout.cStride;
+        uint8_t* cr = static_cast<uint8_t*>(layout.cr) + row * layout.cStride;
+        for (int32_t col = 0; col < size.width / 2; col++) {
+            cb[col] = static_cast<uint8_t>(2 * col);
+            cr[col] = static_cast<uint8_t>(2 * row);
+        }
+    }
+}
+
+size_t yu12Size(const Size& size) {
+    return size.width * size.height * 3 / 2;
+}
+
+// Only the JPEG buffer size is asked from the session while filling the buffers.
+class FakeSession : public OutputThreadInterface {
+  public:
+    Status importBuffer(int32_t, uint64_t, buffer_handle_t, buffer_handle_t**) override {
+        return Status::OK;
+    }
+    void notifyError(int32_t, int32_t, ErrorCode) override {}
+    Status processCaptureRequestError(const std::shared_ptr<HalRequest>&, std::vector<NotifyMsg>*,
+                                      std::vector<CaptureResult>*) override {
+        return Status::OK;
+    }
+    Status processCaptureResult(std::shared_ptr<HalRequest>&) override { return Status::OK; }
+    ssize_t getJpegBufferSize(int32_t, int32_t) const override { return kMaxJpegSize; }
+};
+
+// Runs the buffer processing of the OutputThread with CPU buffers instead of gralloc buffers.
+class TestOutputThread : public ExternalCameraDeviceSession::OutputThread {
+  public:
+    explicit TestOutputThread(std::weak_ptr<OutputThreadInterface> parent)
+        : OutputThread(std::move(parent), CroppingType::VERTICAL, RequestSettings(), nullptr) {}
+
+    // Decodes the MJPEG frame into mYu12Frame, as threadLoop does, then fills the buffers.
+    int process(std::vector<uint8_t>& mjpeg, std::vector<HalStreamBuffer>& buffers,
+                const RequestSettings& settings) {
+        std::lock_guard<std::mutex> lk(mBufferLock);
+        int ret = libyuv::MJPGToI420(
+                mjpeg.data(), mjpeg.size(), static_cast<uint8_t*>(mYu12FrameLayout.y),
+                mYu12FrameLayout.yStride, static_cast<uint8_t*>(mYu12FrameLayout.cb),
+                mYu12FrameLayout.cStride, static_cast<uint8_t*>(mYu12FrameLayout.cr),
+                mYu12FrameLayout.cStride, mYu12Frame->mWidth, mYu12Frame->mHeight,
+                mYu12Frame->mWidth, mYu12Frame->mHeight);
+        if (ret != 0) {
+            return ret;
+        }
+        return processOutputBuffersLocked(buffers, settings, mjpeg.data(), mjpeg.size());
+    }
+
+    // Memory of the buffer of each stream, by stream id. Allocated before processing.
+    std::map<int32_t, std::vector<uint8_t>> mMemory;
+    std::atomic<int> mLockedBuffers = 0;
+
+  protected:
+    void* lockBuffer(HalStreamBuffer& halBuf, size_t size) override {
+        auto& memory = mMemory.at(halBuf.streamId);
+        if (memory.size() < size) {
+            return nullptr;
+        }
+        mLockedBuffers++;
+        return memory.data();
+    }
+
+    // The YUV buffers are laid out as I420.
+    YCbCrLayout lockBufferYCbCr(HalStreamBuffer& halBuf) override {
+        uint8_t* data = mMemory.at(halBuf.streamId).data();
+        const uint32_t lumaSize = halBuf.width * halBuf.height;
+        YCbCrLayout layout;
+        layout.y = data;
+        layout.cb = data + lumaSize;
+        layout.cr = data + lumaSize + lumaSize / 4;
+        layout.yStride = halBuf.width;
+        layout.cStride = halBuf.width / 2;
+        layout.chromaStep = 1;
+        mLockedBuffers++;
+        return layout;
+    }
+
+    int unlockBuffer(HalStreamBuffer&) override {
+        mLockedBuffers--;
+        return -1;
+    }
+};
+
+class ExternalCameraOutputTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        // Make a synthetic MJPEG frame, as sent by the camera.
+        AllocatedFrame source(kInputSize.width, kInputSize.height);
+        YCbCrLayout sourceLayout;
+        ASSERT_EQ(0, source.allocate(&sourceLayout));
+        fillTestPattern(sourceLayout, kInputSize);
+        mMjpeg.resize(kMaxJpegSize);
+        size_t mjpegSize = 0;
+        ASSERT_EQ(0, encodeJpegYU12(kInputSize, sourceLayout, kJpegQuality, nullptr, 0,
+                                    mMjpeg.data(), mMjpeg.size(), mjpegSize));
+        mMjpeg.resize(mjpegSize);
+
+        mSettings.update(ANDROID_JPEG_QUALITY, &kJpegQuality, 1);
+        mSettings.update(ANDROID_JPEG_THUMBNAIL_QUALITY, &kJpegQuality, 1);
+        const int32_t thumbSize[] = {kThumbSize.width, kThumbSize.height};
+        mSettings.update(ANDROID_JPEG_THUMBNAIL_SIZE, thumbSize, 2);
+
+        mNativeHandle = native_handle_create(0, 0);
+        ASSERT_NE(nullptr, mNativeHandle);
+        mHandle = mNativeHandle;
+    }
+
+    void TearDown() override {
+        if (mNativeHandle != nullptr) {
+            native_handle_delete(mNativeHandle);
+        }
+    }
+
+    static Stream makeStream(int32_t id, PixelFormat format, const Size& size) {
+        Stream stream;
+        stream.id = id;
+        stream.width = size.width;
+        stream.height = size.height;
+        stream.format = format;
+        stream.usage = BufferUsage::CPU_WRITE_OFTEN;
+        return stream;
+    }
+
+    // Two YUV outputs of the same size, sharing their intermediate buffer with the BLOB output,
+    // and a smaller preview.
+    static std::vector<Stream> makeStreams() {
+        return {makeStream(0, PixelFormat::YCBCR_420_888, Size{640, 360}),
+                makeStream(1, PixelFormat::YCBCR_420_888, Size{640, 360}),
+                makeStream(2, PixelFormat::BLOB, Size{640, 360}),
+                makeStream(3, PixelFormat::YCBCR_420_888, Size{320, 240})};
+    }
+
+    // Makes an OutputThread configured for the streams, with a buffer for each of them.
+    std::unique_ptr<TestOutputThread> makeOutputThread(const std::vector<Stream>& streams) {
+        auto thread = std::make_unique<TestOutputThread>(mSession);
+        EXPECT_EQ(Status::OK,
+                  thread->allocateIntermediateBuffers(kInputSize, kThumbSize, streams, 0));
+        for (const auto& stream : streams) {
+            thread->mMemory[stream.id].resize(stream.format == PixelFormat::BLOB
+                                                      ? kMaxJpegSize
+                                                      : yu12Size({stream.width, stream.height}));
+        }
+        return thread;
+    }
+
+    HalStreamBuffer makeBuffer(const Stream& stream) {
+        return HalStreamBuffer{.streamId = stream.id,
+                               .bufferId = stream.id,
+                               .width = stream.width,
+                               .height = stream.height,
+                               .format = stream.format,
+                               .usage = stream.usage,
+                               .bufPtr = &mHandle,
+                               .acquireFence = -1,
+                               .fenceTimeout = false};
+    }
+
+    // The EXIF data of the JPEG holds the capture time, so compare the decoded images instead.
+    static std::vector<uint8_t> decodeBlob(const std::vector<uint8_t>& blob, const Size& size) {
+        CameraBlob trailer;
+        memcpy(&trailer, blob.data() + blob.size() - sizeof(CameraBlob), sizeof(CameraBlob));
+        EXPECT_EQ(CameraBlobId::JPEG, trailer.blobId);
+        EXPECT_GT(trailer.blobSizeBytes, 0);
+        if (trailer.blobSizeBytes <= 0) {
+            return {};
+        }
+        std::vector<uint8_t> yu12(yu12Size(size));
+        uint8_t* y = yu12.data();
+        uint8_t* cb = y + size.width * size.height;
+        uint8_t* cr = cb + size.width * size.height / 4;
+        EXPECT_EQ(0, libyuv::MJPGToI420(blob.data(), trailer.blobSizeBytes, y, size.width, cb,
+                                        size.width / 2, cr, size.width / 2, size.width,
+                                        size.height, size.width, size.height));
+        return yu12;
+    }
+
+    std::shared_ptr<FakeSession> mSession = std::make_shared<FakeSession>();
+    std::vector<uint8_t> mMjpeg;
+    RequestSettings mSettings;
+    native_handle_t* mNativeHandle = nullptr;
+    buffer_handle_t mHandle = nullptr;
+};
+
+}  // namespace
+
+TEST(WorkerPoolTest, RunsAllTasks) {
+    WorkerPool pool(kNumWorkers);
+    constexpr size_t kNumTasks = 100;
+    std::vector<std::atomic<int>> runs(kNumTasks);
+    std::vector<std::function<int()>> tasks;
+    for (size_t i = 0; i < kNumTasks; i++) {
+        tasks.push_back([&runs, i]() {
+            runs[i]++;
+            return 0;
+        });
+    }
+    EXPECT_EQ(0, pool.run(tasks));
+    for (size_t i = 0; i < kNumTasks; i++) {
+        EXPECT_EQ(1, runs[i].load()) << "task " << i;
+    }
+    EXPECT_EQ(0, pool.run({}));
+}
+
+TEST(WorkerPoolTest, ReturnsErrorAfterRunningAllTasks) {
+    WorkerPool pool(kNumWorkers);
+    std::atomic<int> runs = 0;
+    std::vector<std::function<int()>> tasks;
+    for (int i = 0; i < 5; i++) {
+        tasks.push_back([&runs, i]() {
+            runs++;
+            return i == 2 ? -EINVAL : 0;
+        });
+    }
+    EXPECT_EQ(-EINVAL, pool.run(tasks));
+    EXPECT_EQ(5, runs.load());
+    // The error of a run does not leak into the next one
+    EXPECT_EQ(0, pool.run({[]() { return 0; }}));
+}
+
+TEST(WorkerPoolTest, RunsTasksConcurrently) {
+    WorkerPool pool(kNumWorkers);
+    // Each task waits for all the others to start, which only happens if they run in parallel.
+    constexpr int kNumTasks = kNumWorkers + 1;
+    std::atomic<int> started = 0;
+    std::vector<std::function<int()>> tasks(kNumTasks, [&started]() {
+        started++;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (started.load() < kNumTasks) {
+            if (std::chrono::steady_clock::now() > deadline) return -ETIMEDOUT;
+            std::this_thread::yield();
+        }
+        return 0;
+    });
+    EXPECT_EQ(0, pool.run(tasks));
+}
+
+
+TEST_F(ExternalCameraOutputTest, ParallelOutputsMatchSerial) {
+    const std::vector<Stream> streams = makeStreams();
+
+    // Process each buffer in a request of its own, so that nothing runs in parallel.
+    auto serialThread = makeOutputThread(streams);
+    for (const auto& stream : streams) {
+        std::vector<HalStreamBuffer> buffers{makeBuffer(stream)};
+        ASSERT_EQ(0, serialThread->process(mMjpeg, buffers, mSettings)) << "stream " << stream.id;
+        EXPECT_NE(std::vector<uint8_t>(serialThread->mMemory.at(stream.id).size(), 0),
+                  serialThread->mMemory.at(stream.id))
+                << "stream " << stream.id;
+    }
+
+    auto thread = makeOutputThread(streams);
+    std::vector<HalStreamBuffer> buffers;
+    for (const auto& stream : streams) {
+        buffers.push_back(makeBuffer(stream));
+    }
+    // Run several requests through the same thread, like consecutive capture requests.
+    for (int request = 0; request < 10; request++) {
+        for (auto& [id, memory] : thread->mMemory) {
+            std::fill(memory.begin(), memory.end(), 0);
+        }
+        ASSERT_EQ(0, thread->process(mMjpeg, buffers, mSettings)) << "request " << request;
+        EXPECT_EQ(0, thread->mLockedBuffers.load()) << "request " << request;
+        for (const auto& stream : streams) {
+            const auto& expected = serialThread->mMemory.at(stream.id);
+            const auto& actual = thread->mMemory.at(stream.id);
+            if (stream.format == PixelFormat::BLOB) {
+                const Size size{stream.width, stream.height};
+                EXPECT_EQ(decodeBlob(expected, size), decodeBlob(actual, size))
+                        << "stream " << stream.id << " of request " << request;
+            } else {
+                EXPECT_EQ(expected, actual) << "stream " << stream.id << " of request " << request;
+            }
+        }
+        // Both outputs of the same size were filled from the same intermediate buffer.
+        EXPECT_EQ(thread->mMemory.at(0), thread->mMemory.at(1)) << "request " << request;
+    }
+}
+
+TEST_F(ExternalCameraOutputTest, MissingBufferIsSkipped) {
+    const std::vector<Stream> streams = makeStreams();
+    auto thread = makeOutputThread(streams);
+    std::vector<HalStreamBuffer> buffers;
+    for (const auto& stream : streams) {
+        buffers.push_back(makeBuffer(stream));
+    }
+    buffer_handle_t missing = nullptr;
+    buffers[1].bufPtr = &missing;
+
+    ASSERT_EQ(0, thread->process(mMjpeg, buffers, mSettings));
+    EXPECT_TRUE(buffers[1].fenceTimeout);
+    EXPECT_EQ(std::vector<uint8_t>(thread->mMemory.at(1).size(), 0), thread->mMemory.at(1));
+    // The other buffer of the same size is still filled.
+    EXPECT_NE(std::vector<uint8_t>(thread->mMemory.at(0).size(), 0), thread->mMemory.at(0));
+}
+
+TEST_F(ExternalCameraOutputTest, FailedBufferFailsTheRequest) {
+    const std::vector<Stream> streams = makeStreams();
+    auto thread = makeOutputThread(streams);
+    std::vector<HalStreamBuffer> buffers;
+    for (const auto& stream : streams) {
+        buffers.push_back(makeBuffer(stream));
+    }
+
+    // Without the JPEG settings the BLOB buffer cannot be encoded.
+    EXPECT_NE(0, thread->process(mMjpeg, buffers, RequestSettings()));
+    // The buffers processed in parallel were all unlocked.
+    EXPECT_EQ(0, thread->mLockedBuffers.load());
+}
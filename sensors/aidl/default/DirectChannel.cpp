@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sensors-impl/DirectChannel.h"
+
+#include "sensors-impl/Sensor.h"
+#include "sensors-impl/SensorScheduler.h"
+
+#include <aidl/sensors/convert.h>
+#include <log/log.h>
+#include <sys/mman.h>
+
+#include <cstring>
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace sensors {
+
+using ::android::hardware::sensors::implementation::convertToSensorEvent;
+
+static constexpr size_t kEventSize = ISensors::DIRECT_REPORT_SENSOR_EVENT_TOTAL_LENGTH;
+static_assert(sizeof(sensors_event_t) == kEventSize);
+static_assert(offsetof(sensors_event_t, reserved0) ==
+              ISensors::DIRECT_REPORT_SENSOR_EVENT_OFFSET_SIZE_ATOMIC_COUNTER);
+
+std::unique_ptr<DirectChannel> DirectChannel::create(const SharedMemInfo& mem) {
+    void* buffer = mmap(nullptr, mem.size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                        mem.memoryHandle.fds[0].get(), 0 /* offset */);
+    if (buffer == MAP_FAILED) {
+        ALOGE("Failed to map direct channel memory: %s", strerror(errno));
+        return nullptr;
+    }
+
+    // The mapping stays valid once the client's file descriptor is closed.
+    return std::unique_ptr<DirectChannel>(
+            new DirectChannel(static_cast<uint8_t*>(buffer), mem.size));
+}
+
+DirectChannel::DirectChannel(uint8_t* buffer, size_t size) : mBuffer(buffer), mSize(size) {
+    memset(mBuffer, 0, mSize);
+}
+
+DirectChannel::~DirectChannel() {
+    SensorScheduler::getInstance().unscheduleDirectReports(this);
+    munmap(mBuffer, mSize);
+}
+
+void DirectChannel::write(int32_t reportToken, const Event& event) {
+    sensors_event_t report;
+    convertToSensorEvent(event, &report);
+    report.sensor = reportToken;
+    report.reserved0 = 0;
+
+    uint8_t* slot = mBuffer + mNextSlot * kEventSize;
+    memcpy(slot, &report, kEventSize);
+
+    // The counter skips 0, which the client takes as an empty slot.
+    mCounter = mCounter == UINT32_MAX ? 1 : mCounter + 1;
+    __atomic_store_n(reinterpret_cast<uint32_t*>(
+                             slot + ISensors::DIRECT_REPORT_SENSOR_EVENT_OFFSET_SIZE_ATOMIC_COUNTER),
+                     mCounter, __ATOMIC_RELEASE);
+
+    mNextSlot = (mNextSlot + 1) % (mSize / kEventSize);
+}
+
+}  // namespace sensors
+}  // namespace hardware
+}  // namespace android
+}  // namespace aidl
@@ -15,9 +15,9 @@
  */
 
 #include "sensors-impl/Sensor.h"
+#include "sensors-impl/SensorScheduler.h"
 
-#include "utils/SystemClock.h"
-
+#include <algorithm>
 #include <cmath>
 
 using ::ndk::ScopedAStatus;
@@ -28,48 +28,51 @@ namespace hardware {
 namespace sensors {
 
 static constexpr int32_t kDefaultMaxDelayUs = 10 * 1000 * 1000;
+static constexpr int32_t kDefaultFifoEventCount = 300;
+
+// Flags of the sensors that can report to ashmem direct channels, at up to the given rate level.
+static constexpr int32_t directReportFlags(ISensors::RateLevel maxRate) {
+    return SensorInfo::SENSOR_FLAG_BITS_DIRECT_CHANNEL_ASHMEM |
+           (static_cast<int32_t>(maxRate) << SensorInfo::SENSOR_FLAG_SHIFT_DIRECT_REPORT);
+}
 
 Sensor::Sensor(ISensorsEventCallback* callback)
     : mIsEnabled(false),
       mSamplingPeriodNs(0),
-      mLastSampleTimeNs(0),
+      mMaxReportLatencyNs(0),
       mCallback(callback),
-      mMode(OperationMode::NORMAL) {
-    mRunThread = std::thread(startThread, this);
-}
+      mMode(OperationMode::NORMAL) {}
 
-Sensor::~Sensor() {
-    std::unique_lock<std::mutex> lock(mRunMutex);
-    mStopThread = true;
-    mIsEnabled = false;
-    mWaitCV.notify_all();
-    lock.release();
-    mRunThread.join();
-}
+Sensor::~Sensor() {}
 
 const SensorInfo& Sensor::getSensorInfo() const {
     return mSensorInfo;
 }
 
-void Sensor::batch(int64_t samplingPeriodNs) {
+void Sensor::batch(int64_t samplingPeriodNs, int64_t maxReportLatencyNs) {
     if (samplingPeriodNs < mSensorInfo.minDelayUs * 1000LL) {
         samplingPeriodNs = mSensorInfo.minDelayUs * 1000LL;
     } else if (samplingPeriodNs > mSensorInfo.maxDelayUs * 1000LL) {
         samplingPeriodNs = mSensorInfo.maxDelayUs * 1000LL;
     }
 
-    if (mSamplingPeriodNs != samplingPeriodNs) {
+    // Sensors without a FIFO can't batch, and the others must report before their FIFO overflows.
+    maxReportLatencyNs = std::clamp(maxReportLatencyNs, int64_t(0),
+                                    mSensorInfo.fifoMaxEventCount * samplingPeriodNs);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    if (mSamplingPeriodNs != samplingPeriodNs || mMaxReportLatencyNs != maxReportLatencyNs) {
         mSamplingPeriodNs = samplingPeriodNs;
-        // Wake up the 'run' thread to check if a new event should be generated now
-        mWaitCV.notify_all();
+        mMaxReportLatencyNs = maxReportLatencyNs;
+        updateScheduleLocked();
     }
 }
 
 void Sensor::activate(bool enable) {
+    std::lock_guard<std::mutex> lock(mLock);
     if (mIsEnabled != enable) {
-        std::unique_lock<std::mutex> lock(mRunMutex);
         mIsEnabled = enable;
-        mWaitCV.notify_all();
+        updateScheduleLocked();
     }
 }
 
@@ -82,8 +85,8 @@ ScopedAStatus Sensor::flush() {
                 static_cast<int32_t>(BnSensors::ERROR_BAD_VALUE));
     }
 
-    // Note: If a sensor supports batching, write all of the currently batched events for the sensor
-    // to the Event FMQ prior to writing the flush complete event.
+    // The scheduler writes all of the currently batched events for the sensor to the Event FMQ
+    // prior to writing the flush complete event.
     Event ev;
     ev.sensorHandle = mSensorInfo.sensorHandle;
     ev.sensorType = SensorType::META_DATA;
@@ -91,39 +94,20 @@ ScopedAStatus Sensor::flush() {
             .what = MetaDataEventType::META_DATA_FLUSH_COMPLETE,
     };
     ev.payload.set<EventPayload::Tag::meta>(meta);
-    std::vector<Event> evs{ev};
-    mCallback->postEvents(evs, isWakeUpSensor());
+    SensorScheduler::getInstance().flush(this, ev);
 
     return ScopedAStatus::ok();
 }
 
-void Sensor::startThread(Sensor* sensor) {
-    sensor->run();
-}
-
-void Sensor::run() {
-    std::unique_lock<std::mutex> runLock(mRunMutex);
-    constexpr int64_t kNanosecondsInSeconds = 1000 * 1000 * 1000;
-
-    while (!mStopThread) {
-        if (!mIsEnabled || mMode == OperationMode::DATA_INJECTION) {
-            mWaitCV.wait(runLock, [&] {
-                return ((mIsEnabled && mMode == OperationMode::NORMAL) || mStopThread);
-            });
-        } else {
-            timespec curTime;
-            clock_gettime(CLOCK_BOOTTIME, &curTime);
-            int64_t now = (curTime.tv_sec * kNanosecondsInSeconds) + curTime.tv_nsec;
-            int64_t nextSampleTime = mLastSampleTimeNs + mSamplingPeriodNs;
-
-            if (now >= nextSampleTime) {
-                mLastSampleTimeNs = now;
-                nextSampleTime = mLastSampleTimeNs + mSamplingPeriodNs;
-                mCallback->postEvents(readEvents(), isWakeUpSensor());
-            }
-
-            mWaitCV.wait_for(runLock, std::chrono::nanoseconds(nextSampleTime - now));
-        }
+void Sensor::updateScheduleLocked() {
+    if (mIsEnabled && mMode == OperationMode::NORMAL) {
+        // Sample at the fastest rate until batch() is called, rather than spinning with a period
+        // of 0.
+        int64_t samplingPeriodNs =
+                mSamplingPeriodNs > 0 ? mSamplingPeriodNs : mSensorInfo.minDelayUs * 1000LL;
+        SensorScheduler::getInstance().schedule(this, samplingPeriodNs, mMaxReportLatencyNs);
+    } else {
+        SensorScheduler::getInstance().unschedule(this);
     }
 }
 
@@ -131,12 +115,12 @@ bool Sensor::isWakeUpSensor() {
     return mSensorInfo.flags & static_cast<uint32_t>(SensorInfo::SENSOR_FLAG_BITS_WAKE_UP);
 }
 
-std::vector<Event> Sensor::readEvents() {
+std::vector<Event> Sensor::readEvents(int64_t timestampNs) {
     std::vector<Event> events;
     Event event;
     event.sensorHandle = mSensorInfo.sensorHandle;
     event.sensorType = mSensorInfo.type;
-    event.timestamp = ::android::elapsedRealtimeNano();
+    event.timestamp = timestampNs;
     memset(&event.payload, 0, sizeof(event.payload));
     readEventPayload(event.payload);
     events.push_back(event);
@@ -144,10 +128,10 @@ std::vector<Event> Sensor::readEvents() {
 }
 
 void Sensor::setOperationMode(OperationMode mode) {
+    std::lock_guard<std::mutex> lock(mLock);
     if (mMode != mode) {
-        std::unique_lock<std::mutex> lock(mRunMutex);
         mMode = mode;
-        mWaitCV.notify_all();
+        updateScheduleLocked();
     }
 }
 
@@ -175,6 +159,41 @@ ScopedAStatus Sensor::injectEvent(const Event& event) {
             static_cast<int32_t>(BnSensors::ERROR_BAD_VALUE));
 }
 
+ScopedAStatus Sensor::configDirectReport(DirectChannel* channel, RateLevel rate,
+                                         int32_t* reportToken) {
+    int32_t maxRate = (mSensorInfo.flags & SensorInfo::SENSOR_FLAG_BITS_MASK_DIRECT_REPORT) >>
+                      SensorInfo::SENSOR_FLAG_SHIFT_DIRECT_REPORT;
+    if (!(mSensorInfo.flags & SensorInfo::SENSOR_FLAG_BITS_DIRECT_CHANNEL_ASHMEM) ||
+        static_cast<int32_t>(rate) > maxRate) {
+        return ScopedAStatus::fromExceptionCode(EX_ILLEGAL_ARGUMENT);
+    }
+
+    if (rate == RateLevel::STOP) {
+        SensorScheduler::getInstance().unscheduleDirectReport(this, channel);
+        return ScopedAStatus::ok();
+    }
+
+    // Report at the nominal rate of the level: 50Hz, 200Hz or 800Hz.
+    int64_t samplingPeriodNs;
+    switch (rate) {
+        case RateLevel::NORMAL:
+            samplingPeriodNs = 20 * 1000 * 1000;
+            break;
+        case RateLevel::FAST:
+            samplingPeriodNs = 5 * 1000 * 1000;
+            break;
+        default:
+            samplingPeriodNs = 1250 * 1000;
+            break;
+    }
+
+    // There's only one sensor of each type in the channel, so its handle is a fine token.
+    *reportToken = mSensorInfo.sensorHandle;
+    SensorScheduler::getInstance().scheduleDirectReport(this, channel, *reportToken,
+                                                        samplingPeriodNs);
+    return ScopedAStatus::ok();
+}
+
 OnChangeSensor::OnChangeSensor(ISensorsEventCallback* callback)
     : Sensor(callback), mPreviousEventSet(false) {}
 
@@ -185,8 +204,8 @@ void OnChangeSensor::activate(bool enable) {
     }
 }
 
-std::vector<Event> OnChangeSensor::readEvents() {
-    std::vector<Event> events = Sensor::readEvents();
+std::vector<Event> OnChangeSensor::readEvents(int64_t timestampNs) {
+    std::vector<Event> events = Sensor::readEvents(timestampNs);
     std::vector<Event> outputEvents;
 
     for (auto iter = events.begin(); iter != events.end(); ++iter) {
@@ -213,10 +232,11 @@ AccelSensor::AccelSensor(int32_t sensorHandle, ISensorsEventCallback* callback)
     mSensorInfo.power = 0.001f;          // mA
     mSensorInfo.minDelayUs = 10 * 1000;  // microseconds
     mSensorInfo.maxDelayUs = kDefaultMaxDelayUs;
-    mSensorInfo.fifoReservedEventCount = 0;
-    mSensorInfo.fifoMaxEventCount = 0;
+    mSensorInfo.fifoReservedEventCount = kDefaultFifoEventCount;
+    mSensorInfo.fifoMaxEventCount = kDefaultFifoEventCount;
     mSensorInfo.requiredPermission = "";
-    mSensorInfo.flags = static_cast<uint32_t>(SensorInfo::SENSOR_FLAG_BITS_DATA_INJECTION);
+    mSensorInfo.flags = static_cast<uint32_t>(SensorInfo::SENSOR_FLAG_BITS_DATA_INJECTION |
+                                              directReportFlags(ISensors::RateLevel::FAST));
 };
 
 void AccelSensor::readEventPayload(EventPayload& payload) {
@@ -242,8 +262,8 @@ PressureSensor::PressureSensor(int32_t sensorHandle, ISensorsEventCallback* call
     mSensorInfo.power = 0.001f;           // mA
     mSensorInfo.minDelayUs = 100 * 1000;  // microseconds
     mSensorInfo.maxDelayUs = kDefaultMaxDelayUs;
-    mSensorInfo.fifoReservedEventCount = 0;
-    mSensorInfo.fifoMaxEventCount = 0;
+    mSensorInfo.fifoReservedEventCount = kDefaultFifoEventCount;
+    mSensorInfo.fifoMaxEventCount = kDefaultFifoEventCount;
     mSensorInfo.requiredPermission = "";
     mSensorInfo.flags = 0;
 };
@@ -265,10 +285,10 @@ MagnetometerSensor::MagnetometerSensor(int32_t sensorHandle, ISensorsEventCallba
     mSensorInfo.power = 0.001f;          // mA
     mSensorInfo.minDelayUs = 20 * 1000;  // microseconds
     mSensorInfo.maxDelayUs = kDefaultMaxDelayUs;
-    mSensorInfo.fifoReservedEventCount = 0;
-    mSensorInfo.fifoMaxEventCount = 0;
+    mSensorInfo.fifoReservedEventCount = kDefaultFifoEventCount;
+    mSensorInfo.fifoMaxEventCount = kDefaultFifoEventCount;
     mSensorInfo.requiredPermission = "";
-    mSensorInfo.flags = 0;
+    mSensorInfo.flags = directReportFlags(ISensors::RateLevel::NORMAL);
 };
 
 void MagnetometerSensor::readEventPayload(EventPayload& payload) {
@@ -340,10 +360,10 @@ GyroSensor::GyroSensor(int32_t sensorHandle, ISensorsEventCallback* callback) :
     mSensorInfo.power = 0.001f;
     mSensorInfo.minDelayUs = 10 * 1000;  // microseconds
     mSensorInfo.maxDelayUs = kDefaultMaxDelayUs;
-    mSensorInfo.fifoReservedEventCount = 0;
-    mSensorInfo.fifoMaxEventCount = 0;
+    mSensorInfo.fifoReservedEventCount = kDefaultFifoEventCount;
+    mSensorInfo.fifoMaxEventCount = kDefaultFifoEventCount;
     mSensorInfo.requiredPermission = "";
-    mSensorInfo.flags = 0;
+    mSensorInfo.flags = directReportFlags(ISensors::RateLevel::FAST);
 };
 
 void GyroSensor::readEventPayload(EventPayload& payload) {
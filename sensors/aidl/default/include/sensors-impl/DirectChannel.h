@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <aidl/android/hardware/sensors/BnSensors.h>
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace sensors {
+
+/**
+ * A direct report channel, the shared memory ring into which sensor events are written for the
+ * client to read without going through the framework.
+ *
+ * Each event takes ISensors::DIRECT_REPORT_SENSOR_EVENT_TOTAL_LENGTH bytes, laid out like a
+ * sensors_event_t, and carries an atomic counter that is written last so that the client can tell
+ * new events from old ones. Events are only written from the SensorScheduler thread.
+ */
+class DirectChannel {
+  public:
+    using Event = ::aidl::android::hardware::sensors::Event;
+    using SharedMemInfo = ::aidl::android::hardware::sensors::ISensors::SharedMemInfo;
+
+    /**
+     * Map the memory of an ashmem or memfd backed channel and zero it.
+     *
+     * The caller checks that the memory has a single file descriptor and room for one event.
+     *
+     * @return The channel, or nullptr if the memory couldn't be mapped.
+     */
+    static std::unique_ptr<DirectChannel> create(const SharedMemInfo& mem);
+
+    ~DirectChannel();
+
+    void write(int32_t reportToken, const Event& event);
+
+  private:
+    DirectChannel(uint8_t* buffer, size_t size);
+
+    uint8_t* const mBuffer;
+    const size_t mSize;
+
+    // The slot the next event is written to.
+    size_t mNextSlot = 0;
+    // The counter of the last event written, 0 if none was written yet.
+    uint32_t mCounter = 0;
+};
+
+}  // namespace sensors
+}  // namespace hardware
+}  // namespace android
+}  // namespace aidl
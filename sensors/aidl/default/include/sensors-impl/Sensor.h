@@ -14,15 +14,20 @@
  * limitations under the License.
  */
 
-#include <thread>
+#include <mutex>
+#include <vector>
 
 #include <aidl/android/hardware/sensors/BnSensors.h>
 
+#include "sensors-impl/SensorScheduler.h"
+
 namespace aidl {
 namespace android {
 namespace hardware {
 namespace sensors {
 
+class DirectChannel;
+
 class ISensorsEventCallback {
   public:
     using Event = ::aidl::android::hardware::sensors::Event;
@@ -34,6 +39,7 @@ class ISensorsEventCallback {
 class Sensor {
   public:
     using OperationMode = ::aidl::android::hardware::sensors::ISensors::OperationMode;
+    using RateLevel = ::aidl::android::hardware::sensors::ISensors::RateLevel;
     using Event = ::aidl::android::hardware::sensors::Event;
     using EventPayload = ::aidl::android::hardware::sensors::Event::EventPayload;
     using SensorInfo = ::aidl::android::hardware::sensors::SensorInfo;
@@ -45,7 +51,7 @@ class Sensor {
     virtual ~Sensor();
 
     const SensorInfo& getSensorInfo() const;
-    void batch(int64_t samplingPeriodNs);
+    void batch(int64_t samplingPeriodNs, int64_t maxReportLatencyNs = 0);
     virtual void activate(bool enable);
     ndk::ScopedAStatus flush();
 
@@ -53,23 +59,26 @@ class Sensor {
     bool supportsDataInjection() const;
     ndk::ScopedAStatus injectEvent(const Event& event);
 
+    ndk::ScopedAStatus configDirectReport(DirectChannel* channel, RateLevel rate,
+                                          int32_t* reportToken);
+
   protected:
-    void run();
-    virtual std::vector<Event> readEvents();
+    friend SensorScheduler;
+
+    // Called from the SensorScheduler thread to generate the sample taken at the given time.
+    virtual std::vector<Event> readEvents(int64_t timestampNs);
     virtual void readEventPayload(EventPayload&) = 0;
-    static void startThread(Sensor* sensor);
+    void updateScheduleLocked();
 
     bool isWakeUpSensor();
 
     bool mIsEnabled;
     int64_t mSamplingPeriodNs;
-    int64_t mLastSampleTimeNs;
+    int64_t mMaxReportLatencyNs;
     SensorInfo mSensorInfo;
 
-    std::atomic_bool mStopThread;
-    std::condition_variable mWaitCV;
-    std::mutex mRunMutex;
-    std::thread mRunThread;
+    // Protects the sampling parameters and the mode.
+    std::mutex mLock;
 
     ISensorsEventCallback* mCallback;
 
@@ -83,7 +92,7 @@ class OnChangeSensor : public Sensor {
     virtual void activate(bool enable) override;
 
   protected:
-    virtual std::vector<Event> readEvents() override;
+    virtual std::vector<Event> readEvents(int64_t timestampNs) override;
 
   protected:
     Event mPreviousEvent;
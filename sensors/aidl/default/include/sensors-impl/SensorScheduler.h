@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <sensors-scheduler/SensorScheduler.h>
+
+namespace aidl {
+namespace android {
+namespace hardware {
+namespace sensors {
+
+class DirectChannel;
+class Sensor;
+
+// Samples the sensors and writes their events to the Event FMQ and to the direct channels.
+using SensorScheduler =
+        ::android::hardware::sensors::common::SensorScheduler<Sensor, DirectChannel>;
+
+}  // namespace sensors
+}  // namespace hardware
+}  // namespace android
+}  // namespace aidl
@@ -21,6 +21,8 @@
 #include <fmq/AidlMessageQueue.h>
 #include <hardware_legacy/power.h>
 #include <map>
+#include <thread>
+#include "DirectChannel.h"
 #include "Sensor.h"
 
 namespace aidl {
@@ -41,6 +43,7 @@ class Sensors : public BnSensors, public ISensorsEventCallback {
     Sensors()
         : mEventQueueFlag(nullptr),
           mNextHandle(1),
+          mNextDirectChannelHandle(1),
           mOutstandingWakeUpEvents(0),
           mReadWakeLockQueueRun(false),
           mAutoReleaseWakeLockTime(0),
@@ -57,9 +60,15 @@ class Sensors : public BnSensors, public ISensorsEventCallback {
     }
 
     virtual ~Sensors() {
+        // Stop the sensors before the Event FMQ they write to goes away
+        for (auto sensor : mSensors) {
+            sensor.second->activate(false);
+        }
         deleteEventFlag();
         mReadWakeLockQueueRun = false;
-        mWakeLockThread.join();
+        if (mWakeLockThread.joinable()) {
+            mWakeLockThread.join();
+        }
     }
 
     ::ndk::ScopedAStatus activate(int32_t in_sensorHandle, bool in_enabled) override;
@@ -112,8 +121,14 @@ class Sensors : public BnSensors, public ISensorsEventCallback {
     // Add a new sensor
     template <class SensorType>
     void AddSensor() {
-        std::shared_ptr<SensorType> sensor =
-                std::make_shared<SensorType>(mNextHandle++ /* sensorHandle */, this /* callback */);
+        std::shared_ptr<SensorType> sensor(
+                new SensorType(mNextHandle++ /* sensorHandle */, this /* callback */),
+                [](SensorType* sensor) {
+                    // The scheduler calls virtual methods of the sensor, so it must stop before
+                    // the destructors run.
+                    SensorScheduler::getInstance().unscheduleAll(sensor);
+                    delete sensor;
+                });
         mSensors[sensor->getSensorInfo().sensorHandle] = sensor;
     }
 
@@ -194,6 +209,12 @@ class Sensors : public BnSensors, public ISensorsEventCallback {
     std::map<int32_t, std::shared_ptr<Sensor>> mSensors;
     // The next available sensor handle.
     int32_t mNextHandle;
+    // Lock to protect the direct channels.
+    std::mutex mDirectChannelLock;
+    // The registered direct channels, by handle. Destroyed before the sensors that report to them.
+    std::map<int32_t, std::unique_ptr<DirectChannel>> mDirectChannels;
+    // The next available direct channel handle.
+    int32_t mNextDirectChannelHandle;
     // Lock to protect writes to the FMQs.
     std::mutex mWriteLock;
     // Lock to protect acquiring and releasing the wake lock
@@ -0,0 +1,382 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sensors-impl/Sensors.h"
+
+#include <android-base/unique_fd.h>
+#include <cutils/ashmem.h>
+#include <gtest/gtest.h>
+#include <hardware/sensors.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using ::aidl::android::hardware::sensors::ISensors;
+using ::aidl::android::hardware::sensors::SensorInfo;
+using ::aidl::android::hardware::sensors::Sensors;
+using ::aidl::android::hardware::sensors::SensorType;
+using ::android::base::unique_fd;
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using RateLevel = ISensors::RateLevel;
+using SharedMemInfo = ISensors::SharedMemInfo;
+
+constexpr size_t kEventSize = ISensors::DIRECT_REPORT_SENSOR_EVENT_TOTAL_LENGTH;
+constexpr size_t kSlots = 128;
+// How long to wait for something that should happen, which only bounds how long a failing test
+// takes.
+constexpr auto kTimeout = 5s;
+// How long to wait for something that should not happen.
+constexpr auto kSettleTime = 100ms;
+
+// An ashmem region mapped like a client of the direct channel maps it.
+class SharedMemory {
+  public:
+    explicit SharedMemory(size_t size) : mSize(size) {
+        mFd.reset(ashmem_create_region("DirectChannelTest", size));
+        if (mFd.ok()) {
+            void* buffer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, mFd.get(), 0);
+            mBuffer = buffer == MAP_FAILED ? nullptr : static_cast<uint8_t*>(buffer);
+        }
+    }
+
+    ~SharedMemory() {
+        if (mBuffer != nullptr) {
+            munmap(mBuffer, mSize);
+        }
+    }
+
+    bool isValid() const { return mBuffer != nullptr; }
+    uint8_t* buffer() const { return mBuffer; }
+
+    SharedMemInfo info() const {
+        SharedMemInfo mem = {
+                .type = SharedMemInfo::SharedMemType::ASHMEM,
+                .format = SharedMemInfo::SharedMemFormat::SENSORS_EVENT,
+                .size = static_cast<int32_t>(mSize),
+        };
+        mem.memoryHandle.fds.emplace_back(dup(mFd.get()));
+        return mem;
+    }
+
+    uint32_t counter(size_t slot) const {
+        return __atomic_load_n(
+                reinterpret_cast<uint32_t*>(
+                        mBuffer + slot * kEventSize +
+                        ISensors::DIRECT_REPORT_SENSOR_EVENT_OFFSET_SIZE_ATOMIC_COUNTER),
+                __ATOMIC_ACQUIRE);
+    }
+
+    // Waits for the first count events, which fill the slots in order, and returns them.
+    std::vector<sensors_event_t> waitForEvents(size_t count) const {
+        std::vector<sensors_event_t> events;
+        const auto deadline = std::chrono::steady_clock::now() + kTimeout;
+        while (events.size() < count && std::chrono::steady_clock::now() < deadline) {
+            if (counter(events.size()) == events.size() + 1) {
+                sensors_event_t event;
+                memcpy(&event, mBuffer + events.size() * kEventSize, kEventSize);
+                events.push_back(event);
+            } else {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        return events;
+    }
+
+    // The number of events written so far, as long as the ring didn't wrap.
+    size_t eventCount() const {
+        size_t count = 0;
+        while (count < mSize / kEventSize && counter(count) != 0) {
+            count++;
+        }
+        return count;
+    }
+
+  private:
+    const size_t mSize;
+    unique_fd mFd;
+    uint8_t* mBuffer = nullptr;
+};
+
+int32_t serviceSpecificError(const ndk::ScopedAStatus& status) {
+    return status.getExceptionCode() == EX_SERVICE_SPECIFIC ? status.getServiceSpecificError() : 0;
+}
+
+}  // namespace
+
+class DirectChannelTest : public testing::Test {
+  public:
+    void SetUp() override {
+        mSensors = ndk::SharedRefBase::make<Sensors>();
+        ASSERT_TRUE(mSensors->getSensorsList(&mSensorList).isOk());
+        ASSERT_TRUE(mMemory.isValid());
+    }
+
+  protected:
+    const SensorInfo* findSensor(SensorType type) const {
+        for (const auto& sensor : mSensorList) {
+            if (sensor.type == type) return &sensor;
+        }
+        return nullptr;
+    }
+
+    static RateLevel maxRateLevel(const SensorInfo& sensor) {
+        return static_cast<RateLevel>(
+                (sensor.flags & SensorInfo::SENSOR_FLAG_BITS_MASK_DIRECT_REPORT) >>
+                SensorInfo::SENSOR_FLAG_SHIFT_DIRECT_REPORT);
+    }
+
+    int32_t registerChannel() {
+        int32_t channelHandle = 0;
+        EXPECT_TRUE(mSensors->registerDirectChannel(mMemory.info(), &channelHandle).isOk());
+        EXPECT_GT(channelHandle, 0);
+        return channelHandle;
+    }
+
+    // Checks that the events come from the sensor, at the period of the rate level.
+    void checkReports(const SensorInfo& sensor, RateLevel rate, int64_t expectedPeriodNs) {
+        SCOPED_TRACE(sensor.name + " at rate level " + std::to_string(static_cast<int>(rate)));
+        const int32_t channelHandle = registerChannel();
+        int32_t reportToken = 0;
+        ASSERT_TRUE(mSensors->configDirectReport(sensor.sensorHandle, channelHandle, rate,
+                                                 &reportToken)
+                            .isOk());
+        EXPECT_NE(0, reportToken);
+
+        const auto events = mMemory.waitForEvents(10);
+        ASSERT_EQ(10u, events.size());
+        ASSERT_TRUE(mSensors->unregisterDirectChannel(channelHandle).isOk());
+
+        int64_t minPeriodNs = INT64_MAX;
+        for (size_t i = 0; i < events.size(); ++i) {
+            EXPECT_EQ(reportToken, events[i].sensor);
+            EXPECT_EQ(static_cast<int32_t>(sensor.type), events[i].type);
+            if (i > 0) {
+                // The samples are timestamped with the time they were scheduled for, and the
+                // ones missed when the scheduler thread wakes up late are skipped.
+                const int64_t periodNs = events[i].timestamp - events[i - 1].timestamp;
+                EXPECT_GT(periodNs, 0);
+                EXPECT_EQ(0, periodNs % expectedPeriodNs) << "event " << i;
+                minPeriodNs = std::min(minPeriodNs, periodNs);
+            }
+        }
+        EXPECT_EQ(expectedPeriodNs, minPeriodNs);
+    }
+
+    std::shared_ptr<Sensors> mSensors;
+    std::vector<SensorInfo> mSensorList;
+    SharedMemory mMemory{kSlots * kEventSize};
+};
+
+TEST_F(DirectChannelTest, RegisterZeroesTheMemory) {
+    memset(mMemory.buffer(), 0xff, kSlots * kEventSize);
+    const int32_t channelHandle = registerChannel();
+    for (size_t i = 0; i < kSlots * kEventSize; ++i) {
+        ASSERT_EQ(0, mMemory.buffer()[i]) << "byte " << i;
+    }
+    EXPECT_TRUE(mSensors->unregisterDirectChannel(channelHandle).isOk());
+}
+
+TEST_F(DirectChannelTest, RegisterReturnsDistinctHandles) {
+    const int32_t first = registerChannel();
+    const int32_t second = registerChannel();
+    EXPECT_NE(first, second);
+    EXPECT_TRUE(mSensors->unregisterDirectChannel(first).isOk());
+    EXPECT_TRUE(mSensors->unregisterDirectChannel(second).isOk());
+}
+
+TEST_F(DirectChannelTest, RegisterRejectsGralloc) {
+    SharedMemInfo mem = mMemory.info();
+    mem.type = SharedMemInfo::SharedMemType::GRALLOC;
+    int32_t channelHandle = 0;
+    EXPECT_EQ(EX_ILLEGAL_ARGUMENT,
+              mSensors->registerDirectChannel(mem, &channelHandle).getExceptionCode());
+}
+
+TEST_F(DirectChannelTest, RegisterRejectsInvalidAshmem) {
+    int32_t channelHandle = 0;
+
+    SharedMemInfo mem = mMemory.info();
+    mem.format = static_cast<SharedMemInfo::SharedMemFormat>(0);
+    EXPECT_EQ(static_cast<int32_t>(ISensors::ERROR_BAD_VALUE),
+              serviceSpecificError(mSensors->registerDirectChannel(mem, &channelHandle)))
+            << "unknown format";
+
+    mem = mMemory.info();
+    mem.size = kEventSize - 1;
+    EXPECT_EQ(static_cast<int32_t>(ISensors::ERROR_BAD_VALUE),
+              serviceSpecificError(mSensors->registerDirectChannel(mem, &channelHandle)))
+            << "smaller than an event";
+
+    mem = mMemory.info();
+    mem.memoryHandle.fds.clear();
+    EXPECT_EQ(static_cast<int32_t>(ISensors::ERROR_BAD_VALUE),
+              serviceSpecificError(mSensors->registerDirectChannel(mem, &channelHandle)))
+            << "no file descriptor";
+}
+
+TEST_F(DirectChannelTest, AdvertisedRateLevels) {
+    for (const auto& sensor : mSensorList) {
+        const bool hasAshmem = sensor.flags & SensorInfo::SENSOR_FLAG_BITS_DIRECT_CHANNEL_ASHMEM;
+        switch (sensor.type) {
+            case SensorType::ACCELEROMETER:
+            case SensorType::GYROSCOPE:
+                EXPECT_TRUE(hasAshmem) << sensor.name;
+                EXPECT_EQ(RateLevel::FAST, maxRateLevel(sensor)) << sensor.name;
+                break;
+            case SensorType::MAGNETIC_FIELD:
+                EXPECT_TRUE(hasAshmem) << sensor.name;
+                EXPECT_EQ(RateLevel::NORMAL, maxRateLevel(sensor)) << sensor.name;
+                break;
+            default:
+                EXPECT_FALSE(hasAshmem) << sensor.name;
+                EXPECT_EQ(RateLevel::STOP, maxRateLevel(sensor)) << sensor.name;
+                break;
+        }
+    }
+}
+
+TEST_F(DirectChannelTest, NormalRateLevelReportsAt50Hz) {
+    const SensorInfo* accel = findSensor(SensorType::ACCELEROMETER);
+    ASSERT_NE(nullptr, accel);
+    checkReports(*accel, RateLevel::NORMAL, 20 * 1000 * 1000);
+}
+
+TEST_F(DirectChannelTest, FastRateLevelReportsAt200Hz) {
+    const SensorInfo* gyro = findSensor(SensorType::GYROSCOPE);
+    ASSERT_NE(nullptr, gyro);
+    checkReports(*gyro, RateLevel::FAST, 5 * 1000 * 1000);
+}
+
+TEST_F(DirectChannelTest, ConfigureRejectsUnsupportedRateLevels) {
+    const int32_t channelHandle = registerChannel();
+    int32_t reportToken = 0;
+    for (const auto& sensor : mSensorList) {
+        for (RateLevel rate : {RateLevel::NORMAL, RateLevel::FAST, RateLevel::VERY_FAST}) {
+            if (rate <= maxRateLevel(sensor)) continue;
+            EXPECT_EQ(EX_ILLEGAL_ARGUMENT,
+                      mSensors->configDirectReport(sensor.sensorHandle, channelHandle, rate,
+                                                   &reportToken)
+                              .getExceptionCode())
+                    << sensor.name << " at rate level " << static_cast<int>(rate);
+        }
+    }
+    EXPECT_EQ(0u, mMemory.eventCount());
+    EXPECT_TRUE(mSensors->unregisterDirectChannel(channelHandle).isOk());
+}
+
+TEST_F(DirectChannelTest, ConfigureRejectsUnknownHandles) {
+    const SensorInfo* accel = findSensor(SensorType::ACCELEROMETER);
+    ASSERT_NE(nullptr, accel);
+    const int32_t channelHandle = registerChannel();
+    int32_t reportToken = 0;
+    EXPECT_EQ(EX_ILLEGAL_ARGUMENT,
+              mSensors->configDirectReport(accel->sensorHandle, channelHandle + 1,
+                                           RateLevel::NORMAL, &reportToken)
+                      .getExceptionCode());
+    EXPECT_EQ(EX_ILLEGAL_ARGUMENT,
+              mSensors->configDirectReport(-2, channelHandle, RateLevel::NORMAL, &reportToken)
+                      .getExceptionCode());
+    // A sensor handle of -1 is only valid to stop all the sensors.
+    EXPECT_EQ(EX_ILLEGAL_ARGUMENT,
+              mSensors->configDirectReport(-1, channelHandle, RateLevel::NORMAL, &reportToken)
+                      .getExceptionCode());
+    EXPECT_TRUE(mSensors->unregisterDirectChannel(channelHandle).isOk());
+}
+
+TEST_F(DirectChannelTest, StopEndsTheReports) {
+    const SensorInfo* accel = findSensor(SensorType::ACCELEROMETER);
+    const SensorInfo* gyro = findSensor(SensorType::GYROSCOPE);
+    ASSERT_NE(nullptr, accel);
+    ASSERT_NE(nullptr, gyro);
+    const int32_t channelHandle = registerChannel();
+    int32_t reportToken = 0;
+    ASSERT_TRUE(mSensors->configDirectReport(accel->sensorHandle, channelHandle, RateLevel::FAST,
+                                             &reportToken)
+                        .isOk());
+    ASSERT_EQ(2u, mMemory.waitForEvents(2).size());
+
+    ASSERT_TRUE(mSensors->configDirectReport(accel->sensorHandle, channelHandle, RateLevel::STOP,
+                                             &reportToken)
+                        .isOk());
+    const size_t stoppedCount = mMemory.eventCount();
+    std::this_thread::sleep_for(kSettleTime);
+    EXPECT_EQ(stoppedCount, mMemory.eventCount());
+
+    // A sensor handle of -1 stops all of them.
+    ASSERT_TRUE(mSensors->configDirectReport(accel->sensorHandle, channelHandle, RateLevel::FAST,
+                                             &reportToken)
+                        .isOk());
+    ASSERT_TRUE(mSensors->configDirectReport(gyro->sensorHandle, channelHandle, RateLevel::FAST,
+                                             &reportToken)
+                        .isOk());
+    ASSERT_EQ(stoppedCount + 2, mMemory.waitForEvents(stoppedCount + 2).size());
+    ASSERT_TRUE(mSensors->configDirectReport(-1, channelHandle, RateLevel::STOP, &reportToken)
+                        .isOk());
+    const size_t allStoppedCount = mMemory.eventCount();
+    std::this_thread::sleep_for(kSettleTime);
+    EXPECT_EQ(allStoppedCount, mMemory.eventCount());
+
+    EXPECT_TRUE(mSensors->unregisterDirectChannel(channelHandle).isOk());
+}
+
+TEST_F(DirectChannelTest, UnregisterEndsTheReports) {
+    const SensorInfo* accel = findSensor(SensorType::ACCELEROMETER);
+    ASSERT_NE(nullptr, accel);
+    const int32_t channelHandle = registerChannel();
+    int32_t reportToken = 0;
+    ASSERT_TRUE(mSensors->configDirectReport(accel->sensorHandle, channelHandle, RateLevel::FAST,
+                                             &reportToken)
+                        .isOk());
+    ASSERT_EQ(2u, mMemory.waitForEvents(2).size());
+
+    ASSERT_TRUE(mSensors->unregisterDirectChannel(channelHandle).isOk());
+    const size_t unregisteredCount = mMemory.eventCount();
+    std::this_thread::sleep_for(kSettleTime);
+    EXPECT_EQ(unregisteredCount, mMemory.eventCount());
+
+    // The handle is no longer valid.
+    EXPECT_EQ(EX_ILLEGAL_ARGUMENT,
+              mSensors->configDirectReport(accel->sensorHandle, channelHandle, RateLevel::FAST,
+                                           &reportToken)
+                      .getExceptionCode());
+}
+
+TEST_F(DirectChannelTest, DestroyingTheHalEndsTheReports) {
+    const SensorInfo* accel = findSensor(SensorType::ACCELEROMETER);
+    ASSERT_NE(nullptr, accel);
+    const int32_t channelHandle = registerChannel();
+    int32_t reportToken = 0;
+    ASSERT_TRUE(mSensors->configDirectReport(accel->sensorHandle, channelHandle, RateLevel::FAST,
+                                             &reportToken)
+                        .isOk());
+    ASSERT_EQ(2u, mMemory.waitForEvents(2).size());
+
+    mSensors.reset();
+    const size_t destroyedCount = mMemory.eventCount();
+    std::this_thread::sleep_for(kSettleTime);
+    EXPECT_EQ(destroyedCount, mMemory.eventCount());
+}
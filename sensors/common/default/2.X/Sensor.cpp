@@ -16,8 +16,7 @@
 
 #include "Sensor.h"
 
-#include <utils/SystemClock.h>
-
+#include <algorithm>
 #include <cmath>
 
 namespace android {
@@ -39,44 +38,40 @@ using ::android::hardware::sensors::V2_1::SensorType;
 Sensor::Sensor(ISensorsEventCallback* callback)
     : mIsEnabled(false),
       mSamplingPeriodNs(0),
-      mLastSampleTimeNs(0),
+      mMaxReportLatencyNs(0),
       mCallback(callback),
-      mMode(OperationMode::NORMAL) {
-    mRunThread = std::thread(startThread, this);
-}
+      mMode(OperationMode::NORMAL) {}
 
-Sensor::~Sensor() {
-    std::unique_lock<std::mutex> lock(mRunMutex);
-    mStopThread = true;
-    mIsEnabled = false;
-    mWaitCV.notify_all();
-    lock.release();
-    mRunThread.join();
-}
+Sensor::~Sensor() {}
 
 const SensorInfo& Sensor::getSensorInfo() const {
     return mSensorInfo;
 }
 
-void Sensor::batch(int64_t samplingPeriodNs) {
+void Sensor::batch(int64_t samplingPeriodNs, int64_t maxReportLatencyNs) {
     if (samplingPeriodNs < mSensorInfo.minDelay * 1000LL) {
         samplingPeriodNs = mSensorInfo.minDelay * 1000LL;
     } else if (samplingPeriodNs > mSensorInfo.maxDelay * 1000LL) {
         samplingPeriodNs = mSensorInfo.maxDelay * 1000LL;
     }
 
-    if (mSamplingPeriodNs != samplingPeriodNs) {
+    // Sensors without a FIFO can't batch, and the others must report before their FIFO overflows.
+    maxReportLatencyNs = std::clamp(maxReportLatencyNs, int64_t(0),
+                                    mSensorInfo.fifoMaxEventCount * samplingPeriodNs);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    if (mSamplingPeriodNs != samplingPeriodNs || mMaxReportLatencyNs != maxReportLatencyNs) {
         mSamplingPeriodNs = samplingPeriodNs;
-        // Wake up the 'run' thread to check if a new event should be generated now
-        mWaitCV.notify_all();
+        mMaxReportLatencyNs = maxReportLatencyNs;
+        updateScheduleLocked();
     }
 }
 
 void Sensor::activate(bool enable) {
+    std::lock_guard<std::mutex> lock(mLock);
     if (mIsEnabled != enable) {
-        std::unique_lock<std::mutex> lock(mRunMutex);
         mIsEnabled = enable;
-        mWaitCV.notify_all();
+        updateScheduleLocked();
     }
 }
 
@@ -87,45 +82,26 @@ Result Sensor::flush() {
         return Result::BAD_VALUE;
     }
 
-    // Note: If a sensor supports batching, write all of the currently batched events for the sensor
-    // to the Event FMQ prior to writing the flush complete event.
+    // The scheduler writes all of the currently batched events for the sensor to the Event FMQ
+    // prior to writing the flush complete event.
     Event ev;
     ev.sensorHandle = mSensorInfo.sensorHandle;
     ev.sensorType = SensorType::META_DATA;
     ev.u.meta.what = MetaDataEventType::META_DATA_FLUSH_COMPLETE;
-    std::vector<Event> evs{ev};
-    mCallback->postEvents(evs, isWakeUpSensor());
+    SensorScheduler::getInstance().flush(this, ev);
 
     return Result::OK;
 }
 
-void Sensor::startThread(Sensor* sensor) {
-    sensor->run();
-}
-
-void Sensor::run() {
-    std::unique_lock<std::mutex> runLock(mRunMutex);
-    constexpr int64_t kNanosecondsInSeconds = 1000 * 1000 * 1000;
-
-    while (!mStopThread) {
-        if (!mIsEnabled || mMode == OperationMode::DATA_INJECTION) {
-            mWaitCV.wait(runLock, [&] {
-                return ((mIsEnabled && mMode == OperationMode::NORMAL) || mStopThread);
-            });
-        } else {
-            timespec curTime;
-            clock_gettime(CLOCK_BOOTTIME, &curTime);
-            int64_t now = (curTime.tv_sec * kNanosecondsInSeconds) + curTime.tv_nsec;
-            int64_t nextSampleTime = mLastSampleTimeNs + mSamplingPeriodNs;
-
-            if (now >= nextSampleTime) {
-                mLastSampleTimeNs = now;
-                nextSampleTime = mLastSampleTimeNs + mSamplingPeriodNs;
-                mCallback->postEvents(readEvents(), isWakeUpSensor());
-            }
-
-            mWaitCV.wait_for(runLock, std::chrono::nanoseconds(nextSampleTime - now));
-        }
+void Sensor::updateScheduleLocked() {
+    if (mIsEnabled && mMode == OperationMode::NORMAL) {
+        // Sample at the fastest rate until batch() is called, rather than spinning with a period
+        // of 0.
+        int64_t samplingPeriodNs =
+                mSamplingPeriodNs > 0 ? mSamplingPeriodNs : mSensorInfo.minDelay * 1000LL;
+        SensorScheduler::getInstance().schedule(this, samplingPeriodNs, mMaxReportLatencyNs);
+    } else {
+        SensorScheduler::getInstance().unschedule(this);
     }
 }
 
@@ -133,12 +109,12 @@ bool Sensor::isWakeUpSensor() {
     return mSensorInfo.flags & static_cast<uint32_t>(SensorFlagBits::WAKE_UP);
 }
 
-std::vector<Event> Sensor::readEvents() {
+std::vector<Event> Sensor::readEvents(int64_t timestampNs) {
     std::vector<Event> events;
     Event event;
     event.sensorHandle = mSensorInfo.sensorHandle;
     event.sensorType = mSensorInfo.type;
-    event.timestamp = ::android::elapsedRealtimeNano();
+    event.timestamp = timestampNs;
     memset(&event.u, 0, sizeof(event.u));
     readEventPayload(event.u);
     events.push_back(event);
@@ -146,10 +122,10 @@ std::vector<Event> Sensor::readEvents() {
 }
 
 void Sensor::setOperationMode(OperationMode mode) {
+    std::lock_guard<std::mutex> lock(mLock);
     if (mMode != mode) {
-        std::unique_lock<std::mutex> lock(mRunMutex);
         mMode = mode;
-        mWaitCV.notify_all();
+        updateScheduleLocked();
     }
 }
 
@@ -182,8 +158,8 @@ void OnChangeSensor::activate(bool enable) {
     }
 }
 
-std::vector<Event> OnChangeSensor::readEvents() {
-    std::vector<Event> events = Sensor::readEvents();
+std::vector<Event> OnChangeSensor::readEvents(int64_t timestampNs) {
+    std::vector<Event> events = Sensor::readEvents(timestampNs);
     std::vector<Event> outputEvents;
 
     for (auto iter = events.begin(); iter != events.end(); ++iter) {
@@ -209,8 +185,8 @@ AccelSensor::AccelSensor(int32_t sensorHandle, ISensorsEventCallback* callback)
     mSensorInfo.power = 0.001f;        // mA
     mSensorInfo.minDelay = 10 * 1000;  // microseconds
     mSensorInfo.maxDelay = kDefaultMaxDelayUs;
-    mSensorInfo.fifoReservedEventCount = 0;
-    mSensorInfo.fifoMaxEventCount = 0;
+    mSensorInfo.fifoReservedEventCount = kDefaultFifoEventCount;
+    mSensorInfo.fifoMaxEventCount = kDefaultFifoEventCount;
     mSensorInfo.requiredPermission = "";
     mSensorInfo.flags = static_cast<uint32_t>(SensorFlagBits::DATA_INJECTION);
 };
@@ -235,8 +211,8 @@ PressureSensor::PressureSensor(int32_t sensorHandle, ISensorsEventCallback* call
     mSensorInfo.power = 0.001f;         // mA
     mSensorInfo.minDelay = 100 * 1000;  // microseconds
     mSensorInfo.maxDelay = kDefaultMaxDelayUs;
-    mSensorInfo.fifoReservedEventCount = 0;
-    mSensorInfo.fifoMaxEventCount = 0;
+    mSensorInfo.fifoReservedEventCount = kDefaultFifoEventCount;
+    mSensorInfo.fifoMaxEventCount = kDefaultFifoEventCount;
     mSensorInfo.requiredPermission = "";
     mSensorInfo.flags = 0;
 };
@@ -258,8 +234,8 @@ MagnetometerSensor::MagnetometerSensor(int32_t sensorHandle, ISensorsEventCallba
     mSensorInfo.power = 0.001f;        // mA
     mSensorInfo.minDelay = 20 * 1000;  // microseconds
     mSensorInfo.maxDelay = kDefaultMaxDelayUs;
-    mSensorInfo.fifoReservedEventCount = 0;
-    mSensorInfo.fifoMaxEventCount = 0;
+    mSensorInfo.fifoReservedEventCount = kDefaultFifoEventCount;
+    mSensorInfo.fifoMaxEventCount = kDefaultFifoEventCount;
     mSensorInfo.requiredPermission = "";
     mSensorInfo.flags = 0;
 };
@@ -315,8 +291,8 @@ GyroSensor::GyroSensor(int32_t sensorHandle, ISensorsEventCallback* callback) :
     mSensorInfo.power = 0.001f;
     mSensorInfo.minDelay = 10 * 1000;  // microseconds
     mSensorInfo.maxDelay = kDefaultMaxDelayUs;
-    mSensorInfo.fifoReservedEventCount = 0;
-    mSensorInfo.fifoMaxEventCount = 0;
+    mSensorInfo.fifoReservedEventCount = kDefaultFifoEventCount;
+    mSensorInfo.fifoMaxEventCount = kDefaultFifoEventCount;
     mSensorInfo.requiredPermission = "";
     mSensorInfo.flags = 0;
 };
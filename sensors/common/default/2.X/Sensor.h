@@ -19,11 +19,10 @@
 
 #include <android/hardware/sensors/1.0/types.h>
 #include <android/hardware/sensors/2.1/types.h>
+#include <sensors-scheduler/SensorScheduler.h>
 
-#include <condition_variable>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <vector>
 
 namespace android {
@@ -33,6 +32,7 @@ namespace V2_X {
 namespace implementation {
 
 static constexpr int32_t kDefaultMaxDelayUs = 10 * 1000 * 1000;
+static constexpr uint32_t kDefaultFifoEventCount = 300;
 
 class ISensorsEventCallback {
   public:
@@ -42,6 +42,9 @@ class ISensorsEventCallback {
     virtual void postEvents(const std::vector<Event>& events, bool wakeup) = 0;
 };
 
+class Sensor;
+using SensorScheduler = ::android::hardware::sensors::common::SensorScheduler<Sensor>;
+
 class Sensor {
   public:
     using OperationMode = ::android::hardware::sensors::V1_0::OperationMode;
@@ -55,7 +58,7 @@ class Sensor {
     virtual ~Sensor();
 
     const SensorInfo& getSensorInfo() const;
-    void batch(int64_t samplingPeriodNs);
+    void batch(int64_t samplingPeriodNs, int64_t maxReportLatencyNs = 0);
     virtual void activate(bool enable);
     Result flush();
 
@@ -64,22 +67,22 @@ class Sensor {
     Result injectEvent(const Event& event);
 
   protected:
-    void run();
-    virtual std::vector<Event> readEvents();
+    friend SensorScheduler;
+
+    // Called from the SensorScheduler thread to generate the sample taken at the given time.
+    virtual std::vector<Event> readEvents(int64_t timestampNs);
     virtual void readEventPayload(EventPayload&) {}
-    static void startThread(Sensor* sensor);
+    void updateScheduleLocked();
 
     bool isWakeUpSensor();
 
     bool mIsEnabled;
     int64_t mSamplingPeriodNs;
-    int64_t mLastSampleTimeNs;
+    int64_t mMaxReportLatencyNs;
     SensorInfo mSensorInfo;
 
-    std::atomic_bool mStopThread;
-    std::condition_variable mWaitCV;
-    std::mutex mRunMutex;
-    std::thread mRunThread;
+    // Protects the sampling parameters and the mode.
+    std::mutex mLock;
 
     ISensorsEventCallback* mCallback;
 
@@ -93,7 +96,7 @@ class OnChangeSensor : public Sensor {
     virtual void activate(bool enable) override;
 
   protected:
-    virtual std::vector<Event> readEvents() override;
+    virtual std::vector<Event> readEvents(int64_t timestampNs) override;
 
   protected:
     Event mPreviousEvent;
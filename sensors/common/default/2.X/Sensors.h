@@ -72,6 +72,10 @@ struct Sensors : public ISensorsInterface, public ISensorsEventCallback {
     }
 
     virtual ~Sensors() {
+        // Stop the sensors before the Event FMQ they write to goes away
+        for (auto sensor : mSensors) {
+            sensor.second->activate(false /* enable */);
+        }
         deleteEventFlag();
         mReadWakeLockQueueRun = false;
         mWakeLockThread.join();
@@ -154,10 +158,10 @@ struct Sensors : public ISensorsInterface, public ISensorsEventCallback {
     }
 
     Return<Result> batch(int32_t sensorHandle, int64_t samplingPeriodNs,
-                         int64_t /* maxReportLatencyNs */) override {
+                         int64_t maxReportLatencyNs) override {
         auto sensor = mSensors.find(sensorHandle);
         if (sensor != mSensors.end()) {
-            sensor->second->batch(samplingPeriodNs);
+            sensor->second->batch(samplingPeriodNs, maxReportLatencyNs);
             return Result::OK;
         }
         return Result::BAD_VALUE;
@@ -216,8 +220,14 @@ struct Sensors : public ISensorsInterface, public ISensorsEventCallback {
      */
     template <class SensorType>
     void AddSensor() {
-        std::shared_ptr<SensorType> sensor =
-                std::make_shared<SensorType>(mNextHandle++ /* sensorHandle */, this /* callback */);
+        std::shared_ptr<SensorType> sensor(
+                new SensorType(mNextHandle++ /* sensorHandle */, this /* callback */),
+                [](SensorType* sensor) {
+                    // The scheduler calls virtual methods of the sensor, so it must stop before
+                    // the destructors run.
+                    SensorScheduler::getInstance().unscheduleAll(sensor);
+                    delete sensor;
+                });
         mSensors[sensor->getSensorInfo().sensorHandle] = sensor;
     }
 
@@ -224,8 +224,10 @@ Return<Result> HalProxy::initializeCommon(
     disableAllSensors();
 
     // Clears the queue if any events were pending write before.
-    mPendingWriteEventsQueue = std::queue<std::pair<std::vector<V2_1::Event>, size_t>>();
-    mSizePendingWriteEventsQueue = 0;
+    {
+        std::lock_guard<std::mutex> lock(mPendingWritesMutex);
+        mPendingWriteEventsQueue.clear();
+    }
 
     // Clears previously connected dynamic sensors
     mDynamicSensors.clear();
@@ -370,13 +372,13 @@ Return<void> HalProxy::debug(const hidl_handle& fd, const hidl_vec<hidl_string>&
            << " ms ago" << std::endl;
     // TODO(b/142969448): Add logging for history of wakelock acquisition per subhal.
     stream << "  Wakelock ref count: " << mWakelockRefCount << std::endl;
-    stream << "  # of events on pending write writes queue: " << mSizePendingWriteEventsQueue
-           << std::endl;
-    stream << " Most events seen on pending write events queue: "
-           << mMostEventsObservedPendingWriteEventsQueue << std::endl;
-    if (!mPendingWriteEventsQueue.empty()) {
-        stream << "  Size of events list on front of pending writes queue: "
-               << mPendingWriteEventsQueue.front().first.size() << std::endl;
+    {
+        std::lock_guard<std::mutex> lock(mPendingWritesMutex);
+        stream << "  # of events on pending write writes queue: "
+               << mPendingWriteEventsQueue.size() << std::endl;
+        stream << " Most events seen on pending write events queue: "
+               << mMostEventsObservedPendingWriteEventsQueue << std::endl;
+        stream << "  # of events dropped: " << mNumDroppedEvents << std::endl;
     }
     stream << "  # of non-dynamic sensors across all subhals: " << mSensors.size() << std::endl;
     stream << "  # of dynamic sensors across all subhals: " << mDynamicSensors.size() << std::endl;
@@ -544,7 +546,11 @@ void HalProxy::stopThreads() {
         mWakelockQueueFlag->wake(static_cast<uint32_t>(WakeLockQueueFlagBits::DATA_WRITTEN));
     }
     mWakelockCV.notify_one();
-    mEventQueueWriteCV.notify_one();
+    {
+        // Makes sure the pending writes thread either sees mThreadsRun or is waiting to be notified
+        std::lock_guard<std::mutex> lock(mPendingWritesMutex);
+    }
+    mPendingWritesCV.notify_one();
     if (mPendingWritesThread.joinable()) {
         mPendingWritesThread.join();
     }
@@ -570,43 +576,34 @@ void HalProxy::startPendingWritesThread(HalProxy* halProxy) {
 }
 
 void HalProxy::handlePendingWrites() {
-    // TODO(b/143302327): Find a way to optimize locking strategy maybe using two mutexes instead of
-    // one.
-    std::unique_lock<std::mutex> lock(mEventQueueWriteMutex);
+    std::unique_lock<std::mutex> lock(mPendingWritesMutex);
     while (mThreadsRun.load()) {
-        mEventQueueWriteCV.wait(
+        mPendingWritesCV.wait(
                 lock, [&] { return !mPendingWriteEventsQueue.empty() || !mThreadsRun.load(); });
         if (mThreadsRun.load()) {
-            std::vector<Event>& pendingWriteEvents = mPendingWriteEventsQueue.front().first;
-            size_t numWakeupEvents = mPendingWriteEventsQueue.front().second;
-            size_t eventQueueSize = mEventQueue->getQuantumCount();
-            size_t numToWrite = std::min(pendingWriteEvents.size(), eventQueueSize);
+            // The events stay on the queue until written, and subhals only append events behind
+            // them, so they can be written straight from the queue without holding the lock.
+            size_t numToWrite;
+            const Event* pendingWriteEvents = mPendingWriteEventsQueue.front(&numToWrite);
+            numToWrite = std::min(numToWrite, mEventQueue->getQuantumCount());
             lock.unlock();
-            if (!mEventQueue->writeBlocking(
-                        pendingWriteEvents.data(), numToWrite,
-                        static_cast<uint32_t>(EventQueueFlagBits::EVENTS_READ),
-                        static_cast<uint32_t>(EventQueueFlagBits::READ_AND_PROCESS),
-                        kPendingWriteTimeoutNs, mEventQueueFlag)) {
+            bool written = mEventQueue->writeBlocking(
+                    pendingWriteEvents, numToWrite,
+                    static_cast<uint32_t>(EventQueueFlagBits::EVENTS_READ),
+                    static_cast<uint32_t>(EventQueueFlagBits::READ_AND_PROCESS),
+                    kPendingWriteTimeoutNs, mEventQueueFlag);
+            if (!written) {
                 ALOGE("Dropping %zu events after blockingWrite failed.", numToWrite);
+                size_t numWakeupEvents = countNumWakeupEvents(pendingWriteEvents, numToWrite);
                 if (numWakeupEvents > 0) {
-                    if (pendingWriteEvents.size() > eventQueueSize) {
-                        decrementRefCountAndMaybeReleaseWakelock(
-                                countNumWakeupEvents(pendingWriteEvents, eventQueueSize));
-                    } else {
-                        decrementRefCountAndMaybeReleaseWakelock(numWakeupEvents);
-                    }
+                    decrementRefCountAndMaybeReleaseWakelock(numWakeupEvents);
                 }
             }
             lock.lock();
-            mSizePendingWriteEventsQueue -= numToWrite;
-            if (pendingWriteEvents.size() > eventQueueSize) {
-                // TODO(b/143302327): Check if this erase operation is too inefficient. It will copy
-                // all the events ahead of it down to fill gap off array at front after the erase.
-                pendingWriteEvents.erase(pendingWriteEvents.begin(),
-                                         pendingWriteEvents.begin() + eventQueueSize);
-            } else {
-                mPendingWriteEventsQueue.pop();
+            if (!written) {
+                mNumDroppedEvents += numToWrite;
             }
+            mPendingWriteEventsQueue.pop(numToWrite);
         }
     }
 }
@@ -660,32 +657,54 @@ void HalProxy::resetSharedWakelock() {
 
 void HalProxy::postEventsToMessageQueue(const std::vector<Event>& events, size_t numWakeupEvents,
                                         V2_0::implementation::ScopedWakelock wakelock) {
-    size_t numToWrite = 0;
     std::lock_guard<std::mutex> lock(mEventQueueWriteMutex);
     if (wakelock.isLocked()) {
         incrementRefCountAndMaybeAcquireWakelock(numWakeupEvents);
     }
-    if (mPendingWriteEventsQueue.empty()) {
-        numToWrite = std::min(events.size(), mEventQueue->availableToWrite());
-        if (numToWrite > 0) {
-            if (mEventQueue->write(events.data(), numToWrite)) {
-                // TODO(b/143302327): While loop if mEventQueue->avaiableToWrite > 0 to possibly fit
-                // in more writes immediately
-                mEventQueueFlag->wake(static_cast<uint32_t>(EventQueueFlagBits::READ_AND_PROCESS));
-            } else {
-                numToWrite = 0;
-            }
+
+    // Events may only be written directly if none are pending ahead of them, in which case the
+    // pending writes thread isn't writing to the fmq either.
+    bool hasPendingWrites;
+    {
+        std::lock_guard<std::mutex> pendingLock(mPendingWritesMutex);
+        hasPendingWrites = !mPendingWriteEventsQueue.empty();
+    }
+    size_t numWritten = 0;
+    while (!hasPendingWrites && numWritten < events.size()) {
+        // Keep writing as long as the framework makes room for more events.
+        size_t numToWrite =
+                std::min(events.size() - numWritten, mEventQueue->availableToWrite());
+        if (numToWrite == 0 || !mEventQueue->write(events.data() + numWritten, numToWrite)) {
+            break;
+        }
+        numWritten += numToWrite;
+        mEventQueueFlag->wake(static_cast<uint32_t>(EventQueueFlagBits::READ_AND_PROCESS));
+    }
+    if (numWritten == events.size()) {
+        return;
+    }
+
+    const Event* eventsLeft = events.data() + numWritten;
+    size_t numLeft = events.size() - numWritten;
+    bool queued;
+    {
+        std::lock_guard<std::mutex> pendingLock(mPendingWritesMutex);
+        queued = mPendingWriteEventsQueue.push(eventsLeft, numLeft);
+        if (queued) {
+            mMostEventsObservedPendingWriteEventsQueue =
+                    std::max(mMostEventsObservedPendingWriteEventsQueue,
+                             mPendingWriteEventsQueue.size());
+        } else {
+            mNumDroppedEvents += numLeft;
         }
     }
-    size_t numLeft = events.size() - numToWrite;
-    if (numToWrite < events.size() &&
-        mSizePendingWriteEventsQueue + numLeft <= kMaxSizePendingWriteEventsQueue) {
-        std::vector<Event> eventsLeft(events.begin() + numToWrite, events.end());
-        mPendingWriteEventsQueue.push({eventsLeft, numWakeupEvents});
-        mSizePendingWriteEventsQueue += numLeft;
-        mMostEventsObservedPendingWriteEventsQueue =
-                std::max(mMostEventsObservedPendingWriteEventsQueue, mSizePendingWriteEventsQueue);
-        mEventQueueWriteCV.notify_one();
+    if (queued) {
+        mPendingWritesCV.notify_one();
+    } else {
+        ALOGE("Dropping %zu events because the pending write events queue is full.", numLeft);
+        if (numWakeupEvents > 0) {
+            decrementRefCountAndMaybeReleaseWakelock(countNumWakeupEvents(eventsLeft, numLeft));
+        }
     }
 }
 
@@ -744,7 +763,7 @@ bool HalProxy::isSubHalIndexValid(int32_t sensorHandle) {
     return extractSubHalIndex(sensorHandle) < mSubHalList.size();
 }
 
-size_t HalProxy::countNumWakeupEvents(const std::vector<Event>& events, size_t n) {
+size_t HalProxy::countNumWakeupEvents(const Event* events, size_t n) {
     size_t numWakeupEvents = 0;
     for (size_t i = 0; i < n; i++) {
         int32_t sensorHandle = events[i].sensorHandle;
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace android {
+namespace hardware {
+namespace sensors {
+namespace V2_1 {
+namespace implementation {
+
+/**
+ * A fixed-capacity FIFO ring of events.
+ *
+ * The storage is split into blocks of kBlockSize events which are only allocated when the ring
+ * first grows into them, so an idle ring costs next to nothing even with a large capacity. Blocks
+ * are kept until clear() is called and events never move once pushed, so the events returned by
+ * front() stay valid while more events are pushed, until they are popped.
+ *
+ * The ring is not thread-safe; callers must serialize access to it.
+ */
+template <typename T, size_t kBlockSize = 1024>
+class EventRing {
+  public:
+    explicit EventRing(size_t capacity)
+        : mCapacity(capacity), mBlocks((capacity + kBlockSize - 1) / kBlockSize) {}
+
+    size_t capacity() const { return mCapacity; }
+
+    size_t size() const { return mSize; }
+
+    bool empty() const { return mSize == 0; }
+
+    /**
+     * Append count events to the back of the ring.
+     *
+     * @return true if the events were appended, false if they didn't all fit in which case none of
+     *     them were appended.
+     */
+    bool push(const T* events, size_t count) {
+        if (count > mCapacity - mSize) {
+            return false;
+        }
+
+        size_t position = (mHead + mSize) % numSlots();
+        while (count > 0) {
+            std::unique_ptr<T[]>& block = mBlocks[position / kBlockSize];
+            if (block == nullptr) {
+                block = std::make_unique<T[]>(kBlockSize);
+            }
+            size_t offset = position % kBlockSize;
+            size_t numToCopy = std::min(count, kBlockSize - offset);
+            std::copy_n(events, numToCopy, &block[offset]);
+
+            events += numToCopy;
+            count -= numToCopy;
+            mSize += numToCopy;
+            position = (position + numToCopy) % numSlots();
+        }
+        return true;
+    }
+
+    /**
+     * Get the contiguous run of events at the front of the ring.
+     *
+     * @param count Set to the number of events in the run, which is 0 if the ring is empty.
+     *
+     * @return The first event of the run.
+     */
+    const T* front(size_t* count) const {
+        if (mSize == 0) {
+            *count = 0;
+            return nullptr;
+        }
+        size_t offset = mHead % kBlockSize;
+        *count = std::min(mSize, kBlockSize - offset);
+        return &mBlocks[mHead / kBlockSize][offset];
+    }
+
+    //! Remove count events, at most size(), from the front of the ring.
+    void pop(size_t count) {
+        count = std::min(count, mSize);
+        mSize -= count;
+        // Restart from the first block when empty, so a ring that keeps up stays in one block.
+        mHead = mSize == 0 ? 0 : (mHead + count) % numSlots();
+    }
+
+    //! Remove all the events and release the memory holding them.
+    void clear() {
+        mHead = 0;
+        mSize = 0;
+        for (auto& block : mBlocks) {
+            block.reset();
+        }
+    }
+
+  private:
+    size_t numSlots() const { return mBlocks.size() * kBlockSize; }
+
+    //! The max number of events in the ring.
+    const size_t mCapacity;
+
+    //! The position of the first event, in [0, numSlots()).
+    size_t mHead = 0;
+
+    //! The number of events in the ring.
+    size_t mSize = 0;
+
+    //! The storage blocks, nullptr until first used.
+    std::vector<std::unique_ptr<T[]>> mBlocks;
+};
+
+}  // namespace implementation
+}  // namespace V2_1
+}  // namespace sensors
+}  // namespace hardware
+}  // namespace android
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "EventMessageQueueWrapper.h"
+#include "EventRing.h"
 #include "HalProxyCallback.h"
 #include "ISensorsCallbackWrapper.h"
 #include "SubHalWrapper.h"
@@ -37,7 +38,6 @@
 #include <condition_variable>
 #include <map>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <utility>
 
@@ -201,26 +201,30 @@ class HalProxy : public V2_0::implementation::IScopedWakelockRefCounter,
     //! The bit mask used to get the subhal index from a sensor handle.
     static constexpr int32_t kSensorHandleSubHalIndexMask = 0xFF000000;
 
+    //! The max number of events allowed in the pending write events queue
+    static constexpr size_t kMaxSizePendingWriteEventsQueue = 100000;
+
     /**
-     * A FIFO queue of pairs of vector of events and the number of wakeup events in that vector
-     * which are waiting to be written to the events fmq in the background thread.
+     * A FIFO queue of events which are waiting to be written to the events fmq in the background
+     * thread. While it isn't empty, the background thread is the only writer of the events fmq.
      */
-    std::queue<std::pair<std::vector<Event>, size_t>> mPendingWriteEventsQueue;
+    EventRing<Event> mPendingWriteEventsQueue{kMaxSizePendingWriteEventsQueue};
 
     //! The most events observed on the pending write events queue for debug purposes.
     size_t mMostEventsObservedPendingWriteEventsQueue = 0;
 
-    //! The max number of events allowed in the pending write events queue
-    static constexpr size_t kMaxSizePendingWriteEventsQueue = 100000;
-
-    //! The number of events in the pending write events queue
-    size_t mSizePendingWriteEventsQueue = 0;
+    //! The number of events dropped because the pending write events queue was full or the
+    //! blocking write of the background thread timed out, for debug purposes.
+    size_t mNumDroppedEvents = 0;
 
-    //! The mutex protecting writing to the fmq and the pending events queue
+    //! The mutex serializing the subhals writing events to the fmq.
     std::mutex mEventQueueWriteMutex;
 
+    //! The mutex protecting the pending write events queue and its statistics.
+    std::mutex mPendingWritesMutex;
+
     //! The condition variable waiting on pending write events to stack up
-    std::condition_variable mEventQueueWriteCV;
+    std::condition_variable mPendingWritesCV;
 
     //! The thread object ptr that handles pending writes
     std::thread mPendingWritesThread;
@@ -357,14 +361,14 @@ class HalProxy : public V2_0::implementation::IScopedWakelockRefCounter,
     bool isSubHalIndexValid(int32_t sensorHandle);
 
     /**
-     * Count the number of wakeup events in the first n events of the vector.
+     * Count the number of wakeup events in the first n events of the array.
      *
-     * @param events The vector of Event objects.
+     * @param events The array of Event objects.
      * @param n The end index not inclusive of events to consider.
      *
      * @return The number of wakeup events of the considered events.
      */
-    size_t countNumWakeupEvents(const std::vector<Event>& events, size_t n);
+    size_t countNumWakeupEvents(const Event* events, size_t n);
 
     /*
      * Clear out the subhal index bytes from a sensorHandle.
@@ -0,0 +1,127 @@
+//
+// Copyright (C) 2023 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "EventRing.h"
+
+#include <numeric>
+#include <vector>
+
+namespace {
+
+using ::android::hardware::sensors::V2_1::implementation::EventRing;
+
+constexpr size_t kBlockSize = 4;
+using TestRing = EventRing<int, kBlockSize>;
+
+// Pops all the values off the ring, one contiguous run at a time
+std::vector<int> drain(TestRing& ring) {
+    std::vector<int> values;
+    size_t count;
+    while (const int* run = ring.front(&count)) {
+        EXPECT_GT(count, 0u);
+        EXPECT_LE(count, kBlockSize);
+        values.insert(values.end(), run, run + count);
+        ring.pop(count);
+    }
+    EXPECT_TRUE(ring.empty());
+    return values;
+}
+
+std::vector<int> makeValues(int first, size_t count) {
+    std::vector<int> values(count);
+    std::iota(values.begin(), values.end(), first);
+    return values;
+}
+
+}  // namespace
+
+TEST(EventRingTest, EmptyRing) {
+    TestRing ring(10);
+    size_t count = 1;
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ring.front(&count), nullptr);
+    EXPECT_EQ(count, 0u);
+}
+
+TEST(EventRingTest, PushAndPopAcrossBlocks) {
+    TestRing ring(10);
+    std::vector<int> values = makeValues(0, 10);
+    ASSERT_TRUE(ring.push(values.data(), values.size()));
+    EXPECT_EQ(ring.size(), 10u);
+    EXPECT_EQ(drain(ring), values);
+}
+
+TEST(EventRingTest, PushFailsWhenFull) {
+    TestRing ring(10);
+    std::vector<int> values = makeValues(0, 8);
+    ASSERT_TRUE(ring.push(values.data(), values.size()));
+    EXPECT_FALSE(ring.push(values.data(), 3));
+    EXPECT_EQ(ring.size(), 8u);
+    EXPECT_TRUE(ring.push(values.data(), 2));
+    EXPECT_EQ(ring.size(), 10u);
+}
+
+TEST(EventRingTest, WrapsAround) {
+    TestRing ring(10);
+    std::vector<int> expected = makeValues(0, 5);
+    int next = expected.size();
+    ASSERT_TRUE(ring.push(expected.data(), expected.size()));
+
+    // Keep the ring half full so the head moves around the whole storage a few times
+    for (int i = 0; i < 20; i++) {
+        std::vector<int> values = makeValues(next, 3);
+        next += values.size();
+        ASSERT_TRUE(ring.push(values.data(), values.size()));
+        expected.insert(expected.end(), values.begin(), values.end());
+
+        for (size_t numPopped = 0; numPopped < values.size();) {
+            size_t count;
+            const int* run = ring.front(&count);
+            ASSERT_NE(run, nullptr);
+            count = std::min(count, values.size() - numPopped);
+            EXPECT_EQ(std::vector<int>(run, run + count),
+                      std::vector<int>(expected.begin(), expected.begin() + count));
+            expected.erase(expected.begin(), expected.begin() + count);
+            ring.pop(count);
+            numPopped += count;
+        }
+        EXPECT_EQ(ring.size(), expected.size());
+    }
+    EXPECT_EQ(drain(ring), expected);
+}
+
+TEST(EventRingTest, FrontStaysValidWhilePushing) {
+    TestRing ring(10);
+    std::vector<int> values = makeValues(0, 3);
+    ASSERT_TRUE(ring.push(values.data(), values.size()));
+
+    size_t count;
+    const int* run = ring.front(&count);
+    std::vector<int> more = makeValues(3, 7);
+    ASSERT_TRUE(ring.push(more.data(), more.size()));
+    EXPECT_EQ(std::vector<int>(run, run + count), values);
+}
+
+TEST(EventRingTest, Clear) {
+    TestRing ring(10);
+    std::vector<int> values = makeValues(0, 7);
+    ASSERT_TRUE(ring.push(values.data(), values.size()));
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+    ASSERT_TRUE(ring.push(values.data(), values.size()));
+    EXPECT_EQ(drain(ring), values);
+}
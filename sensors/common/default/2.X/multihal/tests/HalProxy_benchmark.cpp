@@ -0,0 +1,185 @@
+//
+// Copyright (C) 2023 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <android/hardware/sensors/1.0/types.h>
+#include <android/hardware/sensors/2.0/types.h>
+#include <fmq/MessageQueue.h>
+
+#include "HalProxy.h"
+#include "SensorsSubHal.h"
+#include "convertV2_1.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using ::android::hardware::EventFlag;
+using ::android::hardware::hidl_vec;
+using ::android::hardware::MessageQueue;
+using ::android::hardware::Return;
+using ::android::hardware::sensors::V1_0::EventPayload;
+using ::android::hardware::sensors::V1_0::SensorInfo;
+using ::android::hardware::sensors::V1_0::SensorType;
+using ::android::hardware::sensors::V2_0::EventQueueFlagBits;
+using ::android::hardware::sensors::V2_1::implementation::convertToNewEvents;
+using ::android::hardware::sensors::V2_1::implementation::HalProxy;
+using ::android::hardware::sensors::V2_1::subhal::implementation::AllSensorsSubHal;
+using ::android::hardware::sensors::V2_1::subhal::implementation::SensorsSubHalV2_0;
+
+using ISensorsCallbackV2_0 = ::android::hardware::sensors::V2_0::ISensorsCallback;
+using ISensorsSubHal = ::android::hardware::sensors::V2_0::implementation::ISensorsSubHal;
+using EventV1_0 = ::android::hardware::sensors::V1_0::Event;
+using EventMessageQueueV2_0 = MessageQueue<EventV1_0, ::android::hardware::kSynchronizedReadWrite>;
+using WakeupMessageQueue = MessageQueue<uint32_t, ::android::hardware::kSynchronizedReadWrite>;
+
+// Size of the event FMQ, similar to what the sensors framework allocates
+constexpr size_t kEventQueueSize = 256;
+
+// How long the reader waits for events before checking whether it should stop
+constexpr int64_t kReadWaitTimeoutNs = INT64_C(10000000);
+
+class SensorsCallback : public ISensorsCallbackV2_0 {
+  public:
+    Return<void> onDynamicSensorsConnected(
+            const hidl_vec<SensorInfo>& /*dynamicSensorsAdded*/) override {
+        return Return<void>();
+    }
+
+    Return<void> onDynamicSensorsDisconnected(
+            const hidl_vec<int32_t>& /*dynamicSensorHandlesRemoved*/) override {
+        return Return<void>();
+    }
+};
+
+// Reads events out of the event FMQ as fast as possible, like the sensors framework would
+class EventReader {
+  public:
+    EventReader(EventMessageQueueV2_0* eventQueue) : mEventQueue(eventQueue) {
+        EventFlag::createEventFlag(mEventQueue->getEventFlagWord(), &mEventQueueFlag);
+        mThread = std::thread([this] { run(); });
+    }
+
+    ~EventReader() {
+        mRunning = false;
+        mThread.join();
+        EventFlag::deleteEventFlag(&mEventQueueFlag);
+    }
+
+    void waitForEvents(size_t numEvents) {
+        while (mNumEventsRead.load() < numEvents) {
+            std::this_thread::yield();
+        }
+    }
+
+  private:
+    void run() {
+        std::vector<EventV1_0> events(mEventQueue->getQuantumCount());
+        while (mRunning) {
+            size_t numToRead = mEventQueue->availableToRead();
+            if (numToRead == 0) {
+                uint32_t state;
+                mEventQueueFlag->wait(static_cast<uint32_t>(EventQueueFlagBits::READ_AND_PROCESS),
+                                      &state, kReadWaitTimeoutNs);
+                continue;
+            }
+            mEventQueue->read(events.data(), numToRead);
+            mEventQueueFlag->wake(static_cast<uint32_t>(EventQueueFlagBits::EVENTS_READ));
+            mNumEventsRead += numToRead;
+        }
+    }
+
+    EventMessageQueueV2_0* mEventQueue;
+    EventFlag* mEventQueueFlag = nullptr;
+    std::atomic_bool mRunning = true;
+    std::atomic_size_t mNumEventsRead = 0;
+    std::thread mThread;
+};
+
+std::vector<EventV1_0> makeAccelerometerEvents(size_t numEvents) {
+    EventV1_0 event;
+    event.timestamp = 0xFF00FF00;
+    event.sensorHandle = 0x00000001;
+    event.sensorType = SensorType::ACCELEROMETER;
+    event.u = EventPayload();
+    return std::vector<EventV1_0>(numEvents, event);
+}
+
+/**
+ * Posts batches of state.range(0) events from a fake subhal and waits for all of them to be read
+ * from the event FMQ. Batches larger than the FMQ go through the pending writes queue, like when
+ * a batching sensor is flushed.
+ */
+void BM_PostEvents(benchmark::State& state) {
+    const size_t batchSize = state.range(0);
+    AllSensorsSubHal<SensorsSubHalV2_0> subHal;
+    std::vector<ISensorsSubHal*> subHals{&subHal};
+    HalProxy proxy(subHals);
+    auto eventQueue = std::make_unique<EventMessageQueueV2_0>(kEventQueueSize, true);
+    auto wakeLockQueue = std::make_unique<WakeupMessageQueue>(kEventQueueSize, true);
+    ::android::sp<ISensorsCallbackV2_0> callback = new SensorsCallback();
+    proxy.initialize(*eventQueue->getDesc(), *wakeLockQueue->getDesc(), callback);
+
+    EventReader reader(eventQueue.get());
+    const auto events = convertToNewEvents(makeAccelerometerEvents(batchSize));
+    size_t numEventsPosted = 0;
+    for (auto _ : state) {
+        subHal.postEvents(events, false /* wakeup */);
+        numEventsPosted += batchSize;
+        reader.waitForEvents(numEventsPosted);
+    }
+    state.SetItemsProcessed(numEventsPosted);
+}
+BENCHMARK(BM_PostEvents)->Arg(1)->Arg(16)->Arg(kEventQueueSize)->Arg(4096)->UseRealTime();
+
+/**
+ * Posts batches of state.range(0) events from two fake subhals at once, like a high rate IMU
+ * posting while another sensor is flushed.
+ */
+void BM_PostEventsTwoSubHals(benchmark::State& state) {
+    const size_t batchSize = state.range(0);
+    AllSensorsSubHal<SensorsSubHalV2_0> subHal1, subHal2;
+    std::vector<ISensorsSubHal*> subHals{&subHal1, &subHal2};
+    HalProxy proxy(subHals);
+    auto eventQueue = std::make_unique<EventMessageQueueV2_0>(kEventQueueSize, true);
+    auto wakeLockQueue = std::make_unique<WakeupMessageQueue>(kEventQueueSize, true);
+    ::android::sp<ISensorsCallbackV2_0> callback = new SensorsCallback();
+    proxy.initialize(*eventQueue->getDesc(), *wakeLockQueue->getDesc(), callback);
+
+    EventReader reader(eventQueue.get());
+    const auto imuEvents = convertToNewEvents(makeAccelerometerEvents(1));
+    const auto flushEvents = convertToNewEvents(makeAccelerometerEvents(batchSize));
+    size_t numEventsPosted = 0;
+    for (auto _ : state) {
+        std::thread imu([&] {
+            for (size_t i = 0; i < batchSize; i++) {
+                subHal1.postEvents(imuEvents, false /* wakeup */);
+            }
+        });
+        subHal2.postEvents(flushEvents, false /* wakeup */);
+        imu.join();
+        numEventsPosted += 2 * batchSize;
+        reader.waitForEvents(numEventsPosted);
+    }
+    state.SetItemsProcessed(numEventsPosted);
+}
+BENCHMARK(BM_PostEventsTwoSubHals)->Arg(16)->Arg(kEventQueueSize)->Arg(4096)->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -443,6 +443,47 @@ TEST(HalProxyTest, PostEventsDelayedWrite) {
     EXPECT_EQ(eventQueue->availableToRead(), 0);
 }
 
+TEST(HalProxyTest, PostEventsDelayedWriteKeepsOrder) {
+    constexpr size_t kQueueSize = 5;
+    constexpr size_t kNumEvents = 7;
+    constexpr size_t kNumBatches = 3;
+    AllSensorsSubHal<SensorsSubHalV2_0> subHal;
+    std::vector<ISensorsSubHal*> subHals{&subHal};
+    HalProxy proxy(subHals);
+    std::unique_ptr<EventMessageQueueV2_0> eventQueue = makeEventFMQ(kQueueSize);
+    std::unique_ptr<WakeupMessageQueue> wakeLockQueue = makeWakelockFMQ(kQueueSize);
+    ::android::sp<ISensorsCallbackV2_0> callback = new SensorsCallback();
+    proxy.initialize(*eventQueue->getDesc(), *wakeLockQueue->getDesc(), callback);
+
+    EventFlag* eventQueueFlag;
+    EventFlag::createEventFlag(eventQueue->getEventFlagWord(), &eventQueueFlag);
+
+    // Later batches must queue up behind the events of earlier ones still pending write
+    int64_t timestamp = 0;
+    for (size_t i = 0; i < kNumBatches; i++) {
+        std::vector<EventV1_0> events = makeMultipleAccelerometerEvents(kNumEvents);
+        for (auto& event : events) {
+            event.timestamp = timestamp++;
+        }
+        subHal.postEvents(convertToNewEvents(events), false /* wakeup */);
+    }
+
+    constexpr int64_t kReadBlockingTimeout = INT64_C(500000000);
+    std::vector<EventV1_0> eventsOut(kQueueSize);
+    for (int64_t expected = 0; expected < timestamp;) {
+        size_t numToRead = std::min(kQueueSize, static_cast<size_t>(timestamp - expected));
+        ASSERT_TRUE(eventQueue->readBlocking(
+                eventsOut.data(), numToRead, static_cast<uint32_t>(EventQueueFlagBits::EVENTS_READ),
+                static_cast<uint32_t>(EventQueueFlagBits::READ_AND_PROCESS), kReadBlockingTimeout,
+                eventQueueFlag));
+        for (size_t i = 0; i < numToRead; i++) {
+            EXPECT_EQ(eventsOut[i].timestamp, expected++);
+        }
+    }
+
+    EXPECT_EQ(eventQueue->availableToRead(), 0);
+}
+
 TEST(HalProxyTest, PostEventsMultipleSubhalsThreaded) {
     constexpr size_t kQueueSize = 5;
     constexpr size_t kNumEvents = 2;
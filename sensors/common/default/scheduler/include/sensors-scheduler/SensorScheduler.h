@@ -0,0 +1,406 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <utils/SystemClock.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace android {
+namespace hardware {
+namespace sensors {
+namespace common {
+
+/**
+ * Generates the samples of all the enabled sensors of the process from a single thread.
+ *
+ * The sensors are kept in a min-heap ordered by the time of their next sample. Every time the
+ * thread wakes up it samples all the sensors that are due, appends the samples to the batch of
+ * each sensor and then writes the batches whose report latency has expired to the Event FMQ,
+ * along with all the other batches waiting for the same callback, so the framework is woken up
+ * once for all of them.
+ *
+ * Each sample is timestamped with the time it was scheduled for rather than the time the thread
+ * got to it, so the samples of a sensor are exactly one sampling period apart. If the thread
+ * wakes up more than a period late, the samples it missed are skipped rather than generated at
+ * once, and the next ones stay on the same grid. A change of the sampling period starts a new
+ * grid from the last sample.
+ *
+ * Direct reports are scheduled the same way, as separate entries of the heap whose samples are
+ * written straight to their direct channel instead of being batched.
+ *
+ * The samples are generated with the scheduler lock held, so that unscheduling a sensor waits for
+ * a sample being generated. The events are posted without it, so that configuring the sensors
+ * doesn't wait for the Event FMQ, but under a second lock which keeps them in order with flushes
+ * and which unscheduling waits for too.
+ *
+ * SensorT must be a class with:
+ *  - an Event type,
+ *  - std::vector<Event> readEvents(int64_t timestampNs), generating the sample taken at the
+ *    given time,
+ *  - bool isWakeUpSensor(),
+ *  - an mCallback pointer to an object with postEvents(const std::vector<Event>&, bool wakeup).
+ * ChannelT is the direct channel class, with write(int32_t reportToken, const Event&), or void
+ * if the HAL doesn't support direct channels.
+ */
+template <typename SensorT, typename ChannelT = void>
+class SensorScheduler {
+  public:
+    using Event = typename SensorT::Event;
+
+    static SensorScheduler& getInstance() {
+        // Never destroyed, so that the thread can keep running until the process exits.
+        static SensorScheduler* sInstance = new SensorScheduler();
+        return *sInstance;
+    }
+
+    // Sensors use getInstance(), other instances are for tests.
+    SensorScheduler() = default;
+
+    ~SensorScheduler() {
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            mExiting = true;
+        }
+        mCV.notify_one();
+        if (mThread.joinable()) {
+            mThread.join();
+        }
+    }
+
+    /**
+     * Start sampling the sensor, or update its sampling parameters if it's already being sampled.
+     *
+     * The first sample of a sensor that wasn't being sampled is generated right away.
+     */
+    void schedule(SensorT* sensor, int64_t samplingPeriodNs, int64_t maxReportLatencyNs) {
+        std::lock_guard<std::mutex> lock(mLock);
+        scheduleLocked({.sensor = sensor,
+                        .channel = nullptr,
+                        .reportToken = 0,
+                        .nextSampleTimeNs = 0,
+                        .samplingPeriodNs = samplingPeriodNs,
+                        .maxReportLatencyNs = maxReportLatencyNs});
+    }
+
+    /**
+     * Stop sampling the sensor and drop any events still batched for it.
+     *
+     * Once this returns no sample of the sensor is being generated and no event of it is being
+     * posted. Its direct reports are left running.
+     */
+    void unschedule(SensorT* sensor) {
+        std::unique_lock<std::mutex> lock(mLock);
+        eraseLocked(findLocked(sensor, nullptr));
+        // Nobody is waiting for the events of a disabled sensor anymore.
+        mBatches.erase(sensor);
+        waitForPostsLocked(std::move(lock));
+    }
+
+    /**
+     * Stop sampling the sensor for the Event FMQ and for all the direct channels.
+     *
+     * Once this returns the scheduler no longer references the sensor, so this must be called
+     * before the sensor starts being destroyed, as its destructors may run while it's sampled.
+     */
+    void unscheduleAll(SensorT* sensor) {
+        std::unique_lock<std::mutex> lock(mLock);
+        eraseIfLocked([sensor](const Entry& entry) { return entry.sensor == sensor; });
+        mBatches.erase(sensor);
+        waitForPostsLocked(std::move(lock));
+    }
+
+    /**
+     * Post the events batched for the sensor followed by the given flush complete event.
+     */
+    void flush(SensorT* sensor, const Event& flushCompleteEvent) {
+        std::unique_lock<std::mutex> lock(mLock);
+        std::vector<Event> events;
+        auto batch = mBatches.find(sensor);
+        if (batch != mBatches.end()) {
+            events.swap(batch->second.events);
+        }
+        events.push_back(flushCompleteEvent);
+
+        // The thread may be posting earlier events of the sensor, which must come first.
+        std::lock_guard<std::mutex> postLock(mPostLock);
+        lock.unlock();
+        sensor->mCallback->postEvents(events, sensor->isWakeUpSensor());
+    }
+
+    /**
+     * Start writing the samples of the sensor to the direct channel, or change their period if
+     * they're already being written.
+     */
+    void scheduleDirectReport(SensorT* sensor, ChannelT* channel, int32_t reportToken,
+                              int64_t samplingPeriodNs) {
+        std::lock_guard<std::mutex> lock(mLock);
+        scheduleLocked({.sensor = sensor,
+                        .channel = channel,
+                        .reportToken = reportToken,
+                        .nextSampleTimeNs = 0,
+                        .samplingPeriodNs = samplingPeriodNs,
+                        .maxReportLatencyNs = 0});
+    }
+
+    /**
+     * Stop writing the samples of the sensor to the direct channel.
+     */
+    void unscheduleDirectReport(SensorT* sensor, ChannelT* channel) {
+        std::lock_guard<std::mutex> lock(mLock);
+        eraseLocked(findLocked(sensor, channel));
+    }
+
+    /**
+     * Stop writing the samples of all the sensors to the direct channel.
+     *
+     * Once this returns the scheduler no longer references the channel.
+     */
+    void unscheduleDirectReports(ChannelT* channel) {
+        std::lock_guard<std::mutex> lock(mLock);
+        eraseIfLocked([channel](const Entry& entry) { return entry.channel == channel; });
+    }
+
+  private:
+    using Callback = decltype(SensorT::mCallback);
+
+    struct Entry {
+        SensorT* sensor;
+        // The direct channel the samples are written to, or nullptr for the Event FMQ.
+        ChannelT* channel;
+        int32_t reportToken;
+        int64_t nextSampleTimeNs;
+        int64_t samplingPeriodNs;
+        int64_t maxReportLatencyNs;
+    };
+
+    struct Batch {
+        std::vector<Event> events;
+        // The time by which the events must be written to the Event FMQ.
+        int64_t deadlineNs;
+    };
+
+    struct Post {
+        Callback callback;
+        std::vector<Event> events;
+        bool wakeup;
+    };
+
+    // Heap comparator putting the entry with the earliest next sample at the front.
+    static bool isLaterSample(const Entry& a, const Entry& b) {
+        return a.nextSampleTimeNs > b.nextSampleTimeNs;
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mLock);
+        while (!mExiting) {
+            int64_t wakeUpTimeNs = nextWakeUpTimeLocked();
+            int64_t now = ::android::elapsedRealtimeNano();
+            if (wakeUpTimeNs == std::numeric_limits<int64_t>::max()) {
+                mCV.wait(lock);
+                continue;
+            }
+            if (wakeUpTimeNs > now) {
+                mCV.wait_for(lock, std::chrono::nanoseconds(wakeUpTimeNs - now));
+                continue;
+            }
+
+            sampleLocked(now);
+            std::vector<Post> posts = takeDueBatchesLocked(now);
+            if (posts.empty()) {
+                continue;
+            }
+            // Take the post lock before releasing the scheduler lock, so that the posts are made
+            // in the order the events were taken out of the batches.
+            std::unique_lock<std::mutex> postLock(mPostLock);
+            lock.unlock();
+            for (const Post& post : posts) {
+                post.callback->postEvents(post.events, post.wakeup);
+            }
+            postLock.unlock();
+            lock.lock();
+        }
+    }
+
+    void scheduleLocked(Entry newEntry) {
+        int64_t now = ::android::elapsedRealtimeNano();
+        // A period of 0 would make the thread spin.
+        newEntry.samplingPeriodNs = std::max(newEntry.samplingPeriodNs, int64_t(1));
+
+        auto entry = findLocked(newEntry.sensor, newEntry.channel);
+        if (entry == mQueue.end()) {
+            newEntry.nextSampleTimeNs = now;
+            mQueue.push_back(newEntry);
+        } else {
+            // Count the new period from the last sample, like a sensor changing its rate would.
+            int64_t lastSampleTimeNs = entry->nextSampleTimeNs - entry->samplingPeriodNs;
+            entry->nextSampleTimeNs = std::max(now, lastSampleTimeNs + newEntry.samplingPeriodNs);
+            entry->reportToken = newEntry.reportToken;
+            entry->samplingPeriodNs = newEntry.samplingPeriodNs;
+            entry->maxReportLatencyNs = newEntry.maxReportLatencyNs;
+
+            auto batch = mBatches.find(newEntry.sensor);
+            if (newEntry.channel == nullptr && batch != mBatches.end() &&
+                !batch->second.events.empty()) {
+                batch->second.deadlineNs =
+                        std::min(batch->second.deadlineNs, now + newEntry.maxReportLatencyNs);
+            }
+        }
+        std::make_heap(mQueue.begin(), mQueue.end(), isLaterSample);
+
+        if (!mThread.joinable()) {
+            mThread = std::thread([this] { run(); });
+        }
+        mCV.notify_one();
+    }
+
+    void eraseLocked(typename std::vector<Entry>::iterator entry) {
+        if (entry != mQueue.end()) {
+            mQueue.erase(entry);
+            std::make_heap(mQueue.begin(), mQueue.end(), isLaterSample);
+        }
+    }
+
+    template <typename Predicate>
+    void eraseIfLocked(Predicate predicate) {
+        mQueue.erase(std::remove_if(mQueue.begin(), mQueue.end(), predicate), mQueue.end());
+        std::make_heap(mQueue.begin(), mQueue.end(), isLaterSample);
+    }
+
+    typename std::vector<Entry>::iterator findLocked(SensorT* sensor, ChannelT* channel) {
+        return std::find_if(mQueue.begin(), mQueue.end(), [sensor, channel](const Entry& entry) {
+            return entry.sensor == sensor && entry.channel == channel;
+        });
+    }
+
+    // Wait for the events the thread is posting, which may have been taken from the batches
+    // before the caller changed them. The scheduler lock is released first, so that the other
+    // sensors can be configured in the meantime.
+    void waitForPostsLocked(std::unique_lock<std::mutex> lock) {
+        lock.unlock();
+        std::lock_guard<std::mutex> postLock(mPostLock);
+    }
+
+    int64_t nextWakeUpTimeLocked() const {
+        int64_t wakeUpTimeNs = std::numeric_limits<int64_t>::max();
+        if (!mQueue.empty()) {
+            wakeUpTimeNs = mQueue.front().nextSampleTimeNs;
+        }
+        for (const auto& [sensor, batch] : mBatches) {
+            if (!batch.events.empty()) {
+                wakeUpTimeNs = std::min(wakeUpTimeNs, batch.deadlineNs);
+            }
+        }
+        return wakeUpTimeNs;
+    }
+
+    void sampleLocked(int64_t now) {
+        while (!mQueue.empty() && mQueue.front().nextSampleTimeNs <= now) {
+            std::pop_heap(mQueue.begin(), mQueue.end(), isLaterSample);
+            Entry& entry = mQueue.back();
+
+            // Don't try to catch up on the samples missed if the thread woke up late, take the
+            // latest one that is due instead.
+            int64_t missedSamples = (now - entry.nextSampleTimeNs) / entry.samplingPeriodNs;
+            int64_t sampleTimeNs = entry.nextSampleTimeNs + missedSamples * entry.samplingPeriodNs;
+            std::vector<Event> events = entry.sensor->readEvents(sampleTimeNs);
+
+            bool isDirectReport = false;
+            if constexpr (!std::is_void_v<ChannelT>) {
+                if (entry.channel != nullptr) {
+                    isDirectReport = true;
+                    for (const Event& event : events) {
+                        entry.channel->write(entry.reportToken, event);
+                    }
+                }
+            }
+            if (!isDirectReport && !events.empty()) {
+                Batch& batch = mBatches[entry.sensor];
+                if (batch.events.empty()) {
+                    batch.deadlineNs = sampleTimeNs + entry.maxReportLatencyNs;
+                }
+                batch.events.insert(batch.events.end(), events.begin(), events.end());
+            }
+
+            entry.nextSampleTimeNs = sampleTimeNs + entry.samplingPeriodNs;
+            std::push_heap(mQueue.begin(), mQueue.end(), isLaterSample);
+        }
+    }
+
+    std::vector<Post> takeDueBatchesLocked(int64_t now) {
+        std::vector<Callback> callbacks;
+        for (const auto& [sensor, batch] : mBatches) {
+            if (!batch.events.empty() && batch.deadlineNs <= now &&
+                std::find(callbacks.begin(), callbacks.end(), sensor->mCallback) ==
+                        callbacks.end()) {
+                callbacks.push_back(sensor->mCallback);
+            }
+        }
+
+        // The framework is going to be woken up by the write anyway, so send it everything
+        // batched for it rather than only the batches that are due.
+        std::vector<Post> posts;
+        for (Callback callback : callbacks) {
+            Post post = {.callback = callback, .events = {}, .wakeup = false};
+            Post wakeUpPost = {.callback = callback, .events = {}, .wakeup = true};
+            for (auto& [sensor, batch] : mBatches) {
+                if (sensor->mCallback == callback && !batch.events.empty()) {
+                    Post& target = sensor->isWakeUpSensor() ? wakeUpPost : post;
+                    target.events.insert(target.events.end(), batch.events.begin(),
+                                         batch.events.end());
+                    batch.events.clear();
+                }
+            }
+            for (Post* p : {&post, &wakeUpPost}) {
+                if (!p->events.empty()) {
+                    posts.push_back(std::move(*p));
+                }
+            }
+        }
+        return posts;
+    }
+
+    // Protects the members below but mPostLock.
+    std::mutex mLock;
+    std::condition_variable mCV;
+    std::thread mThread;
+    bool mExiting = false;
+
+    // Held while posting events, which is done without mLock. Taken before mLock is released
+    // when events are taken out of the batches, so that they are posted in that order.
+    std::mutex mPostLock;
+
+    // The sampled sensors, as a min-heap on nextSampleTimeNs.
+    std::vector<Entry> mQueue;
+
+    // The events generated but not yet posted for each sampled sensor.
+    std::map<SensorT*, Batch> mBatches;
+};
+
+}  // namespace common
+}  // namespace sensors
+}  // namespace hardware
+}  // namespace android
@@ -0,0 +1,379 @@
+/*
+ * Copyright (C) 2023 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sensors-scheduler/SensorScheduler.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr int64_t kMsInNs = 1000 * 1000;
+// How long to wait for something that should happen, which only bounds how long a failing test
+// takes.
+constexpr auto kTimeout = 5s;
+// How long to wait for something that should not happen.
+constexpr auto kSettleTime = 100ms;
+
+struct FakeEvent {
+    const void* sensor;
+    int64_t timestamp;
+    bool isFlushComplete;
+};
+
+// Blocks the threads calling wait() until open() is called.
+class Gate {
+  public:
+    void open() {
+        std::lock_guard<std::mutex> lock(mLock);
+        mOpen = true;
+        mCV.notify_all();
+    }
+    void wait() {
+        std::unique_lock<std::mutex> lock(mLock);
+        mCV.wait(lock, [this] { return mOpen; });
+    }
+
+  private:
+    std::mutex mLock;
+    std::condition_variable mCV;
+    bool mOpen = false;
+};
+
+class FakeCallback {
+  public:
+    struct Post {
+        std::vector<FakeEvent> events;
+        bool wakeup;
+    };
+
+    void postEvents(const std::vector<FakeEvent>& events, bool wakeup) {
+        if (mGate != nullptr) {
+            mEntered = true;
+            mGate->wait();
+        }
+        std::lock_guard<std::mutex> lock(mLock);
+        mPosts.push_back({events, wakeup});
+        mCV.notify_all();
+    }
+
+    std::vector<Post> getPosts() {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mPosts;
+    }
+
+    // Returns whether at least the given number of posts were made in time.
+    bool waitForPosts(size_t count) {
+        std::unique_lock<std::mutex> lock(mLock);
+        return mCV.wait_for(lock, kTimeout, [&] { return mPosts.size() >= count; });
+    }
+
+    // Returns whether at least the given number of events were posted in time.
+    bool waitForEvents(size_t count) {
+        std::unique_lock<std::mutex> lock(mLock);
+        return mCV.wait_for(lock, kTimeout, [&] {
+            size_t events = 0;
+            for (const auto& post : mPosts) {
+                events += post.events.size();
+            }
+            return events >= count;
+        });
+    }
+
+    // If set, postEvents() blocks on the gate after setting mEntered.
+    Gate* mGate = nullptr;
+    std::atomic_bool mEntered = false;
+
+  private:
+    std::mutex mLock;
+    std::condition_variable mCV;
+    std::vector<Post> mPosts;
+};
+
+class FakeSensor {
+  public:
+    using Event = FakeEvent;
+
+    FakeSensor(FakeCallback* callback, bool isWakeUp = false)
+        : mCallback(callback), mIsWakeUp(isWakeUp) {}
+
+    std::vector<Event> readEvents(int64_t timestampNs) {
+        if (mGate != nullptr) {
+            mEntered = true;
+            mGate->wait();
+        }
+        std::lock_guard<std::mutex> lock(mLock);
+        mSampleTimes.push_back(timestampNs);
+        mCV.notify_all();
+        return {{this, timestampNs, false}};
+    }
+
+    bool isWakeUpSensor() { return mIsWakeUp; }
+
+    std::vector<int64_t> getSampleTimes() {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mSampleTimes;
+    }
+
+    // Returns whether at least the given number of samples were generated in time.
+    bool waitForSamples(size_t count) {
+        std::unique_lock<std::mutex> lock(mLock);
+        return mCV.wait_for(lock, kTimeout, [&] { return mSampleTimes.size() >= count; });
+    }
+
+    FakeCallback* mCallback;
+    // If set, readEvents() blocks on the gate after setting mEntered.
+    Gate* mGate = nullptr;
+    std::atomic_bool mEntered = false;
+
+  private:
+    const bool mIsWakeUp;
+    std::mutex mLock;
+    std::condition_variable mCV;
+    std::vector<int64_t> mSampleTimes;
+};
+
+using SensorScheduler = ::android::hardware::sensors::common::SensorScheduler<FakeSensor>;
+
+class FakeChannel {
+  public:
+    void write(int32_t reportToken, const FakeEvent& event) {
+        std::lock_guard<std::mutex> lock(mLock);
+        mReports.push_back({reportToken, event.timestamp});
+        mCV.notify_all();
+    }
+
+    // Returns whether at least the given number of events were written in time.
+    bool waitForReports(size_t count) {
+        std::unique_lock<std::mutex> lock(mLock);
+        return mCV.wait_for(lock, kTimeout, [&] { return mReports.size() >= count; });
+    }
+
+    std::vector<std::pair<int32_t, int64_t>> getReports() {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mReports;
+    }
+
+  private:
+    std::mutex mLock;
+    std::condition_variable mCV;
+    // The report token and timestamp of each event written.
+    std::vector<std::pair<int32_t, int64_t>> mReports;
+};
+
+FakeEvent flushCompleteEvent(const FakeSensor& sensor) {
+    return {&sensor, 0, true};
+}
+
+// Expects each sample to be a whole number of periods after the previous one, starting from the
+// given index. The thread may skip samples if it's late, but doesn't leave the grid.
+void expectOnGrid(const std::vector<int64_t>& sampleTimes, size_t first, int64_t periodNs) {
+    for (size_t i = std::max<size_t>(first, 1); i < sampleTimes.size(); ++i) {
+        int64_t delta = sampleTimes[i] - sampleTimes[i - 1];
+        EXPECT_GT(delta, 0) << "sample " << i;
+        EXPECT_EQ(0, delta % periodNs) << "sample " << i << " is " << delta << "ns after the last";
+    }
+}
+
+class SensorSchedulerTest : public testing::Test {
+  protected:
+    FakeCallback mCallback;
+    FakeSensor mSensor{&mCallback};
+    // Destroyed first, so that its thread stops before the sensors go away.
+    SensorScheduler mScheduler;
+};
+
+}  // namespace
+
+TEST_F(SensorSchedulerTest, SamplesAreTimestampedOnTheGrid) {
+    mScheduler.schedule(&mSensor, 10 * kMsInNs, 0 /* maxReportLatencyNs */);
+    ASSERT_TRUE(mCallback.waitForEvents(5));
+    mScheduler.unschedule(&mSensor);
+
+    auto sampleTimes = mSensor.getSampleTimes();
+    expectOnGrid(sampleTimes, 0, 10 * kMsInNs);
+
+    // Without batching every sample is posted on its own, with the timestamp it was taken for.
+    auto posts = mCallback.getPosts();
+    ASSERT_EQ(sampleTimes.size(), posts.size());
+    for (size_t i = 0; i < posts.size(); ++i) {
+        ASSERT_EQ(1u, posts[i].events.size());
+        EXPECT_EQ(sampleTimes[i], posts[i].events[0].timestamp);
+        EXPECT_FALSE(posts[i].wakeup);
+    }
+}
+
+TEST_F(SensorSchedulerTest, RateChangeStartsFromTheLastSample) {
+    mScheduler.schedule(&mSensor, 10 * kMsInNs, 0 /* maxReportLatencyNs */);
+    ASSERT_TRUE(mSensor.waitForSamples(3));
+    // Slowing down schedules the next sample one new period after the last one, so none can be
+    // taken at the new rate before the rate change returns.
+    mScheduler.schedule(&mSensor, 30 * kMsInNs, 0 /* maxReportLatencyNs */);
+    size_t firstAtNewRate = mSensor.getSampleTimes().size();
+    ASSERT_TRUE(mSensor.waitForSamples(firstAtNewRate + 3));
+    mScheduler.unschedule(&mSensor);
+
+    auto sampleTimes = mSensor.getSampleTimes();
+    expectOnGrid(std::vector<int64_t>(sampleTimes.begin(), sampleTimes.begin() + firstAtNewRate),
+                 0, 10 * kMsInNs);
+    expectOnGrid(sampleTimes, firstAtNewRate, 30 * kMsInNs);
+}
+
+TEST_F(SensorSchedulerTest, BatchesUntilFlush) {
+    mScheduler.schedule(&mSensor, 10 * kMsInNs, 60 * 1000 * kMsInNs /* maxReportLatencyNs */);
+    ASSERT_TRUE(mSensor.waitForSamples(5));
+    EXPECT_TRUE(mCallback.getPosts().empty());
+
+    mScheduler.flush(&mSensor, flushCompleteEvent(mSensor));
+    mScheduler.unschedule(&mSensor);
+
+    // The batched events come first, in the same post as the flush complete event.
+    auto sampleTimes = mSensor.getSampleTimes();
+    auto posts = mCallback.getPosts();
+    ASSERT_EQ(1u, posts.size());
+    ASSERT_EQ(sampleTimes.size() + 1, posts[0].events.size());
+    for (size_t i = 0; i < sampleTimes.size(); ++i) {
+        EXPECT_EQ(sampleTimes[i], posts[0].events[i].timestamp);
+        EXPECT_FALSE(posts[0].events[i].isFlushComplete);
+    }
+    EXPECT_TRUE(posts[0].events.back().isFlushComplete);
+}
+
+TEST_F(SensorSchedulerTest, LatencyDecreasePostsTheBatch) {
+    mScheduler.schedule(&mSensor, 10 * kMsInNs, 60 * 1000 * kMsInNs /* maxReportLatencyNs */);
+    ASSERT_TRUE(mSensor.waitForSamples(3));
+    EXPECT_TRUE(mCallback.getPosts().empty());
+
+    mScheduler.schedule(&mSensor, 10 * kMsInNs, 0 /* maxReportLatencyNs */);
+    ASSERT_TRUE(mCallback.waitForPosts(1));
+    mScheduler.unschedule(&mSensor);
+    EXPECT_GE(mCallback.getPosts()[0].events.size(), 3u);
+}
+
+TEST_F(SensorSchedulerTest, BatchesOfACallbackArePostedTogether) {
+    FakeSensor wakeUpSensor(&mCallback, true /* isWakeUp */);
+    mScheduler.schedule(&mSensor, 10 * kMsInNs, 60 * 1000 * kMsInNs /* maxReportLatencyNs */);
+    mScheduler.schedule(&wakeUpSensor, 10 * kMsInNs, 50 * kMsInNs /* maxReportLatencyNs */);
+    ASSERT_TRUE(mCallback.waitForPosts(2));
+    mScheduler.unscheduleAll(&wakeUpSensor);
+    mScheduler.unscheduleAll(&mSensor);
+
+    // The wake-up sensor's batch being due also posts the other sensor's batch, separately as it
+    // isn't a wake-up sensor.
+    auto posts = mCallback.getPosts();
+    EXPECT_FALSE(posts[0].wakeup);
+    EXPECT_TRUE(posts[1].wakeup);
+    for (const auto& event : posts[0].events) {
+        EXPECT_EQ(&mSensor, event.sensor);
+    }
+    for (const auto& event : posts[1].events) {
+        EXPECT_EQ(&wakeUpSensor, event.sensor);
+    }
+}
+
+TEST_F(SensorSchedulerTest, UnscheduleStopsSampling) {
+    mScheduler.schedule(&mSensor, 10 * kMsInNs, 0 /* maxReportLatencyNs */);
+    ASSERT_TRUE(mSensor.waitForSamples(2));
+    mScheduler.unschedule(&mSensor);
+    size_t samples = mSensor.getSampleTimes().size();
+    size_t posts = mCallback.getPosts().size();
+
+    std::this_thread::sleep_for(kSettleTime);
+    EXPECT_EQ(samples, mSensor.getSampleTimes().size());
+    EXPECT_EQ(posts, mCallback.getPosts().size());
+}
+
+TEST_F(SensorSchedulerTest, UnscheduleAllWaitsForSample) {
+    Gate gate;
+    mSensor.mGate = &gate;
+    mScheduler.schedule(&mSensor, 10 * kMsInNs, 0 /* maxReportLatencyNs */);
+    while (!mSensor.mEntered) {
+        std::this_thread::yield();
+    }
+
+    std::atomic_bool unscheduled = false;
+    std::thread unscheduler([&] {
+        mScheduler.unscheduleAll(&mSensor);
+        unscheduled = true;
+    });
+    std::this_thread::sleep_for(kSettleTime);
+    EXPECT_FALSE(unscheduled);
+
+    gate.open();
+    unscheduler.join();
+    size_t samples = mSensor.getSampleTimes().size();
+    std::this_thread::sleep_for(kSettleTime);
+    EXPECT_EQ(samples, mSensor.getSampleTimes().size());
+}
+
+TEST_F(SensorSchedulerTest, UnscheduleWaitsForPost) {
+    Gate gate;
+    mCallback.mGate = &gate;
+    mScheduler.schedule(&mSensor, 10 * kMsInNs, 0 /* maxReportLatencyNs */);
+    while (!mCallback.mEntered) {
+        std::this_thread::yield();
+    }
+
+    std::atomic_bool unscheduled = false;
+    std::thread unscheduler([&] {
+        mScheduler.unschedule(&mSensor);
+        unscheduled = true;
+    });
+    std::this_thread::sleep_for(kSettleTime);
+    EXPECT_FALSE(unscheduled);
+
+    // Neither the post nor the waiting hold up the configuration of the other sensors.
+    FakeCallback otherCallback;
+    FakeSensor otherSensor(&otherCallback);
+    mScheduler.schedule(&otherSensor, 10 * kMsInNs, 60 * 1000 * kMsInNs /* maxReportLatencyNs */);
+    EXPECT_FALSE(unscheduled);
+
+    gate.open();
+    unscheduler.join();
+    mScheduler.unscheduleAll(&otherSensor);
+}
+
+TEST_F(SensorSchedulerTest, DirectReportsAreWrittenRightAway) {
+    ::android::hardware::sensors::common::SensorScheduler<FakeSensor, FakeChannel> scheduler;
+    FakeChannel channel;
+    scheduler.schedule(&mSensor, 10 * kMsInNs, 60 * 1000 * kMsInNs /* maxReportLatencyNs */);
+    scheduler.scheduleDirectReport(&mSensor, &channel, 7 /* reportToken */, 5 * kMsInNs);
+    ASSERT_TRUE(channel.waitForReports(3));
+    scheduler.unscheduleDirectReports(&channel);
+    auto reports = channel.getReports();
+
+    // The direct reports have their own grid and aren't batched with the Event FMQ samples.
+    std::vector<int64_t> reportTimes;
+    for (const auto& [token, timestamp] : reports) {
+        EXPECT_EQ(7, token);
+        reportTimes.push_back(timestamp);
+    }
+    expectOnGrid(reportTimes, 0, 5 * kMsInNs);
+    EXPECT_TRUE(mCallback.getPosts().empty());
+
+    std::this_thread::sleep_for(kSettleTime);
+    EXPECT_EQ(reports.size(), channel.getReports().size());
+    scheduler.unscheduleAll(&mSensor);
+}